@@ -511,6 +511,15 @@ void ParallelRenderingApp::RenderCubesRange(const rhi::RenderCommandList& render
     render_cmd_list.SetVertexBuffers(m_cube_array_buffers_ptr->GetVertexBuffers(), false);
     render_cmd_list.SetIndexBuffer(m_cube_array_buffers_ptr->GetIndexBuffer(), false);
 
+    // Resource state barriers of all program bindings in range are set in one batch before drawing cubes
+    Refs<rhi::IProgramBindings> program_bindings_refs;
+    program_bindings_refs.reserve(end_instance_index - begin_instance_index);
+    for (uint32_t instance_index = begin_instance_index; instance_index < end_instance_index; ++instance_index)
+    {
+        program_bindings_refs.emplace_back(program_bindings_per_instance[instance_index].GetInterface());
+    }
+    render_cmd_list.SetProgramBindingsResourceBarriers(program_bindings_refs);
+
     for (uint32_t instance_index = begin_instance_index; instance_index < end_instance_index; ++instance_index)
     {
         // Constant argument bindings are applied once per command list, mutables are applied always
@@ -0,0 +1,13 @@
+#!/bin/bash
+# CI script to run application executable from current directory for a limited number of frames
+# on software GPU device in virtual frame buffer, which fails on application error, crash or hang
+set +e
+app_exe="${1}"
+frames_count="${2:-100}"
+timeout_sec="${3:-600}"
+echo Running smoke test of $app_exe for $frames_count frames in directory $PWD
+timeout $timeout_sec xvfb-run --auto-servernum --server-args="-screen 0 1280x1024x24" \
+    ./$app_exe --device -1 --frames-limit $frames_count
+result_error_level=$?
+echo  - $app_exe - completed with $result_error_level exit status
+exit $result_error_level
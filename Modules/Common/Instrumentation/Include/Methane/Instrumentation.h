@@ -31,6 +31,7 @@ NOTE:
 
 #include "IttApiHelper.h"
 #include "ScopeTimer.h"
+#include "TraceRecorder.h"
 
 #if defined(__GNUC__) && !defined(__llvm__) && !defined(__INTEL_COMPILER)
 #define __GCC_COMPILER__
@@ -52,7 +53,7 @@ NOTE:
 
 #include <string_view>
 
-#if defined(ITT_INSTRUMENTATION_ENABLED) || defined(TRACY_ENABLE)
+#if defined(ITT_INSTRUMENTATION_ENABLED) || defined(TRACY_ENABLE) || defined(METHANE_TRACE_RECORDER_ENABLED)
 #define META_INSTRUMENTATION_ENABLED
 #endif
 
@@ -91,7 +92,9 @@ ITT_DOMAIN_EXTERN();
 
 #define TracyMessage(S, N)
 #define TracyLockable(M, V) M V
+#define TracySharedLockable(M, V) M V
 #define LockableBase(M) M
+#define SharedLockableBase(M) M
 #define FrameMark
 #define TracyCFrameMarkStart(name)
 #define TracyCFrameMarkEnd(name)
@@ -114,11 +117,13 @@ ITT_DOMAIN_EXTERN();
 
 #define META_SCOPE_TASK(/*const char* */name) \
     TRACY_ZONE_SCOPED_NAME(name); \
-    ITT_SCOPE_TASK(name)
+    ITT_SCOPE_TASK(name); \
+    TRACE_RECORDER_SCOPE(trace_recorder_task, name)
 
 #define META_FUNCTION_TASK() \
     TRACY_ZONE_SCOPED(); \
-    ITT_FUNCTION_TASK()
+    ITT_FUNCTION_TASK(); \
+    TRACE_RECORDER_SCOPE(trace_recorder_task, __FUNCTION__)
 
 #define META_GLOBAL_MARKER(/*const char* */name) \
     ITT_GLOBAL_MARKER(name)
@@ -141,6 +146,7 @@ ITT_DOMAIN_EXTERN();
 #define META_THREAD_NAME(/*const char* */name) \
     TRACY_SET_THREAD_NAME(name); \
     ITT_THREAD_NAME(name); \
+    TRACE_RECORDER_THREAD_NAME(name); \
     Methane::SetThreadName(name)
 
 #else // ifdef META_INSTRUMENTATION_ENABLED
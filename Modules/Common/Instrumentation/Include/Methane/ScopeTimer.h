@@ -24,13 +24,19 @@ Code scope measurement timer with aggregating and averaging of timings.
 #pragma once
 
 #include "ILogger.h"
+#include "TraceRecorder.h"
 
 #include <Methane/IttApiHelper.h>
 #include <Methane/Timer.hpp>
 #include <Methane/Memory.hpp>
 
 #include <string>
+#include <string_view>
 #include <map>
+#include <deque>
+#include <vector>
+#include <array>
+#include <mutex>
 
 namespace Methane
 {
@@ -39,11 +45,13 @@ class ScopeTimer : public Timer // NOSONAR - custom destructor is required
 {
 public:
     using ScopeId = uint32_t;
+    using Counter = ITT_COUNTER_TYPE(uint64_t);
 
     struct Registration
     {
         const char* name;
         ScopeId     id;
+        Counter*    counter_ptr = nullptr;
     };
 
     class Aggregator // NOSONAR - custom destructor is required
@@ -51,13 +59,31 @@ public:
         friend class ScopeTimer;
 
     public:
+        // Scope timings are collected in per-thread buffers with fixed capacity of scopes
+        static constexpr ScopeId  max_scopes_count = 4096U;
+
+        // Durations histogram with logarithmic buckets: every power of two nanoseconds is split in equal sub-buckets
+        static constexpr uint32_t histogram_octaves_count = 40U;
+        static constexpr uint32_t histogram_octave_buckets_count = 8U;
+        static constexpr uint32_t histogram_buckets_count = histogram_octaves_count * histogram_octave_buckets_count;
+
+        using Histogram = std::array<uint32_t, histogram_buckets_count>;
+
         struct Timing
         {
-            TimeDuration duration;
-            uint32_t     count    = 0U;
+            TimeDuration duration     = TimeDuration::zero();
+            TimeDuration min_duration = TimeDuration::max();
+            TimeDuration max_duration = TimeDuration::zero();
+            uint32_t     count        = 0U;
+            Histogram    histogram{};
+
+            [[nodiscard]] TimeDuration GetAverageDuration() const noexcept;
+            [[nodiscard]] TimeDuration GetPercentileDuration(uint32_t percentile) const noexcept;
         };
 
         [[nodiscard]] static Aggregator& Get() noexcept;
+        [[nodiscard]] static uint32_t GetHistogramBucketIndex(uint64_t duration_ns) noexcept;
+        [[nodiscard]] static uint64_t GetHistogramBucketDuration(uint32_t bucket_index) noexcept;
 
         Aggregator(const Aggregator&) = delete;
         Aggregator(Aggregator&&) = delete;
@@ -69,25 +95,37 @@ public:
         void SetLogger(Ptr<ILogger> logger_ptr) noexcept             { m_logger_ptr = std::move(logger_ptr); }
         [[nodiscard]] const Ptr<ILogger>& GetLogger() const noexcept { return m_logger_ptr; }
 
+        // Registration is thread-safe and is done once per scope, when stored in static variable by META_SCOPE_TIMER
+        Registration RegisterScope(const char* scope_name);
+
+        // Timings of all threads are merged on logging and reset on flush
         void LogTimings(ILogger& logger) noexcept;
         void Flush() noexcept;
 
     protected:
-        Registration RegisterScope(const char* scope_name);
-        void AddScopeTiming(const Registration& scope_registration, TimeDuration duration) noexcept;
+        // Timings page is allocated on the first timing of a scope in the thread, so it may throw on allocation failure
+        void AddScopeTiming(const Registration& scope_registration, TimeDuration duration);
 
     private:
+        class ThreadTimings;
+
         Aggregator() = default;
 
-        using ScopeIdByName = std::map<const char*, ScopeId>;
-        using ScopeTimings  = std::vector<Timing>; // index == ScopeId
-        using ScopeCounters = std::vector<ITT_COUNTER_TYPE(uint64_t)>; // index == ScopeId
+        void MergeTimings();
+        void AddThreadTimings(ThreadTimings& thread_timings);
+        void RemoveThreadTimings(ThreadTimings& thread_timings);
+        ThreadTimings& GetThreadTimings();
 
-        ScopeId       m_new_scope_id = 0U;
-        ScopeIdByName m_scope_id_by_name;
-        ScopeTimings  m_timing_by_scope_id;
-        ScopeCounters m_counters_by_scope_id;
-        Ptr<ILogger>  m_logger_ptr;
+        using ScopeIdByName = std::map<std::string_view, ScopeId>;
+        using ScopeTimings  = std::vector<Timing>; // index == ScopeId
+        using ScopeCounters = std::deque<Counter>; // index == ScopeId, deque keeps counter addresses on growth
+
+        ScopeIdByName               m_scope_id_by_name;
+        ScopeTimings                m_timing_by_scope_id;
+        ScopeCounters               m_counters_by_scope_id;
+        std::vector<ThreadTimings*> m_thread_timings;
+        Ptr<ILogger>                m_logger_ptr;
+        std::mutex                  m_mutex;
     };
 
     template<typename TLogger>
@@ -97,6 +135,7 @@ public:
     }
 
     explicit ScopeTimer(const char* scope_name);
+    explicit ScopeTimer(const Registration& scope_registration) noexcept;
     ScopeTimer(const ScopeTimer&) = delete;
     ScopeTimer(ScopeTimer&&) = delete;
     ~ScopeTimer();
@@ -120,7 +159,10 @@ private:
 #ifdef METHANE_SCOPE_TIMERS_ENABLED
 
 #define META_SCOPE_TIMERS_INITIALIZE(LOGGER_TYPE) Methane::ScopeTimer::InitializeLogger<LOGGER_TYPE>()
-#define META_SCOPE_TIMER(SCOPE_NAME) Methane::ScopeTimer scope_timer(SCOPE_NAME)
+#define META_SCOPE_TIMER(SCOPE_NAME) \
+    static const Methane::ScopeTimer::Registration s_scope_timer_registration = Methane::ScopeTimer::Aggregator::Get().RegisterScope(SCOPE_NAME); \
+    Methane::ScopeTimer scope_timer(s_scope_timer_registration); \
+    TRACE_RECORDER_SCOPE(trace_recorder_timer, SCOPE_NAME)
 #define META_FUNCTION_TIMER() META_SCOPE_TIMER(__func__)
 #define META_SCOPE_TIMERS_FLUSH() Methane::ScopeTimer::Aggregator::Get().Flush()
 
@@ -0,0 +1,156 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/TraceRecorder.h
+Low-overhead recorder of instrumented CPU scopes and GPU ranges
+with output to Chrome trace event JSON format (supported by Perfetto UI).
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <iosfwd>
+
+namespace Methane
+{
+
+class TraceRecorder // NOSONAR - custom destructor is required
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Every thread records the latest CPU scopes in its own ring buffer, older scopes are overwritten
+    static constexpr size_t thread_scopes_capacity = 1U << 15U;
+
+    // Ring buffers of finished threads are reused by new threads, while their latest scopes are kept in trace
+    // up to this total count: scopes of the earliest finished threads are dropped first
+    static constexpr size_t finished_threads_scopes_capacity = thread_scopes_capacity;
+    static constexpr size_t gpu_ranges_capacity    = 1U << 14U;
+
+    // Trace file is written on application exit to the path from this environment variable, when it is defined
+    static constexpr const char* output_file_path_env_var = "METHANE_TRACE_FILE";
+
+    class Scope // NOSONAR - custom destructor is required
+    {
+    public:
+        explicit Scope(const char* name) noexcept
+            : m_name(name)
+            , m_begin_ns(GetTimestampNs())
+        { }
+
+        ~Scope()
+        {
+            TraceRecorder::Get().AddScope(m_name, m_begin_ns, GetTimestampNs());
+        }
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        const char*    m_name;
+        const uint64_t m_begin_ns;
+    };
+
+    [[nodiscard]] static TraceRecorder& Get();
+
+    // Timestamps are taken from the steady clock, which matches CPU time domain of the calibrated GPU timestamps
+    [[nodiscard]] static uint64_t GetTimestampNs() noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+    }
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder(TraceRecorder&&) = delete;
+    ~TraceRecorder();
+
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(TraceRecorder&&) = delete;
+
+    void SetOutputFilePath(std::string_view output_file_path);
+    [[nodiscard]] std::string GetOutputFilePath() const;
+
+    // Scope name must be a string with static storage duration, like string literal or __FUNCTION__.
+    // Scope is dropped when ring buffer of the thread can not be allocated or was already released on thread exit.
+    void AddScope(const char* name, uint64_t begin_ns, uint64_t end_ns) noexcept;
+    void AddGpuRange(std::string_view name, std::string_view track_name, uint64_t begin_ns, uint64_t end_ns);
+    void SetThreadName(std::string_view thread_name);
+
+    void WriteChromeTrace(std::ostream& output_stream) const;
+    bool WriteChromeTrace(const std::string& file_path) const;
+    bool WriteOutputFile() const;
+
+private:
+    class ThreadScopes;
+    struct ScopesRing;
+    class ThreadScopesReleaser;
+
+    struct GpuRange
+    {
+        std::string name;
+        std::string track_name;
+        uint64_t    begin_ns;
+        uint64_t    end_ns;
+    };
+
+    TraceRecorder();
+
+    ThreadScopes* GetThreadScopes() noexcept;
+    ThreadScopes& AcquireThreadScopes();
+    void ReleaseThreadScopes(ThreadScopes& thread_scopes);
+
+    const uint64_t                       m_start_ns = GetTimestampNs();
+    std::vector<UniquePtr<ThreadScopes>> m_thread_scopes;
+    std::vector<UniquePtr<ScopesRing>>   m_free_scopes_rings;
+    size_t                               m_finished_threads_scopes_count = 0U;
+    uint32_t                             m_next_thread_id = 0U;
+    std::deque<GpuRange>                 m_gpu_ranges;
+    std::string                          m_output_file_path;
+    mutable std::mutex                   m_mutex;
+};
+
+} // namespace Methane
+
+#ifdef METHANE_TRACE_RECORDER_ENABLED
+
+#define TRACE_RECORDER_SCOPE(/*variable name*/var, /*const char* */name) Methane::TraceRecorder::Scope var(name)
+#define TRACE_RECORDER_THREAD_NAME(/*std::string_view*/name) Methane::TraceRecorder::Get().SetThreadName(name)
+
+#define META_TRACE_GPU_RANGE(/*std::string_view*/name, /*std::string_view*/track_name, /*uint64_t*/begin_ns, /*uint64_t*/end_ns) \
+    Methane::TraceRecorder::Get().AddGpuRange(name, track_name, begin_ns, end_ns)
+#define META_TRACE_WRITE(/*const std::string&*/file_path) Methane::TraceRecorder::Get().WriteChromeTrace(file_path)
+
+#else // ifdef METHANE_TRACE_RECORDER_ENABLED
+
+#define TRACE_RECORDER_SCOPE(var, name)
+#define TRACE_RECORDER_THREAD_NAME(name)
+#define META_TRACE_GPU_RANGE(name, track_name, begin_ns, end_ns)
+#define META_TRACE_WRITE(file_path)
+
+#endif // ifdef METHANE_TRACE_RECORDER_ENABLED
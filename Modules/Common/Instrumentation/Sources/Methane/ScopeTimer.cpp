@@ -27,10 +27,151 @@ Code scope measurement timer with aggregating and averaging of timings.
 #include <sstream>
 #include <chrono>
 #include <cassert>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <bit>
 
 namespace Methane
 {
 
+static constexpr uint32_t g_histogram_octave_bits_count = std::countr_zero(ScopeTimer::Aggregator::histogram_octave_buckets_count);
+static_assert(std::has_single_bit(ScopeTimer::Aggregator::histogram_octave_buckets_count));
+
+[[nodiscard]] static double GetDurationMs(Timer::TimeDuration duration) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+}
+
+// Timings of scopes measured on one thread are written without locks by the owner thread only,
+// and are exchanged with zero values by aggregator on merge, so that no timing is lost
+class ScopeTimer::Aggregator::ThreadTimings // NOSONAR - custom destructor is required
+{
+public:
+    struct Timing
+    {
+        std::atomic<uint64_t>                                      duration_ns{ 0U };
+        std::atomic<uint64_t>                                      min_duration_ns{ std::numeric_limits<uint64_t>::max() };
+        std::atomic<uint64_t>                                      max_duration_ns{ 0U };
+        std::atomic<uint32_t>                                      count{ 0U };
+        std::array<std::atomic<uint32_t>, histogram_buckets_count> histogram{ };
+    };
+
+    explicit ThreadTimings(Aggregator& aggregator)
+        : m_aggregator(aggregator)
+    {
+        m_aggregator.AddThreadTimings(*this);
+    }
+
+    ~ThreadTimings()
+    {
+        m_aggregator.RemoveThreadTimings(*this);
+    }
+
+    ThreadTimings(const ThreadTimings&) = delete;
+    ThreadTimings(ThreadTimings&&) = delete;
+    ThreadTimings& operator=(const ThreadTimings&) = delete;
+    ThreadTimings& operator=(ThreadTimings&&) = delete;
+
+    void AddTiming(ScopeId scope_id, uint64_t duration_ns)
+    {
+        Timing& timing = GetTiming(scope_id);
+        timing.count.fetch_add(1U, std::memory_order_relaxed);
+        timing.duration_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+        timing.histogram[GetHistogramBucketIndex(duration_ns)].fetch_add(1U, std::memory_order_relaxed);
+        if (duration_ns < timing.min_duration_ns.load(std::memory_order_relaxed))
+            timing.min_duration_ns.store(duration_ns, std::memory_order_relaxed);
+        if (duration_ns > timing.max_duration_ns.load(std::memory_order_relaxed))
+            timing.max_duration_ns.store(duration_ns, std::memory_order_relaxed);
+    }
+
+    void MergeTo(ScopeTimings& scope_timings)
+    {
+        for(ScopeId page_index = 0U; page_index < pages_count; ++page_index)
+        {
+            TimingsPage* const page_ptr = m_pages[page_index].load(std::memory_order_acquire);
+            if (!page_ptr)
+                continue;
+
+            for(ScopeId page_scope_index = 0U; page_scope_index < page_scopes_count; ++page_scope_index)
+            {
+                Timing& timing = (*page_ptr)[page_scope_index];
+                const uint32_t count = timing.count.exchange(0U, std::memory_order_relaxed);
+                if (!count)
+                    continue;
+
+                const ScopeId scope_id = page_index * page_scopes_count + page_scope_index;
+                if (scope_id >= scope_timings.size())
+                    scope_timings.resize(scope_id + 1U);
+
+                Aggregator::Timing& scope_timing = scope_timings[scope_id];
+                scope_timing.count        += count;
+                scope_timing.duration     += GetDuration(timing.duration_ns.exchange(0U, std::memory_order_relaxed));
+                scope_timing.min_duration  = std::min(scope_timing.min_duration, GetDuration(timing.min_duration_ns.exchange(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed)));
+                scope_timing.max_duration  = std::max(scope_timing.max_duration, GetDuration(timing.max_duration_ns.exchange(0U, std::memory_order_relaxed)));
+                for(uint32_t bucket_index = 0U; bucket_index < histogram_buckets_count; ++bucket_index)
+                {
+                    scope_timing.histogram[bucket_index] += timing.histogram[bucket_index].exchange(0U, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr ScopeId page_scopes_count = 32U;
+    static constexpr ScopeId pages_count = max_scopes_count / page_scopes_count;
+
+    using TimingsPage = std::array<Timing, page_scopes_count>;
+
+    [[nodiscard]] static TimeDuration GetDuration(uint64_t duration_ns) noexcept
+    {
+        return std::chrono::duration_cast<TimeDuration>(std::chrono::nanoseconds(duration_ns));
+    }
+
+    Timing& GetTiming(ScopeId scope_id)
+    {
+        std::atomic<TimingsPage*>& page_ptr = m_pages[scope_id / page_scopes_count];
+        TimingsPage* timings_page_ptr = page_ptr.load(std::memory_order_relaxed);
+        if (!timings_page_ptr)
+        {
+            // Timings page is allocated by the owner thread once on first timing of the scope in page range
+            timings_page_ptr = m_pages_storage.emplace_back(std::make_unique<TimingsPage>()).get();
+            page_ptr.store(timings_page_ptr, std::memory_order_release);
+        }
+        return (*timings_page_ptr)[scope_id % page_scopes_count];
+    }
+
+    Aggregator&                               m_aggregator;
+    std::array<std::atomic<TimingsPage*>, pages_count> m_pages{ };
+    std::vector<UniquePtr<TimingsPage>>       m_pages_storage;
+};
+
+Timer::TimeDuration ScopeTimer::Aggregator::Timing::GetAverageDuration() const noexcept
+{
+    return count ? duration / count : TimeDuration::zero();
+}
+
+Timer::TimeDuration ScopeTimer::Aggregator::Timing::GetPercentileDuration(uint32_t percentile) const noexcept
+{
+    const uint64_t total_count = std::accumulate(histogram.begin(), histogram.end(), uint64_t{ 0U });
+    if (!total_count)
+        return TimeDuration::zero();
+
+    const uint64_t percentile_rank = std::max(uint64_t{ 1U }, (total_count * percentile + 99U) / 100U);
+    uint64_t accumulated_count = 0U;
+    for(uint32_t bucket_index = 0U; bucket_index < histogram_buckets_count; ++bucket_index)
+    {
+        accumulated_count += histogram[bucket_index];
+        if (accumulated_count < percentile_rank)
+            continue;
+
+        const auto bucket_duration = std::chrono::duration_cast<TimeDuration>(std::chrono::nanoseconds(GetHistogramBucketDuration(bucket_index)));
+        return std::clamp(bucket_duration, min_duration, max_duration);
+    }
+    return max_duration;
+}
+
 ScopeTimer::Aggregator& ScopeTimer::Aggregator::Get() noexcept
 {
     META_FUNCTION_TASK();
@@ -38,6 +179,33 @@ ScopeTimer::Aggregator& ScopeTimer::Aggregator::Get() noexcept
     return s_scope_aggregator;
 }
 
+uint32_t ScopeTimer::Aggregator::GetHistogramBucketIndex(uint64_t duration_ns) noexcept
+{
+    if (!duration_ns)
+        return 0U;
+
+    const auto octave_index = static_cast<uint32_t>(std::bit_width(duration_ns) - 1U);
+    if (octave_index >= histogram_octaves_count)
+        return histogram_buckets_count - 1U;
+
+    // Octave sub-bucket is defined by the most significant bits following the leading one
+    const uint64_t octave_bucket_index = octave_index >= g_histogram_octave_bits_count
+                                       ? duration_ns >> (octave_index - g_histogram_octave_bits_count)
+                                       : duration_ns << (g_histogram_octave_bits_count - octave_index);
+    return octave_index * histogram_octave_buckets_count +
+           static_cast<uint32_t>(octave_bucket_index & (histogram_octave_buckets_count - 1U));
+}
+
+uint64_t ScopeTimer::Aggregator::GetHistogramBucketDuration(uint32_t bucket_index) noexcept
+{
+    // Returns duration in the middle of the bucket range
+    const uint32_t octave_index        = bucket_index / histogram_octave_buckets_count;
+    const uint64_t octave_bucket_index = bucket_index % histogram_octave_buckets_count;
+    const uint64_t bucket_begin_ns     = ((histogram_octave_buckets_count + octave_bucket_index) << octave_index) >> g_histogram_octave_bits_count;
+    const uint64_t bucket_end_ns       = ((histogram_octave_buckets_count + octave_bucket_index + 1U) << octave_index) >> g_histogram_octave_bits_count;
+    return (bucket_begin_ns + bucket_end_ns) / 2U;
+}
+
 ScopeTimer::Aggregator::~Aggregator()
 {
     META_FUNCTION_TASK();
@@ -52,14 +220,15 @@ void ScopeTimer::Aggregator::Flush() noexcept
         LogTimings(*m_logger_ptr);
     }
 
+    std::scoped_lock lock(m_mutex);
     m_timing_by_scope_id.clear();
-    m_scope_id_by_name.clear();
-    m_new_scope_id = 0U;
 }
 
 void ScopeTimer::Aggregator::LogTimings(ILogger& logger) noexcept
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    MergeTimings();
     if (m_timing_by_scope_id.empty())
         return;
 
@@ -72,12 +241,17 @@ void ScopeTimer::Aggregator::LogTimings(ILogger& logger) noexcept
             continue;
 
         const Timing& scope_timing = m_timing_by_scope_id[scope_id];
-        const double total_duration_sec = std::chrono::duration_cast<std::chrono::duration<double>>(scope_timing.duration).count();
-        const double average_duration_ms = total_duration_sec * 1000.0 / scope_timing.count;
+        if (!scope_timing.count)
+            continue;
 
-        ss << "  - "       << scope_name
-           << ": "         << std::fixed << average_duration_ms
-           << " ms. with " << scope_timing.count
+        ss << "  - "        << scope_name
+           << ": "          << std::fixed << GetDurationMs(scope_timing.GetAverageDuration())
+           << " ms. average (min " << GetDurationMs(scope_timing.min_duration)
+           << ", p50 "      << GetDurationMs(scope_timing.GetPercentileDuration(50U))
+           << ", p95 "      << GetDurationMs(scope_timing.GetPercentileDuration(95U))
+           << ", p99 "      << GetDurationMs(scope_timing.GetPercentileDuration(99U))
+           << ", max "      << GetDurationMs(scope_timing.max_duration)
+           << " ms.) with " << scope_timing.count
            << " invocations count;" << std::endl;
     }
 
@@ -87,37 +261,72 @@ void ScopeTimer::Aggregator::LogTimings(ILogger& logger) noexcept
 ScopeTimer::Registration ScopeTimer::Aggregator::RegisterScope(const char* scope_name)
 {
     META_FUNCTION_TASK();
-    const auto [ scope_name_and_id_it, scope_added ] = m_scope_id_by_name.try_emplace(scope_name, m_new_scope_id);
+    std::scoped_lock lock(m_mutex);
+    const auto new_scope_id = static_cast<ScopeId>(m_scope_id_by_name.size());
+    const auto [ scope_name_and_id_it, scope_added ] = m_scope_id_by_name.try_emplace(scope_name, new_scope_id);
     if (scope_added)
     {
-        m_new_scope_id++;
-        m_timing_by_scope_id.resize(m_new_scope_id);
-        m_counters_by_scope_id.emplace_back(ITT_COUNTER_INIT(scope_name_and_id_it->first, g_methane_itt_domain_name));
+        assert(new_scope_id < max_scopes_count);
+        m_counters_by_scope_id.emplace_back(ITT_COUNTER_INIT(scope_name_and_id_it->first.data(), g_methane_itt_domain_name));
 #ifdef TRACY_ENABLE
-        TracyPlotConfig(scope_name_and_id_it->first, tracy::PlotFormatType::Number, false, false, 0);
+        TracyPlotConfig(scope_name_and_id_it->first.data(), tracy::PlotFormatType::Number, false, false, 0);
 #endif
     }
-    return Registration{ scope_name_and_id_it->first, scope_name_and_id_it->second };
+    return Registration{
+        scope_name_and_id_it->first.data(),
+        scope_name_and_id_it->second,
+        &m_counters_by_scope_id[scope_name_and_id_it->second]
+    };
 }
 
-void ScopeTimer::Aggregator::AddScopeTiming(const Registration& scope_registration, TimeDuration duration) noexcept
+void ScopeTimer::Aggregator::AddScopeTiming(const Registration& scope_registration, TimeDuration duration)
 {
     META_FUNCTION_TASK();
-    ITT_COUNTER_VALUE(m_counters_by_scope_id[scope_registration.id], std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    const auto duration_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    ITT_COUNTER_VALUE(*scope_registration.counter_ptr, duration_ns);
 
 #ifdef TRACY_ENABLE
-    TracyPlot(scope_registration.name, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    TracyPlot(scope_registration.name, static_cast<int64_t>(duration_ns));
 #endif
 
-    if (scope_registration.id >= m_timing_by_scope_id.size())
+    if (scope_registration.id >= max_scopes_count)
     {
         assert(false);
         return;
     }
 
-    Timing& scope_timing = m_timing_by_scope_id[scope_registration.id];
-    scope_timing.count++;
-    scope_timing.duration += duration;
+    GetThreadTimings().AddTiming(scope_registration.id, duration_ns);
+}
+
+ScopeTimer::Aggregator::ThreadTimings& ScopeTimer::Aggregator::GetThreadTimings()
+{
+    thread_local ThreadTimings s_thread_timings(*this);
+    return s_thread_timings;
+}
+
+void ScopeTimer::Aggregator::MergeTimings()
+{
+    META_FUNCTION_TASK();
+    for(ThreadTimings* thread_timings_ptr : m_thread_timings)
+    {
+        thread_timings_ptr->MergeTo(m_timing_by_scope_id);
+    }
+}
+
+void ScopeTimer::Aggregator::AddThreadTimings(ThreadTimings& thread_timings)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    m_thread_timings.push_back(&thread_timings);
+}
+
+void ScopeTimer::Aggregator::RemoveThreadTimings(ThreadTimings& thread_timings)
+{
+    META_FUNCTION_TASK();
+    // Timings of the finished thread are merged before removal to keep them until the next flush
+    std::scoped_lock lock(m_mutex);
+    thread_timings.MergeTo(m_timing_by_scope_id);
+    std::erase(m_thread_timings, &thread_timings);
 }
 
 ScopeTimer::ScopeTimer(const char* scope_name)
@@ -125,10 +334,24 @@ ScopeTimer::ScopeTimer(const char* scope_name)
     , m_registration(Aggregator::Get().RegisterScope(scope_name))
 { }
 
+ScopeTimer::ScopeTimer(const Registration& scope_registration) noexcept
+    : Timer()
+    , m_registration(scope_registration)
+{ }
+
 ScopeTimer::~ScopeTimer()
 {
     META_FUNCTION_TASK();
-    Aggregator::Get().AddScopeTiming(m_registration, GetElapsedDuration());
+    try
+    {
+        Aggregator::Get().AddScopeTiming(m_registration, GetElapsedDuration());
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during adding scope timing: {}", e.what());
+        assert(false);
+    }
 }
 
 } // namespace Methane
@@ -0,0 +1,419 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/TraceRecorder.cpp
+Low-overhead recorder of instrumented CPU scopes and GPU ranges
+with output to Chrome trace event JSON format (supported by Perfetto UI).
+
+NOTE: recorder functions are not instrumented with META_FUNCTION_TASK
+      to prevent recursive recording of the recorder itself.
+
+******************************************************************************/
+
+#include <Methane/TraceRecorder.h>
+
+#include <fstream>
+#include <ostream>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+#include <utility>
+
+namespace Methane
+{
+
+static_assert((TraceRecorder::thread_scopes_capacity & (TraceRecorder::thread_scopes_capacity - 1U)) == 0U,
+              "thread scopes capacity must be a power of two");
+
+static constexpr uint32_t g_cpu_process_id = 1U;
+static constexpr uint32_t g_gpu_process_id = 2U;
+
+static void WriteJsonString(std::ostream& os, std::string_view str)
+{
+    os << '"';
+    for(const char c : str)
+    {
+        switch(c)
+        {
+        case '"':  os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n";  break;
+        case '\r': os << "\\r";  break;
+        case '\t': os << "\\t";  break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20U)
+            {
+                std::array<char, 8> code{};
+                std::snprintf(code.data(), code.size(), "\\u%04x", static_cast<unsigned>(c));
+                os << code.data();
+            }
+            else
+            {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+
+static void WriteMetadataEvent(std::ostream& os, std::string_view event_name, uint32_t process_id, uint32_t thread_id, std::string_view name)
+{
+    os << ",\n{\"ph\":\"M\",\"name\":\"" << event_name << "\",\"pid\":" << process_id << ",\"tid\":" << thread_id
+       << ",\"args\":{\"name\":";
+    WriteJsonString(os, name);
+    os << "}}";
+}
+
+static void WriteCompleteEvent(std::ostream& os, std::string_view name, uint32_t process_id, uint32_t thread_id,
+                               double timestamp_us, double duration_us)
+{
+    os << ",\n{\"ph\":\"X\",\"name\":";
+    WriteJsonString(os, name);
+    os << ",\"pid\":" << process_id << ",\"tid\":" << thread_id
+       << ",\"ts\":" << timestamp_us << ",\"dur\":" << duration_us << "}";
+}
+
+[[nodiscard]] static double GetMicroseconds(uint64_t timestamp_ns, uint64_t start_ns) noexcept
+{
+    return (static_cast<double>(timestamp_ns) - static_cast<double>(start_ns)) / 1000.0;
+}
+
+// Ring buffer of scopes written without locks by the owner thread only. Scope fields are atomic
+// to let the trace writer read them concurrently and drop the scopes which could be overwritten during reading.
+struct TraceRecorder::ScopesRing
+{
+    struct Scope
+    {
+        std::atomic<const char*> name{ nullptr };
+        std::atomic<uint64_t>    begin_ns{ 0U };
+        std::atomic<uint64_t>    end_ns{ 0U };
+    };
+
+    std::array<Scope, thread_scopes_capacity> scopes{ };
+};
+
+class TraceRecorder::ThreadScopes
+{
+public:
+    struct ScopeData
+    {
+        const char* name;
+        uint64_t    begin_ns;
+        uint64_t    end_ns;
+    };
+
+    ThreadScopes(uint32_t thread_id, UniquePtr<ScopesRing>&& ring_ptr)
+        : m_thread_id(thread_id)
+        , m_ring_ptr(std::move(ring_ptr))
+    { }
+
+    [[nodiscard]] uint32_t           GetThreadId() const noexcept   { return m_thread_id; }
+    [[nodiscard]] const std::string& GetThreadName() const noexcept { return m_thread_name; }
+    [[nodiscard]] bool               IsFinished() const noexcept    { return !m_ring_ptr; }
+    [[nodiscard]] size_t             GetFinishedScopesCount() const noexcept { return m_finished_scopes.size(); }
+
+    void SetThreadName(std::string_view thread_name) { m_thread_name = thread_name; }
+
+    void AddScope(const char* name, uint64_t begin_ns, uint64_t end_ns) noexcept
+    {
+        const uint64_t scope_index = m_scopes_count.load(std::memory_order_relaxed);
+        ScopesRing::Scope& scope = m_ring_ptr->scopes[scope_index & (thread_scopes_capacity - 1U)];
+        scope.name.store(name, std::memory_order_relaxed);
+        scope.begin_ns.store(begin_ns, std::memory_order_relaxed);
+        scope.end_ns.store(end_ns, std::memory_order_relaxed);
+        m_scopes_count.store(scope_index + 1U, std::memory_order_release);
+    }
+
+    [[nodiscard]] std::vector<ScopeData> GetScopes() const
+    {
+        return IsFinished() ? m_finished_scopes : GetRingScopes(true);
+    }
+
+    // Called on owner thread exit: recorded scopes are copied to compact storage and ring buffer is returned for reuse
+    [[nodiscard]] UniquePtr<ScopesRing> Finish()
+    {
+        m_finished_scopes = GetRingScopes(false);
+        m_finished_scopes.shrink_to_fit();
+        return std::move(m_ring_ptr);
+    }
+
+private:
+    [[nodiscard]] static uint64_t GetFirstScopeIndex(uint64_t scopes_end) noexcept
+    {
+        return scopes_end > thread_scopes_capacity ? scopes_end - thread_scopes_capacity : 0U;
+    }
+
+    [[nodiscard]] std::vector<ScopeData> GetRingScopes(bool is_owner_thread_recording) const
+    {
+        const uint64_t scopes_end = m_scopes_count.load(std::memory_order_acquire);
+        const uint64_t scopes_begin = GetFirstScopeIndex(scopes_end);
+
+        std::vector<ScopeData> scopes;
+        scopes.reserve(scopes_end - scopes_begin);
+        for(uint64_t scope_index = scopes_begin; scope_index < scopes_end; ++scope_index)
+        {
+            const ScopesRing::Scope& scope = m_ring_ptr->scopes[scope_index & (thread_scopes_capacity - 1U)];
+            scopes.push_back({
+                scope.name.load(std::memory_order_relaxed),
+                scope.begin_ns.load(std::memory_order_relaxed),
+                scope.end_ns.load(std::memory_order_relaxed)
+            });
+        }
+
+        if (!is_owner_thread_recording)
+            return scopes;
+
+        // Scopes which could be overwritten by the owner thread during reading are dropped,
+        // including the one which is being written now after the last published scope
+        if (const uint64_t valid_scopes_begin = GetFirstScopeIndex(m_scopes_count.load(std::memory_order_acquire) + 1U);
+            valid_scopes_begin > scopes_begin)
+        {
+            scopes.erase(scopes.begin(), scopes.begin() + static_cast<ptrdiff_t>(std::min(valid_scopes_begin - scopes_begin, scopes.size())));
+        }
+        return scopes;
+    }
+
+    const uint32_t         m_thread_id;
+    std::string            m_thread_name;
+    UniquePtr<ScopesRing>  m_ring_ptr;
+    std::atomic<uint64_t>  m_scopes_count{ 0U };
+    std::vector<ScopeData> m_finished_scopes;
+};
+
+// Thread local releaser of the thread scopes ring buffer on thread exit
+class TraceRecorder::ThreadScopesReleaser // NOSONAR - custom destructor is required
+{
+public:
+    ThreadScopesReleaser(TraceRecorder& trace_recorder, ThreadScopes*& thread_scopes_ptr) noexcept
+        : m_trace_recorder(trace_recorder)
+        , m_thread_scopes_ptr(thread_scopes_ptr)
+    { }
+
+    ~ThreadScopesReleaser()
+    {
+        ThreadScopes* const thread_scopes_ptr = std::exchange(m_thread_scopes_ptr, nullptr);
+        if (!thread_scopes_ptr)
+            return;
+
+        try
+        {
+            m_trace_recorder.ReleaseThreadScopes(*thread_scopes_ptr);
+        }
+        catch(...) // NOSONAR - ring buffer is not reused, when scopes could not be copied
+        {
+            // Ring buffer is kept by the thread scopes
+        }
+    }
+
+    ThreadScopesReleaser(const ThreadScopesReleaser&) = delete;
+    ThreadScopesReleaser(ThreadScopesReleaser&&) = delete;
+    ThreadScopesReleaser& operator=(const ThreadScopesReleaser&) = delete;
+    ThreadScopesReleaser& operator=(ThreadScopesReleaser&&) = delete;
+
+private:
+    TraceRecorder& m_trace_recorder;
+    ThreadScopes*& m_thread_scopes_ptr;
+};
+
+TraceRecorder& TraceRecorder::Get()
+{
+    // Recorder is never destroyed to let scopes be recorded during destruction of other static objects,
+    // trace file is written with exit handler instead
+    static TraceRecorder* const s_trace_recorder_ptr = []()
+    {
+        auto* trace_recorder_ptr = new TraceRecorder(); // NOSONAR
+        std::atexit([]() { TraceRecorder::Get().WriteOutputFile(); });
+        return trace_recorder_ptr;
+    }();
+    return *s_trace_recorder_ptr;
+}
+
+TraceRecorder::TraceRecorder()
+{
+    if (const char* output_file_path = std::getenv(output_file_path_env_var); // NOSONAR
+        output_file_path)
+    {
+        m_output_file_path = output_file_path;
+    }
+}
+
+TraceRecorder::~TraceRecorder() = default;
+
+void TraceRecorder::SetOutputFilePath(std::string_view output_file_path)
+{
+    std::scoped_lock lock(m_mutex);
+    m_output_file_path = output_file_path;
+}
+
+std::string TraceRecorder::GetOutputFilePath() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_output_file_path;
+}
+
+void TraceRecorder::AddScope(const char* name, uint64_t begin_ns, uint64_t end_ns) noexcept
+{
+    if (ThreadScopes* thread_scopes_ptr = GetThreadScopes();
+        thread_scopes_ptr)
+    {
+        thread_scopes_ptr->AddScope(name, begin_ns, end_ns);
+    }
+}
+
+void TraceRecorder::AddGpuRange(std::string_view name, std::string_view track_name, uint64_t begin_ns, uint64_t end_ns)
+{
+    if (!begin_ns && !end_ns)
+        return;
+
+    std::scoped_lock lock(m_mutex);
+    if (m_gpu_ranges.size() >= gpu_ranges_capacity)
+        m_gpu_ranges.pop_front();
+
+    m_gpu_ranges.push_back({ std::string(name), std::string(track_name), begin_ns, end_ns });
+}
+
+void TraceRecorder::SetThreadName(std::string_view thread_name)
+{
+    ThreadScopes* thread_scopes_ptr = GetThreadScopes();
+    if (!thread_scopes_ptr)
+        return;
+
+    std::scoped_lock lock(m_mutex);
+    thread_scopes_ptr->SetThreadName(thread_name);
+}
+
+void TraceRecorder::WriteChromeTrace(std::ostream& os) const
+{
+    std::scoped_lock lock(m_mutex);
+    os << std::fixed;
+    os.precision(3);
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    os << "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":" << g_cpu_process_id << ",\"args\":{\"name\":\"CPU\"}}";
+    WriteMetadataEvent(os, "process_name", g_gpu_process_id, 0U, "GPU");
+
+    for(const UniquePtr<ThreadScopes>& thread_scopes_ptr : m_thread_scopes)
+    {
+        const uint32_t thread_id = thread_scopes_ptr->GetThreadId();
+        const std::string& thread_name = thread_scopes_ptr->GetThreadName();
+        WriteMetadataEvent(os, "thread_name", g_cpu_process_id, thread_id,
+                           thread_name.empty() ? "Thread " + std::to_string(thread_id) : thread_name);
+
+        for(const ThreadScopes::ScopeData& scope : thread_scopes_ptr->GetScopes())
+        {
+            WriteCompleteEvent(os, scope.name ? scope.name : "", g_cpu_process_id, thread_id,
+                               GetMicroseconds(scope.begin_ns, m_start_ns),
+                               GetMicroseconds(scope.end_ns, scope.begin_ns));
+        }
+    }
+
+    std::map<std::string_view, uint32_t> gpu_track_ids;
+    for(const GpuRange& gpu_range : m_gpu_ranges)
+    {
+        const auto [track_id_it, track_added] = gpu_track_ids.try_emplace(gpu_range.track_name, static_cast<uint32_t>(gpu_track_ids.size()));
+        if (track_added)
+        {
+            WriteMetadataEvent(os, "thread_name", g_gpu_process_id, track_id_it->second, gpu_range.track_name);
+        }
+        WriteCompleteEvent(os, gpu_range.name, g_gpu_process_id, track_id_it->second,
+                           GetMicroseconds(gpu_range.begin_ns, m_start_ns),
+                           GetMicroseconds(gpu_range.end_ns, gpu_range.begin_ns));
+    }
+
+    os << "\n]}\n";
+}
+
+bool TraceRecorder::WriteChromeTrace(const std::string& file_path) const
+{
+    std::ofstream file_stream(file_path, std::ios::out | std::ios::trunc);
+    if (!file_stream.is_open())
+        return false;
+
+    WriteChromeTrace(file_stream);
+    return file_stream.good();
+}
+
+bool TraceRecorder::WriteOutputFile() const
+{
+    const std::string output_file_path = GetOutputFilePath();
+    return !output_file_path.empty() && WriteChromeTrace(output_file_path);
+}
+
+TraceRecorder::ThreadScopes* TraceRecorder::GetThreadScopes() noexcept
+{
+    // Pointer is reset on thread exit by the releaser, so scopes recorded by destructors
+    // of other thread local objects after that are dropped
+    thread_local ThreadScopes* s_thread_scopes_ptr = nullptr;
+    thread_local bool          s_thread_scopes_acquired = false;
+    if (s_thread_scopes_ptr || s_thread_scopes_acquired)
+        return s_thread_scopes_ptr;
+
+    try
+    {
+        s_thread_scopes_ptr = &AcquireThreadScopes();
+        s_thread_scopes_acquired = true;
+        thread_local ThreadScopesReleaser s_thread_scopes_releaser(*this, s_thread_scopes_ptr);
+    }
+    catch(...) // NOSONAR - scope is dropped when thread scopes can not be allocated
+    {
+        // Allocation is retried on the next scope
+    }
+    return s_thread_scopes_ptr;
+}
+
+TraceRecorder::ThreadScopes& TraceRecorder::AcquireThreadScopes()
+{
+    // Thread scopes are owned by recorder to keep scopes of the finished threads until trace is written
+    std::scoped_lock lock(m_mutex);
+    UniquePtr<ScopesRing> ring_ptr;
+    if (m_free_scopes_rings.empty())
+    {
+        ring_ptr = std::make_unique<ScopesRing>();
+    }
+    else
+    {
+        ring_ptr = std::move(m_free_scopes_rings.back());
+        m_free_scopes_rings.pop_back();
+    }
+
+    return *m_thread_scopes.emplace_back(std::make_unique<ThreadScopes>(m_next_thread_id++, std::move(ring_ptr)));
+}
+
+void TraceRecorder::ReleaseThreadScopes(ThreadScopes& thread_scopes)
+{
+    std::scoped_lock lock(m_mutex);
+    m_free_scopes_rings.push_back(thread_scopes.Finish());
+    m_finished_threads_scopes_count += thread_scopes.GetFinishedScopesCount();
+
+    // Scopes of the earliest finished threads are dropped to limit memory used by trace of short living threads
+    for(auto thread_scopes_it = m_thread_scopes.begin();
+        thread_scopes_it != m_thread_scopes.end() && m_finished_threads_scopes_count > finished_threads_scopes_capacity;)
+    {
+        if (!(*thread_scopes_it)->IsFinished())
+        {
+            ++thread_scopes_it;
+            continue;
+        }
+
+        m_finished_threads_scopes_count -= (*thread_scopes_it)->GetFinishedScopesCount();
+        thread_scopes_it = m_thread_scopes.erase(thread_scopes_it);
+    }
+}
+
+} // namespace Methane
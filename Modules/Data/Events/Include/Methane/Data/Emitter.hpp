@@ -24,43 +24,187 @@ Event emitter base template class implementation.
 #pragma once
 
 #include "Receiver.hpp"
+#include "EventQueue.h"
 
+#include <Methane/Memory.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <ranges>
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <vector>
+#include <tuple>
+#include <thread>
+#include <concepts>
+#include <type_traits>
+#include <functional>
 
 namespace Methane::Data
 {
 
+// Receivers are called by Emit without locking and memory allocations from the immutable snapshot of connections,
+// which is replaced with the updated copy on every connect or disconnect. Emits running on other threads are awaited
+// on disconnect, so that receiver can be destroyed right after disconnecting, except the case when it is disconnected
+// from the emitted callback of the same emitter, which must not block on emits running in parallel.
+// Events emitted with EmitDeferred are pushed to the active event queue and emitted to receivers on its flush.
 template<typename EventType>
 class Emitter // NOSONAR - custom destructor is required, rule of zero is not applicable
     : public virtual IEmitter<EventType> // NOSONAR - virtual inheritance is required
 {
-    using ReceiverAndPriority = std::pair<Receiver<EventType>*, int32_t>;
-    static bool CompareReceiverAndPriority(const ReceiverAndPriority& left, const ReceiverAndPriority& right)
+    using ReceiverAndPriority  = std::pair<Receiver<EventType>*, int32_t>;
+    using ReceiversAndPriority = std::vector<ReceiverAndPriority>;
+
+    struct Connection
     {
-        return left.second > right.second;
-    }
+        Connection(Receiver<EventType>& receiver, int32_t priority) noexcept
+            : receiver_ptr(std::addressof(receiver))
+            , priority(priority)
+        { }
+
+        std::atomic<Receiver<EventType>*> receiver_ptr; // reset to null on disconnect
+        const int32_t                     priority;
+    };
+
+    // Immutable snapshot of connections sorted by priority
+    using Connections = std::vector<Ptr<Connection>>;
+
+    struct RetiredConnections
+    {
+        uint64_t                     retire_index;
+        UniquePtr<const Connections> connections_ptr;
+    };
+
+    // Connect awaits emits on other threads to release retired snapshots, when their count exceeds this limit
+    static constexpr size_t max_retired_connections_count = 64U;
+
+    // Emit call registered in the emitter readers counter of the current epoch and in the thread stack of emit scopes
+    class EmitScope
+    {
+    public:
+        explicit EmitScope(const Emitter& emitter) noexcept
+            : m_emitter(emitter)
+            , m_readers_index(emitter.m_readers_epoch.load() & 1U)
+            , m_prev_scope_ptr(s_emit_scope_ptr)
+        {
+            m_emitter.m_readers_counts[m_readers_index].fetch_add(1U);
+            s_emit_scope_ptr = this;
+        }
+
+        ~EmitScope()
+        {
+            s_emit_scope_ptr = m_prev_scope_ptr;
+            m_emitter.m_readers_counts[m_readers_index].fetch_sub(1U);
+        }
+
+        EmitScope(const EmitScope&) = delete;
+        EmitScope(EmitScope&&) = delete;
+        EmitScope& operator=(const EmitScope&) = delete;
+        EmitScope& operator=(EmitScope&&) = delete;
+
+        static bool IsEmittingOnThread(const Emitter& emitter) noexcept
+        {
+            for(const EmitScope* scope_ptr = s_emit_scope_ptr; scope_ptr; scope_ptr = scope_ptr->m_prev_scope_ptr)
+            {
+                if (std::addressof(scope_ptr->m_emitter) == std::addressof(emitter))
+                    return true;
+            }
+            return false;
+        }
+
+    private:
+        static inline thread_local const EmitScope* s_emit_scope_ptr = nullptr;
+
+        const Emitter&   m_emitter;
+        const uint32_t   m_readers_index;
+        const EmitScope* m_prev_scope_ptr;
+    };
+
+    // Non-const references and references to polymorphic or non-copyable types are stored as references in deferred event,
+    // which are compared by address for deduplication, other arguments are copied and compared by value when possible
+    template<typename ParamType, typename ValueType = std::remove_cvref_t<ParamType>>
+    using DeferredArg = std::conditional_t<std::is_reference_v<ParamType> &&
+                                           (!std::is_const_v<std::remove_reference_t<ParamType>> ||
+                                            std::is_polymorphic_v<ValueType> || !std::is_copy_constructible_v<ValueType>),
+                                           std::reference_wrapper<std::remove_reference_t<ParamType>>,
+                                           ValueType>;
+
+    template<typename... ParamTypes>
+    class DeferredEvent final
+        : public EventQueue::IEvent
+    {
+    public:
+        using FuncPtr = void (EventType::*)(ParamTypes...);
+
+        template<typename... ArgTypes>
+        DeferredEvent(Emitter& emitter, FuncPtr func_ptr, ArgTypes&&... args)
+            : m_emitter(emitter)
+            , m_func_ptr(func_ptr)
+            , m_args(std::forward<ArgTypes>(args)...)
+        { }
+
+        const void* GetEmitterPtr() const noexcept override
+        {
+            return std::addressof(m_emitter);
+        }
+
+        bool IsEqual(const EventQueue::IEvent& other) const noexcept override
+        {
+            if (other.GetEmitterPtr() != std::addressof(m_emitter))
+                return false;
+
+            const auto* other_event_ptr = dynamic_cast<const DeferredEvent*>(std::addressof(other));
+            return other_event_ptr && other_event_ptr->m_func_ptr == m_func_ptr &&
+                   [this, other_event_ptr]<size_t... Indices>(std::index_sequence<Indices...>)
+                   {
+                       return (IsArgEqual(std::get<Indices>(m_args), std::get<Indices>(other_event_ptr->m_args)) && ...);
+                   }(std::index_sequence_for<ParamTypes...>{});
+        }
+
+        void Emit() override
+        {
+            std::apply([this](auto&... args) { m_emitter.Emit(m_func_ptr, args...); }, m_args);
+        }
+
+    private:
+        template<typename ArgType>
+        static bool IsArgEqual(const std::reference_wrapper<ArgType>& left, const std::reference_wrapper<ArgType>& right) noexcept
+        {
+            return std::addressof(left.get()) == std::addressof(right.get());
+        }
+
+        template<typename ArgType>
+        static bool IsArgEqual(const ArgType& left, const ArgType& right) noexcept
+        {
+            if constexpr (std::equality_comparable<ArgType>)
+                return left == right;
+            else
+                return false;
+        }
+
+        Emitter&                                 m_emitter;
+        const FuncPtr                            m_func_ptr;
+        std::tuple<DeferredArg<ParamTypes>...>   m_args;
+    };
 
 public:
     Emitter() = default;
     Emitter(const Emitter& other) noexcept
-        : m_connected_receivers(other.m_connected_receivers)
     {
         META_FUNCTION_TASK();
-        ConnectReceivers();
+        ConnectReceivers(other.GetConnectedReceivers());
     }
 
     Emitter(Emitter&& other) noexcept
-        : m_connected_receivers(other.DisconnectReceivers())
     {
         META_FUNCTION_TASK();
-        ConnectReceivers();
+        ConnectReceivers(other.DisconnectReceivers());
     }
 
     ~Emitter() override
     {
         META_FUNCTION_TASK();
+        DiscardDeferredEvents();
         DisconnectReceivers();
     }
 
@@ -71,8 +215,7 @@ public:
             return *this;
 
         DisconnectReceivers();
-        m_connected_receivers = other.m_connected_receivers;
-        ConnectReceivers();
+        ConnectReceivers(other.GetConnectedReceivers());
         return *this;
     }
 
@@ -83,183 +226,261 @@ public:
             return *this;
 
         DisconnectReceivers();
-        m_connected_receivers = std::move(other.m_connected_receivers);
-        ConnectReceivers();
+        ConnectReceivers(other.DisconnectReceivers());
         return *this;
     }
 
     void Connect(Receiver<EventType>& receiver, int32_t priority = 0) noexcept final
     {
         META_FUNCTION_TASK();
-        std::lock_guard lock(m_connected_receivers_mutex);
-        if (FindConnectedReceiver(receiver) != m_connected_receivers.end())
-            return;
-
-        // Modification of connected receivers collection is prohibited during emit cycle, so we add them to separate collection and merge later
-        auto& connected_receivers = m_is_emitting ? m_additional_connected_receivers : m_connected_receivers;
-        const auto receiver_and_priority = std::make_pair(&receiver, priority);
-        connected_receivers.insert(
-           std::ranges::upper_bound(connected_receivers, receiver_and_priority, CompareReceiverAndPriority),
-           receiver_and_priority
-        );
-
-        receiver.OnConnected(*this);
+        {
+            std::lock_guard lock(m_connections_mutex);
+            if (FindConnection(receiver) != m_connections_ptr->end())
+                return;
+
+            // Emits which are already running continue to iterate the previous snapshot without the new receiver
+            auto connections_ptr = std::make_unique<Connections>();
+            connections_ptr->reserve(m_connections_ptr->size() + 1);
+            connections_ptr->assign(m_connections_ptr->begin(), m_connections_ptr->end());
+            connections_ptr->insert(
+                std::ranges::upper_bound(*connections_ptr, priority, std::ranges::greater{},
+                                         [](const Ptr<Connection>& connection_ptr) { return connection_ptr->priority; }),
+                std::make_shared<Connection>(receiver, priority)
+            );
+            PublishConnections(std::move(connections_ptr));
+            ReleaseRetiredConnections();
+
+            receiver.OnConnected(*this);
+            if (m_retired_connections.size() <= max_retired_connections_count)
+                return;
+        }
+        WaitForEmitsOnOtherThreads();
     }
 
     void Disconnect(Receiver<EventType>& receiver) noexcept final
     {
         META_FUNCTION_TASK();
-        std::lock_guard lock(m_connected_receivers_mutex);
-
-        const auto connected_receiver_it = FindConnectedReceiver(receiver);
-        if (connected_receiver_it == m_connected_receivers.end())
         {
-            if (m_is_emitting)
-            {
-                const auto receiver_it = std::ranges::find_if(m_additional_connected_receivers,
-                    [&receiver](const ReceiverAndPriority& receiver_and_priority)
-                    { return &receiver == receiver_and_priority.first; }
-                );
-                m_additional_connected_receivers.erase(receiver_it);
-            }
-            return;
-        }
+            std::lock_guard lock(m_connections_mutex);
+            const auto connection_it = FindConnection(receiver);
+            if (connection_it == m_connections_ptr->end())
+                return;
 
-        if (m_is_emitting)
-        {
-            // Modification of connected receivers collection is prohibited during emit cycle, so we just clear the reference instead of erasing from collection
-            connected_receiver_it->first = nullptr;
+            // Receiver is detached from connection, so that it is not called by emits which are iterating the previous snapshot
+            (*connection_it)->receiver_ptr.store(nullptr);
+
+            auto connections_ptr = std::make_unique<Connections>();
+            connections_ptr->reserve(m_connections_ptr->size() - 1);
+            connections_ptr->assign(m_connections_ptr->begin(), connection_it);
+            connections_ptr->insert(connections_ptr->end(), std::next(connection_it), m_connections_ptr->end());
+            PublishConnections(std::move(connections_ptr));
+
+            receiver.OnDisconnected(*this);
         }
-        else
+        WaitForEmitsOnOtherThreads();
+    }
+
+    // Emitter uses the default event queue for deferred events, when custom queue is not set
+    void SetEventQueue(EventQueue* event_queue_ptr)
+    {
+        META_FUNCTION_TASK();
+        if (EventQueue* prev_event_queue_ptr = m_event_queue_ptr.exchange(event_queue_ptr);
+            prev_event_queue_ptr && prev_event_queue_ptr != event_queue_ptr)
         {
-            m_connected_receivers.erase(connected_receiver_it);
+            prev_event_queue_ptr->Discard(this);
         }
-        receiver.OnDisconnected(*this);
     }
 
+    [[nodiscard]] EventQueue* GetEventQueue() const noexcept { return m_event_queue_ptr; }
+
 protected:
-    template<typename FuncType, typename... ArgTypes>
-    void Emit(FuncType&& func_ptr, ArgTypes&&... args)
+    // Deferred event is emitted immediately when event queue is not active,
+    // otherwise it is emitted on the queue flush, unless the emitter is destroyed before
+    template<typename... ParamTypes, typename... ArgTypes>
+    void EmitDeferred(void (EventType::*func_ptr)(ParamTypes...), ArgTypes&&... args)
     {
         META_FUNCTION_TASK();
-        std::lock_guard lock(m_connected_receivers_mutex);
-
-        // Additional receivers may be non-empty before emitting connected receiver calls
-        // only in case when current emit is called during another emitted callback for the same emitter
-        if (m_is_emitting && !m_additional_connected_receivers.empty())
+        EventQueue* const event_queue_ptr = GetActiveEventQueue();
+        if (!event_queue_ptr)
         {
-            // Create copy of the additional connected receivers to iterate over,
-            // because original set of additional receivers may change during emitted calls
-            auto additional_connected_receivers = m_additional_connected_receivers;
-            EmitFuncOfReceivers(additional_connected_receivers, std::forward<FuncType>(func_ptr), std::forward<ArgTypes>(args)...);
+            Emit(func_ptr, std::forward<ArgTypes>(args)...);
+            return;
         }
 
-        // Emit function of connected receivers
-        bool was_emitting = m_is_emitting;
-        m_is_emitting = true;
-        if (EmitFuncOfReceivers(m_connected_receivers, std::forward<FuncType>(func_ptr), std::forward<ArgTypes>(args)...))
-        {
-            CleanupConnectedReceivers();
-        }
-        m_is_emitting = was_emitting;
+        event_queue_ptr->Push(std::make_unique<DeferredEvent<ParamTypes...>>(*this, func_ptr, std::forward<ArgTypes>(args)...));
+    }
 
-        // Add additional receivers connected during emit cycle to the connected receivers
-        if (!was_emitting && !m_additional_connected_receivers.empty())
+    template<typename FuncType, typename... ArgTypes>
+    void Emit(FuncType&& func_ptr, ArgTypes&&... args)
+    {
+        META_FUNCTION_TASK();
+        const EmitScope emit_scope(*this);
+
+        // Receivers connected during emit are called only by the nested emits, which iterate the updated snapshot
+        for(const Ptr<Connection>& connection_ptr : *m_connections_snapshot_ptr.load())
         {
-            m_connected_receivers.insert(m_connected_receivers.end(), m_additional_connected_receivers.begin(), m_additional_connected_receivers.end());
-            std::ranges::sort(m_connected_receivers, CompareReceiverAndPriority);
-            m_additional_connected_receivers.clear();
+            // Receiver may be disconnected or destroyed during the previous emitted calls
+            if (Receiver<EventType>* receiver_ptr = connection_ptr->receiver_ptr.load();
+                receiver_ptr)
+            {
+                (receiver_ptr->*func_ptr)(args...);
+            }
         }
     }
 
     size_t GetConnectedReceiversCount() const noexcept
     {
-        return m_connected_receivers.size() + m_additional_connected_receivers.size();
+        std::lock_guard lock(m_connections_mutex);
+        return m_connections_ptr->size();
     }
 
 private:
     [[nodiscard]]
-    inline decltype(auto) FindConnectedReceiver(Receiver<EventType>& receiver) noexcept
+    inline EventQueue* GetActiveEventQueue() const
+    {
+        if (EventQueue* const event_queue_ptr = m_event_queue_ptr.load();
+            event_queue_ptr)
+            return event_queue_ptr->IsActive() ? event_queue_ptr : nullptr;
+
+        EventQueue& default_event_queue = EventQueue::GetDefault();
+        return default_event_queue.IsActive() ? &default_event_queue : nullptr;
+    }
+
+    inline void DiscardDeferredEvents()
+    {
+        EventQueue::GetDefault().Discard(this);
+        if (EventQueue* const event_queue_ptr = m_event_queue_ptr.load();
+            event_queue_ptr)
+            event_queue_ptr->Discard(this);
+    }
+
+    [[nodiscard]]
+    inline typename Connections::const_iterator FindConnection(const Receiver<EventType>& receiver) const noexcept
     {
-        return std::ranges::find_if(m_connected_receivers,
-            [&receiver](const ReceiverAndPriority& receiver_and_priority)
+        return std::ranges::find_if(*m_connections_ptr,
+            [&receiver](const Ptr<Connection>& connection_ptr)
             {
-                return receiver_and_priority.first && receiver_and_priority.first == std::addressof(receiver);
+                return connection_ptr->receiver_ptr.load() == std::addressof(receiver);
             }
         );
     }
 
-    template<typename ReceiversContainerType, typename FuncType, typename... ArgTypes>
-    bool EmitFuncOfReceivers(ReceiversContainerType& receivers, FuncType&& func_ptr, ArgTypes&&... args)
+    inline void PublishConnections(UniquePtr<const Connections>&& connections_ptr) noexcept
     {
-        bool is_cleanup_required = false;
-        for(const ReceiverAndPriority& receiver_and_priority : receivers)
-        {
-            if (!receiver_and_priority.first)
-            {
-                is_cleanup_required = true;
-                continue;
-            }
+        m_retired_connections.push_back({ m_retired_connections_count++, std::move(m_connections_ptr) });
+        m_connections_ptr = std::move(connections_ptr);
+        m_connections_snapshot_ptr.store(m_connections_ptr.get());
+    }
+
+    inline void ReleaseRetiredConnections() noexcept
+    {
+        // Retired snapshots can be released only when no emits are running, because
+        // emits started before publishing of the current snapshot may still iterate the retired ones
+        if (m_retired_connections.empty() ||
+            m_readers_counts[0].load() || m_readers_counts[1].load())
+            return;
 
-            // Call the emitted event function in receiver
-            (receiver_and_priority.first->*std::forward<FuncType>(func_ptr))(std::forward<ArgTypes>(args)...);
+        m_retired_connections.clear();
+    }
 
-            if (!receiver_and_priority.first)
+    inline void ReleaseRetiredConnections(uint64_t retired_connections_count) noexcept
+    {
+        std::erase_if(m_retired_connections,
+            [retired_connections_count](const RetiredConnections& retired_connections)
+            { return retired_connections.retire_index < retired_connections_count; }
+        );
+    }
+
+    inline void WaitForEmitsOnOtherThreads() noexcept
+    {
+        if (EmitScope::IsEmittingOnThread(*this))
+            return;
+
+        uint64_t retired_connections_count = 0U;
+        {
+            std::lock_guard lock(m_connections_mutex);
+            retired_connections_count = m_retired_connections_count;
+        }
+
+        // Readers epoch is switched so that emits started after this point are counted separately and use the current snapshot,
+        // then all emits of the previous epoch are awaited, which could use retired snapshots or detached receivers.
+        // Epoch is switched twice to await also emits, which have read the epoch before the previous switch,
+        // but registered in the readers counter after it.
+        std::lock_guard wait_lock(m_readers_wait_mutex);
+        for(uint32_t epoch_switch = 0U; epoch_switch < 2U; ++epoch_switch)
+        {
+            const uint32_t readers_index = m_readers_epoch.fetch_add(1U) & 1U;
+            while(m_readers_counts[readers_index].load())
             {
-                // Receiver may be disconnected or destroyed during emitted event, so it will be cleaned up after full emit cycle
-                is_cleanup_required = true;
+                std::this_thread::yield();
             }
         }
-        return is_cleanup_required;
+
+        std::lock_guard lock(m_connections_mutex);
+        ReleaseRetiredConnections(retired_connections_count);
     }
 
-    inline void CleanupConnectedReceivers() noexcept
+    [[nodiscard]]
+    inline ReceiversAndPriority GetConnectedReceivers() const noexcept
     {
-        // Erase receivers disconnected during emit cycle from the connected receivers
-        std::lock_guard lock(m_connected_receivers_mutex);
-        for(auto connected_receiver_it  = m_connected_receivers.begin(); connected_receiver_it != m_connected_receivers.end();)
+        std::lock_guard lock(m_connections_mutex);
+        ReceiversAndPriority receivers_and_priority;
+        receivers_and_priority.reserve(m_connections_ptr->size());
+        for(const Ptr<Connection>& connection_ptr : *m_connections_ptr)
         {
-            if (connected_receiver_it->first)
-                connected_receiver_it++;
-            else
-                connected_receiver_it = m_connected_receivers.erase(connected_receiver_it);
+            receivers_and_priority.emplace_back(connection_ptr->receiver_ptr.load(), connection_ptr->priority);
         }
+        return receivers_and_priority;
     }
 
-    inline void ConnectReceivers() noexcept
+    inline void ConnectReceivers(const ReceiversAndPriority& receivers_and_priority) noexcept
     {
-        std::lock_guard lock(m_connected_receivers_mutex);
-        for(const ReceiverAndPriority& receiver_and_priority : m_connected_receivers)
+        for(const auto& [receiver_ptr, priority] : receivers_and_priority)
         {
-            if (receiver_and_priority.first)
-                receiver_and_priority.first->OnConnected(*this);
+            Connect(*receiver_ptr, priority);
         }
     }
 
-    inline auto DisconnectReceivers() noexcept
+    inline ReceiversAndPriority DisconnectReceivers() noexcept
     {
-        // Move connected receivers so that OnDisconnected callbacks are not processed (m_connected_receivers would be empty)
-        std::lock_guard lock(m_connected_receivers_mutex);
-        const auto connected_receivers = std::move(m_connected_receivers);
-        for(const ReceiverAndPriority& receiver_and_priority : connected_receivers)
+        ReceiversAndPriority receivers_and_priority;
         {
-            if (!receiver_and_priority.first)
-                continue;
+            // Connections are cleared before OnDisconnected callbacks, so that Disconnect calls from receivers are not processed
+            std::lock_guard lock(m_connections_mutex);
+            if (m_connections_ptr->empty())
+                return receivers_and_priority;
+
+            receivers_and_priority = GetConnectedReceivers();
+            for(const Ptr<Connection>& connection_ptr : *m_connections_ptr)
+            {
+                connection_ptr->receiver_ptr.store(nullptr);
+            }
+            PublishConnections(std::make_unique<Connections>());
 
-            receiver_and_priority.first->OnDisconnected(*this);
+            for(const ReceiverAndPriority& receiver_and_priority : receivers_and_priority)
+            {
+                receiver_and_priority.first->OnDisconnected(*this);
+            }
         }
-        return connected_receivers;
+        WaitForEmitsOnOtherThreads();
+        return receivers_and_priority;
     }
 
-    bool                                m_is_emitting = false;
-    std::vector<ReceiverAndPriority>    m_connected_receivers;
-    std::vector<ReceiverAndPriority>    m_additional_connected_receivers;
+    UniquePtr<const Connections>                 m_connections_ptr = std::make_unique<Connections>();
+    std::atomic<const Connections*>              m_connections_snapshot_ptr{ m_connections_ptr.get() };
+    std::vector<RetiredConnections>              m_retired_connections;
+    uint64_t                                     m_retired_connections_count = 0U;
+    std::atomic<uint32_t>                        m_readers_epoch{ 0U };
+    std::atomic<EventQueue*>                     m_event_queue_ptr{ nullptr };
+    mutable std::array<std::atomic<uint32_t>, 2> m_readers_counts{ };
 #if defined(__GNUG__) && !defined(__clang__)
     // GCC fails with internal compiler error: Segmentation fault
-    std::recursive_mutex                m_connected_receivers_mutex;
+    mutable std::recursive_mutex                 m_connections_mutex;
+    std::mutex                                   m_readers_wait_mutex;
 #else
-    TracyLockable(std::recursive_mutex, m_connected_receivers_mutex);
+    mutable TracyLockable(std::recursive_mutex, m_connections_mutex);
+    TracyLockable(std::mutex, m_readers_wait_mutex);
 #endif
 };
 
-} // namespace Methane::Data
\ No newline at end of file
+} // namespace Methane::Data
@@ -0,0 +1,102 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/EventQueue.h
+Queue of deferred events emitted in batch on flush with deduplication of identical events.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vector>
+#include <unordered_map>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+namespace Methane::Data
+{
+
+// Events are pushed to the queue by Emitter::EmitDeferred from any thread and emitted to receivers on Flush,
+// which is called at the well-defined point of the application loop (start of the frame update).
+// Identical events pushed before flush are emitted only once at the position of the first event in queue.
+class EventQueue
+{
+public:
+    class IEvent
+    {
+    public:
+        [[nodiscard]] virtual const void* GetEmitterPtr() const noexcept = 0;
+        [[nodiscard]] virtual bool IsEqual(const IEvent& other) const noexcept = 0;
+        virtual void Emit() = 0;
+
+        virtual ~IEvent() = default;
+    };
+
+    // Default queue is inactive until activated by application, so that deferred events are emitted immediately
+    [[nodiscard]] static EventQueue& GetDefault();
+
+    explicit EventQueue(bool is_active = true) noexcept;
+
+    [[nodiscard]] bool   IsActive() const noexcept                  { return m_is_active; }
+    [[nodiscard]] size_t GetQueuedEventsCount() const noexcept      { return m_queued_events_count; }
+    [[nodiscard]] size_t GetDeduplicatedEventsCount() const noexcept { return m_deduplicated_events_count; }
+
+    // Deactivated queue keeps already queued events until the next flush
+    void SetActive(bool is_active) noexcept { m_is_active = is_active; }
+
+    bool Push(UniquePtr<IEvent>&& event_ptr);
+    void Flush();
+    void Discard(const void* emitter_ptr);
+
+private:
+    using Events = std::vector<UniquePtr<IEvent>>;
+    using EventIndices = std::vector<size_t>;
+
+    // Indices of the emitter events in queued and flushing events,
+    // so that events are deduplicated and discarded without scanning events of other emitters
+    struct EmitterEvents
+    {
+        EventIndices queued_indices;
+        EventIndices flushing_indices;
+    };
+
+    using EmitterEventsByEmitter = std::unordered_map<const void*, EmitterEvents>;
+
+    void CompleteEventEmit();
+    void ClearFlushingEvents();
+
+    std::atomic<bool>        m_is_active;
+    std::atomic<size_t>      m_queued_events_count{ 0U };
+    std::atomic<size_t>      m_deduplicated_events_count{ 0U };
+    std::atomic<const void*> m_emitting_emitter_ptr{ nullptr };
+    Events                   m_queued_events;
+    Events                   m_flushing_events;
+    EmitterEventsByEmitter   m_events_by_emitter;
+    std::thread::id          m_flushing_thread_id;
+    bool                     m_is_flushing = false;
+    std::condition_variable_any m_emit_completed_condition_var;
+    TracyLockable(std::mutex, m_events_mutex);
+    TracyLockable(std::mutex, m_flush_mutex);
+};
+
+} // namespace Methane::Data
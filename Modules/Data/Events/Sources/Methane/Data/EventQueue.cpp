@@ -0,0 +1,182 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/EventQueue.cpp
+Queue of deferred events emitted in batch on flush with deduplication of identical events.
+
+******************************************************************************/
+
+#include <Methane/Data/EventQueue.h>
+
+#include <algorithm>
+
+namespace Methane::Data
+{
+
+EventQueue& EventQueue::GetDefault()
+{
+    static EventQueue s_default_event_queue(false);
+    return s_default_event_queue;
+}
+
+EventQueue::EventQueue(bool is_active) noexcept
+    : m_is_active(is_active)
+{ }
+
+bool EventQueue::Push(UniquePtr<IEvent>&& event_ptr)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_events_mutex);
+    EventIndices& queued_indices = m_events_by_emitter[event_ptr->GetEmitterPtr()].queued_indices;
+    if (std::ranges::any_of(queued_indices,
+                            [this, &event_ptr](size_t event_index)
+                            {
+                                const UniquePtr<IEvent>& queued_event_ptr = m_queued_events[event_index];
+                                return queued_event_ptr && queued_event_ptr->IsEqual(*event_ptr);
+                            }))
+    {
+        m_deduplicated_events_count++;
+        return false;
+    }
+
+    queued_indices.push_back(m_queued_events.size());
+    m_queued_events.emplace_back(std::move(event_ptr));
+    m_queued_events_count++;
+    return true;
+}
+
+void EventQueue::Flush()
+{
+    META_FUNCTION_TASK();
+    if (!m_queued_events_count)
+        return;
+
+    // Flush called from the emitted callback returns before taking the flush lock
+    if (std::scoped_lock lock(m_events_mutex);
+        m_is_flushing)
+    {
+        // Events pushed during flush from the emitted callbacks are emitted on the next flush
+        return;
+    }
+
+    std::scoped_lock flush_lock(m_flush_mutex);
+    {
+        std::scoped_lock lock(m_events_mutex);
+        std::swap(m_queued_events, m_flushing_events);
+        for(auto& [emitter_ptr, emitter_events] : m_events_by_emitter)
+        {
+            std::swap(emitter_events.queued_indices, emitter_events.flushing_indices);
+        }
+        m_flushing_thread_id = std::this_thread::get_id();
+        m_is_flushing = true;
+    }
+
+    try
+    {
+        for(size_t event_index = 0U; event_index < m_flushing_events.size(); ++event_index)
+        {
+            UniquePtr<IEvent> event_ptr;
+            {
+                // Event could be discarded by the emitter destroyed in one of the previous event callbacks
+                std::scoped_lock lock(m_events_mutex);
+                event_ptr = std::move(m_flushing_events[event_index]);
+                if (!event_ptr)
+                    continue;
+
+                m_emitting_emitter_ptr = event_ptr->GetEmitterPtr();
+                m_queued_events_count--;
+            }
+            event_ptr->Emit();
+            CompleteEventEmit();
+        }
+    }
+    catch(...)
+    {
+        CompleteEventEmit();
+        ClearFlushingEvents();
+        throw;
+    }
+    ClearFlushingEvents();
+}
+
+void EventQueue::Discard(const void* emitter_ptr)
+{
+    META_FUNCTION_TASK();
+    if (!m_queued_events_count && m_emitting_emitter_ptr != emitter_ptr)
+        return;
+
+    std::unique_lock lock(m_events_mutex);
+    if (const auto emitter_events_it = m_events_by_emitter.find(emitter_ptr);
+        emitter_events_it != m_events_by_emitter.end())
+    {
+        const auto discard_events = [this](Events& events, const EventIndices& event_indices)
+        {
+            for(size_t event_index : event_indices)
+            {
+                if (!events[event_index])
+                    continue;
+
+                events[event_index].reset();
+                m_queued_events_count--;
+            }
+        };
+        discard_events(m_queued_events, emitter_events_it->second.queued_indices);
+        discard_events(m_flushing_events, emitter_events_it->second.flushing_indices);
+        m_events_by_emitter.erase(emitter_events_it);
+    }
+
+    // Wait for completion of the event emitting on the flushing thread, which uses the discarded emitter,
+    // unless the emitter is discarded from its own event callback on the flushing thread
+    if (m_flushing_thread_id != std::this_thread::get_id())
+    {
+        m_emit_completed_condition_var.wait(lock, [this, emitter_ptr]
+                                            { return m_emitting_emitter_ptr != emitter_ptr; });
+    }
+}
+
+void EventQueue::CompleteEventEmit()
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock(m_events_mutex);
+        m_emitting_emitter_ptr = nullptr;
+    }
+    m_emit_completed_condition_var.notify_all();
+}
+
+void EventQueue::ClearFlushingEvents()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_events_mutex);
+    m_queued_events_count -= static_cast<size_t>(std::ranges::count_if(m_flushing_events,
+        [](const UniquePtr<IEvent>& event_ptr) { return static_cast<bool>(event_ptr); }));
+    m_flushing_events.clear();
+    for(auto emitter_events_it = m_events_by_emitter.begin(); emitter_events_it != m_events_by_emitter.end();)
+    {
+        // Emitters with events queued during flush are kept, while others are removed
+        emitter_events_it->second.flushing_indices.clear();
+        if (emitter_events_it->second.queued_indices.empty())
+            emitter_events_it = m_events_by_emitter.erase(emitter_events_it);
+        else
+            ++emitter_events_it;
+    }
+    m_flushing_thread_id = {};
+    m_is_flushing = false;
+}
+
+} // namespace Methane::Data
@@ -27,7 +27,8 @@ FPS counter interface.
 
 #include <Methane/Timer.hpp>
 
-#include <queue>
+#include <vector>
+#include <array>
 
 namespace Methane::Data
 {
@@ -36,26 +37,64 @@ class FpsCounter
     : public IFpsCounter
 {
 public:
-    FpsCounter() = default;
+    // Frame durations histogram with logarithmic buckets: every power of two microseconds is split in equal sub-buckets
+    class Histogram
+    {
+    public:
+        static constexpr uint32_t octaves_count = 25U;
+        static constexpr uint32_t octave_buckets_count = 32U;
+        static constexpr uint32_t buckets_count = octaves_count * octave_buckets_count;
+
+        [[nodiscard]] static uint32_t GetBucketIndex(uint64_t duration_us) noexcept;
+        [[nodiscard]] static uint64_t GetBucketBeginDuration(uint32_t bucket_index) noexcept;
+
+        void Add(double duration_sec) noexcept;
+        void Remove(double duration_sec) noexcept;
+        void Clear() noexcept;
+
+        [[nodiscard]] uint32_t GetCount() const noexcept { return m_count; }
+        [[nodiscard]] double   GetPercentileDurationSec(double percent) const noexcept;
+
+    private:
+        std::array<uint32_t, buckets_count> m_bucket_counts{ };
+        uint32_t m_count = 0U;
+    };
+
+    static constexpr uint32_t default_averaged_timings_count = 100U;
+
+    FpsCounter() noexcept;
     explicit FpsCounter(uint32_t averaged_timings_count) noexcept;
 
     void Reset(uint32_t averaged_timings_count) noexcept override;
     [[nodiscard]] uint32_t GetAveragedTimingsCount() const noexcept override;
     [[nodiscard]] Timing   GetAverageFrameTiming() const noexcept override;
     [[nodiscard]] uint32_t GetFramesPerSecond() const noexcept override;
+    [[nodiscard]] Timing   GetPercentileFrameTiming(double percent) const noexcept override;
+    [[nodiscard]] TimingStatistics GetFrameTimingStatistics(double frame_time_budget_sec) const noexcept override;
 
     void OnGpuFramePresentWait() noexcept;
     void OnCpuFrameReadyToPresent() noexcept;
     void OnGpuFramePresented() noexcept;
     void OnCpuFramePresented() noexcept;
 
+    // Adds frame timing measured externally, used by OnCpuFramePresented with timings of the frame timers
+    void OnFramePresented(const Timing& frame_timing) noexcept;
+
 private:
-    Timer              m_frame_timer;
-    Timer              m_present_timer;
-    double             m_present_on_gpu_wait_time_sec = 0.0;
-    uint32_t           m_averaged_timings_count = 100;
-    Timing             m_frame_timings_sum;
-    std::queue<Timing> m_frame_timings;
+    void AddFrameTiming(const Timing& frame_timing) noexcept;
+    void RemoveFrameTiming(const Timing& frame_timing) noexcept;
+
+    Timer               m_frame_timer;
+    Timer               m_present_timer;
+    double              m_present_on_gpu_wait_time_sec = 0.0;
+    uint32_t            m_averaged_timings_count = default_averaged_timings_count;
+    Timing              m_frame_timings_sum;
+    std::vector<Timing> m_frame_timings;         // ring buffer allocated on reset with averaged timings count capacity
+    uint32_t            m_frame_timings_begin = 0U;
+    uint32_t            m_frame_timings_size  = 0U;
+    Histogram           m_total_time_histogram;
+    Histogram           m_present_time_histogram;
+    Histogram           m_gpu_wait_time_histogram;
 };
 
 } // namespace Methane::Graphics::Base
\ No newline at end of file
@@ -71,15 +71,32 @@ private:
     double m_gpu_wait_time_sec { 0.0 };
 };
 
+struct FrameTimingStatistics
+{
+    // Percentiles are calculated independently for every component of frame timing
+    FrameTiming p50;
+    FrameTiming p90;
+    FrameTiming p99;
+    FrameTiming p99_9;
+    double      total_time_variance_sec2 { 0.0 };
+    uint32_t    frames_count             { 0U };
+    uint32_t    over_budget_frames_count { 0U };
+
+    [[nodiscard]] double GetTotalTimeDeviationMSec() const noexcept;
+};
+
 class IFpsCounter
 {
 public:
     using Timing = FrameTiming;
+    using TimingStatistics = FrameTimingStatistics;
 
     virtual void Reset(uint32_t averaged_timings_count) noexcept = 0;
     [[nodiscard]] virtual uint32_t GetAveragedTimingsCount() const noexcept = 0;
     [[nodiscard]] virtual Timing   GetAverageFrameTiming() const noexcept = 0;
     [[nodiscard]] virtual uint32_t GetFramesPerSecond() const noexcept = 0;
+    [[nodiscard]] virtual Timing   GetPercentileFrameTiming(double percent) const noexcept = 0;
+    [[nodiscard]] virtual TimingStatistics GetFrameTimingStatistics(double frame_time_budget_sec) const noexcept = 0;
 
     virtual ~IFpsCounter() = default;
 };
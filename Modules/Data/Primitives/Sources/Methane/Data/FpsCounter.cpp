@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/FpsCounter.cpp
-FPS counter calculates frame time duration with moving average window algorithm.
+FPS counter calculates frame time duration with moving average window algorithm
+and frame time percentiles with histogram of the same window of frames.
 
 ******************************************************************************/
 
@@ -25,24 +26,120 @@ FPS counter calculates frame time duration with moving average window algorithm.
 
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
 
 namespace Methane::Data
 {
 
+static constexpr uint32_t g_histogram_octave_bits_count = std::countr_zero(FpsCounter::Histogram::octave_buckets_count);
+static_assert(std::has_single_bit(FpsCounter::Histogram::octave_buckets_count));
+
+static constexpr std::array<double, 4> g_statistics_percents{ 50.0, 90.0, 99.0, 99.9 };
+
+[[nodiscard]] static uint64_t GetDurationMicroseconds(double duration_sec) noexcept
+{
+    return duration_sec > 0.0 ? static_cast<uint64_t>(duration_sec * 1E6) : 0U;
+}
+
+uint32_t FpsCounter::Histogram::GetBucketIndex(uint64_t duration_us) noexcept
+{
+    META_FUNCTION_TASK();
+    if (!duration_us)
+        return 0U;
+
+    const auto octave_index = static_cast<uint32_t>(std::bit_width(duration_us) - 1U);
+    if (octave_index >= octaves_count)
+        return buckets_count - 1U;
+
+    // Octave sub-bucket is defined by the most significant bits following the leading one
+    const uint64_t octave_bucket_index = octave_index >= g_histogram_octave_bits_count
+                                       ? duration_us >> (octave_index - g_histogram_octave_bits_count)
+                                       : duration_us << (g_histogram_octave_bits_count - octave_index);
+    return octave_index * octave_buckets_count +
+           static_cast<uint32_t>(octave_bucket_index & (octave_buckets_count - 1U));
+}
+
+uint64_t FpsCounter::Histogram::GetBucketBeginDuration(uint32_t bucket_index) noexcept
+{
+    META_FUNCTION_TASK();
+    const uint32_t octave_index        = bucket_index / octave_buckets_count;
+    const uint64_t octave_bucket_index = bucket_index % octave_buckets_count;
+    return ((octave_buckets_count + octave_bucket_index) << octave_index) >> g_histogram_octave_bits_count;
+}
+
+void FpsCounter::Histogram::Add(double duration_sec) noexcept
+{
+    META_FUNCTION_TASK();
+    m_bucket_counts[GetBucketIndex(GetDurationMicroseconds(duration_sec))]++;
+    m_count++;
+}
+
+void FpsCounter::Histogram::Remove(double duration_sec) noexcept
+{
+    META_FUNCTION_TASK();
+    uint32_t& bucket_count = m_bucket_counts[GetBucketIndex(GetDurationMicroseconds(duration_sec))];
+    if (!bucket_count)
+        return;
+
+    bucket_count--;
+    m_count--;
+}
+
+void FpsCounter::Histogram::Clear() noexcept
+{
+    META_FUNCTION_TASK();
+    m_bucket_counts.fill(0U);
+    m_count = 0U;
+}
+
+double FpsCounter::Histogram::GetPercentileDurationSec(double percent) const noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_count)
+        return 0.0;
+
+    const auto percentile_rank = std::clamp(static_cast<uint32_t>(std::ceil(percent * m_count / 100.0)), 1U, m_count);
+    uint32_t accumulated_count = 0U;
+    for(uint32_t bucket_index = 0U; bucket_index < buckets_count; ++bucket_index)
+    {
+        const uint32_t bucket_count = m_bucket_counts[bucket_index];
+        if (accumulated_count + bucket_count < percentile_rank)
+        {
+            accumulated_count += bucket_count;
+            continue;
+        }
+
+        // Duration is interpolated linearly between bucket bounds by the percentile rank of samples in bucket
+        const auto   bucket_begin_us = static_cast<double>(GetBucketBeginDuration(bucket_index));
+        const auto   bucket_end_us   = static_cast<double>(GetBucketBeginDuration(bucket_index + 1U));
+        const double bucket_ratio    = (static_cast<double>(percentile_rank - accumulated_count) - 0.5) / bucket_count;
+        return (bucket_begin_us + (bucket_end_us - bucket_begin_us) * bucket_ratio) / 1E6;
+    }
+    return 0.0;
+}
+
+FpsCounter::FpsCounter() noexcept
+    : FpsCounter(default_averaged_timings_count)
+{ }
+
 FpsCounter::FpsCounter(uint32_t averaged_timings_count) noexcept
     : m_averaged_timings_count(averaged_timings_count)
+    , m_frame_timings(averaged_timings_count)
 { }
 
 void FpsCounter::Reset(uint32_t averaged_timings_count) noexcept
 {
     META_FUNCTION_TASK();
     m_averaged_timings_count = averaged_timings_count;
-    while (!m_frame_timings.empty())
-    {
-        m_frame_timings.pop();
-    }
+    m_frame_timings.assign(averaged_timings_count, Timing());
+    m_frame_timings_begin = 0U;
+    m_frame_timings_size  = 0U;
     m_frame_timings_sum = Timing();
+    m_total_time_histogram.Clear();
+    m_present_time_histogram.Clear();
+    m_gpu_wait_time_histogram.Clear();
     m_present_on_gpu_wait_time_sec = 0.0;
     m_frame_timer.Reset();
     m_present_timer.Reset();
@@ -69,7 +166,7 @@ void FpsCounter::OnGpuFramePresented() noexcept
 uint32_t FpsCounter::GetAveragedTimingsCount() const noexcept
 {
     META_FUNCTION_TASK();
-    return static_cast<uint32_t>(m_frame_timings.size());
+    return m_frame_timings_size;
 }
 
 FpsCounter::Timing FpsCounter::GetAverageFrameTiming() const noexcept
@@ -86,22 +183,89 @@ uint32_t FpsCounter::GetFramesPerSecond() const noexcept
     return average_frame_time_sec > 0.0 ? static_cast<uint32_t>(std::round(1.0 / average_frame_time_sec)) : 0U;
 }
 
-void FpsCounter::OnCpuFramePresented() noexcept
+FpsCounter::Timing FpsCounter::GetPercentileFrameTiming(double percent) const noexcept
 {
     META_FUNCTION_TASK();
-    if (m_frame_timings.size() >= m_averaged_timings_count)
+    return Timing(m_total_time_histogram.GetPercentileDurationSec(percent),
+                  m_present_time_histogram.GetPercentileDurationSec(percent),
+                  m_gpu_wait_time_histogram.GetPercentileDurationSec(percent));
+}
+
+FpsCounter::TimingStatistics FpsCounter::GetFrameTimingStatistics(double frame_time_budget_sec) const noexcept
+{
+    META_FUNCTION_TASK();
+    TimingStatistics statistics;
+    statistics.p50   = GetPercentileFrameTiming(g_statistics_percents[0]);
+    statistics.p90   = GetPercentileFrameTiming(g_statistics_percents[1]);
+    statistics.p99   = GetPercentileFrameTiming(g_statistics_percents[2]);
+    statistics.p99_9 = GetPercentileFrameTiming(g_statistics_percents[3]);
+    statistics.frames_count = m_frame_timings_size;
+    if (!m_frame_timings_size)
+        return statistics;
+
+    // Variance and budget overruns are calculated precisely from the ring buffer of frame timings,
+    // which is cheap enough for the statistics requested once per HUD update
+    const double average_total_time_sec = GetAverageFrameTiming().GetTotalTimeSec();
+    double total_time_squared_deviations_sum = 0.0;
+    for(uint32_t timing_index = 0U; timing_index < m_frame_timings_size; ++timing_index)
     {
-        m_frame_timings_sum -= m_frame_timings.front();
-        m_frame_timings.pop();
+        const double total_time_sec = m_frame_timings[(m_frame_timings_begin + timing_index) % m_averaged_timings_count].GetTotalTimeSec();
+        const double total_time_deviation_sec = total_time_sec - average_total_time_sec;
+        total_time_squared_deviations_sum += total_time_deviation_sec * total_time_deviation_sec;
+        if (frame_time_budget_sec > 0.0 && total_time_sec > frame_time_budget_sec)
+            statistics.over_budget_frames_count++;
     }
+    statistics.total_time_variance_sec2 = total_time_squared_deviations_sum / m_frame_timings_size;
+    return statistics;
+}
 
+void FpsCounter::OnCpuFramePresented() noexcept
+{
+    META_FUNCTION_TASK();
     const Timing frame_timing(m_frame_timer.GetElapsedSecondsD(),
                               m_present_timer.GetElapsedSecondsD(),
                               m_present_on_gpu_wait_time_sec);
+    m_frame_timer.Reset();
+    OnFramePresented(frame_timing);
+}
 
+void FpsCounter::OnFramePresented(const Timing& frame_timing) noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_averaged_timings_count)
+        return;
+
+    if (m_frame_timings_size >= m_averaged_timings_count)
+    {
+        // Oldest frame timing in the full ring buffer is overwritten with the new one
+        RemoveFrameTiming(m_frame_timings[m_frame_timings_begin]);
+        m_frame_timings[m_frame_timings_begin] = frame_timing;
+        m_frame_timings_begin = (m_frame_timings_begin + 1U) % m_averaged_timings_count;
+    }
+    else
+    {
+        m_frame_timings[(m_frame_timings_begin + m_frame_timings_size) % m_averaged_timings_count] = frame_timing;
+        m_frame_timings_size++;
+    }
+    AddFrameTiming(frame_timing);
+}
+
+void FpsCounter::AddFrameTiming(const Timing& frame_timing) noexcept
+{
+    META_FUNCTION_TASK();
     m_frame_timings_sum += frame_timing;
-    m_frame_timings.push(frame_timing);
-    m_frame_timer.Reset();
+    m_total_time_histogram.Add(frame_timing.GetTotalTimeSec());
+    m_present_time_histogram.Add(frame_timing.GetPresentTimeSec());
+    m_gpu_wait_time_histogram.Add(frame_timing.GetGpuWaitTimeSec());
+}
+
+void FpsCounter::RemoveFrameTiming(const Timing& frame_timing) noexcept
+{
+    META_FUNCTION_TASK();
+    m_frame_timings_sum -= frame_timing;
+    m_total_time_histogram.Remove(frame_timing.GetTotalTimeSec());
+    m_present_time_histogram.Remove(frame_timing.GetPresentTimeSec());
+    m_gpu_wait_time_histogram.Remove(frame_timing.GetGpuWaitTimeSec());
 }
 
 } // namespace Methane::Graphics::Base
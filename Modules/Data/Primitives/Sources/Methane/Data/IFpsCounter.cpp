@@ -25,6 +25,8 @@ FPS counter interface.
 
 #include <Methane/Instrumentation.h>
 
+#include <cmath>
+
 namespace Methane::Data
 {
 
@@ -52,4 +54,10 @@ FrameTiming& FrameTiming::operator-=(const FrameTiming& other) noexcept
     return *this;
 }
 
+double FrameTimingStatistics::GetTotalTimeDeviationMSec() const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::sqrt(total_time_variance_sec2) * 1000.0;
+}
+
 } // namespace Methane::Graphics::Rhi
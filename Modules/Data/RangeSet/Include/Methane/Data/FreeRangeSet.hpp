@@ -0,0 +1,229 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FreeRangeSet.hpp
+Set of free ranges with size-class buckets index used for best-fit reservation of ranges.
+
+******************************************************************************/
+
+#pragma once
+
+#include "RangeSet.hpp"
+
+#include <Methane/Instrumentation.h>
+
+#include <array>
+#include <bit>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <cassert>
+
+namespace Methane::Data
+{
+
+// Free ranges are stored in the range set ordered by offsets and indexed in size-class buckets, similar to TLSF allocator:
+// each power of two range of lengths is split into linear sub-classes, so that lengths of each bucket are greater than lengths
+// of all previous buckets. Each bucket is a flat vector sorted by range length and start, so that the best-fit range is the first
+// range not shorter than the reserved length in its bucket or the first range of the next non-empty bucket.
+template<typename ScalarT>
+class FreeRangeSet
+{
+    static_assert(std::is_unsigned_v<ScalarT>, "free range set supports only unsigned scalar types");
+
+public:
+    using Ranges        = RangeSet<ScalarT>;
+    using ConstIterator = typename Ranges::ConstIterator;
+
+    [[nodiscard]] size_t        Size() const noexcept      { return m_ranges.Size(); }
+    [[nodiscard]] bool          IsEmpty() const noexcept   { return m_ranges.IsEmpty(); }
+    [[nodiscard]] const Ranges& GetRanges() const noexcept { return m_ranges; }
+    [[nodiscard]] ConstIterator begin() const noexcept     { return m_ranges.begin(); }
+    [[nodiscard]] ConstIterator end() const noexcept       { return m_ranges.end(); }
+
+    [[nodiscard]] ScalarT GetMaxRangeLength() const noexcept
+    {
+        for (size_t mask_index = g_mask_words_count; mask_index > 0U; --mask_index)
+        {
+            if (const uint64_t mask_word = m_buckets_mask[mask_index - 1U]; mask_word)
+                return m_buckets[(mask_index - 1U) * 64U + static_cast<size_t>(std::bit_width(mask_word)) - 1U].back().length;
+        }
+        return ScalarT{};
+    }
+
+    void Clear() noexcept
+    {
+        META_FUNCTION_TASK();
+        m_ranges.Clear();
+        for (Bucket& bucket : m_buckets)
+        {
+            bucket.clear();
+        }
+        m_buckets_mask.fill(0U);
+    }
+
+    void Add(const Range<ScalarT>& range)
+    {
+        META_FUNCTION_TASK();
+        if (range.IsEmpty())
+            return;
+
+        // Free ranges overlapping or adjacent to the added range are merged with it in one range
+        const typename Ranges::BaseSet& ranges = m_ranges.GetRanges();
+        const auto first_it = std::ranges::lower_bound(ranges, range.GetStart(), std::less<ScalarT>(), &Range<ScalarT>::GetEnd);
+        const auto last_it  = std::upper_bound(first_it, ranges.end(), range.GetEnd(),
+                                               [](ScalarT end, const Range<ScalarT>& other) { return end < other.GetStart(); });
+
+        Range<ScalarT> merged_range = range;
+        if (first_it != last_it)
+        {
+            merged_range = Range<ScalarT>(std::min(first_it->GetStart(), range.GetStart()),
+                                          std::max(std::prev(last_it)->GetEnd(), range.GetEnd()));
+            for (auto range_it = first_it; range_it != last_it; ++range_it)
+            {
+                RemoveFromBucket(*range_it);
+            }
+        }
+
+        m_ranges.Add(range);
+        AddToBucket(merged_range);
+    }
+
+    void Remove(const Range<ScalarT>& range)
+    {
+        META_FUNCTION_TASK();
+        if (range.IsEmpty())
+            return;
+
+        // Free ranges overlapping with the removed range are cut, leaving their left and right parts free
+        const typename Ranges::BaseSet& ranges = m_ranges.GetRanges();
+        const auto first_it = std::ranges::upper_bound(ranges, range.GetStart(), std::less<ScalarT>(), &Range<ScalarT>::GetEnd);
+        const auto last_it  = std::lower_bound(first_it, ranges.end(), range.GetEnd(),
+                                               [](const Range<ScalarT>& other, ScalarT end) { return other.GetStart() < end; });
+        if (first_it == last_it)
+            return;
+
+        const Range<ScalarT> left_sub_range(first_it->GetStart(), std::max(first_it->GetStart(), range.GetStart()));
+        const Range<ScalarT> right_sub_range(std::min(std::prev(last_it)->GetEnd(), range.GetEnd()), std::prev(last_it)->GetEnd());
+        for (auto range_it = first_it; range_it != last_it; ++range_it)
+        {
+            RemoveFromBucket(*range_it);
+        }
+
+        m_ranges.Remove(range);
+        AddToBucket(left_sub_range);
+        AddToBucket(right_sub_range);
+    }
+
+    // Reserves range of the given length at the start of the smallest free range fitting it,
+    // to keep large free ranges for large reservations, or returns empty range when no free range fits
+    [[nodiscard]] Range<ScalarT> ReserveBestFit(ScalarT reserved_length)
+    {
+        META_FUNCTION_TASK();
+        if (!reserved_length)
+            return Range<ScalarT>();
+
+        const size_t bucket_index = GetBucketIndex(reserved_length);
+        const Bucket& bucket = m_buckets[bucket_index];
+        auto size_key_it = std::ranges::lower_bound(bucket, SizeKey{ reserved_length, ScalarT{} });
+        if (size_key_it == bucket.end())
+        {
+            // All ranges of the larger size-class buckets fit the reserved length, so the first range of the next bucket is the best fit
+            const size_t next_bucket_index = GetNextBucketIndex(bucket_index + 1U);
+            if (next_bucket_index == g_buckets_count)
+                return Range<ScalarT>();
+
+            size_key_it = m_buckets[next_bucket_index].begin();
+        }
+
+        const Range<ScalarT> reserved_range(size_key_it->start, size_key_it->start + reserved_length);
+        Remove(reserved_range);
+        return reserved_range;
+    }
+
+private:
+    static constexpr size_t g_sub_classes_bits  = 3U;
+    static constexpr size_t g_sub_classes_count = 1U << g_sub_classes_bits;
+    static constexpr size_t g_buckets_count     = (sizeof(ScalarT) * 8U - g_sub_classes_bits + 1U) * g_sub_classes_count;
+    static constexpr size_t g_mask_words_count  = (g_buckets_count + 63U) / 64U;
+
+    struct SizeKey
+    {
+        ScalarT length;
+        ScalarT start;
+
+        [[nodiscard]] friend auto operator<=>(const SizeKey& left, const SizeKey& right) noexcept = default;
+    };
+
+    using Bucket = std::vector<SizeKey>;
+
+    // Lengths less than sub-classes count are indexed exactly, larger lengths are indexed
+    // by the highest bit and the next sub-classes bits, which select linear sub-class of lengths
+    [[nodiscard]] static size_t GetBucketIndex(ScalarT length) noexcept
+    {
+        if (length < g_sub_classes_count)
+            return static_cast<size_t>(length);
+
+        const auto highest_bit = static_cast<size_t>(std::bit_width(length)) - 1U;
+        const auto sub_class   = static_cast<size_t>(length >> (highest_bit - g_sub_classes_bits)) - g_sub_classes_count;
+        return (highest_bit - g_sub_classes_bits + 1U) * g_sub_classes_count + sub_class;
+    }
+
+    // Returns index of the first non-empty bucket starting from the given index or buckets count when all of them are empty
+    [[nodiscard]] size_t GetNextBucketIndex(size_t bucket_index) const noexcept
+    {
+        for (size_t mask_index = bucket_index / 64U; mask_index < g_mask_words_count; ++mask_index)
+        {
+            const uint64_t mask_word = mask_index == bucket_index / 64U
+                                     ? m_buckets_mask[mask_index] & (~0ULL << (bucket_index % 64U))
+                                     : m_buckets_mask[mask_index];
+            if (mask_word)
+                return mask_index * 64U + static_cast<size_t>(std::countr_zero(mask_word));
+        }
+        return g_buckets_count;
+    }
+
+    void AddToBucket(const Range<ScalarT>& range)
+    {
+        if (range.IsEmpty())
+            return;
+
+        const size_t bucket_index = GetBucketIndex(range.GetLength());
+        Bucket& bucket = m_buckets[bucket_index];
+        const SizeKey size_key{ range.GetLength(), range.GetStart() };
+        bucket.insert(std::ranges::lower_bound(bucket, size_key), size_key);
+        m_buckets_mask[bucket_index / 64U] |= 1ULL << (bucket_index % 64U);
+    }
+
+    void RemoveFromBucket(const Range<ScalarT>& range)
+    {
+        const size_t bucket_index = GetBucketIndex(range.GetLength());
+        Bucket& bucket = m_buckets[bucket_index];
+        const auto size_key_it = std::ranges::lower_bound(bucket, SizeKey{ range.GetLength(), range.GetStart() });
+        assert(size_key_it != bucket.end() && size_key_it->start == range.GetStart());
+        bucket.erase(size_key_it);
+        if (bucket.empty())
+            m_buckets_mask[bucket_index / 64U] &= ~(1ULL << (bucket_index % 64U));
+    }
+
+    Ranges                                   m_ranges;
+    std::array<Bucket, g_buckets_count>      m_buckets;
+    std::array<uint64_t, g_mask_words_count> m_buckets_mask{ }; // bit is set for each non-empty bucket
+};
+
+} // namespace Methane::Data
@@ -19,7 +19,9 @@ limitations under the License.
 FILE: Methane/Data/RangeSet.hpp
 
 Set of ranges with operations of adding and removing a range with maintaining
-minimum number of continuous ranges by merging or splitting adjacent ranges in set
+minimum number of continuous ranges by merging or splitting adjacent ranges in set.
+Ranges are stored in a flat sorted vector, which keeps them contiguous in memory
+and lets bulk operations merge two range sets in one linear pass.
 
 ******************************************************************************/
 
@@ -30,7 +32,9 @@ minimum number of continuous ranges by merging or splitting adjacent ranges in s
 #include <Methane/Instrumentation.h>
 
 #include <set>
+#include <span>
 #include <vector>
+#include <algorithm>
 
 namespace Methane::Data
 {
@@ -39,12 +43,15 @@ template<typename ScalarT>
 class RangeSet
 {
 public:
-    using BaseSet  = std::set<Range<ScalarT>>;
+    using BaseSet  = std::vector<Range<ScalarT>>;
     using Iterator = typename BaseSet::iterator;
     using ConstIterator = typename BaseSet::const_iterator;
 
     RangeSet() = default;
-    RangeSet(std::initializer_list<Range<ScalarT>> init) noexcept : m_container(init) { } //NOSONAR - initializer list constructor is not explicit intentionally
+    RangeSet(std::initializer_list<Range<ScalarT>> init) //NOSONAR - initializer list constructor is not explicit intentionally
+    {
+        AddRanges(std::span<const Range<ScalarT>>(init.begin(), init.size()));
+    }
 
     [[nodiscard]] friend bool operator==(const RangeSet&, const RangeSet&) noexcept = default;
 
@@ -53,20 +60,30 @@ public:
         return left.m_container == right;
     }
 
-    RangeSet<ScalarT>& operator=(std::initializer_list<Range<ScalarT>> init) noexcept
+    [[nodiscard]] friend bool operator==(const RangeSet& left, const std::set<Range<ScalarT>>& right) noexcept
+    {
+        return std::ranges::equal(left.m_container, right);
+    }
+
+    RangeSet<ScalarT>& operator=(std::initializer_list<Range<ScalarT>> init)
     {
         META_FUNCTION_TASK();
-        for (const Range<ScalarT>& range : init)
-            Add(range);
+        AddRanges(std::span<const Range<ScalarT>>(init.begin(), init.size()));
         return *this;
     }
 
     [[nodiscard]] size_t Size() const noexcept              { return m_container.size();  }
     [[nodiscard]] bool   IsEmpty() const noexcept           { return m_container.empty(); }
-    [[nodiscard]] const BaseSet& GetRanges() const noexcept { return *this; }
+    [[nodiscard]] const BaseSet& GetRanges() const noexcept { return m_container; }
     [[nodiscard]] ConstIterator begin() const noexcept      { return m_container.begin(); }
     [[nodiscard]] ConstIterator end() const noexcept        { return m_container.end(); }
 
+    void Reserve(size_t ranges_count)
+    {
+        META_FUNCTION_TASK();
+        m_container.reserve(ranges_count);
+    }
+
     void Clear() noexcept
     {
         META_FUNCTION_TASK();
@@ -76,117 +93,221 @@ public:
     void Add(const Range<ScalarT>& range)
     {
         META_FUNCTION_TASK();
-        Range<ScalarT> merged_range(range);
-        const RangeOfRanges ranges = GetMergeableRanges(range);
-
-        Ranges remove_ranges;
-        for (auto range_it = ranges.first; range_it != ranges.second; ++range_it)
+        if (range.IsEmpty())
+            return;
+
+        // Ranges in [first_it, last_it) are overlapping or adjacent to the added range
+        const auto first_it = std::ranges::lower_bound(m_container, range.GetStart(), std::less<ScalarT>(), &Range<ScalarT>::GetEnd);
+        const auto last_it  = std::upper_bound(first_it, m_container.end(), range.GetEnd(),
+                                               [](ScalarT end, const Range<ScalarT>& other) { return end < other.GetStart(); });
+        if (first_it == last_it)
         {
-            merged_range = merged_range + *range_it;
-            remove_ranges.emplace_back(*range_it);
+            m_container.insert(first_it, range);
+            return;
         }
 
-        RemoveRanges(remove_ranges);
-        m_container.insert(merged_range);
+        *first_it = Range<ScalarT>(std::min(first_it->GetStart(), range.GetStart()),
+                                   std::max(std::prev(last_it)->GetEnd(), range.GetEnd()));
+        m_container.erase(std::next(first_it), last_it);
     }
 
     void Remove(const Range<ScalarT>& range)
     {
         META_FUNCTION_TASK();
-        Ranges remove_ranges;
-        Ranges add_ranges;
-        RangeOfRanges ranges = GetMergeableRanges(range);
-        for (auto range_it = ranges.first; range_it != ranges.second; ++range_it)
-        {
-            if (!range.IsOverlapping(*range_it))
-                continue;
+        if (range.IsEmpty())
+            return;
 
-            remove_ranges.push_back(*range_it);
+        // Ranges in [first_it, last_it) are overlapping with the removed range
+        const auto first_it = std::ranges::upper_bound(m_container, range.GetStart(), std::less<ScalarT>(), &Range<ScalarT>::GetEnd);
+        const auto last_it  = std::lower_bound(first_it, m_container.end(), range.GetEnd(),
+                                               [](const Range<ScalarT>& other, ScalarT end) { return other.GetStart() < end; });
+        if (first_it == last_it)
+            return;
 
-            if (range.Contains(*range_it))
-                continue;
-            
-            if (range_it->Contains(range))
-            {
-                if (const Range<ScalarT> left_sub_range(range_it->GetStart(), range.GetStart());
-                    !left_sub_range.IsEmpty())
-                {
-                    add_ranges.emplace_back(left_sub_range);
-                }
+        const Range<ScalarT> left_sub_range(first_it->GetStart(), std::max(first_it->GetStart(), range.GetStart()));
+        const Range<ScalarT> right_sub_range(std::min(std::prev(last_it)->GetEnd(), range.GetEnd()), std::prev(last_it)->GetEnd());
 
-                if (const Range<ScalarT> right_sub_range(range.GetEnd(), range_it->GetEnd());
-                    !right_sub_range.IsEmpty())
-                {
-                    add_ranges.emplace_back(right_sub_range);
-                }
-            }
-            else if (Range<ScalarT> trimmed_range = *range_it - range;
-                    !trimmed_range.IsEmpty())
+        auto write_it = first_it;
+        if (!left_sub_range.IsEmpty())
+            *write_it++ = left_sub_range;
+
+        if (!right_sub_range.IsEmpty())
+        {
+            if (write_it == last_it)
             {
-                add_ranges.emplace_back(trimmed_range);
+                // Single range was split in two parts by the removed range
+                m_container.insert(last_it, right_sub_range);
+                return;
             }
+            *write_it++ = right_sub_range;
         }
 
-        RemoveRanges(remove_ranges);
-        AddRanges(add_ranges);
+        m_container.erase(write_it, last_it);
     }
 
-private:
-    using RangeOfRanges = std::pair<ConstIterator, ConstIterator>;
+    // Adds ranges in one linear merge pass when they are sorted by start, otherwise falls back to sorting in place
+    void AddRanges(std::span<const Range<ScalarT>> ranges)
+    {
+        META_FUNCTION_TASK();
+        if (ranges.empty())
+            return;
+
+        const size_t orig_size = m_container.size();
+        m_container.resize(orig_size + ranges.size());
+
+        if (std::ranges::is_sorted(ranges, std::less<ScalarT>(), &Range<ScalarT>::GetStart))
+        {
+            // Merge sorted ranges from the back, so that original ranges are not overwritten before being read
+            auto orig_it  = m_container.begin() + static_cast<std::ptrdiff_t>(orig_size);
+            auto added_it = ranges.end();
+            auto write_it = m_container.end();
+            while (added_it != ranges.begin())
+            {
+                if (orig_it != m_container.begin() && std::prev(orig_it)->GetStart() > std::prev(added_it)->GetStart())
+                    *--write_it = *--orig_it;
+                else
+                    *--write_it = *--added_it;
+            }
+        }
+        else
+        {
+            std::ranges::copy(ranges, m_container.begin() + static_cast<std::ptrdiff_t>(orig_size));
+            std::ranges::sort(m_container, std::less<ScalarT>(), &Range<ScalarT>::GetStart);
+        }
 
-    [[nodiscard]]
-    RangeOfRanges GetMergeableRanges(const Range<ScalarT>& range)
+        MergeSortedRanges();
+    }
+
+    // Removes ranges in one linear pass when they are sorted and not overlapping, otherwise removes them one by one
+    void RemoveRanges(std::span<const Range<ScalarT>> ranges)
     {
         META_FUNCTION_TASK();
-        if (m_container.empty())
+        if (ranges.empty() || m_container.empty())
+            return;
+
+        if (std::ranges::adjacent_find(ranges, [](const Range<ScalarT>& left, const Range<ScalarT>& right)
+                                       { return left.GetEnd() > right.GetStart(); }) != ranges.end())
         {
-            return RangeOfRanges{ m_container.end(), m_container.end() };
+            for (const Range<ScalarT>& range : ranges)
+                Remove(range);
+            return;
         }
 
-        RangeOfRanges mergeable_ranges{
-            m_container.lower_bound(Range<ScalarT>(range.GetStart(), range.GetStart())),
-            m_container.upper_bound(range)
-        };
+        // Each removed range can split at most one original range in two, so the result fits in the extended container.
+        // Result is written from the back, where it never overwrites original ranges which were not read yet.
+        const size_t orig_size = m_container.size();
+        m_container.resize(orig_size + ranges.size());
+        auto orig_it    = m_container.begin() + static_cast<std::ptrdiff_t>(orig_size);
+        auto removed_it = ranges.end();
+        auto write_it   = m_container.end();
+        while (orig_it != m_container.begin())
+        {
+            const Range<ScalarT> orig_range = *--orig_it;
+            ScalarT orig_end = orig_range.GetEnd();
+            while (removed_it != ranges.begin() && std::prev(removed_it)->GetStart() >= orig_range.GetEnd())
+                --removed_it;
 
-        if (mergeable_ranges.first != m_container.begin())
-            mergeable_ranges.first--;
+            while (removed_it != ranges.begin() && std::prev(removed_it)->GetEnd() > orig_range.GetStart())
+            {
+                const Range<ScalarT>& removed_range = *std::prev(removed_it);
+                if (removed_range.IsEmpty())
+                {
+                    --removed_it;
+                    continue;
+                }
 
-        while (mergeable_ranges.first != m_container.end() && !range.IsMergeable(*mergeable_ranges.first))
-            mergeable_ranges.first++;
+                if (removed_range.GetEnd() < orig_end)
+                    *--write_it = Range<ScalarT>(removed_range.GetEnd(), orig_end);
 
-        if (mergeable_ranges.first == m_container.end())
-            return RangeOfRanges(m_container.end(), m_container.end());
+                orig_end = std::max(orig_range.GetStart(), std::min(orig_end, removed_range.GetStart()));
+                if (removed_range.GetStart() <= orig_range.GetStart())
+                    break; // removed range may still overlap with previous original ranges
 
-        while (mergeable_ranges.second != mergeable_ranges.first &&
-              (mergeable_ranges.second == m_container.end() || !range.IsMergeable(*mergeable_ranges.second)))
-        {
-            mergeable_ranges.second--;
+                --removed_it;
+            }
+
+            if (orig_range.GetStart() < orig_end)
+                *--write_it = Range<ScalarT>(orig_range.GetStart(), orig_end);
         }
-        mergeable_ranges.second++;
 
-        return mergeable_ranges;
+        const auto result_it = std::move(write_it, m_container.end(), m_container.begin());
+        m_container.erase(result_it, m_container.end());
+    }
+
+    void Union(const RangeSet& other)
+    {
+        META_FUNCTION_TASK();
+        if (&other == this)
+            return;
+
+        AddRanges(other.m_container);
     }
 
-    using Ranges = std::vector<Range<ScalarT>>;
-    inline void RemoveRanges(const Ranges& delete_ranges) noexcept
+    void Intersect(const RangeSet& other)
     {
         META_FUNCTION_TASK();
-        for (const Range<ScalarT>& delete_range : delete_ranges)
+        if (&other == this || m_container.empty())
+            return;
+
+        if (other.IsEmpty())
         {
-            m_container.erase(delete_range);
+            m_container.clear();
+            return;
         }
+
+        // Intersection is written from the back in the same way as in RemoveRanges:
+        // each range of other set splits at most one more original range
+        const size_t orig_size = m_container.size();
+        m_container.resize(orig_size + other.Size());
+        auto orig_it  = m_container.begin() + static_cast<std::ptrdiff_t>(orig_size);
+        auto other_it = other.end();
+        auto write_it = m_container.end();
+        while (orig_it != m_container.begin() && other_it != other.begin())
+        {
+            const Range<ScalarT> orig_range = *--orig_it;
+            while (other_it != other.begin() && std::prev(other_it)->GetStart() >= orig_range.GetEnd())
+                --other_it;
+
+            while (other_it != other.begin() && std::prev(other_it)->GetEnd() > orig_range.GetStart())
+            {
+                const Range<ScalarT>& other_range = *std::prev(other_it);
+                *--write_it = Range<ScalarT>(std::max(orig_range.GetStart(), other_range.GetStart()),
+                                             std::min(orig_range.GetEnd(), other_range.GetEnd()));
+                if (other_range.GetStart() <= orig_range.GetStart())
+                    break; // other range may still overlap with previous original ranges
+
+                --other_it;
+            }
+        }
+
+        const auto result_it = std::move(write_it, m_container.end(), m_container.begin());
+        m_container.erase(result_it, m_container.end());
     }
 
-    inline void AddRanges(const Ranges& add_ranges)
+private:
+    // Merges overlapping and adjacent ranges of the container sorted by range start and drops empty ranges
+    void MergeSortedRanges() noexcept
     {
         META_FUNCTION_TASK();
-        for(const Range<ScalarT>& add_range : add_ranges)
+        auto write_it = m_container.begin();
+        for (auto read_it = m_container.begin(); read_it != m_container.end(); ++read_it)
         {
-            m_container.insert(add_range);
+            if (read_it->IsEmpty())
+                continue;
+
+            if (write_it != m_container.begin() && std::prev(write_it)->GetEnd() >= read_it->GetStart())
+            {
+                if (std::prev(write_it)->GetEnd() < read_it->GetEnd())
+                    *std::prev(write_it) = Range<ScalarT>(std::prev(write_it)->GetStart(), read_it->GetEnd());
+                continue;
+            }
+
+            *write_it++ = *read_it;
         }
+        m_container.erase(write_it, m_container.end());
     }
 
-    std::set<Range<ScalarT>> m_container;
+    BaseSet m_container;
 };
 
 } // namespace Methane::Data
@@ -0,0 +1,124 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FlatMap.hpp
+Associative container with key-value pairs stored in the vector sorted by key.
+
+******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
+namespace Methane::Data
+{
+
+// Map with std::map-like interface storing key-value pairs contiguously in the vector sorted by key:
+// it does not allocate memory per element, iterates linearly in cache and keeps capacity on erase and clear,
+// but element insertion and erase invalidate iterators and references to other elements.
+template<typename K, typename V, typename C = std::less<K>>
+class FlatMap
+{
+public:
+    using key_type       = K;
+    using mapped_type    = V;
+    using key_compare    = C;
+    using value_type     = std::pair<K, V>;
+    using Storage        = std::vector<value_type>;
+    using size_type      = typename Storage::size_type;
+    using iterator       = typename Storage::iterator;
+    using const_iterator = typename Storage::const_iterator;
+
+    FlatMap() = default;
+
+    template<typename InputIt>
+    FlatMap(InputIt first, InputIt last)
+    {
+        for(; first != last; ++first)
+            try_emplace(first->first, first->second);
+    }
+
+    [[nodiscard]] friend bool operator==(const FlatMap& left, const FlatMap& right) = default;
+
+    [[nodiscard]] bool      empty() const noexcept    { return m_storage.empty(); }
+    [[nodiscard]] size_type size() const noexcept     { return m_storage.size(); }
+    [[nodiscard]] size_type capacity() const noexcept { return m_storage.capacity(); }
+
+    [[nodiscard]] iterator       begin() noexcept       { return m_storage.begin(); }
+    [[nodiscard]] iterator       end() noexcept         { return m_storage.end(); }
+    [[nodiscard]] const_iterator begin() const noexcept { return m_storage.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept   { return m_storage.end(); }
+
+    void reserve(size_type capacity) { m_storage.reserve(capacity); }
+    void clear() noexcept            { m_storage.clear(); }
+
+    [[nodiscard]] iterator find(const K& key)
+    {
+        const iterator it = LowerBound(key);
+        return it != m_storage.end() && !C{}(key, it->first) ? it : m_storage.end();
+    }
+
+    [[nodiscard]] const_iterator find(const K& key) const
+    {
+        const const_iterator it = LowerBound(key);
+        return it != m_storage.end() && !C{}(key, it->first) ? it : m_storage.end();
+    }
+
+    [[nodiscard]] bool contains(const K& key) const { return find(key) != m_storage.end(); }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        const iterator it = LowerBound(key);
+        if (it != m_storage.end() && !C{}(key, it->first))
+            return { it, false };
+
+        return { m_storage.emplace(it, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)), true };
+    }
+
+    iterator erase(const_iterator it) { return m_storage.erase(it); }
+
+    size_type erase(const K& key)
+    {
+        const const_iterator it = std::as_const(*this).find(key);
+        if (it == m_storage.cend())
+            return 0U;
+
+        m_storage.erase(it);
+        return 1U;
+    }
+
+private:
+    iterator LowerBound(const K& key)
+    {
+        return std::ranges::lower_bound(m_storage, key, C{}, &value_type::first);
+    }
+
+    const_iterator LowerBound(const K& key) const
+    {
+        return std::ranges::lower_bound(m_storage, key, C{}, &value_type::first);
+    }
+
+    Storage m_storage;
+};
+
+} // namespace Methane::Data
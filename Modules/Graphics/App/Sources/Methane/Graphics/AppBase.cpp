@@ -27,6 +27,7 @@ Base implementation of the Methane graphics application.
 #include <Methane/Graphics/RHI/System.h>
 #include <Methane/Graphics/RHI/RenderState.h>
 #include <Methane/Data/IProvider.h>
+#include <Methane/Data/EventQueue.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
@@ -65,11 +66,19 @@ AppBase::AppBase(const CombinedAppSettings& settings, Data::IProvider& textures_
              [this](int64_t is_direct) { m_initial_context_settings.options_mask.SetBit(Rhi::ContextOption::TransferWithD3D12DirectQueue, is_direct); },
              "Transfer command lists and queues use DIRECT instead of COPY type in DX API");
 #endif
+    add_flag("--async-pipelines",
+             [this](int64_t is_async) { m_initial_context_settings.options_mask.SetBit(Rhi::ContextOption::AsyncPipelineCreation, is_async); },
+             "Asynchronous pipelines creation with skipping draw calls until pipelines are ready (Vulkan only)");
+
+    // Deferred events are emitted in batch on every application update
+    Data::EventQueue::GetDefault().SetActive(true);
 }
 
 AppBase::~AppBase()
 {
     META_FUNCTION_TASK();
+    Data::EventQueue::GetDefault().SetActive(false);
+
     if (m_context.IsInitialized())
     {
         // Prevent OnContextReleased callback emitting during application destruction
@@ -213,6 +222,9 @@ bool AppBase::Resize(const FrameSize& frame_size, bool is_minimized)
 bool AppBase::Update()
 {
     META_FUNCTION_TASK();
+    // Deferred events, including ones emitted from GPU completion threads, are emitted to receivers on main thread once per update
+    Data::EventQueue::GetDefault().Flush();
+
     if (Platform::App::IsMinimized())
         return false;
 
@@ -24,6 +24,7 @@ Mesh buffers base implementation class.
 #pragma once
 
 #include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Graphics/RHI/IRenderCommandList.h>
 #include <Methane/Graphics/RHI/Buffer.h>
 #include <Methane/Graphics/RHI/BufferSet.h>
 #include <Methane/Graphics/RHI/ProgramBindings.h>
@@ -91,6 +92,17 @@ public:
               Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
               uint32_t first_instance_index = 0U, bool retain_bindings_once = false, bool set_resource_barriers = true) const;
 
+    // Draw instances with shared program bindings in one multi-draw call, where consecutive instances
+    // of the same mesh subset are merged in one instanced draw, so per-instance data is addressed by instance index in shaders
+    void DrawInstanced(const Rhi::RenderCommandList& cmd_list,
+                       const Rhi::ProgramBindings& program_bindings,
+                       uint32_t instance_count, uint32_t first_instance_index = 0U,
+                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                       bool set_resource_barriers = true) const;
+
+    // Multi-draw arguments of instanced draw, which can be also written to the indirect arguments buffer
+    [[nodiscard]] std::vector<Rhi::DrawIndexedArguments> GetInstancedDrawArguments(uint32_t instance_count, uint32_t first_instance_index = 0U) const;
+
     void DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
                       const InstancedProgramBindings& instance_program_bindings,
                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
@@ -28,7 +28,6 @@ Mesh buffers base implementation class.
 #include <Methane/Graphics/TypeConverters.hpp>
 #include <Methane/Instrumentation.h>
 
-#include <taskflow/algorithm/for_each.hpp>
 #include <fmt/format.h>
 
 namespace Methane::Graphics
@@ -136,6 +135,22 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
     cmd_list.SetVertexBuffers(GetVertexBuffers(), set_resource_barriers);
     cmd_list.SetIndexBuffer(GetIndexBuffer(), set_resource_barriers);
 
+    // Resource state barriers of all instance program bindings are set in one batch before drawing,
+    // instead of setting barriers separately on application of each program bindings
+    if (bindings_apply_behavior.HasAnyBit(Rhi::ProgramBindingsApplyBehavior::StateBarriers))
+    {
+        Refs<Rhi::IProgramBindings> program_bindings_refs;
+        program_bindings_refs.reserve(static_cast<size_t>(std::distance(instance_program_bindings_begin, instance_program_bindings_end)));
+        for (ProgramBindingsIteratorType instance_program_bindings_it = instance_program_bindings_begin;
+             instance_program_bindings_it != instance_program_bindings_end;
+             ++instance_program_bindings_it)
+        {
+            program_bindings_refs.emplace_back(instance_program_bindings_it->GetInterface());
+        }
+        cmd_list.SetProgramBindingsResourceBarriers(program_bindings_refs);
+        bindings_apply_behavior.SetBitOff(Rhi::ProgramBindingsApplyBehavior::StateBarriers);
+    }
+
     for (ProgramBindingsIteratorType instance_program_bindings_it = instance_program_bindings_begin;
          instance_program_bindings_it != instance_program_bindings_end;
          ++instance_program_bindings_it)
@@ -161,33 +176,75 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
     }
 }
 
+void MeshBuffersBase::DrawInstanced(const Rhi::RenderCommandList& cmd_list,
+                                    const Rhi::ProgramBindings& program_bindings,
+                                    uint32_t instance_count, uint32_t first_instance_index,
+                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                                    bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE(program_bindings.IsInitialized());
+
+    const std::vector<Rhi::DrawIndexedArguments> draw_arguments = GetInstancedDrawArguments(instance_count, first_instance_index);
+    cmd_list.SetProgramBindings(program_bindings, bindings_apply_behavior);
+    cmd_list.SetVertexBuffers(GetVertexBuffers(), set_resource_barriers);
+    cmd_list.SetIndexBuffer(GetIndexBuffer(), set_resource_barriers);
+    cmd_list.MultiDrawIndexed(Rhi::RenderPrimitive::Triangle, draw_arguments);
+}
+
+std::vector<Rhi::DrawIndexedArguments> MeshBuffersBase::GetInstancedDrawArguments(uint32_t instance_count, uint32_t first_instance_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(instance_count, "can not draw zero instances");
+
+    std::vector<Rhi::DrawIndexedArguments> draw_arguments;
+    Opt<uint32_t> last_subset_index_opt;
+    const uint32_t end_instance_index = first_instance_index + instance_count;
+    for (uint32_t instance_index = first_instance_index; instance_index < end_instance_index; ++instance_index)
+    {
+        const uint32_t subset_index = GetSubsetByInstanceIndex(instance_index);
+        if (last_subset_index_opt == subset_index)
+        {
+            draw_arguments.back().instance_count++;
+            continue;
+        }
+
+        META_CHECK_LESS(subset_index, m_mesh_subsets.size());
+        const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
+        last_subset_index_opt = subset_index;
+
+        draw_arguments.push_back(Rhi::DrawIndexedArguments{
+            .index_count    = mesh_subset.indices.count,
+            .instance_count = 1U,
+            .start_index    = mesh_subset.indices.offset,
+            .start_vertex   = mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
+            .start_instance = instance_index
+        });
+    }
+    return draw_arguments;
+}
+
 void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
                                    const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
                                    bool retain_bindings_once, bool set_resource_barriers) const
 {
     META_FUNCTION_TASK();
-    const std::vector<Rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
-    const auto instances_count_per_command_list = static_cast<uint32_t>(Data::DivCeil(instance_program_bindings.size(), render_cmd_lists.size()));
-
-    tf::Taskflow render_task_flow;
-    render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
-        [this, &render_cmd_lists, instances_count_per_command_list, &instance_program_bindings,
-        bindings_apply_behavior, retain_bindings_once, set_resource_barriers](const uint32_t cmd_list_index)
+    // Instances are distributed between thread command lists in contiguous ranges balanced by the count of drawn indices
+    parallel_cmd_list.DrawParallel(static_cast<Data::Size>(instance_program_bindings.size()),
+        [this, &instance_program_bindings, bindings_apply_behavior, retain_bindings_once, set_resource_barriers]
+        (const Rhi::RenderCommandList& render_cmd_list, const Rhi::ParallelRenderCommandList::DrawRange& instances_range)
         {
-            const Rhi::RenderCommandList& render_cmd_list = render_cmd_lists[cmd_list_index];
-            const uint32_t begin_instance_index = cmd_list_index * instances_count_per_command_list;
-            const uint32_t end_instance_index = std::min(begin_instance_index + instances_count_per_command_list,
-                                                         static_cast<uint32_t>(instance_program_bindings.size()));
-
             Draw(render_cmd_list,
-                 instance_program_bindings.begin() + begin_instance_index,
-                 instance_program_bindings.begin() + end_instance_index,
-                 bindings_apply_behavior, begin_instance_index,
+                 instance_program_bindings.begin() + instances_range.GetStart(),
+                 instance_program_bindings.begin() + instances_range.GetEnd(),
+                 bindings_apply_behavior, instances_range.GetStart(),
                  retain_bindings_once, set_resource_barriers);
-        }
-    );
-    m_context.GetParallelExecutor().run(render_task_flow).get();
+        },
+        [this](Data::Index instance_index)
+        {
+            return m_mesh_subsets[GetSubsetByInstanceIndex(instance_index)].indices.count;
+        });
 }
 
 } // namespace Methane::Graphics
@@ -0,0 +1,131 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/BindlessDescriptorTable.h
+Backend-agnostic table of global bindless descriptor arrays with resource views
+registered once and referenced in shaders by their indices.
+
+******************************************************************************/
+
+#pragma once
+
+#include "FrameRetireQueue.h"
+
+#include <Methane/Graphics/RHI/ResourceView.h>
+#include <Methane/Graphics/RHI/IResource.h>
+
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <array>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Base
+{
+
+struct BindlessDescriptorTableSettings
+{
+    uint32_t buffers_count       = 16384U; // capacity of the global descriptor array of buffers
+    uint32_t textures_count      = 16384U; // capacity of the global descriptor array of textures
+    uint32_t samplers_count      = 1024U;  // capacity of the global descriptor array of samplers
+    uint32_t retire_frames_count = 3U;     // frames count before index of the removed view is reused, not less than frame buffers count
+};
+
+struct BindlessDescriptorTableStatistics
+{
+    uint32_t views_count   = 0U; // number of registered resource views
+    uint32_t retired_count = 0U; // number of descriptors of removed views, which still may be used by GPU
+    uint32_t writes_count  = 0U; // number of descriptors written on views registration
+    uint32_t reused_count  = 0U; // number of views registrations served with already written descriptor
+
+    [[nodiscard]] friend bool operator==(const BindlessDescriptorTableStatistics& left, const BindlessDescriptorTableStatistics& right) noexcept = default;
+};
+
+class BindlessDescriptorTable
+{
+public:
+    using Settings   = BindlessDescriptorTableSettings;
+    using Statistics = BindlessDescriptorTableStatistics;
+
+    explicit BindlessDescriptorTable(const Settings& settings = {});
+    virtual ~BindlessDescriptorTable() = default;
+
+    BindlessDescriptorTable(const BindlessDescriptorTable&) = delete;
+    BindlessDescriptorTable(BindlessDescriptorTable&&) = delete;
+    BindlessDescriptorTable& operator=(const BindlessDescriptorTable&) = delete;
+    BindlessDescriptorTable& operator=(BindlessDescriptorTable&&) = delete;
+
+    // Returns index of the view descriptor in the global array of its resource type,
+    // descriptor is written only on the first registration of the view and reused by the next ones
+    [[nodiscard]] uint32_t AddResourceView(const Rhi::ResourceView& resource_view);
+    void RemoveResourceView(const Rhi::ResourceView& resource_view);
+
+    // Indices of removed views are reused only after the retire frames count has passed or when GPU is idle
+    void CompleteFrame();
+    void CompleteAllFrames();
+    void SetRetireFramesCount(uint32_t retire_frames_count);
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept { return m_settings; }
+    [[nodiscard]] uint32_t        GetCapacity(Rhi::ResourceType resource_type) const noexcept;
+    [[nodiscard]] Statistics      GetStatistics() const;
+
+protected:
+    // BindlessDescriptorTable interface of the native descriptor arrays
+    virtual void WriteDescriptor(Rhi::ResourceType resource_type, uint32_t index, const Rhi::ResourceView& resource_view) = 0;
+
+private:
+    struct ViewKey
+    {
+        const Rhi::IResource*     resource_ptr; // resource is alive while its view is registered by argument bindings
+        Rhi::ResourceViewSettings settings;
+
+        [[nodiscard]] friend auto operator<=>(const ViewKey& left, const ViewKey& right) noexcept = default;
+    };
+
+    struct ViewEntry
+    {
+        Rhi::ResourceType resource_type;
+        uint32_t          index;
+        uint32_t          references_count;
+    };
+
+    struct DescriptorArray
+    {
+        uint32_t                   capacity;
+        uint32_t                   allocated_count = 0U;
+        std::vector<uint32_t>      free_indices;
+        FrameRetireQueue<uint32_t> retired_indices;
+    };
+
+    using DescriptorArrays = std::array<DescriptorArray, 3U>; // indexed by Rhi::ResourceType
+
+    [[nodiscard]] DescriptorArray& GetDescriptorArray(Rhi::ResourceType resource_type);
+    [[nodiscard]] uint32_t AllocateIndex(Rhi::ResourceType resource_type);
+
+    Settings                     m_settings;
+    DescriptorArrays             m_descriptor_arrays;
+    std::map<ViewKey, ViewEntry> m_entry_by_view;
+    FrameRetireCounter           m_frame_counter;
+    uint32_t                     m_writes_count = 0U;
+    uint32_t                     m_reused_count = 0U;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
@@ -48,6 +48,10 @@ public:
     Rhi::ResourceView GetBufferView(Data::Size offset, Data::Size size) final;
     void              SetData(Rhi::ICommandQueue&, const SubResource& sub_resource) override;
 
+    // Buffer interface: persistent mapping of the managed buffer memory, which stays mapped until buffer is released
+    virtual Data::RawPtr GetMappedDataPtr();
+    virtual void         FlushMappedData(const BytesRange&) { /* mapped memory is coherent by default */ }
+
 private:
     Settings m_settings;
 };
@@ -38,6 +38,7 @@ Base implementation of the command list interface.
 #endif
 
 #include <stack>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 
@@ -48,6 +49,42 @@ class CommandQueue;
 class ProgramBindings;
 class CommandListDebugGroup;
 
+struct StateCommandCounters
+{
+    uint32_t issued_count   = 0U;
+    uint32_t filtered_count = 0U;
+
+    void Count(bool is_filtered) noexcept
+    {
+        if (is_filtered)
+            filtered_count++;
+        else
+            issued_count++;
+    }
+};
+
+// Counters of state setting commands issued to the native command list or filtered as redundant since the last reset
+struct StateFilteringStatistics
+{
+    StateCommandCounters program_bindings;
+    StateCommandCounters render_state;
+    StateCommandCounters view_state;
+    StateCommandCounters vertex_buffers;
+    StateCommandCounters index_buffer;
+
+    [[nodiscard]] uint32_t GetIssuedCount() const noexcept
+    {
+        return program_bindings.issued_count + render_state.issued_count + view_state.issued_count +
+               vertex_buffers.issued_count + index_buffer.issued_count;
+    }
+
+    [[nodiscard]] uint32_t GetFilteredCount() const noexcept
+    {
+        return program_bindings.filtered_count + render_state.filtered_count + view_state.filtered_count +
+               vertex_buffers.filtered_count + index_buffer.filtered_count;
+    }
+};
+
 class CommandList // NOSONAR - custom destructor is used for logging, class has more than 35 methods
     : public Object
     , public virtual Rhi::ICommandList // NOSONAR
@@ -63,7 +100,16 @@ public:
         // Raw pointer is used for program bindings instead of smart pointer for performance reasons
         // to get rid of shared_from_this() overhead required to acquire smart pointer from reference
         const ProgramBindings* program_bindings_ptr = nullptr;
-        Ptrs<Object>           retained_resources;
+
+        // Resources are retained by command list only once until execution completion: retained objects are deduplicated
+        // with open addressing hash table of object pointers kept per command list, so that repeated binding of the same resources
+        // does not grow retained resources and does not touch their reference counters, even when the same resources are used
+        // by other command lists, while the table capacity is reused after release, so that binding does not allocate memory
+        Ptrs<Object>               retained_resources;
+        std::vector<const Object*> retained_objects_table; // power of two size with null pointers in free slots
+
+        // Non-empty resource barriers were encoded since reset, so command list must be executed to keep resource states valid
+        bool has_resource_barriers = false;
     };
 
     CommandList(CommandQueue& command_queue, Type type);
@@ -77,6 +123,7 @@ public:
     void  Reset(IDebugGroup* debug_group_ptr = nullptr) override;
     void  ResetOnce(IDebugGroup* debug_group_ptr = nullptr) final;
     void  SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) override;
+    void  SetProgramBindingsResourceBarriers(const Refs<Rhi::IProgramBindings>& program_bindings_refs) override;
     void  Commit() override;
     void  WaitUntilCompleted(uint32_t timeout_ms = 0U) override;
     Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const override;
@@ -94,11 +141,22 @@ public:
     CommandQueue&          GetBaseCommandQueue();
     const CommandQueue&    GetBaseCommandQueue() const;
     const ProgramBindings* GetProgramBindingsPtr() const noexcept { return GetCommandState().program_bindings_ptr; }
+    const StateFilteringStatistics& GetStateFilteringStatistics() const noexcept { return m_state_filtering_statistics; }
     Ptr<CommandList>       GetCommandListPtr()                    { return GetPtr<CommandList>(); }
 
-    inline void RetainResource(const Ptr<Object>& resource_ptr)   { if (resource_ptr) m_command_state.retained_resources.emplace_back(resource_ptr); }
-    inline void RetainResource(Object& resource)                  { m_command_state.retained_resources.emplace_back(resource.GetBasePtr()); }
-    inline void ReleaseRetainedResources()                        { m_command_state.retained_resources.clear(); }
+    inline void RetainResource(const Ptr<Object>& resource_ptr)
+    {
+        if (resource_ptr && AddRetainedObject(*resource_ptr))
+            m_command_state.retained_resources.emplace_back(resource_ptr);
+    }
+
+    inline void RetainResource(Object& resource)
+    {
+        if (AddRetainedObject(resource))
+            m_command_state.retained_resources.emplace_back(resource.GetBasePtr());
+    }
+
+    void ReleaseRetainedResources();
 
     template<typename T> requires std::is_base_of_v<Object, T>
     inline void RetainResources(const Ptrs<T>& resource_ptrs)
@@ -111,8 +169,9 @@ protected:
     virtual void ResetCommandState();
     virtual void ApplyProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior);
 
-    CommandState&       GetCommandState()        { return m_command_state; }
-    const CommandState& GetCommandState() const  { return m_command_state; }
+    CommandState&             GetCommandState()                      { return m_command_state; }
+    const CommandState&       GetCommandState() const                { return m_command_state; }
+    StateFilteringStatistics& GetStateFilteringStatistics() noexcept { return m_state_filtering_statistics; }
 
     void SetCommandListState(State state);
     void SetCommandListStateNoLock(State state);
@@ -130,13 +189,18 @@ private:
     using DebugGroupStack  = std::stack<Ptr<DebugGroup>>;
 
     void CompleteInternal();
-
-    const Type        m_type;
-    Ptr<CommandQueue> m_command_queue_ptr;
-    CommandState      m_command_state;
-    DebugGroupStack   m_open_debug_groups;
-    CompletedCallback m_completed_callback;
-    State             m_state = State::Pending;
+    void FlushBatchedResourceBarriers();
+    bool AddRetainedObject(const Object& object); // returns false when object is already retained
+    void GrowRetainedObjectsTable();
+
+    const Type               m_type;
+    Ptr<CommandQueue>        m_command_queue_ptr;
+    CommandState             m_command_state;
+    StateFilteringStatistics m_state_filtering_statistics;
+    DebugGroupStack          m_open_debug_groups;
+    CompletedCallback        m_completed_callback;
+    Ptr<Rhi::IResourceBarriers> m_batched_resource_barriers_ptr;
+    State                    m_state = State::Pending;
 
     mutable TracyLockable(std::recursive_mutex, m_state_mutex);
     TracyLockable(std::mutex,   m_state_change_mutex);
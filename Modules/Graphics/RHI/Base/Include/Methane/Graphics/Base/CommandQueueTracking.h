@@ -28,11 +28,10 @@ Base implementation of the command queue with execution tracking.
 #include <Methane/Instrumentation.h>
 
 #include <optional>
-#include <queue>
+#include <array>
 #include <thread>
 #include <mutex>
 #include <atomic>
-#include <condition_variable>
 #include <exception>
 
 namespace Methane::Graphics::Rhi
@@ -67,46 +66,57 @@ public:
     Ptr<CommandListSet> GetLastExecutingCommandListSet() const;
     const Ptr<Rhi::ITimestampQueryPool>& GetTimestampQueryPoolPtr() final;
 
-protected:
-    using CommandListSetsQueue = std::queue<Ptr<CommandListSet>>;
-
-    template<bool const_access, typename MutexType>
-    class CommandListSetsQueueGuard
-    {
-    public:
-        using CommandListSetsQueueType = std::conditional_t<const_access, const CommandListSetsQueue, CommandListSetsQueue>;
-        CommandListSetsQueueGuard(CommandListSetsQueueType& executing_command_lists, MutexType& mutex)
-            : m_lock_guard(mutex)
-            , m_command_lists_queue(executing_command_lists)
-        { }
-
-        CommandListSetsQueueType& GetCommandListsQueue() const noexcept { return m_command_lists_queue; }
-
-    private:
-        std::scoped_lock<MutexType> m_lock_guard;
-        CommandListSetsQueueType&   m_command_lists_queue;
-    };
+    // Executing command list sets ring buffer has fixed capacity, Execute waits for completion of the oldest set when it is full
+    static constexpr uint32_t executing_command_list_sets_capacity = 256U;
 
-    decltype(auto) GetExecutingCommandListsGuard() const
+protected:
+    // Iterates executing command list sets from the oldest to the newest one,
+    // called on the executing thread only, which is synchronized with Execute but not with the completion thread
+    template<typename FuncType>
+    void ForEachExecutingCommandListSet(FuncType&& func) const
     {
-        return CommandListSetsQueueGuard<true, decltype(m_executing_command_lists_mutex)>(m_executing_command_lists, m_executing_command_lists_mutex);
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_executing_command_lists_mutex);
+        const uint64_t sets_end = m_executing_sets_push_index.load(std::memory_order_relaxed);
+        for(uint64_t set_index = m_executing_sets_pop_index.load(std::memory_order_acquire); set_index < sets_end; ++set_index)
+        {
+            const CommandListSet& command_list_set = *GetExecutingCommandListSetPtr(set_index);
+            func(command_list_set);
+        }
     }
 
+    // Called on the completion thread only, pops the completed command list set from the executing sets ring buffer
     virtual void CompleteCommandListSetExecution(CommandListSet& executing_command_list_set);
 
     void ShutdownQueueExecution();
 
 private:
+    using CommandListSetPtrs = std::array<Ptr<CommandListSet>, executing_command_list_sets_capacity>;
+
     void InitializeTimestampQueryPool();
     void CompleteExecutionSafely();
     void WaitForExecution() noexcept;
+    void WaitForExecutionSignal(uint32_t execution_signal) const;
+    void WaitForCompletionSignal(uint32_t completion_signal) const;
+    void ReleaseCompletedCommandListSets();
+    uint64_t GetLeadingFrameCommandListSetsEnd(const Opt<Data::Index>& frame_index) const;
 
-    const Ptr<CommandListSet>& GetNextExecutingCommandListSet() const;
+    const Ptr<CommandListSet>& GetExecutingCommandListSetPtr(uint64_t set_index) const noexcept
+    {
+        return m_executing_command_list_sets[set_index % executing_command_list_sets_capacity];
+    }
 
-    CommandListSetsQueue                  m_executing_command_lists;
+    // Single-producer/single-consumer ring buffer of executing command list sets:
+    // sets are pushed by the executing thread under mutex, which is never locked by the completion thread,
+    // completed sets are popped by the completion thread without locks and released later by the executing thread.
+    // Execution and completion signals are incremented with every push/pop and used for futex-based waiting.
+    CommandListSetPtrs                    m_executing_command_list_sets;
+    std::atomic<uint64_t>                 m_executing_sets_push_index{ 0U };
+    std::atomic<uint64_t>                 m_executing_sets_pop_index{ 0U };
+    uint64_t                              m_executing_sets_release_index{ 0U };
+    std::atomic<uint32_t>                 m_execution_signal{ 0U };
+    std::atomic<uint32_t>                 m_completion_signal{ 0U };
     mutable TracyLockable(std::mutex,     m_executing_command_lists_mutex);
-    TracyLockable(std::mutex,             m_execution_waiting_mutex);
-    std::condition_variable_any           m_execution_waiting_condition_var;
     std::atomic<bool>                     m_execution_waiting{ true };
     std::thread                           m_execution_waiting_thread;
     std::exception_ptr                    m_execution_waiting_exception_ptr;
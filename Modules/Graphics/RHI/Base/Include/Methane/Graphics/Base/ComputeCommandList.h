@@ -44,7 +44,7 @@ public:
     // IComputeCommandList interface
     void ResetWithState(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr = nullptr) final;
     void ResetWithStateOnce(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr = nullptr) final;
-    void SetComputeState(Rhi::IComputeState& compute_state) final;
+    void SetComputeState(Rhi::IComputeState& compute_state) override;
     void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
 
     ComputeState& GetComputeState();
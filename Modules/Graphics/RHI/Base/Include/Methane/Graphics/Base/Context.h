@@ -29,10 +29,14 @@ Base implementation of the context interface.
 #include <Methane/Graphics/RHI/IContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Instrumentation.h>
 
 #include <magic_enum/magic_enum.hpp>
 #include <array>
+#include <atomic>
 #include <string>
+#include <vector>
+#include <mutex>
 
 namespace tf
 {
@@ -55,6 +59,9 @@ namespace Methane::Graphics::Base
 
 class Device;
 class CommandQueue;
+class TransientBuffer;
+class BindlessDescriptorTable;
+struct BindlessDescriptorTableSettings;
 
 class Context
     : public Object
@@ -83,6 +90,9 @@ public:
     Rhi::ICommandKit&           GetDefaultCommandKit(Rhi::ICommandQueue& cmd_queue) const final;
     const Rhi::IDevice&         GetDevice() const final;
     bool                        UploadResources() const override;
+    Data::Size                  GetRootConstantsUploadedSize() const noexcept override  { return m_root_constants_uploaded_size; }
+    Rhi::ITransientBuffer&      GetTransientBuffer() const final;
+    Rhi::PipelineCacheStatistics GetPipelineCacheStatistics() const noexcept override   { return {}; }
 
     // Context interface
     virtual void Initialize(Device& device, bool is_callback_emitted = true);
@@ -97,22 +107,42 @@ public:
     const Device&            GetBaseDevice() const;
     Rhi::IDescriptorManager& GetDescriptorManager() const;
 
+    void AddRootConstantsUploadedSize(Data::Size uploaded_size) noexcept { m_root_constants_uploading_size += uploaded_size; }
+
+    // All transient buffers created with context are recycled on frame completion
+    void AddTransientBuffer(TransientBuffer& transient_buffer) const;
+    void RemoveTransientBuffer(TransientBuffer& transient_buffer) const;
+
+    // Bindless descriptor table is created on first use by bindless argument bindings, null is returned when it is not supported
+    Ptr<BindlessDescriptorTable> GetBindlessDescriptorTablePtr() const;
+
 protected:
     void PerformRequestedAction();
+    void CompleteRootConstantsUploadFrame() noexcept;
+    void CloseTransientBuffersFrame(Data::Index frame_index) const;
+    void CompleteTransientBuffersFrame(Data::Index frame_index) const;
+    void CompleteTransientBuffersFrames() const;
+    void CompleteBindlessDescriptorsFrame() const;
+    void CompleteBindlessDescriptorsFrames() const;
+    void UpdateBindlessDescriptorsRetireFramesCount() const;
     void SetDevice(Device& device);
 
     // Context interface
+    [[nodiscard]] virtual uint32_t GetFramesInFlightCount() const noexcept { return 1U; }
+    [[nodiscard]] virtual Ptr<BindlessDescriptorTable> CreateBindlessDescriptorTable(const BindlessDescriptorTableSettings&) const { return nullptr; }
     virtual void OnGpuWaitStart(WaitFor);
     virtual void OnGpuWaitComplete(WaitFor wait_for);
 
 private:
     using CommandKitPtrByType = std::array<Ptr<Rhi::ICommandKit>, magic_enum::enum_count<Rhi::CommandListType>()>;
     using CommandKitByQueue   = std::map<Rhi::ICommandQueue*, Ptr<Rhi::ICommandKit>>;
+    using TransientBufferPtrs = std::vector<TransientBuffer*>;
 
     template<Rhi::CommandListPurpose cmd_list_purpose>
     void ExecuteSyncCommandLists(const Rhi::ICommandKit& upload_cmd_kit) const;
 
     bool UploadResourcesAndNotify();
+    [[nodiscard]] uint32_t GetBindlessDescriptorsRetireFramesCount() const noexcept;
 
     const Type                         m_type;
     Ptr<Device>                        m_device_ptr;
@@ -123,6 +153,13 @@ private:
     mutable CommandKitByQueue          m_default_command_kit_ptr_by_queue;
     mutable DeferredAction             m_requested_action = DeferredAction::None;
     mutable bool                       m_is_completing_initialization = false;
+    std::atomic<Data::Size>            m_root_constants_uploading_size{ 0U };
+    std::atomic<Data::Size>            m_root_constants_uploaded_size{ 0U };
+    mutable TransientBufferPtrs        m_transient_buffers;
+    mutable TracyLockable(std::mutex,  m_transient_buffers_mutex);
+    mutable Ptr<Rhi::ITransientBuffer> m_default_transient_buffer_ptr;
+    mutable Ptr<BindlessDescriptorTable> m_bindless_descriptor_table_ptr;
+    mutable TracyLockable(std::mutex,  m_bindless_descriptor_table_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -0,0 +1,328 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/DescriptorSetRecycler.h
+Backend-agnostic recycler of descriptor sets allocated from native pools,
+which reuses released descriptor sets per layout after GPU completion.
+
+******************************************************************************/
+
+#pragma once
+
+#include "FrameRetireQueue.h"
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Base
+{
+
+struct DescriptorSetLayoutStatistics
+{
+    uint32_t live_sets_count    = 0U; // descriptor sets allocated and not released yet
+    uint32_t free_sets_count    = 0U; // released descriptor sets ready to be reused
+    uint32_t retired_sets_count = 0U; // released descriptor sets which may still be used by GPU
+
+    [[nodiscard]] friend bool operator==(const DescriptorSetLayoutStatistics& left, const DescriptorSetLayoutStatistics& right) noexcept = default;
+};
+
+struct DescriptorSetRecyclerStatistics
+{
+    uint32_t layouts_count        = 0U;
+    uint32_t allocated_sets_count = 0U; // descriptor sets allocated from pools
+    uint32_t reused_sets_count    = 0U; // descriptor set allocations served from free lists
+    uint32_t freed_sets_count     = 0U; // descriptor sets returned to pools with their layouts unregistered
+    DescriptorSetLayoutStatistics sets; // totals of all layouts
+
+    [[nodiscard]] friend bool operator==(const DescriptorSetRecyclerStatistics& left, const DescriptorSetRecyclerStatistics& right) noexcept = default;
+};
+
+template<typename LayoutType, typename SetType, typename PoolType>
+class DescriptorSetRecycler // NOSONAR - custom destructor is required
+{
+public:
+    using Statistics       = DescriptorSetRecyclerStatistics;
+    using LayoutStatistics = DescriptorSetLayoutStatistics;
+
+    struct PooledSet
+    {
+        SetType  set;
+        PoolType pool;
+    };
+
+    using PooledSets = std::vector<PooledSet>;
+
+    DescriptorSetRecycler() = default;
+    virtual ~DescriptorSetRecycler() = default;
+
+    DescriptorSetRecycler(const DescriptorSetRecycler&) = delete;
+    DescriptorSetRecycler(DescriptorSetRecycler&&) = delete;
+    DescriptorSetRecycler& operator=(const DescriptorSetRecycler&) = delete;
+    DescriptorSetRecycler& operator=(DescriptorSetRecycler&&) = delete;
+
+    void SetRetireFramesCount(uint32_t retire_frames_count)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        m_frame_counter.SetRetireFramesCount(retire_frames_count);
+    }
+
+    // Layouts are registered by programs to recycle their descriptor sets and to free them on program destruction
+    void RegisterLayout(LayoutType layout)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        const bool layout_added = m_sets_by_layout.try_emplace(layout).second;
+        META_CHECK_TRUE_DESCR(layout_added, "descriptor set layout is already registered");
+    }
+
+    void UnregisterLayout(LayoutType layout)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+
+        const auto layout_sets_it = m_sets_by_layout.find(layout);
+        if (layout_sets_it == m_sets_by_layout.end())
+            return;
+
+        // Free sets are returned to their pools, while retired sets may still be used by GPU, so they are freed after retirement
+        LayoutSets& layout_sets = layout_sets_it->second;
+        FreeSets(layout_sets.free_sets);
+        m_orphan_retired_sets.Merge(std::move(layout_sets.retired_sets));
+        m_sets_by_layout.erase(layout_sets_it);
+    }
+
+    [[nodiscard]] std::vector<SetType> AllocateSets(LayoutType layout, uint32_t sets_count)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_ZERO(sets_count);
+        std::scoped_lock lock_guard(m_mutex);
+
+        std::vector<SetType> sets;
+        sets.reserve(sets_count);
+
+        // Reuse released descriptor sets of the same layout, which are not used by GPU anymore
+        const auto layout_sets_it = m_sets_by_layout.find(layout);
+        if (layout_sets_it != m_sets_by_layout.end())
+        {
+            PooledSets& free_sets = layout_sets_it->second.free_sets;
+            while(!free_sets.empty() && sets.size() < sets_count)
+            {
+                const PooledSet& free_set = free_sets.back();
+                sets.emplace_back(free_set.set);
+                m_live_sets.try_emplace(free_set.set, LiveSet{ layout, free_set.pool });
+                free_sets.pop_back();
+                m_reused_sets_count++;
+            }
+        }
+
+        if (const auto new_sets_count = static_cast<uint32_t>(sets_count - sets.size());
+            new_sets_count > 0U)
+        {
+            PooledSets new_sets;
+            new_sets.reserve(new_sets_count);
+            AllocateNativeSets(layout, new_sets_count, new_sets);
+            META_CHECK_EQUAL(new_sets.size(), new_sets_count);
+
+            for(const PooledSet& new_set : new_sets)
+            {
+                sets.emplace_back(new_set.set);
+                m_live_sets.try_emplace(new_set.set, LiveSet{ layout, new_set.pool });
+            }
+            m_allocated_sets_count += new_sets_count;
+        }
+
+        if (layout_sets_it != m_sets_by_layout.end())
+            layout_sets_it->second.live_sets_count += sets_count;
+
+        return sets;
+    }
+
+    // Released descriptor sets are reused for the same layout only after the retire frames count has passed or when GPU is idle
+    void ReleaseSet(SetType set)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+
+        // Descriptor set is not found when it was already released with pools reset
+        const auto live_set_it = m_live_sets.find(set);
+        if (live_set_it == m_live_sets.end())
+            return;
+
+        const PooledSet pooled_set{ set, live_set_it->second.pool };
+        if (const auto layout_sets_it = m_sets_by_layout.find(live_set_it->second.layout);
+            layout_sets_it != m_sets_by_layout.end())
+        {
+            LayoutSets& layout_sets = layout_sets_it->second;
+            META_CHECK_NOT_ZERO(layout_sets.live_sets_count);
+            layout_sets.live_sets_count--;
+            layout_sets.retired_sets.Retire(pooled_set, m_frame_counter.GetFrameIndex());
+        }
+        else
+        {
+            m_orphan_retired_sets.Retire(pooled_set, m_frame_counter.GetFrameIndex());
+        }
+        m_live_sets.erase(live_set_it);
+    }
+
+    void CompleteFrame()
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+
+        const Opt<FrameIndex> completed_frame_index_opt = m_frame_counter.CompleteFrame();
+        if (!completed_frame_index_opt)
+            return;
+
+        for(auto& [layout, layout_sets] : m_sets_by_layout)
+        {
+            PooledSets& free_sets = layout_sets.free_sets;
+            layout_sets.retired_sets.CompleteFrames(*completed_frame_index_opt,
+                [&free_sets](const PooledSet& pooled_set) { free_sets.emplace_back(pooled_set); });
+        }
+
+        PooledSets orphan_sets;
+        m_orphan_retired_sets.CompleteFrames(*completed_frame_index_opt,
+            [&orphan_sets](const PooledSet& pooled_set) { orphan_sets.emplace_back(pooled_set); });
+        FreeSets(orphan_sets);
+    }
+
+    void CompleteAllFrames()
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        m_frame_counter.CompleteAllFrames();
+
+        for(auto& [layout, layout_sets] : m_sets_by_layout)
+        {
+            PooledSets& free_sets = layout_sets.free_sets;
+            layout_sets.retired_sets.CompleteAllFrames(
+                [&free_sets](const PooledSet& pooled_set) { free_sets.emplace_back(pooled_set); });
+        }
+
+        PooledSets orphan_sets;
+        m_orphan_retired_sets.CompleteAllFrames(
+            [&orphan_sets](const PooledSet& pooled_set) { orphan_sets.emplace_back(pooled_set); });
+        FreeSets(orphan_sets);
+    }
+
+    // All descriptor sets are released with native pools reset, while registered layouts are kept for the live programs
+    void ReleaseAllSets()
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        ResetNativePools();
+
+        for(auto& [layout, layout_sets] : m_sets_by_layout)
+        {
+            layout_sets.free_sets.clear();
+            layout_sets.retired_sets.Clear();
+            layout_sets.live_sets_count = 0U;
+        }
+        m_live_sets.clear();
+        m_orphan_retired_sets.Clear();
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+
+        Statistics statistics{
+            static_cast<uint32_t>(m_sets_by_layout.size()),
+            m_allocated_sets_count,
+            m_reused_sets_count,
+            m_freed_sets_count,
+            LayoutStatistics{
+                static_cast<uint32_t>(m_live_sets.size()),
+                0U,
+                m_orphan_retired_sets.GetCount()
+            }
+        };
+        for(const auto& [layout, layout_sets] : m_sets_by_layout)
+        {
+            statistics.sets.free_sets_count    += static_cast<uint32_t>(layout_sets.free_sets.size());
+            statistics.sets.retired_sets_count += layout_sets.retired_sets.GetCount();
+        }
+        return statistics;
+    }
+
+    [[nodiscard]] LayoutStatistics GetLayoutStatistics(LayoutType layout) const
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+
+        const auto layout_sets_it = m_sets_by_layout.find(layout);
+        if (layout_sets_it == m_sets_by_layout.end())
+            return {};
+
+        const LayoutSets& layout_sets = layout_sets_it->second;
+        return LayoutStatistics{
+            layout_sets.live_sets_count,
+            static_cast<uint32_t>(layout_sets.free_sets.size()),
+            layout_sets.retired_sets.GetCount()
+        };
+    }
+
+protected:
+    // DescriptorSetRecycler interface of the native descriptor pools, called under the recycler lock
+    virtual void AllocateNativeSets(LayoutType layout, uint32_t sets_count, PooledSets& pooled_sets) = 0;
+    virtual void FreeNativeSets(const PooledSets& pooled_sets) = 0;
+    virtual void ResetNativePools() = 0;
+
+    // Can be used only from the native interface implementation, called under the recycler lock
+    [[nodiscard]] uint32_t GetLiveSetsCount() const noexcept { return static_cast<uint32_t>(m_live_sets.size()); }
+
+private:
+    struct LiveSet
+    {
+        LayoutType layout;
+        PoolType   pool;
+    };
+
+    struct LayoutSets
+    {
+        PooledSets                  free_sets;
+        FrameRetireQueue<PooledSet> retired_sets;
+        uint32_t                    live_sets_count = 0U;
+    };
+
+    void FreeSets(const PooledSets& pooled_sets)
+    {
+        if (pooled_sets.empty())
+            return;
+
+        FreeNativeSets(pooled_sets);
+        m_freed_sets_count += static_cast<uint32_t>(pooled_sets.size());
+    }
+
+    std::map<LayoutType, LayoutSets> m_sets_by_layout;
+    std::map<SetType, LiveSet>       m_live_sets;
+    FrameRetireQueue<PooledSet>      m_orphan_retired_sets; // retired sets of unregistered layouts
+    FrameRetireCounter               m_frame_counter;
+    uint32_t                         m_allocated_sets_count = 0U;
+    uint32_t                         m_reused_sets_count = 0U;
+    uint32_t                         m_freed_sets_count = 0U;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
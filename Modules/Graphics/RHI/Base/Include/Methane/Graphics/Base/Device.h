@@ -45,6 +45,8 @@ public:
     const std::string&  GetAdapterName() const noexcept override    { return m_adapter_name; }
     bool                IsSoftwareAdapter() const noexcept override { return m_is_software_adapter; }
     const Capabilities& GetCapabilities() const noexcept override   { return m_capabilities; }
+    MemoryStatistics    GetMemoryStatistics() const noexcept override { return {}; }
+    DynamicStateMask    GetDynamicStates() const noexcept override    { return {}; }
     std::string         ToString() const override;
     
 protected:
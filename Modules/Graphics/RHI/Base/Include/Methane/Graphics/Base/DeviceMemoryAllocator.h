@@ -0,0 +1,137 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/DeviceMemoryAllocator.h
+Backend-agnostic device memory allocator with resource memory sub-allocated
+from large native memory blocks using buddy allocation.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IDevice.h>
+
+#include <Methane/Memory.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Data/FlatMap.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <set>
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Base
+{
+
+// Buddy allocator of the memory block: block is split in halves recursively down to the minimum allocation size,
+// so that allocated ranges are aligned by their power of two size and free buddies are merged back on release
+class DeviceMemoryBuddyAllocator
+{
+public:
+    DeviceMemoryBuddyAllocator(uint64_t size, uint64_t min_allocation_size);
+
+    [[nodiscard]] Opt<uint64_t> Allocate(uint64_t size, uint64_t alignment = 1U);
+    void Free(uint64_t offset);
+
+    [[nodiscard]] uint64_t GetSize() const noexcept              { return m_size; }
+    [[nodiscard]] uint64_t GetUsedSize() const noexcept          { return m_used_size; }
+    [[nodiscard]] uint32_t GetAllocationsCount() const noexcept  { return static_cast<uint32_t>(m_order_by_offset.size()); }
+    [[nodiscard]] bool     IsEmpty() const noexcept              { return m_order_by_offset.empty(); }
+    [[nodiscard]] uint64_t GetMaxFreeRangeSize() const noexcept;
+
+private:
+    [[nodiscard]] uint32_t GetOrderOfSize(uint64_t size) const noexcept;
+    [[nodiscard]] uint64_t GetSizeOfOrder(uint32_t order) const noexcept { return m_min_allocation_size << order; }
+
+    const uint64_t                    m_size;
+    const uint64_t                    m_min_allocation_size;
+    const uint32_t                    m_max_order;
+    std::vector<std::set<uint64_t>>   m_free_offsets_by_order;
+    Data::FlatMap<uint64_t, uint32_t> m_order_by_offset; // order of allocated ranges by offset
+    uint64_t                          m_used_size = 0U;
+};
+
+struct DeviceMemoryAllocation
+{
+    Data::Index pool_index   = 0U; // pool of memory blocks with compatible memory type and resources
+    Data::Index block_index  = 0U; // index of native memory block in allocator
+    uint64_t    offset       = 0U; // offset of allocated range in memory block
+    uint64_t    size         = 0U;
+    bool        is_dedicated = false;
+
+    [[nodiscard]] bool IsInitialized() const noexcept { return size > 0U; }
+
+    [[nodiscard]] friend bool operator==(const DeviceMemoryAllocation& left, const DeviceMemoryAllocation& right) = default;
+};
+
+struct DeviceMemoryAllocatorSettings
+{
+    uint64_t block_size          = 64U * 1024U * 1024U; // size of native memory blocks shared by sub-allocations
+    uint64_t min_allocation_size = 256U;
+    uint64_t dedicated_min_size  = 16U * 1024U * 1024U; // resources of this size or larger get dedicated memory block
+};
+
+class DeviceMemoryAllocator // NOSONAR - custom destructor is required
+{
+public:
+    using Allocation = DeviceMemoryAllocation;
+    using Settings   = DeviceMemoryAllocatorSettings;
+    using Statistics = Rhi::DeviceMemoryStatistics;
+
+    explicit DeviceMemoryAllocator(const Settings& settings = {});
+    virtual ~DeviceMemoryAllocator() = default;
+
+    DeviceMemoryAllocator(const DeviceMemoryAllocator&) = delete;
+    DeviceMemoryAllocator(DeviceMemoryAllocator&&) = delete;
+    DeviceMemoryAllocator& operator=(const DeviceMemoryAllocator&) = delete;
+    DeviceMemoryAllocator& operator=(DeviceMemoryAllocator&&) = delete;
+
+    // Returns uninitialized allocation when native memory block can not be allocated
+    [[nodiscard]] Allocation Allocate(Data::Index pool_index, uint64_t size, uint64_t alignment);
+    void Free(const Allocation& allocation);
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept { return m_settings; }
+    [[nodiscard]] Statistics      GetStatistics() const;
+
+protected:
+    // DeviceMemoryAllocator interface of the native memory blocks
+    [[nodiscard]] virtual bool AllocateMemoryBlock(Data::Index pool_index, Data::Index block_index, uint64_t size) = 0;
+    virtual void FreeMemoryBlock(Data::Index block_index) = 0;
+
+private:
+    struct Block
+    {
+        Data::Index                           pool_index;
+        uint64_t                              size;
+        UniquePtr<DeviceMemoryBuddyAllocator> buddy_allocator_ptr; // null for dedicated memory block
+    };
+
+    Data::Index AddBlock(Data::Index pool_index, uint64_t size, bool is_dedicated);
+    void        RemoveBlock(Data::Index block_index);
+    bool        HasOtherEmptyBlock(Data::Index pool_index, Data::Index block_index) const;
+
+    const Settings          m_settings;
+    std::vector<Opt<Block>> m_blocks;
+    uint64_t                m_allocated_size = 0U;
+    uint64_t                m_used_size = 0U;
+    uint32_t                m_dedicated_blocks_count = 0U;
+    uint32_t                m_allocations_count = 0U;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
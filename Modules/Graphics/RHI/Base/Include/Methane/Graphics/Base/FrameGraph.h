@@ -0,0 +1,98 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/FrameGraph.h
+Methane frame graph implementation: culls unused passes, aliases transient textures
+and infers resource transition barriers from resource usages declared by passes.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IFrameGraph.h>
+
+#include <memory>
+#include <vector>
+#include <utility>
+
+namespace Methane::Graphics::Base
+{
+
+class FrameGraph final
+    : public Rhi::IFrameGraph
+    , public std::enable_shared_from_this<FrameGraph>
+{
+public:
+    explicit FrameGraph(const Rhi::IContext& context);
+
+    // IFrameGraph interface
+    ResourceId ImportResource(Rhi::IResource& resource, bool is_output) override;
+    ResourceId AddTransientTexture(const Rhi::TextureSettings& settings) override;
+    PassId     AddPass(const PassSettings& settings, const PassFunction& function) override;
+
+    const Schedule& Compile() override;
+    void            Execute() override;
+
+    [[nodiscard]] bool             IsCompiled() const noexcept override  { return m_is_compiled; }
+    [[nodiscard]] const Schedule&  GetSchedule() const noexcept override { return m_schedule; }
+    [[nodiscard]] Rhi::IResource&  GetResource(ResourceId resource_id) const override;
+    [[nodiscard]] Ptr<IFrameGraph> GetPtr() override                     { return shared_from_this(); }
+
+    [[nodiscard]] const Rhi::IContext& GetContext() const noexcept { return m_context; }
+
+private:
+    struct Resource
+    {
+        Rhi::IResource*           imported_resource_ptr = nullptr;
+        Opt<Rhi::TextureSettings> transient_settings_opt;
+        bool                      is_output = false;
+    };
+
+    struct Pass
+    {
+        PassSettings settings;
+        PassFunction function;
+    };
+
+    // Physical resources of scheduled pass with unique states and barriers reused between frames
+    struct ScheduledPass
+    {
+        using ResourceState = std::pair<Rhi::IResource*, Rhi::ResourceState>;
+
+        std::vector<ResourceState>  resource_states;
+        Ptr<Rhi::IResourceBarriers> barriers_ptr;
+    };
+
+    using PassAliveFlags   = std::vector<bool>;
+    using ResourceLifetime = std::pair<Data::Index, Data::Index>; // first and last scheduled pass indices
+
+    PassAliveFlags CullPasses();
+    void AliasTransientTextures(const PassAliveFlags& pass_alive_flags);
+    void ScheduleTransitions(const PassAliveFlags& pass_alive_flags);
+    Rhi::IResource* GetResourcePtr(ResourceId resource_id) const;
+
+    const Rhi::IContext&       m_context;
+    std::vector<Resource>      m_resources;
+    std::vector<Pass>          m_passes;
+    Schedule                   m_schedule;
+    std::vector<ScheduledPass> m_scheduled_passes;
+    Ptrs<Rhi::ITexture>        m_transient_texture_ptrs;
+    bool                       m_is_compiled = false;
+};
+
+} // namespace Methane::Graphics::Base
@@ -0,0 +1,149 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/FrameRetireQueue.h
+Queue of items retired in frames, which may still be used by GPU,
+and counter of frames completed on GPU after the retire frames count.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <cstdint>
+
+namespace Methane::Graphics::Base
+{
+
+using FrameIndex = uint64_t;
+
+// Items are retired in the non-decreasing order of frame indices
+// and completed in the same order, when their frames are not used by GPU anymore
+template<typename ItemType>
+class FrameRetireQueue
+{
+public:
+    void Retire(const ItemType& item, FrameIndex frame_index)
+    {
+        m_retired_items.push_back({ item, frame_index });
+    }
+
+    // Completes items retired in frames up to and including the given frame index
+    template<typename CompleteFuncType>
+    uint32_t CompleteFrames(FrameIndex frame_index, const CompleteFuncType& complete_item)
+    {
+        uint32_t completed_count = 0U;
+        while(!m_retired_items.empty() && m_retired_items.front().frame_index <= frame_index)
+        {
+            complete_item(m_retired_items.front().item);
+            m_retired_items.pop_front();
+            completed_count++;
+        }
+        return completed_count;
+    }
+
+    template<typename CompleteFuncType>
+    uint32_t CompleteAllFrames(const CompleteFuncType& complete_item)
+    {
+        for(const RetiredItem& retired_item : m_retired_items)
+        {
+            complete_item(retired_item.item);
+        }
+        const auto completed_count = static_cast<uint32_t>(m_retired_items.size());
+        m_retired_items.clear();
+        return completed_count;
+    }
+
+    // Items of the other queue are merged keeping the order of frame indices
+    void Merge(FrameRetireQueue&& other)
+    {
+        const auto merge_position = static_cast<std::ptrdiff_t>(m_retired_items.size());
+        std::move(other.m_retired_items.begin(), other.m_retired_items.end(), std::back_inserter(m_retired_items));
+        std::inplace_merge(m_retired_items.begin(), std::next(m_retired_items.begin(), merge_position), m_retired_items.end(),
+                           [](const RetiredItem& left, const RetiredItem& right) { return left.frame_index < right.frame_index; });
+        other.m_retired_items.clear();
+    }
+
+    // Returns frame index of the first retired item satisfying the predicate
+    template<typename PredicateType>
+    [[nodiscard]] Opt<FrameIndex> FindFrame(const PredicateType& predicate) const
+    {
+        const auto retired_item_it = std::ranges::find_if(m_retired_items,
+            [&predicate](const RetiredItem& retired_item) { return predicate(retired_item.item); });
+        return retired_item_it == m_retired_items.end() ? Opt<FrameIndex>() : Opt<FrameIndex>(retired_item_it->frame_index);
+    }
+
+    [[nodiscard]] uint32_t GetCount() const noexcept { return static_cast<uint32_t>(m_retired_items.size()); }
+    [[nodiscard]] bool     IsEmpty() const noexcept  { return m_retired_items.empty(); }
+
+    void Clear() noexcept { m_retired_items.clear(); }
+
+private:
+    struct RetiredItem
+    {
+        ItemType   item;
+        FrameIndex frame_index;
+    };
+
+    std::deque<RetiredItem> m_retired_items;
+};
+
+// Counts frames completed on GPU: items retired in a frame are not used by GPU anymore
+// after the retire frames count, which is not less than the number of frames in flight
+class FrameRetireCounter
+{
+public:
+    static constexpr uint32_t g_min_retire_frames_count = 3U;
+
+    [[nodiscard]] static uint32_t GetRetireFramesCountOf(uint32_t frames_in_flight_count,
+                                                         uint32_t min_retire_frames_count = g_min_retire_frames_count) noexcept
+    {
+        return std::max(frames_in_flight_count, min_retire_frames_count);
+    }
+
+    explicit FrameRetireCounter(uint32_t retire_frames_count = g_min_retire_frames_count) noexcept
+        : m_retire_frames_count(retire_frames_count)
+    { }
+
+    [[nodiscard]] FrameIndex GetFrameIndex() const noexcept         { return m_frame_index; }
+    [[nodiscard]] uint32_t   GetRetireFramesCount() const noexcept  { return m_retire_frames_count; }
+    void SetRetireFramesCount(uint32_t retire_frames_count) noexcept { m_retire_frames_count = retire_frames_count; }
+
+    // Moves to the next frame and returns index of the last frame, which items are not used by GPU anymore
+    [[nodiscard]] Opt<FrameIndex> CompleteFrame() noexcept
+    {
+        m_frame_index++;
+        if (m_frame_index < m_retire_frames_count)
+            return std::nullopt;
+
+        return m_frame_index - m_retire_frames_count;
+    }
+
+    // Moves to the next frame, when all frames are completed on GPU, so that all retired items are completed
+    void CompleteAllFrames() noexcept { m_frame_index++; }
+
+private:
+    FrameIndex m_frame_index = 0U;
+    uint32_t   m_retire_frames_count;
+};
+
+} // namespace Methane::Graphics::Base
@@ -30,6 +30,7 @@ Base implementation of the parallel render command list interface.
 
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace Methane::Graphics::Rhi
 {
@@ -53,12 +54,16 @@ public:
     // IParallelRenderCommandList interface
     [[nodiscard]] bool IsValidationEnabled() const noexcept final { return m_is_validation_enabled; }
     void SetValidationEnabled(bool is_validation_enabled) override;
+    [[nodiscard]] bool IsParallelCommandListsReuseEnabled() const noexcept final { return m_is_parallel_command_lists_reuse_enabled; }
+    void SetParallelCommandListsReuseEnabled(bool is_reuse_enabled) override;
     [[nodiscard]] Rhi::IRenderPass& GetRenderPass() const final;
     void Reset(IDebugGroup* debug_group_ptr = nullptr) override;
     void ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) override;
     void SetViewState(Rhi::IViewState& view_state) override;
     void SetParallelCommandListsCount(uint32_t count) override;
     [[nodiscard]] const Refs<Rhi::IRenderCommandList>& GetParallelCommandLists() const override { return m_parallel_command_lists_refs; }
+    void DrawParallel(Data::Size draws_count, const DrawRangeFunction& draw_range_fn,
+                      const DrawCostFunction& draw_cost_fn = {}, Data::Size min_command_list_cost = 1U) override;
 
     // CommandList interface, which throw NotImplementedException (i.e. can not be used)
     void SetProgramBindings(Rhi::IProgramBindings&, Rhi::ProgramBindingsApplyBehaviorMask) override;
@@ -77,11 +82,28 @@ public:
     [[nodiscard]] RenderPass& GetBaseRenderPass() const;
     [[nodiscard]] const Ptr<RenderPass>& GetBaseRenderPassPtr() const noexcept { return m_render_pass_ptr;}
 
+    [[nodiscard]] static std::vector<DrawRange> PartitionDraws(Data::Size command_lists_count, Data::Size draws_count,
+                                                               const DrawCostFunction& draw_cost_fn = {},
+                                                               Data::Size min_command_list_cost = 1U);
+
 protected:
     static std::string GetParallelCommandListDebugName(std::string_view base_name, std::string_view suffix);
     static std::string GetTrailingCommandListDebugName(std::string_view base_name, bool is_beginning);
     static std::string GetThreadCommandListName(std::string_view base_name, Data::Index index);
 
+    // Thread command lists released by decreasing count, which are kept for reuse in order of their thread indices
+    [[nodiscard]] const Ptrs<RenderCommandList>& GetReservedParallelCommandLists() const noexcept { return m_reserved_parallel_command_lists; }
+
+    // Thread command lists with encoded commands, which were committed and executed with the current encoding
+    [[nodiscard]] const Ptrs<RenderCommandList>& GetCommittedParallelCommandLists() const noexcept { return m_committed_parallel_command_lists; }
+
+    // Per-thread command lists are reset in parallel, unless native API requires them to be reset in order of threads
+    [[nodiscard]] virtual bool IsParallelResetSupported() const noexcept { return true; }
+
+    // Idle per-thread command lists are left open without commit and execution, so that their native reset is skipped too,
+    // unless native API requires all per-thread command lists to be ended with the parallel command list
+    [[nodiscard]] virtual bool IsIdleCommandListsSkipSupported() const noexcept { return true; }
+
     // ParallelRenderCommandListBase interface
     [[nodiscard]] virtual Ptr<Rhi::IRenderCommandList> CreateCommandList(bool is_beginning_list) = 0;
 
@@ -92,7 +114,10 @@ private:
     const Ptr<RenderPass>         m_render_pass_ptr;
     Ptrs<RenderCommandList>       m_parallel_command_lists;
     Refs<Rhi::IRenderCommandList> m_parallel_command_lists_refs;
+    Ptrs<RenderCommandList>       m_reserved_parallel_command_lists;
+    Ptrs<RenderCommandList>       m_committed_parallel_command_lists;
     bool                          m_is_validation_enabled = true;
+    bool                          m_is_parallel_command_lists_reuse_enabled = false;
 };
 
 } // namespace Methane::Graphics::Base
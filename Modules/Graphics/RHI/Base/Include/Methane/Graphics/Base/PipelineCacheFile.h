@@ -0,0 +1,70 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/PipelineCacheFile.h
+Versioned file of the native pipeline cache data, which is valid only
+for the same device and driver version it was saved with.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+#include <array>
+#include <string>
+
+namespace Methane::Graphics::Base
+{
+
+struct PipelineCacheDeviceKey
+{
+    uint32_t                 vendor_id      = 0U;
+    uint32_t                 device_id      = 0U;
+    uint32_t                 driver_version = 0U;
+    std::array<uint8_t, 16U> cache_uuid{ };
+
+    [[nodiscard]] friend bool operator==(const PipelineCacheDeviceKey& left, const PipelineCacheDeviceKey& right) noexcept = default;
+};
+
+class PipelineCacheFile
+{
+public:
+    using DeviceKey = PipelineCacheDeviceKey;
+
+    static constexpr uint32_t g_magic   = 0x4D50434BU; // "MPCK"
+    static constexpr uint32_t g_version = 1U;
+
+    PipelineCacheFile(std::string file_path, const DeviceKey& device_key);
+
+    // Returns empty data when file does not exist or was saved for another device, driver or file version
+    [[nodiscard]] Data::Bytes Load() const;
+    bool Save(const Data::Bytes& cache_data) const;
+
+    [[nodiscard]] const std::string& GetFilePath() const noexcept { return m_file_path; }
+    [[nodiscard]] const DeviceKey&   GetDeviceKey() const noexcept { return m_device_key; }
+
+    [[nodiscard]] static Data::Bytes Serialize(const DeviceKey& device_key, const Data::Bytes& cache_data);
+    [[nodiscard]] static Data::Bytes Deserialize(const DeviceKey& device_key, const Data::Bytes& file_data);
+
+private:
+    const std::string m_file_path;
+    const DeviceKey   m_device_key;
+};
+
+} // namespace Methane::Graphics::Base
@@ -0,0 +1,235 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/PipelineRegistry.h
+Registry of native pipelines shared between state objects with equal keys,
+which are created synchronously or asynchronously with parallel executor.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/core/executor.hpp>
+
+#include <unordered_map>
+#include <functional>
+#include <future>
+#include <vector>
+#include <chrono>
+#include <exception>
+#include <mutex>
+
+namespace Methane::Graphics::Base
+{
+
+struct PipelineRegistryStatistics
+{
+    uint32_t pipelines_count  = 0U; // number of alive pipelines referenced by state objects
+    uint32_t created_count    = 0U;
+    uint32_t reused_count     = 0U; // number of pipeline requests served with already existing pipeline
+    uint32_t async_count      = 0U;
+    uint32_t skipped_count    = 0U; // number of pipeline uses skipped while it was being created asynchronously
+
+    [[nodiscard]] friend bool operator==(const PipelineRegistryStatistics& left, const PipelineRegistryStatistics& right) noexcept = default;
+};
+
+// Shared reference to the registry pipeline, which is destroyed with the last reference
+template<typename PipelineType>
+class PipelineReference
+{
+public:
+    using Future = std::shared_future<PipelineType>;
+
+    PipelineReference() = default;
+    explicit PipelineReference(Ptr<const Future> future_ptr) noexcept
+        : m_future_ptr(std::move(future_ptr))
+    { }
+
+    [[nodiscard]] bool IsInitialized() const noexcept { return static_cast<bool>(m_future_ptr); }
+    [[nodiscard]] bool IsReady() const noexcept
+    {
+        return m_future_ptr && m_future_ptr->wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    // Waits for asynchronous pipeline creation to complete
+    [[nodiscard]] const PipelineType& Get() const
+    {
+        META_CHECK_NOT_NULL_DESCR(m_future_ptr, "pipeline reference is not initialized");
+        return m_future_ptr->get();
+    }
+
+    // Returns nullptr instead of waiting while pipeline is being created asynchronously
+    [[nodiscard]] const PipelineType* GetIfReady() const
+    {
+        return IsReady() ? &m_future_ptr->get() : nullptr;
+    }
+
+    [[nodiscard]] friend bool operator==(const PipelineReference& left, const PipelineReference& right) noexcept = default;
+
+private:
+    Ptr<const Future> m_future_ptr;
+};
+
+template<typename KeyType, typename PipelineType, typename KeyHashType = std::hash<KeyType>>
+class PipelineRegistry
+{
+public:
+    using Key        = KeyType;
+    using Pipeline   = PipelineReference<PipelineType>;
+    using CreateFunc = std::function<PipelineType()>;
+    using Statistics = PipelineRegistryStatistics;
+
+    explicit PipelineRegistry(tf::Executor& parallel_executor)
+        : m_parallel_executor(parallel_executor)
+    { }
+
+    ~PipelineRegistry()
+    {
+        WaitForPendingPipelines();
+    }
+
+    PipelineRegistry(const PipelineRegistry&) = delete;
+    PipelineRegistry(PipelineRegistry&&) = delete;
+
+    PipelineRegistry& operator=(const PipelineRegistry&) = delete;
+    PipelineRegistry& operator=(PipelineRegistry&&) = delete;
+
+    // Returns existing pipeline with equal key or creates a new one with the given function,
+    // which is called on parallel executor thread in asynchronous mode and has to capture its arguments by value.
+    // In synchronous mode pipeline is created on the calling thread outside of the registry lock,
+    // while concurrent requests of the same key receive placeholder pipeline and wait for its creation on get.
+    [[nodiscard]] Pipeline GetPipeline(const Key& key, CreateFunc create_func, bool is_async = false)
+    {
+        META_FUNCTION_TASK();
+        std::promise<PipelineType> promise;
+        Ptr<const Future> future_ptr;
+        {
+            std::lock_guard lock(m_mutex);
+            m_request_count++;
+
+            if (const auto pipeline_it = m_pipeline_by_key.find(key);
+                pipeline_it != m_pipeline_by_key.end())
+            {
+                if (Ptr<const Future> existing_future_ptr = pipeline_it->second.lock())
+                {
+                    m_reused_count++;
+                    return Pipeline(std::move(existing_future_ptr));
+                }
+                m_pipeline_by_key.erase(pipeline_it);
+            }
+
+            // Expired pipeline references are removed periodically to limit registry growth without callbacks from pipeline references
+            if (m_request_count % g_cleanup_period == 0U)
+            {
+                std::erase_if(m_pipeline_by_key, [](const auto& key_and_pipeline) { return key_and_pipeline.second.expired(); });
+            }
+            std::erase_if(m_pending_futures, [](const Future& future) { return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+
+            if (is_async)
+            {
+                Future future = m_parallel_executor.async(std::move(create_func)).share();
+                m_pending_futures.push_back(future);
+                m_async_count++;
+                future_ptr = std::make_shared<const Future>(std::move(future));
+            }
+            else
+            {
+                future_ptr = std::make_shared<const Future>(promise.get_future().share());
+            }
+
+            m_pipeline_by_key.insert_or_assign(key, WeakPtr<const Future>(future_ptr));
+            m_created_count++;
+        }
+
+        if (is_async)
+            return Pipeline(std::move(future_ptr));
+
+        try
+        {
+            promise.set_value(create_func());
+        }
+        catch (...)
+        {
+            // Waiting requests receive creation error, while placeholder is removed to let the next request retry creation
+            promise.set_exception(std::current_exception());
+            std::lock_guard lock(m_mutex);
+            if (const auto pipeline_it = m_pipeline_by_key.find(key);
+                pipeline_it != m_pipeline_by_key.end() && pipeline_it->second.lock() == future_ptr)
+            {
+                m_pipeline_by_key.erase(pipeline_it);
+            }
+            throw;
+        }
+        return Pipeline(std::move(future_ptr));
+    }
+
+    // Pipelines created asynchronously have to be completed before releasing the device
+    void WaitForPendingPipelines()
+    {
+        META_FUNCTION_TASK();
+        std::lock_guard lock(m_mutex);
+        for (const Future& future : m_pending_futures)
+        {
+            future.wait();
+        }
+        m_pending_futures.clear();
+    }
+
+    // Pipeline users report skipped work, like draw calls skipped while pipeline is not ready, to make it visible in statistics
+    void AddSkippedUse()
+    {
+        META_FUNCTION_TASK();
+        std::lock_guard lock(m_mutex);
+        m_skipped_count++;
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const
+    {
+        META_FUNCTION_TASK();
+        std::lock_guard lock(m_mutex);
+        Statistics statistics{ 0U, m_created_count, m_reused_count, m_async_count, m_skipped_count };
+        for (const auto& [key, future_wptr] : m_pipeline_by_key)
+        {
+            if (!future_wptr.expired())
+                statistics.pipelines_count++;
+        }
+        return statistics;
+    }
+
+private:
+    using Future = typename Pipeline::Future;
+    using PipelineByKey = std::unordered_map<Key, WeakPtr<const Future>, KeyHashType>;
+
+    static constexpr uint32_t g_cleanup_period = 64U;
+
+    tf::Executor&       m_parallel_executor;
+    PipelineByKey       m_pipeline_by_key;
+    std::vector<Future> m_pending_futures;
+    uint32_t            m_request_count = 0U;
+    uint32_t            m_created_count = 0U;
+    uint32_t            m_reused_count  = 0U;
+    uint32_t            m_async_count   = 0U;
+    uint32_t            m_skipped_count = 0U;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Base
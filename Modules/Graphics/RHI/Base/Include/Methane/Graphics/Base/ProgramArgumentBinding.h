@@ -32,6 +32,7 @@ namespace Methane::Graphics::Base
 
 class Context;
 class Program;
+class BindlessDescriptorTable;
 class ProgramBindings;
 class RootConstantAccessor;
 class RootConstantBuffer;
@@ -81,11 +82,16 @@ protected:
     virtual bool UpdateRootConstantResourceViews();
 
 private:
-    const Context&                  m_context;
-    Settings                        m_settings;
-    Rhi::ResourceViews              m_resource_views;
-    UniquePtr<RootConstantAccessor> m_root_constant_accessor_ptr;
-    bool                            m_emit_callback_enabled = true;
+    void SetBindlessIndices(Rhi::ResourceViewSpan resource_views);
+    void ReleaseBindlessIndices();
+
+    const Context&                   m_context;
+    Settings                         m_settings;
+    Rhi::ResourceViews               m_resource_views;
+    UniquePtr<RootConstantAccessor>  m_root_constant_accessor_ptr;
+    WeakPtr<BindlessDescriptorTable> m_bindless_table_wptr;
+    std::vector<uint32_t>            m_bindless_indices; // indices of registered resource views in bindless descriptor table
+    bool                             m_emit_callback_enabled = true;
 };
 
 } // namespace Methane::Graphics::Base
@@ -74,15 +74,20 @@ public:
 
     Rhi::ProgramArguments GetUnboundArguments() const;
 
+    // Transitions bound resources to the states required by program arguments and returns barriers to be set in command list,
+    // or null pointer when all resources are already in required states
+    const Rhi::IResourceBarriers* UpdateResourceTransitionBarriers(Rhi::ProgramArgumentAccessMask apply_access = Rhi::ProgramArgumentAccessMask{ ~0U },
+                                                                   const Rhi::ICommandQueue* owner_queue_ptr = nullptr) const;
+
     template<typename CommandListType>
     void ApplyResourceTransitionBarriers(CommandListType& command_list,
                                          Rhi::ProgramArgumentAccessMask apply_access = Rhi::ProgramArgumentAccessMask{ ~0U },
                                          const Rhi::ICommandQueue* owner_queue_ptr = nullptr) const
     {
-        if (ApplyResourceStates(apply_access, owner_queue_ptr) &&
-            m_resource_state_transition_barriers_ptr && !m_resource_state_transition_barriers_ptr->IsEmpty())
+        if (const Rhi::IResourceBarriers* resource_barriers_ptr = UpdateResourceTransitionBarriers(apply_access, owner_queue_ptr);
+            resource_barriers_ptr)
         {
-            command_list.SetResourceBarriers(*m_resource_state_transition_barriers_ptr);
+            command_list.SetResourceBarriers(*resource_barriers_ptr);
         }
     }
 
@@ -59,13 +59,16 @@ struct RenderDrawingState
 
     using ChangeMask = Data::EnumMask<Change>;
 
+    // Raw pointers are used for the bound objects instead of smart pointers for performance reasons,
+    // since their lifetime is guaranteed by retaining them in the command list on binding
     Ptrs<Texture>             render_pass_attachment_ptrs;
-    Ptr<RenderState>          render_state_ptr;
-    Ptr<BufferSet>            vertex_buffer_set_ptr;
-    Ptr<Buffer>               index_buffer_ptr;
+    RenderState*              render_state_ptr      = nullptr;
+    BufferSet*                vertex_buffer_set_ptr = nullptr;
+    Buffer*                   index_buffer_ptr      = nullptr;
     Opt<Rhi::RenderPrimitive> primitive_type_opt;
     ViewState*                view_state_ptr      = nullptr;
     Rhi::RenderStateGroupMask render_state_groups;
+    Rhi::RenderStateGroupMask bound_render_state_groups; // all groups set since the current render state was bound
     ChangeMask                changes;
 };
 
@@ -99,12 +102,25 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void MultiDrawIndexed(Primitive primitive_type, std::span<const Rhi::DrawIndexedArguments> draw_arguments) override;
+    void DrawIndirect(Primitive primitive_type, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
+    void DrawIndexedIndirect(Primitive primitive_type, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
 
     RenderPass&         GetPass();
     RenderPass*         GetPassPtr() const noexcept      { return m_render_pass_ptr.get(); }
     bool                HasPass() const noexcept         { return !!m_render_pass_ptr; }
     const DrawingState& GetDrawingState() const noexcept { return m_drawing_state; }
 
+    // Command list is idle when no draws and no resource barriers were encoded since reset,
+    // since primitive type is set by any draw call and state setup commands have no effect without draws
+    [[nodiscard]] bool IsIdle() const noexcept { return !m_drawing_state.primitive_type_opt && !GetCommandState().has_resource_barriers; }
+
+    // Idle command list left in encoding state without commit releases its retained resources and closes open debug groups,
+    // as if it was committed and completed, so that debug groups are pushed again on the next reset
+    void ReleaseIdleEncoding();
+
 protected:
     // CommandList overrides
     void ResetCommandState() override;
@@ -112,10 +128,21 @@ protected:
     DrawingState& GetDrawingState() noexcept  { return m_drawing_state; }
     bool          IsParallel() const noexcept { return m_is_parallel; }
 
+    // Verifies encoding state, validates all draw arguments and updates drawing state once for the native multi-draw
+    void PrepareMultiDrawIndexed(Primitive primitive_type, std::span<const Rhi::DrawIndexedArguments> draw_arguments);
+
+    // Zero index count is substituted with all indices count of the bound index buffer
+    [[nodiscard]] uint32_t GetDrawIndexCount(uint32_t index_count) const noexcept;
+
     inline void UpdateDrawingState(Primitive primitive_type);
+    inline void ValidateDrawIndexed(uint32_t index_count, uint32_t start_index, uint32_t start_vertex, uint32_t instance_count) const;
     inline void ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count = 0) const;
+    inline void ValidateDrawIndirectBuffers(const Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, Data::Size arguments_size,
+                                            uint32_t max_draw_count, const Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) const;
 
 private:
+    void SetIndirectBufferState(Rhi::IBuffer& indirect_buffer);
+
     const bool            m_is_parallel = false;
     const Ptr<RenderPass> m_render_pass_ptr;
     DrawingState          m_drawing_state;
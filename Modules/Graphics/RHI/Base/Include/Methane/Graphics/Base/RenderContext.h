@@ -73,6 +73,7 @@ protected:
     Rhi::IFence& GetRenderFence() const;
 
     // Context overrides
+    uint32_t GetFramesInFlightCount() const noexcept override { return m_settings.frame_buffers_count; }
     void OnGpuWaitStart(WaitFor wait_for) override;
     void OnGpuWaitComplete(WaitFor wait_for) override;
 
@@ -0,0 +1,137 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/RenderPipelineKey.h
+Key of the native render pipeline made of render state settings,
+view state shape and primitive type, which are baked in pipeline
+unless they are set dynamically in command list.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IRenderState.h>
+#include <Methane/Graphics/RHI/IViewState.h>
+#include <Methane/Graphics/RHI/IDevice.h>
+#include <Methane/Graphics/RHI/IProgram.h>
+#include <Methane/Graphics/RHI/IShader.h>
+#include <Methane/Memory.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Methane::Graphics::Rhi
+{
+enum class RenderPrimitive;
+}
+
+namespace Methane::Graphics::Base
+{
+
+// Numbers of viewports and scissor rects baked in pipeline, while their values are always set dynamically
+struct RenderPipelineViewShape
+{
+    uint32_t viewports_count     = 0U;
+    uint32_t scissor_rects_count = 0U;
+
+    [[nodiscard]] friend bool operator==(const RenderPipelineViewShape& left, const RenderPipelineViewShape& right) noexcept = default;
+};
+
+struct RenderPipelineShaderKey
+{
+    Rhi::ShaderType             type;
+    const Data::IProvider*      data_provider_ptr;
+    Rhi::ShaderEntryFunction    entry_function;
+    Rhi::ShaderMacroDefinitions compile_definitions;
+
+    [[nodiscard]] friend bool operator==(const RenderPipelineShaderKey& left, const RenderPipelineShaderKey& right) noexcept = default;
+};
+
+struct RenderPipelineInputLayoutKey
+{
+    std::vector<std::string>                argument_semantics;
+    Rhi::ProgramInputBufferLayout::StepType step_type;
+    uint32_t                                step_rate;
+
+    [[nodiscard]] friend bool operator==(const RenderPipelineInputLayoutKey& left, const RenderPipelineInputLayoutKey& right) noexcept = default;
+};
+
+struct RenderPipelineArgumentKey
+{
+    Rhi::ShaderType                 shader_type;
+    std::string                     name;
+    Rhi::ProgramArgumentAccessType  access_type;
+    Rhi::ProgramArgumentValueType   value_type;
+
+    [[nodiscard]] friend auto operator<=>(const RenderPipelineArgumentKey& left, const RenderPipelineArgumentKey& right) noexcept = default;
+};
+
+// Program identity in pipeline key is defined by its shaders and layout instead of program object address,
+// so that programs created with equal settings share pipelines and a new program allocated at the address
+// of released one does not reuse pipeline of different shaders; values are copied to outlive the program
+struct RenderPipelineProgramKey
+{
+    std::vector<RenderPipelineShaderKey>      shaders;
+    std::vector<RenderPipelineInputLayoutKey> input_buffer_layouts;
+    std::vector<RenderPipelineArgumentKey>    argument_accessors; // sorted to be independent of unordered set order
+
+    RenderPipelineProgramKey() = default;
+    explicit RenderPipelineProgramKey(const Rhi::IProgram& program);
+
+    [[nodiscard]] friend bool operator==(const RenderPipelineProgramKey& left, const RenderPipelineProgramKey& right) noexcept = default;
+};
+
+class RenderPipelineKey
+{
+public:
+    struct Hash
+    {
+        [[nodiscard]] size_t operator()(const RenderPipelineKey& key) const noexcept { return static_cast<size_t>(key.GetHash()); }
+    };
+
+    // Settings of dynamic states are excluded from the key, so that pipelines are shared between states different only in them;
+    // view settings and primitive type are specified only for monolithic pipelines without dynamic viewports count and topology
+    explicit RenderPipelineKey(const Rhi::RenderStateSettings& settings,
+                               Rhi::DeviceDynamicStateMask dynamic_states = {},
+                               const Rhi::ViewSettings* view_settings_ptr = nullptr,
+                               Opt<Rhi::RenderPrimitive> primitive_opt = {});
+
+    [[nodiscard]] const RenderPipelineProgramKey&     GetProgram() const noexcept       { return m_program; }
+    [[nodiscard]] Rhi::DeviceDynamicStateMask         GetDynamicStates() const noexcept { return m_dynamic_states; }
+    [[nodiscard]] const Opt<RenderPipelineViewShape>& GetViewShape() const noexcept     { return m_view_shape_opt; }
+    [[nodiscard]] const Opt<Rhi::RenderPrimitive>&    GetPrimitive() const noexcept     { return m_primitive_opt; }
+    [[nodiscard]] uint64_t                            GetHash() const noexcept          { return m_hash; }
+
+    [[nodiscard]] friend bool operator==(const RenderPipelineKey& left, const RenderPipelineKey& right) noexcept = default;
+
+private:
+    // Render pattern is compared by address, since it stays alive while pipeline is used by render state
+    RenderPipelineProgramKey      m_program;
+    const Rhi::IRenderPattern*    m_render_pattern_ptr;
+    Rhi::RasterizerSettings       m_rasterizer;
+    Rhi::DepthSettings            m_depth;
+    Rhi::StencilSettings          m_stencil;
+    Rhi::BlendingSettings         m_blending;
+    Color4F                       m_blending_color;
+    Rhi::DeviceDynamicStateMask   m_dynamic_states;
+    Opt<RenderPipelineViewShape>  m_view_shape_opt;
+    Opt<Rhi::RenderPrimitive>     m_primitive_opt;
+    uint64_t                      m_hash = 0U;
+};
+
+} // namespace Methane::Graphics::Base
@@ -27,6 +27,7 @@ Methane resource barriers base implementation.
 #include <Methane/Instrumentation.h>
 
 #include <mutex>
+#include <atomic>
 
 namespace Methane::Graphics::Base
 {
@@ -40,7 +41,7 @@ public:
 
     // IResourceBarriers overrides
     [[nodiscard]] Ptr<IResourceBarriers> GetPtr() final     { return shared_from_this(); }
-    [[nodiscard]] bool       IsEmpty() const noexcept final { return m_barriers_map.empty(); }
+    [[nodiscard]] bool       IsEmpty() const noexcept final { return m_barriers_count.load(std::memory_order_acquire) == 0U; }
     [[nodiscard]] Set        GetSet() const noexcept final;
     [[nodiscard]] const Map& GetMap() const noexcept final  { return m_barriers_map; }
     [[nodiscard]] explicit operator std::string() const noexcept final;
@@ -61,10 +62,16 @@ public:
 
     void ApplyTransitions() const final;
 
+    // Removes all barriers keeping the allocated storage for reuse
+    virtual void Clear();
+
     auto Lock() const { return std::scoped_lock<LockableBase(std::recursive_mutex)>(m_barriers_mutex); }
 
 private:
+    void UpdateBarriersCount() noexcept { m_barriers_count.store(m_barriers_map.size(), std::memory_order_release); }
+
     Map m_barriers_map;
+    std::atomic<size_t> m_barriers_count{ 0U };
     mutable TracyLockable(std::recursive_mutex, m_barriers_mutex);
 };
 
@@ -31,11 +31,15 @@ bound to Program using ProgramArgumentBinging as RootConstant.
 #include <Methane/Memory.hpp>
 #include <Methane/Data/Types.h>
 #include <Methane/Data/RangeSet.hpp>
+#include <Methane/Data/FreeRangeSet.hpp>
 #include <Methane/Data/Emitter.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <mutex>
+#include <shared_mutex>
 #include <atomic>
+#include <array>
+#include <vector>
 
 namespace Methane::Graphics::Rhi
 {
@@ -49,28 +53,42 @@ namespace Methane::Graphics::Base
 
 class RootConstantStorage;
 
+// Chunk of root constant storage with slots sub-allocated by multiple threads without locking
+struct RootConstantChunk
+{
+    static constexpr Data::Size slots_count = 64U;
+
+    Data::Index           offset = 0U;              // chunk offset in storage, changed on storage compaction
+    std::atomic<uint64_t> free_slots_mask{ ~0ULL }; // bit is set for each free slot
+};
+
 class RootConstantAccessor // NOSONAR - custom destructor is required
 {
+    friend class RootConstantStorage;
+
 public:
     using Range = Data::Range<Data::Index>;
 
-    RootConstantAccessor(RootConstantStorage& storage, const Range& buffer_range, Data::Size data_size);
+    RootConstantAccessor(RootConstantStorage& storage, const Range& buffer_range, Data::Size data_size,
+                         RootConstantChunk* chunk_ptr = nullptr);
     ~RootConstantAccessor();
 
     [[nodiscard]] Rhi::RootConstant GetRootConstant() const;
     bool SetRootConstant(const Rhi::RootConstant& root_constant) const;
 
     bool                    IsInitialized() const noexcept  { return m_is_initialized; }
-    const Range&            GetBufferRange() const noexcept { return m_buffer_range; }
+    Range                   GetBufferRange() const;
     Data::Size              GetDataSize() const noexcept    { return m_data_size; }
     Data::Byte*             GetDataPtr();
     Rhi::ResourceView       GetResourceView() const;
     RootConstantStorage&    GetRootConstantBuffer() const   { return m_storage_ref.get(); }
 
 private:
-    Ref<RootConstantStorage> m_storage_ref;  // storage reference
-    Range                    m_buffer_range; // aligned memory range
-    Data::Size               m_data_size;    // unaligned original size
+    Ref<RootConstantStorage> m_storage_ref;           // storage reference
+    Range                    m_buffer_range;          // aligned memory range, relative to chunk offset when reserved in chunk
+    Data::Size               m_data_size;             // unaligned original size
+    RootConstantChunk*       m_chunk_ptr = nullptr;   // chunk of the reserved slots or null for ranges reserved in storage
+    Data::Index              m_storage_index = 0U;    // index in storage live accessors, when reserved not in chunk
     mutable bool             m_is_initialized = false;
 };
 
@@ -79,18 +97,40 @@ class RootConstantStorage
 public:
     using Accessor = RootConstantAccessor;
 
+    struct Statistics
+    {
+        Data::Size live_size           = 0U; // total size of reserved root constants
+        Data::Size peak_live_size      = 0U; // maximum total size of reserved root constants
+        Data::Size buffer_size         = 0U; // storage size including free ranges
+        Data::Size free_size           = 0U; // total size of free ranges and free chunk slots
+        Data::Size max_free_range_size = 0U; // size of the largest free range outside of chunks
+        uint32_t   chunks_count        = 0U;
+        uint32_t   compactions_count   = 0U;
+
+        // Share of free memory which can not be reserved with one range: 0 - no fragmentation, 1 - maximum fragmentation
+        [[nodiscard]] float GetFragmentationRatio() const noexcept;
+    };
+
     RootConstantStorage() = default;
     virtual ~RootConstantStorage();
 
     // RootConstantStorage virtual methods
     [[nodiscard]] virtual UniquePtr<Accessor> ReserveRootConstant(Data::Size root_constant_size);
     virtual void ReleaseRootConstant(const Accessor& accessor);
-    virtual void SetRootConstant(const Accessor& accessor, const Rhi::RootConstant& root_constant);
+    virtual bool SetRootConstant(const Accessor& accessor, const Rhi::RootConstant& root_constant); // returns false when unchanged
+    virtual bool Compact(); // waits for completion of root constant reservations in progress
 
-    Data::Size GetDataSize() const noexcept { return m_deferred_size; }
+    Data::Size GetDataSize() const noexcept { return m_deferred_size.load(); }
     Data::Bytes& GetData();
 
+    // Returned pointer is valid until the storage data is resized for new root constants or compacted
+    [[nodiscard]] Data::Byte* GetRootConstantData(const Accessor& accessor);
+    Statistics GetStatistics();
+
 protected:
+    using RangeSet     = Data::RangeSet<Data::Index>;
+    using FreeRangeSet = Data::FreeRangeSet<Data::Index>;
+
 #ifdef TRACY_ENABLE
     using Mutex = tracy::Lockable<std::mutex>;
 #else
@@ -99,16 +139,58 @@ protected:
 
     std::scoped_lock<Mutex> GetLockGuard();
     bool IsDataResizeRequired() const noexcept { return m_data_resize_required.load(); }
+    bool IsCompactionRequired() const noexcept;
+
+    // Returns data ranges changed with SetRootConstant or moved by Compact since the previous call
+    [[nodiscard]] RangeSet TakeDirtyRanges();
 
 private:
-    using RangeSet = Data::RangeSet<Data::Index>;
 
-    Data::Size        m_deferred_size = 0U;
-    Data::Bytes       m_buffer_data;
-    std::atomic<bool> m_data_resize_required{ false };
-    RangeSet          m_free_ranges;
+    // Small root constants are reserved in chunk slots without locking:
+    // each thread reserves slots in the current chunk of its arena with atomic operations on the chunk free slots mask
+    // and only acquiring of the new arena chunk is done under storage lock
+    static constexpr size_t arenas_count = 16U;
+
+    // Chunk loaded from arena without locking can be removed by compaction, so compaction waits until arena reservations
+    // counters are zero, while new reservations are not started until compaction requests counter is zero
+    struct Arena
+    {
+        std::atomic<RootConstantChunk*> chunk_ptr{ nullptr };
+        std::atomic<uint32_t>           reservations_count{ 0U }; // chunk reservations in progress
+    };
+
+    using Arenas = std::array<Arena, arenas_count>;
+
+    UniquePtr<Accessor> ReserveChunkRootConstant(Data::Size root_constant_size, Data::Size slots_count);
+    RootConstantChunk& AcquireArenaChunk(Arena& arena, Data::Size slots_count, Data::Index& slot_index);
+    Accessor::Range ReserveFreeRange(Data::Size aligned_size);
+    void ClearReleasedData(const Accessor& accessor, const Accessor::Range& data_range);
+    void UpdatePeakLiveSize(Data::Size live_size) noexcept;
+
+    using Chunks = std::vector<UniquePtr<RootConstantChunk>>;
+
+    std::atomic<Data::Size> m_deferred_size{ 0U };
+    Data::Bytes             m_buffer_data;
+    std::atomic<bool>       m_data_resize_required{ false };
+    FreeRangeSet            m_free_ranges;
+    Chunks                  m_chunks;
+    Arenas                  m_arenas{ };
+    std::atomic<uint32_t>   m_compaction_requests_count{ 0U };
+    std::atomic<bool>       m_chunk_slots_released{ false };
+    std::vector<Accessor*>  m_accessors; // live accessors not in chunks indexed with RootConstantAccessor::m_storage_index
+    std::atomic<Data::Size> m_chunks_size{ 0U };
+    std::atomic<Data::Size> m_live_size{ 0U };
+    std::atomic<Data::Size> m_chunked_live_size{ 0U };
+    std::atomic<Data::Size> m_peak_live_size{ 0U };
+    uint32_t                m_compactions_count = 0U;
+    RangeSet                m_dirty_ranges;
 
     TracyLockable(std::mutex, m_mutex);
+    TracyLockable(std::mutex, m_dirty_ranges_mutex);
+
+    // Buffer data and chunk offsets are changed by data resize and compaction under exclusive lock,
+    // while root constants data is accessed by parallel threads under shared lock
+    TracySharedLockable(std::shared_mutex, m_data_mutex);
 };
 
 class Context;
@@ -134,7 +216,9 @@ public:
 
     // RootConstantStorage overrides
     [[nodiscard]] UniquePtr<Accessor> ReserveRootConstant(Data::Size root_constant_size) override;
-    void SetRootConstant(const Accessor& accessor, const Rhi::RootConstant& root_constant) override;
+    void ReleaseRootConstant(const Accessor& accessor) override;
+    bool SetRootConstant(const Accessor& accessor, const Rhi::RootConstant& root_constant) override;
+    bool Compact() override;
 
     Rhi::IBuffer& GetBuffer();
     const Ptr<Rhi::IBuffer>& GetBufferPtr() const { return m_buffer_ptr; }
@@ -144,9 +228,10 @@ public:
     void SetBufferName(std::string_view buffer_name);
     std::string_view GetBufferName() const { return m_buffer_name; }
 
-private:
-    using RangeSet = Data::RangeSet<Data::Index>;
+    // Size of root constants data uploaded to GPU buffer during the last resources upload
+    Data::Size GetUploadedDataSize() const noexcept { return m_uploaded_data_size; }
 
+private:
     void UpdateGpuBuffer(Rhi::ICommandQueue& target_cmd_queue);
 
     // Rhi::IContextCallback overrides
@@ -158,6 +243,8 @@ private:
     std::string       m_buffer_name;
     std::atomic<bool> m_buffer_resize_required{ false };
     std::atomic<bool> m_buffer_data_changed{ false };
+    bool              m_buffer_full_upload_required = false;
+    Data::Size        m_uploaded_data_size = 0U;
     Ptr<Rhi::IBuffer> m_buffer_ptr;
 };
 
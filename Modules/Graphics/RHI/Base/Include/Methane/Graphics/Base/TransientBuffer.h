@@ -0,0 +1,123 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/TransientBuffer.h
+Base implementation of the transient buffer interface with frame-indexed ring allocator.
+
+******************************************************************************/
+
+#pragma once
+
+#include "FrameRetireQueue.h"
+
+#include <Methane/Graphics/RHI/ITransientBuffer.h>
+#include <Methane/Graphics/RHI/ResourceView.h>
+
+#include <Methane/Memory.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Instrumentation.h>
+
+#include <atomic>
+#include <mutex>
+#include <array>
+#include <memory>
+
+namespace Methane::Graphics::Base
+{
+
+class Context;
+class Buffer;
+
+// Ring allocator with head and tail positions growing monotonically and wrapped to the buffer offsets:
+// slices are allocated by multiple threads without locking by moving the head position,
+// while the tail position is moved to the end of frame, which is completed on GPU
+class TransientRingAllocator
+{
+public:
+    using Statistics  = Rhi::TransientBufferStatistics;
+    using FlushRanges = std::array<Rhi::BytesRange, 2>; // second range is not empty when flushed data is wrapped
+    using Position    = uint64_t;
+
+    TransientRingAllocator(Data::Size capacity, Data::Size alignment);
+
+    // Returns aligned offset of the allocated slice or empty value when ring is full with slices of frames in flight
+    [[nodiscard]] Opt<Data::Size> Allocate(Data::Size size) noexcept;
+
+    // Frame is closed on CPU present with the frame buffer index and completed when the same index is waited on GPU
+    void CloseFrame(Data::Index frame_index);
+    void CompleteFrame(Data::Index frame_index);
+    void CompleteAllFrames();
+
+    // Returns buffer ranges allocated since the previous call, which have to be made visible to GPU
+    [[nodiscard]] FlushRanges TakeFlushRanges() noexcept;
+
+    [[nodiscard]] Data::Size GetCapacity() const noexcept  { return m_capacity; }
+    [[nodiscard]] Data::Size GetAlignment() const noexcept { return m_alignment; }
+    [[nodiscard]] Statistics GetStatistics() const noexcept;
+
+private:
+    struct FrameMarker
+    {
+        Data::Index frame_buffer_index;
+        Position    end_position;
+    };
+
+    const Data::Size        m_capacity;
+    const Data::Size        m_alignment;
+    std::atomic<Position>   m_head_position{ 0U };
+    std::atomic<Position>   m_tail_position{ 0U };
+    std::atomic<Position>   m_flushed_position{ 0U };
+    std::atomic<Data::Size> m_peak_used_size{ 0U };
+    std::atomic<uint32_t>   m_allocations_count{ 0U };
+    std::atomic<uint32_t>   m_frames_in_flight{ 0U };
+    TracyLockable(std::mutex, m_frame_markers_mutex);
+    FrameRetireQueue<FrameMarker> m_frame_markers; // markers of closed frames retired with closed frames counter
+    FrameIndex                    m_closed_frames_count = 0U;
+};
+
+class TransientBuffer final
+    : public Rhi::ITransientBuffer
+    , public std::enable_shared_from_this<TransientBuffer>
+{
+public:
+    TransientBuffer(const Context& context, const Settings& settings);
+    ~TransientBuffer() override;
+
+    // ITransientBuffer interface
+    [[nodiscard]] const Settings&       GetSettings() const noexcept override   { return m_settings; }
+    [[nodiscard]] Rhi::IBuffer&         GetBuffer() const noexcept override;
+    [[nodiscard]] Statistics            GetStatistics() const noexcept override { return m_allocator.GetStatistics(); }
+    [[nodiscard]] Ptr<ITransientBuffer> GetPtr() override                       { return shared_from_this(); }
+    [[nodiscard]] Slice                 Allocate(Data::Size size) override;
+    void Flush() override;
+
+    // TransientBuffer interface
+    void CloseFrame(Data::Index frame_index)    { m_allocator.CloseFrame(frame_index); }
+    void CompleteFrame(Data::Index frame_index) { m_allocator.CompleteFrame(frame_index); }
+    void CompleteAllFrames()                    { m_allocator.CompleteAllFrames(); }
+
+private:
+    const Context&         m_context;
+    const Settings         m_settings;
+    TransientRingAllocator m_allocator;
+    Ptr<Rhi::IBuffer>      m_buffer_ptr;
+    Buffer&                m_buffer;
+    Data::RawPtr           m_mapped_data_ptr;
+};
+
+} // namespace Methane::Graphics::Base
@@ -0,0 +1,165 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/BindlessDescriptorTable.cpp
+Backend-agnostic table of global bindless descriptor arrays with resource views
+registered once and referenced in shaders by their indices.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/BindlessDescriptorTable.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Base
+{
+
+BindlessDescriptorTable::BindlessDescriptorTable(const Settings& settings)
+    : m_settings(settings)
+    , m_descriptor_arrays{ {
+        { settings.buffers_count  },
+        { settings.textures_count },
+        { settings.samplers_count }
+    } }
+    , m_frame_counter(settings.retire_frames_count)
+{ }
+
+uint32_t BindlessDescriptorTable::AddResourceView(const Rhi::ResourceView& resource_view)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    const ViewKey view_key{ &resource_view.GetResource(), resource_view.GetSettings() };
+    if (const auto entry_it = m_entry_by_view.find(view_key);
+        entry_it != m_entry_by_view.end())
+    {
+        entry_it->second.references_count++;
+        m_reused_count++;
+        return entry_it->second.index;
+    }
+
+    const Rhi::ResourceType resource_type = resource_view.GetResource().GetResourceType();
+    const uint32_t index = AllocateIndex(resource_type);
+    WriteDescriptor(resource_type, index, resource_view);
+    m_writes_count++;
+
+    m_entry_by_view.try_emplace(view_key, ViewEntry{ resource_type, index, 1U });
+    return index;
+}
+
+void BindlessDescriptorTable::RemoveResourceView(const Rhi::ResourceView& resource_view)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    const auto entry_it = m_entry_by_view.find(ViewKey{ &resource_view.GetResource(), resource_view.GetSettings() });
+    META_CHECK_TRUE_DESCR(entry_it != m_entry_by_view.end(), "resource view is not registered in bindless descriptor table");
+
+    ViewEntry& view_entry = entry_it->second;
+    META_CHECK_NOT_ZERO(view_entry.references_count);
+    if (--view_entry.references_count)
+        return;
+
+    // Descriptor may still be accessed by GPU in the frames being rendered, so its index is retired instead of being freed
+    GetDescriptorArray(view_entry.resource_type).retired_indices.Retire(view_entry.index, m_frame_counter.GetFrameIndex());
+    m_entry_by_view.erase(entry_it);
+}
+
+void BindlessDescriptorTable::CompleteFrame()
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    const Opt<FrameIndex> completed_frame_index_opt = m_frame_counter.CompleteFrame();
+    if (!completed_frame_index_opt)
+        return;
+
+    for (DescriptorArray& descriptor_array : m_descriptor_arrays)
+    {
+        descriptor_array.retired_indices.CompleteFrames(*completed_frame_index_opt,
+            [&descriptor_array](uint32_t index) { descriptor_array.free_indices.push_back(index); });
+    }
+}
+
+void BindlessDescriptorTable::CompleteAllFrames()
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    m_frame_counter.CompleteAllFrames();
+    for (DescriptorArray& descriptor_array : m_descriptor_arrays)
+    {
+        descriptor_array.retired_indices.CompleteAllFrames(
+            [&descriptor_array](uint32_t index) { descriptor_array.free_indices.push_back(index); });
+    }
+}
+
+void BindlessDescriptorTable::SetRetireFramesCount(uint32_t retire_frames_count)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    m_settings.retire_frames_count = retire_frames_count;
+    m_frame_counter.SetRetireFramesCount(retire_frames_count);
+}
+
+uint32_t BindlessDescriptorTable::GetCapacity(Rhi::ResourceType resource_type) const noexcept
+{
+    META_FUNCTION_TASK();
+    return m_descriptor_arrays[static_cast<size_t>(resource_type)].capacity;
+}
+
+BindlessDescriptorTable::Statistics BindlessDescriptorTable::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    Statistics statistics{ static_cast<uint32_t>(m_entry_by_view.size()), 0U, m_writes_count, m_reused_count };
+    for (const DescriptorArray& descriptor_array : m_descriptor_arrays)
+    {
+        statistics.retired_count += descriptor_array.retired_indices.GetCount();
+    }
+    return statistics;
+}
+
+BindlessDescriptorTable::DescriptorArray& BindlessDescriptorTable::GetDescriptorArray(Rhi::ResourceType resource_type)
+{
+    META_FUNCTION_TASK();
+    const auto resource_type_index = static_cast<size_t>(resource_type);
+    META_CHECK_LESS(resource_type_index, m_descriptor_arrays.size());
+    return m_descriptor_arrays[resource_type_index];
+}
+
+uint32_t BindlessDescriptorTable::AllocateIndex(Rhi::ResourceType resource_type)
+{
+    META_FUNCTION_TASK();
+    DescriptorArray& descriptor_array = GetDescriptorArray(resource_type);
+    if (!descriptor_array.free_indices.empty())
+    {
+        const uint32_t index = descriptor_array.free_indices.back();
+        descriptor_array.free_indices.pop_back();
+        return index;
+    }
+
+    META_CHECK_LESS_DESCR(descriptor_array.allocated_count, descriptor_array.capacity,
+                          "bindless descriptor array capacity is exceeded, increase it in the table settings "
+                          "or release bindings with unused resource views");
+    return descriptor_array.allocated_count++;
+}
+
+} // namespace Methane::Graphics::Base
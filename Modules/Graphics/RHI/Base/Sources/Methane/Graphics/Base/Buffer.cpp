@@ -27,6 +27,8 @@ Base implementation of the buffer interface.
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Base
 {
 
@@ -65,8 +67,25 @@ void Buffer::SetData(Rhi::ICommandQueue&, const SubResource& sub_resource)
 
     const Data::Size reserved_data_size = GetDataSize(Data::MemoryState::Reserved);
     META_UNUSED(reserved_data_size);
-    META_CHECK_LESS_OR_EQUAL_DESCR(sub_resource.GetDataSize(), reserved_data_size, "can not set more data than allocated buffer size");
-    SetInitializedDataSize(sub_resource.GetDataSize());
+    if (!sub_resource.HasDataRange())
+    {
+        META_CHECK_LESS_OR_EQUAL_DESCR(sub_resource.GetDataSize(), reserved_data_size, "can not set more data than allocated buffer size");
+        SetInitializedDataSize(sub_resource.GetDataSize());
+        return;
+    }
+
+    // Sub-resource with data range updates only part of the buffer data at the range offset
+    const Rhi::BytesRange& data_range = sub_resource.GetDataRange();
+    META_CHECK_EQUAL_DESCR(sub_resource.GetDataSize(), data_range.GetLength(),
+                           "sub-resource data size should be equal to the length of data range");
+    META_CHECK_LESS_OR_EQUAL_DESCR(data_range.GetEnd(), reserved_data_size, "can not set data out of allocated buffer range");
+    SetInitializedDataSize(std::max(GetInitializedDataSize(), data_range.GetEnd()));
+}
+
+Data::RawPtr Buffer::GetMappedDataPtr()
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "persistent mapping is not supported by buffer '{}'", GetName());
 }
 
 } // namespace Methane::Graphics::Base
\ No newline at end of file
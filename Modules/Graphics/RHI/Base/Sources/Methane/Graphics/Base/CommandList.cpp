@@ -27,12 +27,16 @@ Base implementation of the command list interface.
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/Base/Resource.h>
+#include <Methane/Graphics/Base/ResourceBarriers.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <magic_enum/magic_enum.hpp>
 
+#include <algorithm>
+#include <bit>
+
 // Disable debug groups instrumentation with discontinuous CPU frames in Tracy,
 // because it is not working for parallel render command lists by some reason
 //#define METHANE_DEBUG_GROUP_FRAMES_ENABLED
@@ -40,6 +44,15 @@ Base implementation of the command list interface.
 namespace Methane::Graphics::Base
 {
 
+static constexpr size_t g_min_retained_objects_table_size = 64U;
+
+// Returns start slot of the linear probing sequence in the power of two sized table by Fibonacci hashing of the object address
+[[nodiscard]] static size_t GetRetainedObjectSlotIndex(const Object& object, size_t table_size) noexcept
+{
+    const auto object_address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(std::addressof(object))); // NOSONAR
+    return static_cast<size_t>((object_address * 0x9E3779B97F4A7C15ULL) >> (64 - std::countr_zero(table_size)));
+}
+
 #ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
 static Data::TimeRange GetNormalTimeRange(Timestamp start, Timestamp end)
 {
@@ -132,7 +145,9 @@ void CommandList::ResetOnce(IDebugGroup* debug_group_ptr)
 void CommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
 {
     META_FUNCTION_TASK();
-    if (m_command_state.program_bindings_ptr == std::addressof(program_bindings))
+    const bool is_program_bindings_redundant = m_command_state.program_bindings_ptr == std::addressof(program_bindings);
+    m_state_filtering_statistics.program_bindings.Count(is_program_bindings_redundant);
+    if (is_program_bindings_redundant)
         return;
 
     META_LOG("{} Command list '{}' SET PROGRAM BINDINGS '{}':\n{}",
@@ -153,8 +168,41 @@ void CommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rh
 
     if (apply_behavior.HasAnyBit(Rhi::ProgramBindingsApplyBehavior::RetainResources))
     {
-        RetainResource(program_bindings_base.GetBasePtr());
+        RetainResource(program_bindings_base);
+    }
+}
+
+void CommandList::SetProgramBindingsResourceBarriers(const Refs<Rhi::IProgramBindings>& program_bindings_refs)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (!m_batched_resource_barriers_ptr)
+        m_batched_resource_barriers_ptr = Rhi::IResourceBarriers::Create();
+
+    const Rhi::ICommandQueue& owner_queue = GetCommandQueue();
+    for(const Ref<Rhi::IProgramBindings>& program_bindings_ref : program_bindings_refs)
+    {
+        const auto& program_bindings = static_cast<const ProgramBindings&>(program_bindings_ref.get());
+        const Rhi::IResourceBarriers* resource_barriers_ptr = program_bindings.UpdateResourceTransitionBarriers(Rhi::ProgramArgumentAccessMask{ ~0U }, &owner_queue);
+        if (!resource_barriers_ptr)
+            continue;
+
+        const auto lock_guard = static_cast<const ResourceBarriers&>(*resource_barriers_ptr).Lock();
+        for(const auto& [barrier_id, barrier] : resource_barriers_ptr->GetMap())
+        {
+            // Different transitions of the same resource requested by different program bindings can not be merged
+            // in one batch, so the batch is flushed to keep the order of transitions
+            if (const Rhi::ResourceBarrier* batched_barrier_ptr = m_batched_resource_barriers_ptr->GetBarrier(barrier_id);
+                batched_barrier_ptr && *batched_barrier_ptr != barrier)
+            {
+                FlushBatchedResourceBarriers();
+            }
+            m_batched_resource_barriers_ptr->Add(barrier);
+        }
     }
+
+    FlushBatchedResourceBarriers();
 }
 
 void CommandList::Commit()
@@ -221,7 +269,18 @@ void CommandList::Complete()
     if (m_completed_callback)
         m_completed_callback(*this);
 
-    Data::Emitter<Rhi::ICommandListCallback>::Emit(&Rhi::ICommandListCallback::OnCommandListExecutionCompleted, *this);
+    // Completion is emitted from the GPU waiting thread, so receivers are called on deferred events queue flush when it is active
+    Data::Emitter<Rhi::ICommandListCallback>::EmitDeferred(&Rhi::ICommandListCallback::OnCommandListExecutionCompleted, *this);
+}
+
+void CommandList::FlushBatchedResourceBarriers()
+{
+    META_FUNCTION_TASK();
+    if (m_batched_resource_barriers_ptr->IsEmpty())
+        return;
+
+    SetResourceBarriers(*m_batched_resource_barriers_ptr);
+    static_cast<ResourceBarriers&>(*m_batched_resource_barriers_ptr).Clear();
 }
 
 void CommandList::CompleteInternal()
@@ -236,9 +295,62 @@ void CommandList::CompleteInternal()
     SetCommandListStateNoLock(State::Pending);
 
     TRACY_GPU_SCOPE_COMPLETE(m_tracy_gpu_scope, GetGpuTimeRange(false));
+#if defined(METHANE_TRACE_RECORDER_ENABLED) && defined(METHANE_GPU_INSTRUMENTATION_ENABLED)
+    const Data::TimeRange gpu_time_range = GetGpuTimeRange(true);
+    META_TRACE_GPU_RANGE(GetName(), m_command_queue_ptr->GetName(), gpu_time_range.GetStart(), gpu_time_range.GetEnd());
+#endif
     META_LOG("{} Command list '{}' was COMPLETED with GPU timings {}", magic_enum::enum_name(m_type), GetName(), static_cast<std::string>(GetGpuTimeRange(true)));
 }
 
+void CommandList::ReleaseRetainedResources()
+{
+    META_FUNCTION_TASK();
+    // Resources used after execution completion will be retained again, while retained resources capacity is reused
+    m_command_state.retained_resources.clear();
+    std::ranges::fill(m_command_state.retained_objects_table, nullptr);
+}
+
+bool CommandList::AddRetainedObject(const Object& object)
+{
+    // Table is kept at most half full to keep linear probing sequences short
+    std::vector<const Object*>& retained_objects_table = m_command_state.retained_objects_table;
+    if (retained_objects_table.size() < (m_command_state.retained_resources.size() + 1U) * 2U)
+        GrowRetainedObjectsTable();
+
+    const size_t slot_mask = retained_objects_table.size() - 1U;
+    for (size_t slot_index = GetRetainedObjectSlotIndex(object, retained_objects_table.size()); ; slot_index = (slot_index + 1U) & slot_mask)
+    {
+        const Object*& slot_object_ptr = retained_objects_table[slot_index];
+        if (slot_object_ptr == std::addressof(object))
+            return false;
+
+        if (!slot_object_ptr)
+        {
+            slot_object_ptr = std::addressof(object);
+            return true;
+        }
+    }
+}
+
+void CommandList::GrowRetainedObjectsTable()
+{
+    META_FUNCTION_TASK();
+    std::vector<const Object*>& retained_objects_table = m_command_state.retained_objects_table;
+    retained_objects_table.assign(std::max(g_min_retained_objects_table_size, retained_objects_table.size() * 2U), nullptr);
+
+    // Objects of the retained resources are added to the new table, since all of them are unique
+    const size_t slot_mask = retained_objects_table.size() - 1U;
+    for (const Ptr<Object>& retained_resource_ptr : m_command_state.retained_resources)
+    {
+        size_t slot_index = GetRetainedObjectSlotIndex(*retained_resource_ptr, retained_objects_table.size());
+        while (retained_objects_table[slot_index])
+        {
+            slot_index = (slot_index + 1U) & slot_mask;
+        }
+        retained_objects_table[slot_index] = retained_resource_ptr.get();
+    }
+}
+
 CommandListDebugGroup* CommandList::GetTopOpenDebugGroup() const
 {
     META_FUNCTION_TASK();
@@ -363,6 +475,8 @@ void CommandList::ResetCommandState()
 {
     META_FUNCTION_TASK();
     m_command_state.program_bindings_ptr = nullptr;
+    m_command_state.has_resource_barriers = false;
+    m_state_filtering_statistics = {};
 }
 
 void CommandList::ApplyProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
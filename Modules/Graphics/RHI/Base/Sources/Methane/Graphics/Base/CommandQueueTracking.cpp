@@ -54,8 +54,10 @@ static Tracy::GpuContext::Type ConvertSystemGraphicsApiToTracyGpuContextType(Rhi
 
 CommandQueueTracking::CommandQueueTracking(const Context& context, Rhi::CommandListType command_lists_type)
     : CommandQueue(context, command_lists_type)
-    , m_execution_waiting_thread(&CommandQueueTracking::WaitForExecution, this)
-{ }
+{
+    // Waiting thread is started after initialization of all members used by it
+    m_execution_waiting_thread = std::thread(&CommandQueueTracking::WaitForExecution, this);
+}
 
 CommandQueueTracking::~CommandQueueTracking()
 {
@@ -97,8 +99,22 @@ void CommandQueueTracking::Execute(Rhi::ICommandListSet& command_lists, const Rh
 
     auto& command_lists_base = static_cast<CommandListSet&>(command_lists);
     std::scoped_lock lock_guard(m_executing_command_lists_mutex);
-    m_executing_command_lists.push(command_lists_base.GetBasePtr());
-    m_execution_waiting_condition_var.notify_one();
+    const uint64_t push_index = m_executing_sets_push_index.load(std::memory_order_relaxed);
+    for(uint32_t completion_signal = m_completion_signal.load(std::memory_order_acquire);
+        push_index - m_executing_sets_pop_index.load(std::memory_order_acquire) >= executing_command_list_sets_capacity;
+        completion_signal = m_completion_signal.load(std::memory_order_acquire))
+    {
+        // Ring buffer is full, so wait for completion of the oldest executing command list set
+        META_CHECK_TRUE_DESCR(m_execution_waiting.load(), "Command queue '{}' execution waiting thread has unexpectedly finished", GetName());
+        WaitForCompletionSignal(completion_signal);
+    }
+
+    ReleaseCompletedCommandListSets();
+    m_executing_command_list_sets[push_index % executing_command_list_sets_capacity] = command_lists_base.GetBasePtr();
+    m_executing_sets_push_index.store(push_index + 1U, std::memory_order_release);
+
+    m_execution_signal.fetch_add(1U, std::memory_order_release);
+    m_execution_signal.notify_one();
 }
 
 bool CommandQueueTracking::SetName(std::string_view name)
@@ -115,26 +131,37 @@ void CommandQueueTracking::CompleteExecution(const Opt<Data::Index>& frame_index
 {
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_executing_command_lists_mutex);
-    while (!m_executing_command_lists.empty() &&
-           m_executing_command_lists.front()->GetFrameIndex() == frame_index)
+    const uint64_t sets_end = GetLeadingFrameCommandListSetsEnd(frame_index);
+    for(uint64_t set_index = m_executing_sets_pop_index.load(std::memory_order_acquire); set_index < sets_end; ++set_index)
     {
-        m_executing_command_lists.front()->Complete();
-        m_executing_command_lists.pop();
+        // Completed command list sets are skipped by the completion thread without waiting
+        GetExecutingCommandListSetPtr(set_index)->Complete();
     }
-    m_execution_waiting_condition_var.notify_one();
+    ReleaseCompletedCommandListSets();
 }
 
 void CommandQueueTracking::WaitUntilCompleted(const Opt<Data::Index>& frame_index, uint32_t timeout_ms)
 {
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_executing_command_lists_mutex);
-    while (!m_executing_command_lists.empty() &&
-           m_executing_command_lists.front()->GetFrameIndex() == frame_index)
+    const uint64_t sets_end = GetLeadingFrameCommandListSetsEnd(frame_index);
+    for(uint64_t set_index = m_executing_sets_pop_index.load(std::memory_order_acquire); set_index < sets_end; ++set_index)
     {
-        m_executing_command_lists.front()->WaitUntilCompleted(timeout_ms);
-        m_executing_command_lists.pop();
+        GetExecutingCommandListSetPtr(set_index)->WaitUntilCompleted(timeout_ms);
     }
-    m_execution_waiting_condition_var.notify_one();
+
+    // Wait until completed command list sets are popped by the completion thread,
+    // unless waiting has timed out and some command list sets may be still executing
+    if (!timeout_ms)
+    {
+        for(uint32_t completion_signal = m_completion_signal.load(std::memory_order_acquire);
+            m_execution_waiting && m_executing_sets_pop_index.load(std::memory_order_acquire) < sets_end;
+            completion_signal = m_completion_signal.load(std::memory_order_acquire))
+        {
+            WaitForCompletionSignal(completion_signal);
+        }
+    }
+    ReleaseCompletedCommandListSets();
 }
 
 void CommandQueueTracking::WaitForExecution() noexcept
@@ -143,11 +170,7 @@ void CommandQueueTracking::WaitForExecution() noexcept
     {
         do
         {
-            std::unique_lock lock(m_execution_waiting_mutex);
-            m_execution_waiting_condition_var.wait_for(lock, std::chrono::milliseconds(32),
-                [this] { return !m_execution_waiting || !m_executing_command_lists.empty(); }
-            );
-
+            const uint32_t execution_signal = m_execution_signal.load(std::memory_order_acquire);
             if (m_name_changed)
             {
                 const std::string thread_name = fmt::format("{} Wait for Execution", GetName());
@@ -155,14 +178,25 @@ void CommandQueueTracking::WaitForExecution() noexcept
                 m_name_changed = false;
             }
 
-            while (!m_executing_command_lists.empty())
+            const uint64_t sets_end = m_executing_sets_push_index.load(std::memory_order_acquire);
+            uint64_t set_index = m_executing_sets_pop_index.load(std::memory_order_relaxed);
+            if (set_index == sets_end)
             {
-                Ptr<CommandListSet> command_list_set_ptr = GetNextExecutingCommandListSet();
-                if (!command_list_set_ptr)
-                    break;
+                // Execution signal is loaded before checking for new command list sets and shutdown to not miss the wakeup
+                if (m_execution_waiting)
+                    WaitForExecutionSignal(execution_signal);
+                continue;
+            }
 
-                command_list_set_ptr->WaitUntilCompleted();
-                CompleteCommandListSetExecution(*command_list_set_ptr);
+            for(; set_index < sets_end; ++set_index)
+            {
+                // Command list set pointer is not modified by the executing thread until it is popped
+                CommandListSet& command_list_set = *GetExecutingCommandListSetPtr(set_index);
+                if (command_list_set.IsExecuting())
+                {
+                    command_list_set.WaitUntilCompleted();
+                }
+                CompleteCommandListSetExecution(command_list_set);
             }
 
             if (m_timestamp_query_pool_ptr)
@@ -171,53 +205,80 @@ void CommandQueueTracking::WaitForExecution() noexcept
                 GetTracyContext().Calibrate(calibrated_timestamps.cpu_ts, calibrated_timestamps.gpu_ts);
             }
         }
-        while (m_execution_waiting);
+        while (m_execution_waiting || m_executing_sets_pop_index.load(std::memory_order_acquire) < m_executing_sets_push_index.load(std::memory_order_acquire));
     }
     catch (...)
     {
         m_execution_waiting_exception_ptr = std::current_exception();
         m_execution_waiting = false;
+        m_completion_signal.fetch_add(1U, std::memory_order_release);
+        m_completion_signal.notify_all();
     }
 }
 
-Ptr<CommandListSet> CommandQueueTracking::GetLastExecutingCommandListSet() const
+void CommandQueueTracking::WaitForExecutionSignal(uint32_t execution_signal) const
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_executing_command_lists_mutex);
-    return m_executing_command_lists.empty() ? Ptr<CommandListSet>() : m_executing_command_lists.back();
+    m_execution_signal.wait(execution_signal, std::memory_order_acquire);
 }
 
-const Ptr<Rhi::ITimestampQueryPool>& CommandQueueTracking::GetTimestampQueryPoolPtr()
+void CommandQueueTracking::WaitForCompletionSignal(uint32_t completion_signal) const
 {
     META_FUNCTION_TASK();
-    if (!m_timestamp_query_pool_ptr)
-        InitializeTimestampQueryPool();
+    m_completion_signal.wait(completion_signal, std::memory_order_acquire);
+}
 
-    return m_timestamp_query_pool_ptr;
+void CommandQueueTracking::ReleaseCompletedCommandListSets()
+{
+    META_FUNCTION_TASK();
+    const uint64_t sets_end = m_executing_sets_pop_index.load(std::memory_order_acquire);
+    for(; m_executing_sets_release_index < sets_end; ++m_executing_sets_release_index)
+    {
+        m_executing_command_list_sets[m_executing_sets_release_index % executing_command_list_sets_capacity].reset();
+    }
+}
+
+uint64_t CommandQueueTracking::GetLeadingFrameCommandListSetsEnd(const Opt<Data::Index>& frame_index) const
+{
+    META_FUNCTION_TASK();
+    const uint64_t sets_end = m_executing_sets_push_index.load(std::memory_order_relaxed);
+    uint64_t set_index = m_executing_sets_pop_index.load(std::memory_order_acquire);
+    while (set_index < sets_end && GetExecutingCommandListSetPtr(set_index)->GetFrameIndex() == frame_index)
+    {
+        ++set_index;
+    }
+    return set_index;
 }
 
-const Ptr<CommandListSet>& CommandQueueTracking::GetNextExecutingCommandListSet() const
+Ptr<CommandListSet> CommandQueueTracking::GetLastExecutingCommandListSet() const
 {
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_executing_command_lists_mutex);
+    const uint64_t push_index = m_executing_sets_push_index.load(std::memory_order_relaxed);
+    return push_index > m_executing_sets_pop_index.load(std::memory_order_acquire)
+         ? GetExecutingCommandListSetPtr(push_index - 1U)
+         : Ptr<CommandListSet>();
+}
 
-    static const Ptr<CommandListSet> s_empty_command_list_set_ptr;
-    if (m_executing_command_lists.empty())
-        return s_empty_command_list_set_ptr;
+const Ptr<Rhi::ITimestampQueryPool>& CommandQueueTracking::GetTimestampQueryPoolPtr()
+{
+    META_FUNCTION_TASK();
+    if (!m_timestamp_query_pool_ptr)
+        InitializeTimestampQueryPool();
 
-    META_CHECK_NOT_NULL(m_executing_command_lists.front());
-    return m_executing_command_lists.front();
+    return m_timestamp_query_pool_ptr;
 }
 
 void CommandQueueTracking::CompleteCommandListSetExecution(CommandListSet& executing_command_list_set)
 {
     META_FUNCTION_TASK();
-    std::unique_lock lock_guard(m_executing_command_lists_mutex);
+    const uint64_t pop_index = m_executing_sets_pop_index.load(std::memory_order_relaxed);
+    META_CHECK_TRUE_DESCR(GetExecutingCommandListSetPtr(pop_index).get() == std::addressof(executing_command_list_set),
+                          "only the oldest executing command list set can be completed");
 
-    if (!m_executing_command_lists.empty() && m_executing_command_lists.front().get() == std::addressof(executing_command_list_set))
-    {
-        m_executing_command_lists.pop();
-    }
+    m_executing_sets_pop_index.store(pop_index + 1U, std::memory_order_release);
+    m_completion_signal.fetch_add(1U, std::memory_order_release);
+    m_completion_signal.notify_all();
 }
 
 void CommandQueueTracking::ShutdownQueueExecution()
@@ -228,16 +289,19 @@ void CommandQueueTracking::ShutdownQueueExecution()
 
     CompleteExecutionSafely();
 
-    m_execution_waiting_condition_var.notify_one();
+    m_execution_signal.fetch_add(1U, std::memory_order_release);
+    m_execution_signal.notify_one();
     m_execution_waiting_thread.join();
+    m_timestamp_query_pool_ptr.reset();
+
+    // Release all command list sets while derived command queue is still alive
+    std::scoped_lock lock_guard(m_executing_command_lists_mutex);
+    ReleaseCompletedCommandListSets();
 }
 
 void CommandQueueTracking::CompleteExecutionSafely()
 {
     META_FUNCTION_TASK();
-    std::unique_lock lock(m_execution_waiting_mutex);
-    m_timestamp_query_pool_ptr.reset();
-
     try
     {
         // Do not use virtual call in destructor
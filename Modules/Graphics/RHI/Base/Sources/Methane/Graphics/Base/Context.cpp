@@ -25,13 +25,18 @@ Base implementation of the context interface.
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/CommandKit.h>
+#include <Methane/Graphics/Base/TransientBuffer.h>
+#include <Methane/Graphics/Base/BindlessDescriptorTable.h>
 #include <Methane/Graphics/RHI/IDescriptorManager.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
 #include <Methane/Instrumentation.h>
 
 #include <fmt/format.h>
 #include <magic_enum/magic_enum.hpp>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Base
 {
 
@@ -137,6 +142,9 @@ void Context::OnGpuWaitComplete(WaitFor wait_for)
     META_FUNCTION_TASK();
     if (wait_for != WaitFor::ResourcesUploaded)
     {
+        CompleteRootConstantsUploadFrame();
+        CompleteTransientBuffersFrames();
+        CompleteBindlessDescriptorsFrames();
         PerformRequestedAction();
     }
 }
@@ -146,7 +154,14 @@ void Context::Release()
     META_FUNCTION_TASK();
     META_LOG("Context '{}' RELEASE", GetName());
 
+    {
+        // Native descriptors of bindless table have to be released before the device
+        std::lock_guard lock(m_bindless_descriptor_table_mutex);
+        m_bindless_descriptor_table_ptr.reset();
+    }
+
     m_device_ptr.reset();
+    m_default_transient_buffer_ptr.reset();
 
     m_default_command_kit_ptr_by_queue.clear();
     for (Ptr<Rhi::ICommandKit>& cmd_kit_ptr : m_default_command_kit_ptrs)
@@ -198,6 +213,31 @@ Rhi::ICommandKit& Context::GetDefaultCommandKit(Rhi::ICommandQueue& cmd_queue) c
     return *cmd_kit_ptr;
 }
 
+Rhi::ITransientBuffer& Context::GetTransientBuffer() const
+{
+    META_FUNCTION_TASK();
+    if (m_default_transient_buffer_ptr)
+        return *m_default_transient_buffer_ptr;
+
+    m_default_transient_buffer_ptr = Rhi::ITransientBuffer::Create(*this, Rhi::TransientBufferSettings{});
+    m_default_transient_buffer_ptr->GetBuffer().SetName(fmt::format("{} Transient Buffer", GetName()));
+    return *m_default_transient_buffer_ptr;
+}
+
+void Context::AddTransientBuffer(TransientBuffer& transient_buffer) const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_transient_buffers_mutex);
+    m_transient_buffers.push_back(&transient_buffer);
+}
+
+void Context::RemoveTransientBuffer(TransientBuffer& transient_buffer) const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_transient_buffers_mutex);
+    std::erase(m_transient_buffers, &transient_buffer);
+}
+
 const Rhi::IDevice& Context::GetDevice() const
 {
     META_FUNCTION_TASK();
@@ -325,6 +365,80 @@ bool Context::UploadResourcesAndNotify()
     return UploadResources();
 }
 
+void Context::CompleteRootConstantsUploadFrame() noexcept
+{
+    META_FUNCTION_TASK();
+    m_root_constants_uploaded_size = m_root_constants_uploading_size.exchange(0U);
+}
+
+void Context::CloseTransientBuffersFrame(Data::Index frame_index) const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_transient_buffers_mutex);
+    for(TransientBuffer* transient_buffer_ptr : m_transient_buffers)
+        transient_buffer_ptr->CloseFrame(frame_index);
+}
+
+void Context::CompleteTransientBuffersFrame(Data::Index frame_index) const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_transient_buffers_mutex);
+    for(TransientBuffer* transient_buffer_ptr : m_transient_buffers)
+        transient_buffer_ptr->CompleteFrame(frame_index);
+}
+
+void Context::CompleteTransientBuffersFrames() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_transient_buffers_mutex);
+    for(TransientBuffer* transient_buffer_ptr : m_transient_buffers)
+        transient_buffer_ptr->CompleteAllFrames();
+}
+
+Ptr<BindlessDescriptorTable> Context::GetBindlessDescriptorTablePtr() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_bindless_descriptor_table_mutex);
+    if (!m_bindless_descriptor_table_ptr)
+    {
+        // Indices of removed views are not reused until all frames in flight, which may access them, are completed
+        BindlessDescriptorTableSettings settings;
+        settings.retire_frames_count = GetBindlessDescriptorsRetireFramesCount();
+        m_bindless_descriptor_table_ptr = CreateBindlessDescriptorTable(settings);
+    }
+    return m_bindless_descriptor_table_ptr;
+}
+
+void Context::CompleteBindlessDescriptorsFrame() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_bindless_descriptor_table_mutex);
+    if (m_bindless_descriptor_table_ptr)
+        m_bindless_descriptor_table_ptr->CompleteFrame();
+}
+
+void Context::CompleteBindlessDescriptorsFrames() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_bindless_descriptor_table_mutex);
+    if (m_bindless_descriptor_table_ptr)
+        m_bindless_descriptor_table_ptr->CompleteAllFrames();
+}
+
+void Context::UpdateBindlessDescriptorsRetireFramesCount() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_bindless_descriptor_table_mutex);
+    if (m_bindless_descriptor_table_ptr)
+        m_bindless_descriptor_table_ptr->SetRetireFramesCount(GetBindlessDescriptorsRetireFramesCount());
+}
+
+uint32_t Context::GetBindlessDescriptorsRetireFramesCount() const noexcept
+{
+    META_FUNCTION_TASK();
+    return FrameRetireCounter::GetRetireFramesCountOf(GetFramesInFlightCount(), BindlessDescriptorTableSettings().retire_frames_count);
+}
+
 void Context::PerformRequestedAction()
 {
     META_FUNCTION_TASK();
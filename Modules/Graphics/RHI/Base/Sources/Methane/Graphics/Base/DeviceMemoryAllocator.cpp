@@ -0,0 +1,264 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/DeviceMemoryAllocator.cpp
+Backend-agnostic device memory allocator with resource memory sub-allocated
+from large native memory blocks using buddy allocation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/DeviceMemoryAllocator.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <bit>
+#include <algorithm>
+
+namespace Methane::Graphics::Base
+{
+
+DeviceMemoryBuddyAllocator::DeviceMemoryBuddyAllocator(uint64_t size, uint64_t min_allocation_size)
+    : m_size(size)
+    , m_min_allocation_size(min_allocation_size)
+    , m_max_order(static_cast<uint32_t>(std::countr_zero(size / min_allocation_size)))
+    , m_free_offsets_by_order(m_max_order + 1U)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(std::has_single_bit(min_allocation_size), "minimum allocation size must be a power of two");
+    META_CHECK_TRUE_DESCR(std::has_single_bit(size) && size >= min_allocation_size,
+                          "memory block size must be a power of two not less than minimum allocation size");
+    m_free_offsets_by_order[m_max_order].insert(0U);
+}
+
+Opt<uint64_t> DeviceMemoryBuddyAllocator::Allocate(uint64_t size, uint64_t alignment)
+{
+    META_FUNCTION_TASK();
+    if (!size || size > m_size || alignment > m_size)
+        return std::nullopt;
+
+    // Ranges of each order are aligned by their size, so the alignment is satisfied by allocation of larger order
+    const uint32_t order = GetOrderOfSize(std::max(size, alignment));
+    uint32_t free_order = order;
+    while(free_order <= m_max_order && m_free_offsets_by_order[free_order].empty())
+        ++free_order;
+
+    if (free_order > m_max_order)
+        return std::nullopt;
+
+    std::set<uint64_t>& free_offsets = m_free_offsets_by_order[free_order];
+    const uint64_t offset = *free_offsets.begin();
+    free_offsets.erase(free_offsets.begin());
+
+    // Split free range in halves down to the requested order and release the upper buddies
+    for(; free_order > order; --free_order)
+    {
+        m_free_offsets_by_order[free_order - 1U].insert(offset + GetSizeOfOrder(free_order - 1U));
+    }
+
+    m_order_by_offset.try_emplace(offset, order);
+    m_used_size += GetSizeOfOrder(order);
+    return offset;
+}
+
+void DeviceMemoryBuddyAllocator::Free(uint64_t offset)
+{
+    META_FUNCTION_TASK();
+    const auto order_it = m_order_by_offset.find(offset);
+    META_CHECK_TRUE_DESCR(order_it != m_order_by_offset.end(), "memory range at offset {} was not allocated", offset);
+
+    uint32_t order = order_it->second;
+    m_order_by_offset.erase(order_it);
+    m_used_size -= GetSizeOfOrder(order);
+
+    // Merge released range with free buddy ranges up to the maximum order
+    for(; order < m_max_order; ++order)
+    {
+        const uint64_t buddy_offset = offset ^ GetSizeOfOrder(order);
+        if (!m_free_offsets_by_order[order].erase(buddy_offset))
+            break;
+
+        offset = std::min(offset, buddy_offset);
+    }
+    m_free_offsets_by_order[order].insert(offset);
+}
+
+uint64_t DeviceMemoryBuddyAllocator::GetMaxFreeRangeSize() const noexcept
+{
+    META_FUNCTION_TASK();
+    for(uint32_t order = m_max_order + 1U; order > 0U; --order)
+    {
+        if (!m_free_offsets_by_order[order - 1U].empty())
+            return GetSizeOfOrder(order - 1U);
+    }
+    return 0U;
+}
+
+uint32_t DeviceMemoryBuddyAllocator::GetOrderOfSize(uint64_t size) const noexcept
+{
+    const uint64_t ranges_count = (size + m_min_allocation_size - 1U) / m_min_allocation_size;
+    return static_cast<uint32_t>(std::bit_width(ranges_count - 1U));
+}
+
+DeviceMemoryAllocator::DeviceMemoryAllocator(const Settings& settings)
+    : m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS_OR_EQUAL_DESCR(settings.dedicated_min_size, settings.block_size,
+                                   "dedicated allocation size must not be greater than memory block size");
+}
+
+DeviceMemoryAllocator::Allocation DeviceMemoryAllocator::Allocate(Data::Index pool_index, uint64_t size, uint64_t alignment)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(size, "can not allocate device memory of zero size");
+    std::lock_guard lock(m_mutex);
+
+    if (size >= m_settings.dedicated_min_size)
+    {
+        const Data::Index block_index = AddBlock(pool_index, size, true);
+        if (block_index == static_cast<Data::Index>(m_blocks.size()))
+            return {};
+
+        m_used_size += size;
+        m_allocations_count++;
+        return Allocation{ pool_index, block_index, 0U, size, true };
+    }
+
+    // Sub-allocate from the first memory block of the pool with enough free space or from the new block
+    Opt<uint64_t> offset_opt;
+    Data::Index block_index = 0U;
+    for(; block_index < m_blocks.size(); ++block_index)
+    {
+        Opt<Block>& block_opt = m_blocks[block_index];
+        if (!block_opt || block_opt->pool_index != pool_index || !block_opt->buddy_allocator_ptr)
+            continue;
+
+        offset_opt = block_opt->buddy_allocator_ptr->Allocate(size, alignment);
+        if (offset_opt)
+            break;
+    }
+
+    if (!offset_opt)
+    {
+        block_index = AddBlock(pool_index, m_settings.block_size, false);
+        if (block_index == static_cast<Data::Index>(m_blocks.size()))
+            return {};
+
+        offset_opt = m_blocks[block_index]->buddy_allocator_ptr->Allocate(size, alignment);
+        META_CHECK_TRUE_DESCR(offset_opt.has_value(), "failed to allocate {} bytes in the new memory block", size);
+    }
+
+    m_used_size += size;
+    m_allocations_count++;
+    return Allocation{ pool_index, block_index, *offset_opt, size, false };
+}
+
+void DeviceMemoryAllocator::Free(const Allocation& allocation)
+{
+    META_FUNCTION_TASK();
+    if (!allocation.IsInitialized())
+        return;
+
+    std::lock_guard lock(m_mutex);
+    META_CHECK_LESS(allocation.block_index, m_blocks.size());
+    Opt<Block>& block_opt = m_blocks[allocation.block_index];
+    META_CHECK_TRUE_DESCR(block_opt.has_value(), "memory block {} was already released", allocation.block_index);
+
+    m_used_size -= allocation.size;
+    m_allocations_count--;
+
+    if (allocation.is_dedicated)
+    {
+        RemoveBlock(allocation.block_index);
+        return;
+    }
+
+    // One empty block is kept in each pool to avoid reallocation of native memory, when resources are recreated
+    block_opt->buddy_allocator_ptr->Free(allocation.offset);
+    if (block_opt->buddy_allocator_ptr->IsEmpty() &&
+        HasOtherEmptyBlock(allocation.pool_index, allocation.block_index))
+    {
+        RemoveBlock(allocation.block_index);
+    }
+}
+
+DeviceMemoryAllocator::Statistics DeviceMemoryAllocator::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    Statistics statistics;
+    statistics.allocated_size         = m_allocated_size;
+    statistics.used_size              = m_used_size;
+    statistics.blocks_count           = static_cast<uint32_t>(std::ranges::count_if(m_blocks, [](const Opt<Block>& block_opt)
+                                                                                    { return block_opt.has_value(); }));
+    statistics.dedicated_blocks_count = m_dedicated_blocks_count;
+    statistics.allocations_count      = m_allocations_count;
+    return statistics;
+}
+
+Data::Index DeviceMemoryAllocator::AddBlock(Data::Index pool_index, uint64_t size, bool is_dedicated)
+{
+    META_FUNCTION_TASK();
+    const auto free_block_it = std::ranges::find_if(m_blocks, [](const Opt<Block>& block_opt) { return !block_opt.has_value(); });
+    const auto block_index = static_cast<Data::Index>(std::distance(m_blocks.begin(), free_block_it));
+    if (!AllocateMemoryBlock(pool_index, block_index, size))
+        return static_cast<Data::Index>(m_blocks.size());
+
+    UniquePtr<DeviceMemoryBuddyAllocator> buddy_allocator_ptr = is_dedicated
+        ? nullptr
+        : std::make_unique<DeviceMemoryBuddyAllocator>(size, m_settings.min_allocation_size);
+
+    if (free_block_it == m_blocks.end())
+        m_blocks.emplace_back(Block{ pool_index, size, std::move(buddy_allocator_ptr) });
+    else
+        free_block_it->emplace(Block{ pool_index, size, std::move(buddy_allocator_ptr) });
+
+    m_allocated_size += size;
+    if (is_dedicated)
+        m_dedicated_blocks_count++;
+
+    return block_index;
+}
+
+void DeviceMemoryAllocator::RemoveBlock(Data::Index block_index)
+{
+    META_FUNCTION_TASK();
+    Opt<Block>& block_opt = m_blocks[block_index];
+    m_allocated_size -= block_opt->size;
+    if (!block_opt->buddy_allocator_ptr)
+        m_dedicated_blocks_count--;
+
+    FreeMemoryBlock(block_index);
+    block_opt.reset();
+}
+
+bool DeviceMemoryAllocator::HasOtherEmptyBlock(Data::Index pool_index, Data::Index block_index) const
+{
+    META_FUNCTION_TASK();
+    for(Data::Index other_block_index = 0U; other_block_index < m_blocks.size(); ++other_block_index)
+    {
+        const Opt<Block>& block_opt = m_blocks[other_block_index];
+        if (other_block_index != block_index && block_opt && block_opt->pool_index == pool_index &&
+            block_opt->buddy_allocator_ptr && block_opt->buddy_allocator_ptr->IsEmpty())
+            return true;
+    }
+    return false;
+}
+
+} // namespace Methane::Graphics::Base
@@ -0,0 +1,302 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/FrameGraph.cpp
+Methane frame graph implementation: culls unused passes, aliases transient textures
+and infers resource transition barriers from resource usages declared by passes.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/FrameGraph.h>
+
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Graphics/RHI/IResource.h>
+#include <Methane/Graphics/RHI/ITexture.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace Methane::Graphics::Rhi
+{
+
+Ptr<IFrameGraph> IFrameGraph::Create(const IContext& context)
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<Base::FrameGraph>(context);
+}
+
+} // namespace Methane::Graphics::Rhi
+
+namespace Methane::Graphics::Base
+{
+
+FrameGraph::FrameGraph(const Rhi::IContext& context)
+    : m_context(context)
+{ }
+
+FrameGraph::ResourceId FrameGraph::ImportResource(Rhi::IResource& resource, bool is_output)
+{
+    META_FUNCTION_TASK();
+    m_resources.push_back(Resource{ &resource, std::nullopt, is_output });
+    m_is_compiled = false;
+    return static_cast<ResourceId>(m_resources.size() - 1U);
+}
+
+FrameGraph::ResourceId FrameGraph::AddTransientTexture(const Rhi::TextureSettings& settings)
+{
+    META_FUNCTION_TASK();
+    m_resources.push_back(Resource{ nullptr, settings, false });
+    m_is_compiled = false;
+    return static_cast<ResourceId>(m_resources.size() - 1U);
+}
+
+FrameGraph::PassId FrameGraph::AddPass(const PassSettings& settings, const PassFunction& function)
+{
+    META_FUNCTION_TASK();
+    for(const ResourceUsage& resource_usage : settings.resource_usages)
+    {
+        META_CHECK_LESS_DESCR(resource_usage.resource_id, m_resources.size(),
+                              "frame graph pass '{}' uses unknown resource", settings.name);
+    }
+    m_passes.push_back(Pass{ settings, function });
+    m_is_compiled = false;
+    return static_cast<PassId>(m_passes.size() - 1U);
+}
+
+const FrameGraph::Schedule& FrameGraph::Compile()
+{
+    META_FUNCTION_TASK();
+    m_schedule = {};
+    m_is_compiled = false;
+
+    const PassAliveFlags pass_alive_flags = CullPasses();
+    AliasTransientTextures(pass_alive_flags);
+    ScheduleTransitions(pass_alive_flags);
+
+    META_LOG("Frame graph compiled with {} scheduled passes, {} culled passes, {} transitions and {} transient texture slots",
+             m_schedule.passes.size(), m_schedule.culled_pass_ids.size(),
+             m_schedule.GetTransitionsCount(), m_schedule.transient_slots_count);
+
+    m_is_compiled = true;
+    return m_schedule;
+}
+
+void FrameGraph::Execute()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(m_is_compiled, "frame graph must be compiled before execution");
+
+    for(size_t scheduled_pass_index = 0U; scheduled_pass_index < m_scheduled_passes.size(); ++scheduled_pass_index)
+    {
+        ScheduledPass& scheduled_pass = m_scheduled_passes[scheduled_pass_index];
+
+        // Transitions are updated from actual resource states, which may differ from compiled schedule
+        // when resources are used outside of the frame graph or when frame graph is executed in a loop
+        for(const auto& [resource_ptr, resource_state] : scheduled_pass.resource_states)
+        {
+            resource_ptr->SetState(resource_state, scheduled_pass.barriers_ptr);
+        }
+
+        if (const Pass& pass = m_passes[m_schedule.passes[scheduled_pass_index].pass_id];
+            pass.function)
+        {
+            pass.function(*scheduled_pass.barriers_ptr);
+        }
+    }
+}
+
+Rhi::IResource& FrameGraph::GetResource(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    return *GetResourcePtr(resource_id);
+}
+
+FrameGraph::PassAliveFlags FrameGraph::CullPasses()
+{
+    META_FUNCTION_TASK();
+    std::vector<bool> resource_needed_flags(m_resources.size(), false);
+    for(size_t resource_index = 0U; resource_index < m_resources.size(); ++resource_index)
+    {
+        resource_needed_flags[resource_index] = m_resources[resource_index].is_output;
+    }
+
+    // Passes are visited in reverse order: pass is alive when it is output or writes resource needed by the following alive passes.
+    // Resources written by alive pass are kept needed too, so that preceding passes writing the same resource
+    // are not culled, because their results may be loaded by the following pass render targets
+    PassAliveFlags pass_alive_flags(m_passes.size(), false);
+    for(size_t pass_index = m_passes.size(); pass_index-- > 0U;)
+    {
+        const PassSettings& pass_settings = m_passes[pass_index].settings;
+        const bool is_pass_alive = pass_settings.is_output ||
+            std::ranges::any_of(pass_settings.resource_usages,
+                                [&resource_needed_flags](const ResourceUsage& resource_usage)
+                                {
+                                    return resource_usage.access == ResourceAccess::Write &&
+                                           resource_needed_flags[resource_usage.resource_id];
+                                });
+        if (!is_pass_alive)
+        {
+            m_schedule.culled_pass_ids.push_back(static_cast<PassId>(pass_index));
+            continue;
+        }
+
+        pass_alive_flags[pass_index] = true;
+        for(const ResourceUsage& resource_usage : pass_settings.resource_usages)
+        {
+            resource_needed_flags[resource_usage.resource_id] = true;
+        }
+    }
+
+    std::ranges::reverse(m_schedule.culled_pass_ids);
+    return pass_alive_flags;
+}
+
+void FrameGraph::AliasTransientTextures(const PassAliveFlags& pass_alive_flags)
+{
+    META_FUNCTION_TASK();
+    std::vector<Opt<ResourceLifetime>> resource_lifetimes(m_resources.size());
+    Data::Index scheduled_pass_index = 0U;
+    for(size_t pass_index = 0U; pass_index < m_passes.size(); ++pass_index)
+    {
+        if (!pass_alive_flags[pass_index])
+            continue;
+
+        for(const ResourceUsage& resource_usage : m_passes[pass_index].settings.resource_usages)
+        {
+            if (Opt<ResourceLifetime>& lifetime_opt = resource_lifetimes[resource_usage.resource_id];
+                lifetime_opt)
+                lifetime_opt->second = scheduled_pass_index;
+            else
+                lifetime_opt = ResourceLifetime{ scheduled_pass_index, scheduled_pass_index };
+        }
+        scheduled_pass_index++;
+    }
+
+    std::vector<ResourceId> transient_resource_ids;
+    for(size_t resource_index = 0U; resource_index < m_resources.size(); ++resource_index)
+    {
+        if (m_resources[resource_index].transient_settings_opt && resource_lifetimes[resource_index])
+            transient_resource_ids.push_back(static_cast<ResourceId>(resource_index));
+    }
+    std::ranges::stable_sort(transient_resource_ids, {},
+                             [&resource_lifetimes](ResourceId resource_id) { return resource_lifetimes[resource_id]->first; });
+
+    // Transient textures are assigned greedily in order of first use to the physical texture slots
+    // with equal settings, which were last used by the passes scheduled before
+    using TextureSlot = std::pair<const Rhi::TextureSettings*, Data::Index>; // settings and last scheduled pass index
+    std::vector<TextureSlot> texture_slots;
+    m_schedule.transient_slot_by_resource.resize(m_resources.size());
+    for(const ResourceId resource_id : transient_resource_ids)
+    {
+        const Rhi::TextureSettings& texture_settings = *m_resources[resource_id].transient_settings_opt;
+        const ResourceLifetime&     resource_lifetime = *resource_lifetimes[resource_id];
+        const auto texture_slot_it = std::ranges::find_if(texture_slots,
+            [&texture_settings, &resource_lifetime](const TextureSlot& texture_slot)
+            {
+                return texture_slot.second < resource_lifetime.first && *texture_slot.first == texture_settings;
+            });
+
+        if (texture_slot_it == texture_slots.end())
+        {
+            m_schedule.transient_slot_by_resource[resource_id] = static_cast<Data::Index>(texture_slots.size());
+            texture_slots.emplace_back(&texture_settings, resource_lifetime.second);
+        }
+        else
+        {
+            m_schedule.transient_slot_by_resource[resource_id] = static_cast<Data::Index>(std::distance(texture_slots.begin(), texture_slot_it));
+            texture_slot_it->second = resource_lifetime.second;
+        }
+    }
+    m_schedule.transient_slots_count = static_cast<Data::Size>(texture_slots.size());
+
+    // Physical textures are kept between compilations when slot settings are not changed
+    m_transient_texture_ptrs.resize(texture_slots.size());
+    for(size_t slot_index = 0U; slot_index < texture_slots.size(); ++slot_index)
+    {
+        const Rhi::TextureSettings& texture_settings = *texture_slots[slot_index].first;
+        Ptr<Rhi::ITexture>& texture_ptr = m_transient_texture_ptrs[slot_index];
+        if (texture_ptr && texture_ptr->GetSettings() == texture_settings)
+            continue;
+
+        texture_ptr = Rhi::ITexture::Create(m_context, texture_settings);
+        texture_ptr->SetName(fmt::format("Frame Graph Transient Texture {}", slot_index));
+    }
+}
+
+void FrameGraph::ScheduleTransitions(const PassAliveFlags& pass_alive_flags)
+{
+    META_FUNCTION_TASK();
+    std::unordered_map<const Rhi::IResource*, Rhi::ResourceState> resource_states;
+    m_scheduled_passes.clear();
+
+    for(size_t pass_index = 0U; pass_index < m_passes.size(); ++pass_index)
+    {
+        if (!pass_alive_flags[pass_index])
+            continue;
+
+        const PassSettings&         pass_settings = m_passes[pass_index].settings;
+        Rhi::FrameGraphPassSchedule pass_schedule{ static_cast<PassId>(pass_index), {} };
+        ScheduledPass               scheduled_pass{ {}, Rhi::IResourceBarriers::Create() };
+
+        for(const ResourceUsage& resource_usage : pass_settings.resource_usages)
+        {
+            Rhi::IResource* resource_ptr = GetResourcePtr(resource_usage.resource_id);
+            if (const auto pass_resource_state_it = std::ranges::find(scheduled_pass.resource_states, resource_ptr, &ScheduledPass::ResourceState::first);
+                pass_resource_state_it != scheduled_pass.resource_states.end())
+            {
+                META_CHECK_TRUE_DESCR(pass_resource_state_it->second == resource_usage.state,
+                                      "frame graph pass '{}' uses resource '{}' in different states",
+                                      pass_settings.name, resource_ptr->GetName());
+                continue;
+            }
+            scheduled_pass.resource_states.emplace_back(resource_ptr, resource_usage.state);
+
+            // Consecutive usages of the resource in the same state do not require transitions
+            const auto resource_state_it = resource_states.try_emplace(resource_ptr, resource_ptr->GetState()).first;
+            if (resource_state_it->second == resource_usage.state)
+                continue;
+
+            pass_schedule.transitions.push_back(Rhi::FrameGraphTransition{ resource_usage.resource_id, resource_state_it->second, resource_usage.state });
+            resource_state_it->second = resource_usage.state;
+        }
+
+        m_schedule.passes.push_back(std::move(pass_schedule));
+        m_scheduled_passes.push_back(std::move(scheduled_pass));
+    }
+}
+
+Rhi::IResource* FrameGraph::GetResourcePtr(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(resource_id, m_resources.size());
+    if (Rhi::IResource* imported_resource_ptr = m_resources[resource_id].imported_resource_ptr;
+        imported_resource_ptr)
+        return imported_resource_ptr;
+
+    META_CHECK_TRUE_DESCR(resource_id < m_schedule.transient_slot_by_resource.size() &&
+                          m_schedule.transient_slot_by_resource[resource_id].has_value(),
+                          "frame graph transient texture {} is not used by scheduled passes or frame graph was not compiled",
+                          resource_id);
+    return m_transient_texture_ptrs[*m_schedule.transient_slot_by_resource[resource_id]].get();
+}
+
+} // namespace Methane::Graphics::Base
@@ -38,6 +38,8 @@ Base implementation of the parallel render command list interface.
 #include <fmt/format.h>
 
 #include <string_view>
+#include <algorithm>
+#include <iterator>
 
 namespace Methane::Graphics::Base
 {
@@ -58,6 +60,14 @@ void ParallelRenderCommandList::SetValidationEnabled(bool is_validation_enabled)
     }
 }
 
+void ParallelRenderCommandList::SetParallelCommandListsReuseEnabled(bool is_reuse_enabled)
+{
+    META_FUNCTION_TASK();
+    m_is_parallel_command_lists_reuse_enabled = is_reuse_enabled;
+    if (!m_is_parallel_command_lists_reuse_enabled)
+        m_reserved_parallel_command_lists.clear();
+}
+
 Rhi::IRenderPass& ParallelRenderCommandList::GetRenderPass() const
 {
     META_FUNCTION_TASK();
@@ -103,25 +113,41 @@ void ParallelRenderCommandList::ResetImpl(IDebugGroup* debug_group_ptr, const Re
         }
     }
 
-    // Per-thread render command lists can be reset in parallel only with DirectX 12 on Windows
-#ifdef _WIN32
+    // Per-thread render command lists own their native command allocators (pools), so they can be reset in parallel
+    const auto command_lists_count = static_cast<Data::Index>(m_parallel_command_lists.size());
+    if (!IsParallelResetSupported() || command_lists_count < 2U)
+    {
+        for(Data::Index command_list_index = 0U; command_list_index < command_lists_count; ++command_list_index)
+            reset_command_list_fn(command_list_index);
+        return;
+    }
+
     tf::Taskflow reset_task_flow;
-    reset_task_flow.for_each_index(0U, static_cast<uint32_t>(m_parallel_command_lists.size()), 1U, reset_command_list_fn);
+    reset_task_flow.for_each_index(0U, command_lists_count, 1U, reset_command_list_fn);
     GetCommandQueue().GetContext().GetParallelExecutor().run(reset_task_flow).get();
-#else
-    for(Data::Index command_list_index = 0U; command_list_index < static_cast<Data::Index>(m_parallel_command_lists.size()); ++command_list_index)
-        reset_command_list_fn(command_list_index);
-#endif
 }
 
 void ParallelRenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
+    // Idle thread command lists stay in encoding state: they are not committed and executed,
+    // and their native command lists are not reset on the next reset, since they were not closed.
+    // Resources retained by idle command lists are not used by GPU, so they are released right away
+    const bool is_idle_skip_supported = IsIdleCommandListsSkipSupported();
+    m_committed_parallel_command_lists.clear();
+    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_parallel_command_lists)
+    {
+        META_CHECK_NOT_NULL(render_command_list_ptr);
+        if (!is_idle_skip_supported || !render_command_list_ptr->IsIdle())
+            m_committed_parallel_command_lists.emplace_back(render_command_list_ptr);
+        else
+            render_command_list_ptr->ReleaseIdleEncoding();
+    }
+
     tf::Taskflow commit_task_flow;
-    commit_task_flow.for_each(m_parallel_command_lists.begin(), m_parallel_command_lists.end(),
+    commit_task_flow.for_each(m_committed_parallel_command_lists.begin(), m_committed_parallel_command_lists.end(),
         [](const Ptr<RenderCommandList>& render_command_list_ptr)
         {
-            META_CHECK_NOT_NULL(render_command_list_ptr);
             render_command_list_ptr->Commit();
         }
     );
@@ -145,8 +171,15 @@ void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count)
     const auto initial_count = static_cast<uint32_t>(m_parallel_command_lists.size());
     if (count < initial_count)
     {
-        m_parallel_command_lists.erase(m_parallel_command_lists.begin() + count);
-        m_parallel_command_lists_refs.erase(m_parallel_command_lists_refs.begin() + count);
+        if (m_is_parallel_command_lists_reuse_enabled)
+        {
+            // Released command lists are kept with their native command buffers to be reused on the next count increase
+            m_reserved_parallel_command_lists.insert(m_reserved_parallel_command_lists.begin(),
+                                                     std::make_move_iterator(m_parallel_command_lists.begin() + count),
+                                                     std::make_move_iterator(m_parallel_command_lists.end()));
+        }
+        m_parallel_command_lists.erase(m_parallel_command_lists.begin() + count, m_parallel_command_lists.end());
+        m_parallel_command_lists_refs.erase(m_parallel_command_lists_refs.begin() + count, m_parallel_command_lists_refs.end());
         return;
     }
 
@@ -154,10 +187,20 @@ void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count)
     m_parallel_command_lists.reserve(count);
     m_parallel_command_lists_refs.reserve(count);
 
+    const auto reused_count = std::min(static_cast<uint32_t>(m_reserved_parallel_command_lists.size()), count - initial_count);
+    m_parallel_command_lists.insert(m_parallel_command_lists.end(),
+                                    std::make_move_iterator(m_reserved_parallel_command_lists.begin()),
+                                    std::make_move_iterator(m_reserved_parallel_command_lists.begin() + reused_count));
+    m_reserved_parallel_command_lists.erase(m_reserved_parallel_command_lists.begin(),
+                                            m_reserved_parallel_command_lists.begin() + reused_count);
+
     for(uint32_t cmd_list_index = initial_count; cmd_list_index < count; ++cmd_list_index)
     {
-        m_parallel_command_lists.emplace_back(std::static_pointer_cast<RenderCommandList>(CreateCommandList(false)));
-        RenderCommandList& render_command_list = *m_parallel_command_lists.back();
+        if (cmd_list_index >= initial_count + reused_count)
+        {
+            m_parallel_command_lists.emplace_back(std::static_pointer_cast<RenderCommandList>(CreateCommandList(false)));
+        }
+        RenderCommandList& render_command_list = *m_parallel_command_lists[cmd_list_index];
         render_command_list.SetValidationEnabled(m_is_validation_enabled);
         m_parallel_command_lists_refs.emplace_back(render_command_list);
         if (!name.empty())
@@ -167,6 +210,80 @@ void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count)
     }
 }
 
+void ParallelRenderCommandList::DrawParallel(Data::Size draws_count, const DrawRangeFunction& draw_range_fn,
+                                             const DrawCostFunction& draw_cost_fn, Data::Size min_command_list_cost)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_EMPTY_DESCR(m_parallel_command_lists, "parallel command lists count must be set before drawing");
+
+    const std::vector<DrawRange> draw_ranges = PartitionDraws(static_cast<Data::Size>(m_parallel_command_lists.size()),
+                                                              draws_count, draw_cost_fn, min_command_list_cost);
+    if (draw_ranges.size() < 2U)
+    {
+        // Single draw range is encoded in the calling thread to avoid task scheduling overhead for small draws count
+        if (!draw_ranges.empty())
+            draw_range_fn(*m_parallel_command_lists.front(), draw_ranges.front());
+        return;
+    }
+
+    tf::Taskflow draw_task_flow;
+    draw_task_flow.for_each_index(0U, static_cast<Data::Index>(draw_ranges.size()), 1U,
+        [this, &draw_ranges, &draw_range_fn](const Data::Index cmd_list_index)
+        {
+            META_FUNCTION_TASK();
+            draw_range_fn(*m_parallel_command_lists[cmd_list_index], draw_ranges[cmd_list_index]);
+        }
+    );
+    GetCommandQueue().GetContext().GetParallelExecutor().run(draw_task_flow).get();
+}
+
+std::vector<ParallelRenderCommandList::DrawRange> ParallelRenderCommandList::PartitionDraws(Data::Size command_lists_count, Data::Size draws_count,
+                                                                                             const DrawCostFunction& draw_cost_fn,
+                                                                                             Data::Size min_command_list_cost)
+{
+    META_FUNCTION_TASK();
+    std::vector<DrawRange> draw_ranges;
+    if (!command_lists_count || !draws_count)
+        return draw_ranges;
+
+    std::vector<uint64_t> draw_costs;
+    uint64_t total_cost = draws_count;
+    if (draw_cost_fn)
+    {
+        draw_costs.reserve(draws_count);
+        total_cost = 0U;
+        for(Data::Index draw_index = 0U; draw_index < draws_count; ++draw_index)
+        {
+            total_cost += draw_costs.emplace_back(draw_cost_fn(draw_index));
+        }
+    }
+
+    // Only command lists with enough work are used, so that small frames do not pay for idle threads
+    const uint64_t min_cost = std::max(min_command_list_cost, 1U);
+    const auto ranges_count = static_cast<Data::Size>(std::clamp<uint64_t>(total_cost / min_cost, 1U,
+                                                                           std::min(command_lists_count, draws_count)));
+    draw_ranges.reserve(ranges_count);
+
+    // Range is closed when accumulated cost reaches its proportional share of the total cost,
+    // while leaving at least one draw for each of the remaining ranges
+    Data::Index range_start = 0U;
+    uint64_t accumulated_cost = 0U;
+    for(Data::Index draw_index = 0U; draw_index < draws_count && draw_ranges.size() + 1U < ranges_count; ++draw_index)
+    {
+        accumulated_cost += draw_costs.empty() ? 1U : draw_costs[draw_index];
+        const auto closed_ranges_count = static_cast<uint64_t>(draw_ranges.size() + 1U);
+        const bool is_cost_reached     = accumulated_cost * ranges_count >= total_cost * closed_ranges_count;
+        const bool is_draws_exhausted  = draws_count - draw_index - 1U <= ranges_count - closed_ranges_count;
+        if (is_cost_reached || is_draws_exhausted)
+        {
+            draw_ranges.emplace_back(range_start, draw_index + 1U);
+            range_start = draw_index + 1U;
+        }
+    }
+    draw_ranges.emplace_back(range_start, draws_count);
+    return draw_ranges;
+}
+
 void ParallelRenderCommandList::SetProgramBindings(Rhi::IProgramBindings&, Rhi::ProgramBindingsApplyBehaviorMask)
 {
     META_FUNCTION_NOT_IMPLEMENTED_DESCR("Can not set program bindings on parallel render command list.");
@@ -190,9 +307,8 @@ void ParallelRenderCommandList::PopDebugGroup()
 void ParallelRenderCommandList::Execute(const Rhi::ICommandList::CompletedCallback& completed_callback)
 {
     META_FUNCTION_TASK();
-    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_parallel_command_lists)
+    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_committed_parallel_command_lists)
     {
-        META_CHECK_NOT_NULL(render_command_list_ptr);
         render_command_list_ptr->Execute();
     }
 
@@ -202,9 +318,8 @@ void ParallelRenderCommandList::Execute(const Rhi::ICommandList::CompletedCallba
 void ParallelRenderCommandList::Complete()
 {
     META_FUNCTION_TASK();
-    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_parallel_command_lists)
+    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_committed_parallel_command_lists)
     {
-        META_CHECK_NOT_NULL(render_command_list_ptr);
         render_command_list_ptr->Complete();
     }
 
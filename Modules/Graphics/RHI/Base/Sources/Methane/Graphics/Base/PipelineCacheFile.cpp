@@ -0,0 +1,149 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/PipelineCacheFile.cpp
+Versioned file of the native pipeline cache data, which is valid only
+for the same device and driver version it was saved with.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/PipelineCacheFile.h>
+
+#include <Methane/Instrumentation.h>
+
+#include <fstream>
+#include <algorithm>
+#include <type_traits>
+#include <filesystem>
+#include <system_error>
+#include <cstring>
+
+namespace Methane::Graphics::Base
+{
+
+struct PipelineCacheFileHeader
+{
+    uint32_t               magic;
+    uint32_t               version;
+    PipelineCacheDeviceKey device_key;
+    uint32_t               reserved; // explicit padding to have deterministic file content
+    uint64_t               data_size;
+    uint64_t               data_hash;
+};
+
+static_assert(std::is_trivially_copyable_v<PipelineCacheFileHeader>);
+static_assert(sizeof(PipelineCacheFileHeader) == 56U);
+
+// FNV-1a hash is used to detect truncated or corrupted cache data, which may crash some drivers
+static uint64_t GetDataHash(const std::byte* data_ptr, size_t data_size) noexcept
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for(size_t i = 0; i < data_size; ++i)
+    {
+        hash ^= static_cast<uint64_t>(data_ptr[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+PipelineCacheFile::PipelineCacheFile(std::string file_path, const DeviceKey& device_key)
+    : m_file_path(std::move(file_path))
+    , m_device_key(device_key)
+{ }
+
+Data::Bytes PipelineCacheFile::Load() const
+{
+    META_FUNCTION_TASK();
+    std::ifstream file_stream(m_file_path, std::ios::binary);
+    if (!file_stream.good())
+        return {};
+
+    file_stream.seekg(0, std::ios::end);
+    Data::Bytes file_data(static_cast<size_t>(file_stream.tellg()), {});
+    file_stream.seekg(0, std::ios::beg);
+    file_stream.read(reinterpret_cast<char*>(file_data.data()), static_cast<std::streamsize>(file_data.size())); // NOSONAR
+    if (!file_stream.good())
+        return {};
+
+    return Deserialize(m_device_key, file_data);
+}
+
+bool PipelineCacheFile::Save(const Data::Bytes& cache_data) const
+{
+    META_FUNCTION_TASK();
+    const Data::Bytes file_data = Serialize(m_device_key, cache_data);
+
+    // File is written under temporary name and renamed, so that other processes never read partially written cache
+    const std::string temp_file_path = m_file_path + ".tmp";
+    {
+        std::ofstream file_stream(temp_file_path, std::ios::binary | std::ios::trunc);
+        if (!file_stream.good())
+            return false;
+
+        file_stream.write(reinterpret_cast<const char*>(file_data.data()), static_cast<std::streamsize>(file_data.size())); // NOSONAR
+        if (!file_stream.good())
+            return false;
+    }
+
+    std::error_code error_code;
+    std::filesystem::rename(temp_file_path, m_file_path, error_code);
+    if (error_code)
+    {
+        std::filesystem::remove(temp_file_path, error_code);
+        return false;
+    }
+    return true;
+}
+
+Data::Bytes PipelineCacheFile::Serialize(const DeviceKey& device_key, const Data::Bytes& cache_data)
+{
+    META_FUNCTION_TASK();
+    const PipelineCacheFileHeader header{
+        g_magic,
+        g_version,
+        device_key,
+        0U,
+        cache_data.size(),
+        GetDataHash(cache_data.data(), cache_data.size())
+    };
+
+    Data::Bytes file_data(sizeof(PipelineCacheFileHeader) + cache_data.size(), {});
+    std::memcpy(file_data.data(), &header, sizeof(PipelineCacheFileHeader));
+    std::ranges::copy(cache_data, file_data.begin() + sizeof(PipelineCacheFileHeader));
+    return file_data;
+}
+
+Data::Bytes PipelineCacheFile::Deserialize(const DeviceKey& device_key, const Data::Bytes& file_data)
+{
+    META_FUNCTION_TASK();
+    if (file_data.size() < sizeof(PipelineCacheFileHeader))
+        return {};
+
+    PipelineCacheFileHeader header{};
+    std::memcpy(&header, file_data.data(), sizeof(PipelineCacheFileHeader));
+
+    const std::byte* cache_data_ptr = file_data.data() + sizeof(PipelineCacheFileHeader);
+    if (header.magic != g_magic || header.version != g_version || header.device_key != device_key ||
+        header.data_size != file_data.size() - sizeof(PipelineCacheFileHeader) ||
+        header.data_hash != GetDataHash(cache_data_ptr, header.data_size))
+        return {};
+
+    return Data::Bytes(cache_data_ptr, cache_data_ptr + header.data_size);
+}
+
+} // namespace Methane::Graphics::Base
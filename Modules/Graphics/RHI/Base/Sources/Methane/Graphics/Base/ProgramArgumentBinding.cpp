@@ -24,6 +24,8 @@ Base implementation of the program argument binding interface.
 #include <Methane/Graphics/Base/ProgramArgumentBinding.h>
 #include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/Base/Program.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/BindlessDescriptorTable.h>
 #include <Methane/Graphics/RHI/TypeFormatters.hpp>
 #include <Methane/Data/SpanComparable.hpp>
 #include <Methane/Data/EnumMaskUtil.hpp>
@@ -49,7 +51,18 @@ ProgramArgumentBinding::ProgramArgumentBinding(const ProgramArgumentBinding& oth
     , m_emit_callback_enabled(other.m_emit_callback_enabled)
 { }
 
-ProgramArgumentBinding::~ProgramArgumentBinding() = default;
+ProgramArgumentBinding::~ProgramArgumentBinding()
+{
+    try
+    {
+        ReleaseBindlessIndices();
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during bindless indices release: {}", e.what());
+    }
+}
 
 void ProgramArgumentBinding::MergeSettings(const ProgramArgumentBinding& other)
 {
@@ -80,18 +93,29 @@ bool ProgramArgumentBinding::SetResourceViewSpan(Rhi::ResourceViewSpan resource_
     [[maybe_unused]] const bool              is_addressable_binding = m_settings.argument.IsAddressable();
     [[maybe_unused]] const Rhi::IResource::Type bound_resource_type = m_settings.resource_type;
 
-    for (const Rhi::ResourceView& resource_view : resource_views)
+    if (m_settings.argument.IsBindlessIndex())
+    {
+        // Views of any resource type are bound by their indices in the global descriptor arrays of their types
+        META_CHECK_EQUAL_DESCR(static_cast<Data::Size>(resource_views.size() * sizeof(uint32_t)), m_settings.buffer_size,
+                               "count of resource views does not match with count of indices in root constant of bindless argument '{}'",
+                               m_settings.argument.GetName());
+        SetBindlessIndices(resource_views);
+    }
+    else
     {
-        META_CHECK_NAME_DESCR("resource_view", resource_view.GetResource().GetResourceType() == bound_resource_type,
-                                  "incompatible resource type '{}' is bound to argument '{}' of type '{}'",
-                                  magic_enum::enum_name(resource_view.GetResource().GetResourceType()),
-                                  m_settings.argument.GetName(), magic_enum::enum_name(bound_resource_type));
-
-        const Rhi::ResourceUsageMask resource_usage_mask = resource_view.GetResource().GetUsage();
-        META_CHECK_EQUAL_DESCR(resource_usage_mask.HasAnyBit(Rhi::ResourceUsage::Addressable), is_addressable_binding,
-                             "resource usage mask {} does not have addressable flag", Data::GetEnumMaskName(resource_usage_mask));
-        META_CHECK_NAME_DESCR("resource_view", is_addressable_binding || !resource_view.GetOffset(),
-                                  "can not set resource view_id with non-zero offset to non-addressable resource binding");
+        for (const Rhi::ResourceView& resource_view : resource_views)
+        {
+            META_CHECK_NAME_DESCR("resource_view", resource_view.GetResource().GetResourceType() == bound_resource_type,
+                                      "incompatible resource type '{}' is bound to argument '{}' of type '{}'",
+                                      magic_enum::enum_name(resource_view.GetResource().GetResourceType()),
+                                      m_settings.argument.GetName(), magic_enum::enum_name(bound_resource_type));
+
+            const Rhi::ResourceUsageMask resource_usage_mask = resource_view.GetResource().GetUsage();
+            META_CHECK_EQUAL_DESCR(resource_usage_mask.HasAnyBit(Rhi::ResourceUsage::Addressable), is_addressable_binding,
+                                 "resource usage mask {} does not have addressable flag", Data::GetEnumMaskName(resource_usage_mask));
+            META_CHECK_NAME_DESCR("resource_view", is_addressable_binding || !resource_view.GetOffset(),
+                                      "can not set resource view_id with non-zero offset to non-addressable resource binding");
+        }
     }
 
     Rhi::ResourceViews prev_resource_views;
@@ -182,6 +206,10 @@ ProgramArgumentBinding::operator std::string() const
     if (m_settings.argument.IsRootConstantValue())
         return fmt::format("{} is bound to value of {} bytes", m_settings.argument, m_root_constant_accessor_ptr->GetDataSize());
 
+    if (m_settings.argument.IsBindlessIndex() && !m_bindless_indices.empty())
+        return fmt::format("{} is bound to {} with bindless indices {}", m_settings.argument,
+                           fmt::join(m_resource_views, ", "), fmt::join(m_bindless_indices, ", "));
+
     return m_resource_views.empty()
          ? fmt::format("{} is unbound", m_settings.argument)
          : fmt::format("{} is bound to {}", m_settings.argument, fmt::join(m_resource_views, ", "));
@@ -190,10 +218,19 @@ ProgramArgumentBinding::operator std::string() const
 void ProgramArgumentBinding::Initialize(Program& program, Data::Index frame_index)
 {
     META_FUNCTION_TASK();
-    if (!m_settings.argument.IsRootConstant() || m_root_constant_accessor_ptr)
+    const Rhi::ProgramArgumentAccessor& argument = m_settings.argument;
+    if (!(argument.IsRootConstant() || argument.IsBindlessIndex()) || m_root_constant_accessor_ptr)
         return;
 
-    if (m_settings.argument.IsRootConstantValue())
+    if (argument.IsBindlessIndex())
+    {
+        m_root_constant_accessor_ptr = program.GetRootConstantStorage().ReserveRootConstant(m_settings.buffer_size);
+
+        // Resource views copied from the original argument binding are registered after root constant reservation
+        if (!m_resource_views.empty())
+            SetBindlessIndices(m_resource_views);
+    }
+    else if (argument.IsRootConstantValue())
     {
         m_root_constant_accessor_ptr = program.GetRootConstantStorage().ReserveRootConstant(m_settings.buffer_size);
     }
@@ -229,6 +266,53 @@ bool ProgramArgumentBinding::IsAlreadyApplied(const Rhi::IProgram& program,
     return false;
 }
 
+void ProgramArgumentBinding::SetBindlessIndices(Rhi::ResourceViewSpan resource_views)
+{
+    META_FUNCTION_TASK();
+    const Ptr<BindlessDescriptorTable> bindless_table_ptr = m_context.GetBindlessDescriptorTablePtr();
+    META_CHECK_NOT_NULL_DESCR(bindless_table_ptr, "bindless descriptors are not supported by context, so argument '{}' can not be bound",
+                              m_settings.argument.GetName());
+
+    // New views are registered before releasing the previous ones to reuse descriptors of the views which remain bound
+    std::vector<uint32_t> bindless_indices;
+    bindless_indices.reserve(resource_views.size());
+    for (const Rhi::ResourceView& resource_view : resource_views)
+    {
+        bindless_indices.push_back(bindless_table_ptr->AddResourceView(resource_view));
+    }
+
+    ReleaseBindlessIndices();
+    m_bindless_table_wptr = bindless_table_ptr;
+    m_bindless_indices    = std::move(bindless_indices);
+
+    if (m_root_constant_accessor_ptr)
+    {
+        m_root_constant_accessor_ptr->SetRootConstant(Rhi::RootConstant(
+            reinterpret_cast<Data::ConstRawPtr>(m_bindless_indices.data()), // NOSONAR
+            static_cast<Data::Size>(m_bindless_indices.size() * sizeof(uint32_t))
+        ));
+    }
+}
+
+void ProgramArgumentBinding::ReleaseBindlessIndices()
+{
+    META_FUNCTION_TASK();
+    if (m_bindless_indices.empty())
+        return;
+
+    // Bindless table may be already released with context, so there is nothing to remove from it
+    if (const Ptr<BindlessDescriptorTable> bindless_table_ptr = m_bindless_table_wptr.lock())
+    {
+        for (const Rhi::ResourceView& resource_view : m_resource_views)
+        {
+            bindless_table_ptr->RemoveResourceView(resource_view);
+        }
+    }
+
+    m_bindless_indices.clear();
+    m_bindless_table_wptr.reset();
+}
+
 void ProgramArgumentBinding::OnRootConstantBufferChanged(RootConstantBuffer&, const Ptr<Rhi::IBuffer>&)
 {
     META_FUNCTION_TASK();
@@ -79,6 +79,17 @@ static Rhi::ResourceState GetBoundResourceTargetState(const Rhi::IResource& reso
     return Rhi::ResourceState::ShaderResource;
 }
 
+static Rhi::ResourceState GetBoundResourceTargetState(const Rhi::IResource& resource, const Rhi::IProgramArgumentBinding::Settings& argument_binding_settings)
+{
+    META_FUNCTION_TASK();
+    // Bindless argument type is the type of its root constant with indices, while bound resources of any type
+    // are accessed through global descriptor arrays as shader resource or unordered access views, but never as constant buffers
+    if (argument_binding_settings.argument.IsBindlessIndex())
+        return GetBoundResourceTargetState(resource, resource.GetResourceType(), false);
+
+    return GetBoundResourceTargetState(resource, argument_binding_settings.resource_type, argument_binding_settings.argument.IsConstant());
+}
+
 ProgramBindings::ResourceAndState::ResourceAndState(Ptr<Resource> resource_ptr, Rhi::ResourceState state)
     : resource_ptr(std::move(resource_ptr))
     , state(state)
@@ -403,7 +414,7 @@ void ProgramBindings::AddTransitionResourceState(const Rhi::IProgramArgumentBind
         return;
 
     const Rhi::IProgramArgumentBinding::Settings& argument_binding_settings = argument_binding.GetSettings();
-    const Rhi::ResourceState target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings.resource_type, argument_binding_settings.argument.IsConstant());
+    const Rhi::ResourceState target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings);
     ResourceStates& transition_resource_states = m_transition_resource_states_by_access[argument_binding_settings.argument.GetAccessorIndex()];
     transition_resource_states.emplace_back(resource.GetDerivedPtr<Resource>(), target_resource_state);
 }
@@ -423,11 +434,22 @@ void ProgramBindings::AddTransitionResourceStates(const Rhi::IProgramArgumentBin
         if (resource.GetResourceType() == Rhi::IResource::Type::Sampler)
             continue;
 
-        const Rhi::ResourceState target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings.resource_type, argument_binding_settings.argument.IsConstant());
+        const Rhi::ResourceState target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings);
         transition_resource_states.emplace_back(std::dynamic_pointer_cast<Resource>(resource_view.GetResourcePtr()), target_resource_state);
     }
 }
 
+const Rhi::IResourceBarriers* ProgramBindings::UpdateResourceTransitionBarriers(Rhi::ProgramArgumentAccessMask apply_access,
+                                                                                const Rhi::ICommandQueue* owner_queue_ptr) const
+{
+    META_FUNCTION_TASK();
+    if (!ApplyResourceStates(apply_access, owner_queue_ptr) ||
+        !m_resource_state_transition_barriers_ptr || m_resource_state_transition_barriers_ptr->IsEmpty())
+        return nullptr;
+
+    return m_resource_state_transition_barriers_ptr.get();
+}
+
 bool ProgramBindings::ApplyResourceStates(Rhi::ProgramArgumentAccessMask access, const Rhi::ICommandQueue* owner_queue_ptr) const
 {
     META_FUNCTION_TASK();
@@ -72,6 +72,24 @@ void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
     }
 }
 
+void RenderCommandList::ReleaseIdleEncoding()
+{
+    META_FUNCTION_TASK();
+    const auto state_lock = LockStateMutex();
+    META_CHECK_EQUAL_DESCR(GetState(), State::Encoding, "only command list in encoding state can release idle encoding");
+    META_CHECK_TRUE_DESCR(IsIdle(), "{} command list '{}' is not idle", magic_enum::enum_name(GetType()), GetName());
+    META_LOG("{} Command list '{}' RELEASE idle encoding", magic_enum::enum_name(GetType()), GetName());
+
+    while (HasOpenDebugGroups())
+    {
+        PopDebugGroup();
+    }
+
+    // Command state references retained program bindings and buffers, so it is reset before they are released
+    ResetCommandState();
+    ReleaseRetainedResources();
+}
+
 void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
@@ -82,7 +100,7 @@ void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGr
 void RenderCommandList::ResetWithStateOnce(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
-    if (GetState() == State::Encoding && GetDrawingState().render_state_ptr.get() == std::addressof(render_state))
+    if (GetState() == State::Encoding && GetDrawingState().render_state_ptr == std::addressof(render_state))
     {
         META_LOG("{} Command list '{}' was already RESET with the same render state '{}'", magic_enum::enum_name(GetType()), GetName(), render_state.GetName());
         return;
@@ -93,13 +111,23 @@ void RenderCommandList::ResetWithStateOnce(Rhi::IRenderState& render_state, IDeb
 void RenderCommandList::SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups)
 {
     META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    // Render state is redundant when it is already bound with all requested state groups
+    const bool render_state_changed = m_drawing_state.render_state_ptr != std::addressof(render_state);
+    const bool is_render_state_redundant = !render_state_changed && !(state_groups & ~m_drawing_state.bound_render_state_groups);
+    GetStateFilteringStatistics().render_state.Count(is_render_state_redundant);
+    if (is_render_state_redundant)
+    {
+        META_LOG("{} Command list '{}' render state '{}' is already set up",
+                 magic_enum::enum_name(GetType()), GetName(), render_state.GetName());
+        return;
+    }
+
     META_LOG("{} Command list '{}' SET RENDER STATE '{}':\n{}",
              magic_enum::enum_name(GetType()), GetName(), render_state.GetName(),
              static_cast<std::string>(render_state.GetSettings()));
 
-    VerifyEncodingState();
-
-    const bool render_state_changed = m_drawing_state.render_state_ptr.get() != std::addressof(render_state);
     Rhi::RenderStateGroupMask changed_states{ m_drawing_state.render_state_ptr ? 0U : ~0U };
     if (m_drawing_state.render_state_ptr && render_state_changed)
     {
@@ -114,13 +142,16 @@ void RenderCommandList::SetRenderState(Rhi::IRenderState& render_state, Rhi::Ren
         render_state_base.Apply(*this, changed_states & state_groups);
     }
 
-    Ptr<Object> render_state_object_ptr = render_state_base.GetBasePtr();
-    m_drawing_state.render_state_ptr = std::static_pointer_cast<RenderState>(render_state_object_ptr);
+    m_drawing_state.render_state_ptr = std::addressof(render_state_base);
     m_drawing_state.render_state_groups |= state_groups;
+    m_drawing_state.bound_render_state_groups = render_state_changed
+                                              ? state_groups
+                                              : m_drawing_state.bound_render_state_groups | state_groups;
 
-    if (render_state_changed && !render_state_base.IsDeferred())
+    if (render_state_changed)
     {
-        RetainResource(render_state_object_ptr);
+        // Deferred render state is retained on binding too, since drawing state does not hold a strong reference to it
+        RetainResource(render_state_base);
     }
 }
 
@@ -130,7 +161,9 @@ void RenderCommandList::SetViewState(Rhi::IViewState& view_state)
     VerifyEncodingState();
 
     DrawingState& drawing_state = GetDrawingState();
-    if (drawing_state.view_state_ptr && drawing_state.view_state_ptr->GetSettings() == view_state.GetSettings())
+    const bool is_view_state_redundant = drawing_state.view_state_ptr && drawing_state.view_state_ptr->GetSettings() == view_state.GetSettings();
+    GetStateFilteringStatistics().view_state.Count(is_view_state_redundant);
+    if (is_view_state_redundant)
     {
         META_LOG("{} Command list '{}' view state is already set up", magic_enum::enum_name(GetType()), GetName());
         return;
@@ -150,6 +183,17 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
 
     VerifyEncodingState();
 
+    // Redundant vertex buffers are filtered before validation, since they were already validated on first binding
+    DrawingState& drawing_state = GetDrawingState();
+    const bool is_vertex_buffers_redundant = drawing_state.vertex_buffer_set_ptr == std::addressof(vertex_buffers);
+    GetStateFilteringStatistics().vertex_buffers.Count(is_vertex_buffers_redundant);
+    if (is_vertex_buffers_redundant)
+    {
+        META_LOG("{} Command list '{}' vertex buffers {} are already set up",
+                 magic_enum::enum_name(GetType()), GetName(), vertex_buffers.GetNames());
+        return false;
+    }
+
     if (m_is_validation_enabled)
     {
         META_CHECK_NAME_DESCR("vertex_buffers", vertex_buffers.GetType() == Rhi::BufferType::Vertex,
@@ -157,20 +201,12 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
                               magic_enum::enum_name(vertex_buffers.GetType()));
     }
 
-    DrawingState&  drawing_state = GetDrawingState();
-    if (drawing_state.vertex_buffer_set_ptr.get() == std::addressof(vertex_buffers))
-    {
-        META_LOG("{} Command list '{}' vertex buffers {} are already set up",
-                 magic_enum::enum_name(GetType()), GetName(), vertex_buffers.GetNames());
-        return false;
-    }
-
     META_LOG("{} Command list '{}' SET VERTEX BUFFERS {}",
              magic_enum::enum_name(GetType()), GetName(), vertex_buffers.GetNames());
 
-    Ptr<Object> vertex_buffer_set_object_ptr = static_cast<BufferSet&>(vertex_buffers).GetBasePtr();
-    drawing_state.vertex_buffer_set_ptr = std::static_pointer_cast<BufferSet>(vertex_buffer_set_object_ptr);
-    RetainResource(vertex_buffer_set_object_ptr);
+    auto& vertex_buffer_set_base = static_cast<BufferSet&>(vertex_buffers);
+    drawing_state.vertex_buffer_set_ptr = std::addressof(vertex_buffer_set_base);
+    RetainResource(vertex_buffer_set_base);
     return true;
 }
 
@@ -181,24 +217,26 @@ bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_reso
 
     VerifyEncodingState();
 
-    if (m_is_validation_enabled)
-    {
-        META_CHECK_NAME_DESCR("index_buffer", index_buffer.GetSettings().type == Rhi::BufferType::Index,
-                              "can not set with index buffer of type '{}' where 'Index' buffer is required",
-                              magic_enum::enum_name(index_buffer.GetSettings().type));
-    }
-
     DrawingState& drawing_state = GetDrawingState();
-    if (drawing_state.index_buffer_ptr.get() == std::addressof(index_buffer))
+    const bool is_index_buffer_redundant = drawing_state.index_buffer_ptr == std::addressof(index_buffer);
+    GetStateFilteringStatistics().index_buffer.Count(is_index_buffer_redundant);
+    if (is_index_buffer_redundant)
     {
         META_LOG("{} Command list '{}' index buffer {} is already set up",
                  magic_enum::enum_name(GetType()), GetName(), index_buffer.GetName());
         return false;
     }
 
-    Ptr<Object> index_buffer_object_ptr = static_cast<Buffer&>(index_buffer).GetBasePtr();
-    drawing_state.index_buffer_ptr = std::static_pointer_cast<Buffer>(index_buffer_object_ptr);
-    RetainResource(index_buffer_object_ptr);
+    if (m_is_validation_enabled)
+    {
+        META_CHECK_NAME_DESCR("index_buffer", index_buffer.GetSettings().type == Rhi::BufferType::Index,
+                              "can not set with index buffer of type '{}' where 'Index' buffer is required",
+                              magic_enum::enum_name(index_buffer.GetSettings().type));
+    }
+
+    auto& index_buffer_base = static_cast<Buffer&>(index_buffer);
+    drawing_state.index_buffer_ptr = std::addressof(index_buffer_base);
+    RetainResource(index_buffer_base);
     return true;
 }
 
@@ -210,20 +248,7 @@ void RenderCommandList::DrawIndexed(Primitive primitive_type, uint32_t index_cou
 
     if (m_is_validation_enabled)
     {
-        const DrawingState& drawing_state = GetDrawingState();
-        META_CHECK_NOT_NULL_DESCR(drawing_state.render_state_ptr, "render state must be set before indexed draw call");
-        META_CHECK_NOT_NULL_DESCR(drawing_state.view_state_ptr, "view state must be set before indexed draw call");
-        META_CHECK_NOT_NULL_DESCR(drawing_state.index_buffer_ptr, "index buffer must be set before indexed draw call");
-        META_CHECK_NOT_NULL_DESCR(drawing_state.vertex_buffer_set_ptr, "vertex buffers must be set before draw call");
-
-        const uint32_t formatted_items_count = drawing_state.index_buffer_ptr->GetFormattedItemsCount();
-        META_CHECK_NOT_ZERO_DESCR(formatted_items_count, "can not draw with index buffer which contains no formatted vertices");
-        META_CHECK_NOT_ZERO_DESCR(index_count, "can not draw zero index/vertex count");
-        META_CHECK_NOT_ZERO_DESCR(instance_count, "can not draw zero instances");
-        META_CHECK_LESS_OR_EQUAL_DESCR(index_count, formatted_items_count, "can not draw more indices than available in the index buffer");
-        META_CHECK_LESS_OR_EQUAL_DESCR(start_index, formatted_items_count - index_count, "ending index is out of buffer bounds");
-
-        ValidateDrawVertexBuffers(start_vertex);
+        ValidateDrawIndexed(index_count, start_index, start_vertex, instance_count);
     }
 
     META_LOG("{} Command list '{}' DRAW INDEXED with vertex buffers {} and index buffer '{}' using {} primive type, {} indices from {} index and {} vertex with {} instances count from {} instance",
@@ -265,6 +290,109 @@ void RenderCommandList::Draw(Primitive primitive_type, uint32_t vertex_count, ui
     UpdateDrawingState(primitive_type);
 }
 
+void RenderCommandList::MultiDrawIndexed(Primitive primitive_type, std::span<const Rhi::DrawIndexedArguments> draw_arguments)
+{
+    META_FUNCTION_TASK();
+    // Multi-draw is emulated with a sequence of indexed draws, which substitute zero index count with index buffer size,
+    // while native implementations use PrepareMultiDrawIndexed instead
+    for (const Rhi::DrawIndexedArguments& draw_args : draw_arguments)
+    {
+        DrawIndexed(primitive_type, draw_args.index_count, draw_args.start_index, draw_args.start_vertex,
+                    draw_args.instance_count, draw_args.start_instance);
+    }
+}
+
+void RenderCommandList::PrepareMultiDrawIndexed(Primitive primitive_type, std::span<const Rhi::DrawIndexedArguments> draw_arguments)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        for (const Rhi::DrawIndexedArguments& draw_args : draw_arguments)
+        {
+            ValidateDrawIndexed(GetDrawIndexCount(draw_args.index_count), draw_args.start_index, draw_args.start_vertex, draw_args.instance_count);
+        }
+    }
+
+    META_LOG("{} Command list '{}' MULTI-DRAW INDEXED with vertex buffers {} and index buffer '{}' using {} primitive type, {} draws",
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             GetDrawingState().index_buffer_ptr ? GetDrawingState().index_buffer_ptr->GetName() : "None",
+             magic_enum::enum_name(primitive_type), draw_arguments.size());
+
+    UpdateDrawingState(primitive_type);
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive_type, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        const DrawingState& drawing_state = GetDrawingState();
+        META_CHECK_NOT_NULL_DESCR(drawing_state.render_state_ptr, "render state must be set before indirect draw call");
+        META_CHECK_NOT_NULL_DESCR(drawing_state.view_state_ptr, "view state must be set before indirect draw call");
+        const size_t input_buffers_count = drawing_state.render_state_ptr->GetSettings().program_ptr->GetSettings().input_buffer_layouts.size();
+        META_CHECK_TRUE_DESCR(!input_buffers_count || drawing_state.vertex_buffer_set_ptr,
+                              "vertex buffers must be set when program has non empty input buffer layouts");
+        ValidateDrawIndirectBuffers(arguments_buffer, arguments_offset, sizeof(Rhi::DrawArguments),
+                                    max_draw_count, count_buffer_ptr, count_offset);
+    }
+
+    META_LOG("{} Command list '{}' DRAW INDIRECT with vertex buffers {} using {} primitive type, up to {} draws from buffer '{}' at offset {}{}",
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             magic_enum::enum_name(primitive_type), max_draw_count, arguments_buffer.GetName(), arguments_offset,
+             count_buffer_ptr ? fmt::format(" with count from buffer '{}' at offset {}", count_buffer_ptr->GetName(), count_offset) : "");
+
+    SetIndirectBufferState(arguments_buffer);
+    if (count_buffer_ptr)
+        SetIndirectBufferState(*count_buffer_ptr);
+
+    UpdateDrawingState(primitive_type);
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive_type, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        const DrawingState& drawing_state = GetDrawingState();
+        META_CHECK_NOT_NULL_DESCR(drawing_state.render_state_ptr, "render state must be set before indexed indirect draw call");
+        META_CHECK_NOT_NULL_DESCR(drawing_state.view_state_ptr, "view state must be set before indexed indirect draw call");
+        META_CHECK_NOT_NULL_DESCR(drawing_state.index_buffer_ptr, "index buffer must be set before indexed indirect draw call");
+        META_CHECK_NOT_NULL_DESCR(drawing_state.vertex_buffer_set_ptr, "vertex buffers must be set before indexed indirect draw call");
+        ValidateDrawIndirectBuffers(arguments_buffer, arguments_offset, sizeof(Rhi::DrawIndexedArguments),
+                                    max_draw_count, count_buffer_ptr, count_offset);
+    }
+
+    META_LOG("{} Command list '{}' DRAW INDEXED INDIRECT with vertex buffers {} and index buffer '{}' using {} primitive type, up to {} draws from buffer '{}' at offset {}{}",
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             GetDrawingState().index_buffer_ptr ? GetDrawingState().index_buffer_ptr->GetName() : "None",
+             magic_enum::enum_name(primitive_type), max_draw_count, arguments_buffer.GetName(), arguments_offset,
+             count_buffer_ptr ? fmt::format(" with count from buffer '{}' at offset {}", count_buffer_ptr->GetName(), count_offset) : "");
+
+    SetIndirectBufferState(arguments_buffer);
+    if (count_buffer_ptr)
+        SetIndirectBufferState(*count_buffer_ptr);
+
+    UpdateDrawingState(primitive_type);
+}
+
+uint32_t RenderCommandList::GetDrawIndexCount(uint32_t index_count) const noexcept
+{
+    return index_count == 0U && m_drawing_state.index_buffer_ptr
+         ? m_drawing_state.index_buffer_ptr->GetFormattedItemsCount()
+         : index_count;
+}
+
 void RenderCommandList::ResetCommandState()
 {
     META_FUNCTION_TASK();
@@ -273,12 +401,13 @@ void RenderCommandList::ResetCommandState()
     CommandList::ResetCommandState();
 
     m_drawing_state.render_pass_attachment_ptrs.clear();
-    m_drawing_state.render_state_ptr.reset();
-    m_drawing_state.vertex_buffer_set_ptr.reset();
-    m_drawing_state.index_buffer_ptr.reset();
+    m_drawing_state.render_state_ptr = nullptr;
+    m_drawing_state.vertex_buffer_set_ptr = nullptr;
+    m_drawing_state.index_buffer_ptr = nullptr;
     m_drawing_state.primitive_type_opt.reset();
     m_drawing_state.view_state_ptr = nullptr;
     m_drawing_state.render_state_groups = {};
+    m_drawing_state.bound_render_state_groups = {};
     m_drawing_state.changes = DrawingState::ChangeMask{};
 }
 
@@ -302,7 +431,6 @@ void RenderCommandList::UpdateDrawingState(Primitive primitive_type)
         // Apply render state in deferred mode right before the Draw call,
         // only in case when any render state groups or view state or primitive type has changed
         m_drawing_state.render_state_ptr->Apply(*this, m_drawing_state.render_state_groups);
-        RetainResource(m_drawing_state.render_state_ptr);
 
         m_drawing_state.render_state_groups = {};
         drawing_state.changes.SetBitOff(PrimitiveType);
@@ -310,6 +438,24 @@ void RenderCommandList::UpdateDrawingState(Primitive primitive_type)
     }
 }
 
+void RenderCommandList::ValidateDrawIndexed(uint32_t index_count, uint32_t start_index, uint32_t start_vertex, uint32_t instance_count) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL_DESCR(m_drawing_state.render_state_ptr, "render state must be set before indexed draw call");
+    META_CHECK_NOT_NULL_DESCR(m_drawing_state.view_state_ptr, "view state must be set before indexed draw call");
+    META_CHECK_NOT_NULL_DESCR(m_drawing_state.index_buffer_ptr, "index buffer must be set before indexed draw call");
+    META_CHECK_NOT_NULL_DESCR(m_drawing_state.vertex_buffer_set_ptr, "vertex buffers must be set before draw call");
+
+    const uint32_t formatted_items_count = m_drawing_state.index_buffer_ptr->GetFormattedItemsCount();
+    META_CHECK_NOT_ZERO_DESCR(formatted_items_count, "can not draw with index buffer which contains no formatted vertices");
+    META_CHECK_NOT_ZERO_DESCR(index_count, "can not draw zero index/vertex count");
+    META_CHECK_NOT_ZERO_DESCR(instance_count, "can not draw zero instances");
+    META_CHECK_LESS_OR_EQUAL_DESCR(index_count, formatted_items_count, "can not draw more indices than available in the index buffer");
+    META_CHECK_LESS_OR_EQUAL_DESCR(start_index, formatted_items_count - index_count, "ending index is out of buffer bounds");
+
+    ValidateDrawVertexBuffers(start_vertex);
+}
+
 void RenderCommandList::ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count) const
 {
     META_FUNCTION_TASK();
@@ -333,6 +479,39 @@ void RenderCommandList::ValidateDrawVertexBuffers(uint32_t draw_start_vertex, ui
     }
 }
 
+void RenderCommandList::ValidateDrawIndirectBuffers(const Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, Data::Size arguments_size,
+                                                    uint32_t max_draw_count, const Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NAME_DESCR("arguments_buffer", arguments_buffer.GetSettings().type == Rhi::BufferType::Indirect,
+                          "can not draw with arguments from buffer of type '{}' where 'Indirect' buffer is required",
+                          magic_enum::enum_name(arguments_buffer.GetSettings().type));
+    META_CHECK_NOT_ZERO_DESCR(max_draw_count, "can not draw zero indirect draws count");
+    META_CHECK_LESS_OR_EQUAL_DESCR(arguments_offset + arguments_size * max_draw_count, arguments_buffer.GetSettings().size,
+                                   "indirect draw arguments are out of bounds of buffer '{}'", arguments_buffer.GetName());
+    if (!count_buffer_ptr)
+        return;
+
+    META_CHECK_NAME_DESCR("count_buffer", count_buffer_ptr->GetSettings().type == Rhi::BufferType::Indirect,
+                          "can not draw with count from buffer of type '{}' where 'Indirect' buffer is required",
+                          magic_enum::enum_name(count_buffer_ptr->GetSettings().type));
+    META_CHECK_LESS_OR_EQUAL_DESCR(count_offset + sizeof(uint32_t), count_buffer_ptr->GetSettings().size,
+                                   "indirect draws count is out of bounds of buffer '{}'", count_buffer_ptr->GetName());
+}
+
+void RenderCommandList::SetIndirectBufferState(Rhi::IBuffer& indirect_buffer)
+{
+    META_FUNCTION_TASK();
+    auto& indirect_buffer_base = static_cast<Buffer&>(indirect_buffer);
+    RetainResource(indirect_buffer_base);
+
+    if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = indirect_buffer_base.GetSetupTransitionBarriers();
+        indirect_buffer_base.SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+}
+
 RenderPass& RenderCommandList::GetPass()
 {
     META_FUNCTION_TASK();
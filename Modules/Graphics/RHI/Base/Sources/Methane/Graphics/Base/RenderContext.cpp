@@ -105,6 +105,9 @@ void RenderContext::OnCpuPresentComplete(bool signal_frame_fence)
         GetCurrentFrameFence().Signal();
     }
 
+    // Transient buffer slices allocated in this frame are recycled when frame buffer with the same index is presented again
+    CloseTransientBuffersFrame(m_frame_buffer_index);
+
     META_CPU_FRAME_DELIMITER(m_frame_buffer_index, m_frame_index);
     META_LOG("Render context '{}' PRESENT COMPLETE frame {}", GetName(), m_frame_buffer_index);
 
@@ -178,6 +181,9 @@ void RenderContext::OnGpuWaitComplete(WaitFor wait_for)
     if (wait_for == WaitFor::FramePresented)
     {
         m_fps_counter.OnGpuFramePresented();
+        CompleteRootConstantsUploadFrame();
+        CompleteTransientBuffersFrame(m_frame_buffer_index);
+        CompleteBindlessDescriptorsFrame();
         PerformRequestedAction();
     }
     else
@@ -236,6 +242,9 @@ bool RenderContext::SetFrameBuffersCount(uint32_t frame_buffers_count)
     new_settings.frame_buffers_count = frame_buffers_count;
     ResetWithSettings(new_settings);
 
+    // Bindless descriptor table created during context reset keeps retiring removed views for the new frames in flight count
+    UpdateBindlessDescriptorsRetireFramesCount();
+
     return true;
 }
 
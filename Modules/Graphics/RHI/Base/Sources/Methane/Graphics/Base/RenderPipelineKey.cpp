@@ -0,0 +1,262 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/RenderPipelineKey.cpp
+Key of the native render pipeline made of render state settings,
+view state shape and primitive type, which are baked in pipeline
+unless they are set dynamically in command list.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/RenderPipelineKey.h>
+
+#include <Methane/Instrumentation.h>
+
+#include <bit>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace Methane::Graphics::Base
+{
+
+class RenderPipelineHasher
+{
+public:
+    template<typename T>
+    RenderPipelineHasher& Add(T value) noexcept
+    {
+        if constexpr (std::is_enum_v<T>)
+            AddValue(static_cast<uint64_t>(value));
+        else if constexpr (std::is_pointer_v<T>)
+            AddValue(reinterpret_cast<uintptr_t>(value)); // NOSONAR
+        else if constexpr (std::is_same_v<T, float>)
+            AddValue(std::bit_cast<uint32_t>(value));
+        else
+            AddValue(static_cast<uint64_t>(value));
+        return *this;
+    }
+
+    RenderPipelineHasher& Add(std::string_view str) noexcept
+    {
+        AddValue(static_cast<uint64_t>(std::hash<std::string_view>{}(str)));
+        return *this;
+    }
+
+    RenderPipelineHasher& Add(const RenderPipelineProgramKey& program) noexcept
+    {
+        for (const RenderPipelineShaderKey& shader : program.shaders)
+        {
+            Add(shader.type)
+           .Add(shader.data_provider_ptr)
+           .Add(std::string_view(shader.entry_function.file_name))
+           .Add(std::string_view(shader.entry_function.function_name));
+            for (const Rhi::ShaderMacroDefinition& definition : shader.compile_definitions)
+            {
+                Add(std::string_view(definition.name)).Add(std::string_view(definition.value));
+            }
+        }
+        for (const RenderPipelineInputLayoutKey& input_layout : program.input_buffer_layouts)
+        {
+            Add(input_layout.step_type).Add(input_layout.step_rate);
+            for (const std::string& semantic : input_layout.argument_semantics)
+            {
+                Add(std::string_view(semantic));
+            }
+        }
+        for (const RenderPipelineArgumentKey& argument : program.argument_accessors)
+        {
+            Add(argument.shader_type)
+           .Add(std::string_view(argument.name))
+           .Add(argument.access_type)
+           .Add(argument.value_type);
+        }
+        return *this;
+    }
+
+    RenderPipelineHasher& Add(const Rhi::FaceOperations& face_operations) noexcept
+    {
+        return Add(face_operations.stencil_failure)
+              .Add(face_operations.stencil_pass)
+              .Add(face_operations.depth_failure)
+              .Add(face_operations.compare);
+    }
+
+    RenderPipelineHasher& Add(const Rhi::RenderTargetSettings& render_target) noexcept
+    {
+        return Add(render_target.blend_enabled)
+              .Add(render_target.color_write.GetValue())
+              .Add(render_target.rgb_blend_op)
+              .Add(render_target.alpha_blend_op)
+              .Add(render_target.source_rgb_blend_factor)
+              .Add(render_target.source_alpha_blend_factor)
+              .Add(render_target.dest_rgb_blend_factor)
+              .Add(render_target.dest_alpha_blend_factor);
+    }
+
+    [[nodiscard]] uint64_t GetHash() const noexcept { return m_hash; }
+
+private:
+    // FNV-1a hash combination of 64-bit values
+    void AddValue(uint64_t value) noexcept
+    {
+        m_hash ^= value;
+        m_hash *= 1099511628211ULL;
+    }
+
+    uint64_t m_hash = 14695981039346656037ULL;
+};
+
+RenderPipelineProgramKey::RenderPipelineProgramKey(const Rhi::IProgram& program)
+{
+    META_FUNCTION_TASK();
+    const Rhi::ProgramSettings& settings = program.GetSettings();
+
+    shaders.reserve(settings.shaders.size());
+    for (const Ptr<Rhi::IShader>& shader_ptr : settings.shaders)
+    {
+        META_CHECK_NOT_NULL(shader_ptr);
+        const Rhi::ShaderSettings& shader_settings = shader_ptr->GetSettings();
+        shaders.push_back(RenderPipelineShaderKey{
+            shader_ptr->GetType(),
+            std::addressof(shader_settings.data_provider),
+            shader_settings.entry_function,
+            shader_settings.compile_definitions
+        });
+    }
+
+    input_buffer_layouts.reserve(settings.input_buffer_layouts.size());
+    for (const Rhi::ProgramInputBufferLayout& input_layout : settings.input_buffer_layouts)
+    {
+        input_buffer_layouts.push_back(RenderPipelineInputLayoutKey{
+            std::vector<std::string>(input_layout.argument_semantics.begin(), input_layout.argument_semantics.end()),
+            input_layout.step_type,
+            input_layout.step_rate
+        });
+    }
+
+    argument_accessors.reserve(settings.argument_accessors.size());
+    for (const Rhi::ProgramArgumentAccessor& accessor : settings.argument_accessors)
+    {
+        argument_accessors.push_back(RenderPipelineArgumentKey{
+            accessor.GetShaderType(),
+            std::string(accessor.GetName()),
+            accessor.GetAccessorType(),
+            accessor.GetValueType()
+        });
+    }
+    std::ranges::sort(argument_accessors);
+}
+
+RenderPipelineKey::RenderPipelineKey(const Rhi::RenderStateSettings& settings,
+                                     Rhi::DeviceDynamicStateMask dynamic_states,
+                                     const Rhi::ViewSettings* view_settings_ptr,
+                                     Opt<Rhi::RenderPrimitive> primitive_opt)
+    : m_program(settings.program_ptr ? RenderPipelineProgramKey(*settings.program_ptr) : RenderPipelineProgramKey())
+    , m_render_pattern_ptr(settings.render_pattern_ptr.get())
+    , m_rasterizer(settings.rasterizer)
+    , m_depth(settings.depth)
+    , m_stencil(settings.stencil)
+    , m_blending(settings.blending)
+    , m_blending_color(settings.blending_color)
+    , m_dynamic_states(dynamic_states)
+{
+    META_FUNCTION_TASK();
+    using enum Rhi::DeviceDynamicState;
+    if (view_settings_ptr && !dynamic_states.HasAnyBit(ViewportsCount))
+    {
+        m_view_shape_opt = RenderPipelineViewShape{
+            static_cast<uint32_t>(view_settings_ptr->viewports.size()),
+            static_cast<uint32_t>(view_settings_ptr->scissor_rects.size())
+        };
+    }
+    if (!dynamic_states.HasAnyBit(PrimitiveTopology))
+    {
+        m_primitive_opt = primitive_opt;
+    }
+
+    // Only render targets used by pipeline are compared to share pipelines with different unused blending settings
+    if (!m_blending.is_independent)
+    {
+        std::fill(m_blending.render_targets.begin() + 1, m_blending.render_targets.end(), Rhi::RenderTargetSettings{});
+    }
+
+    // Settings of dynamic states are reset to defaults to share pipelines between render states different only in them
+    if (dynamic_states.HasAnyBit(CullMode))
+    {
+        m_rasterizer.cull_mode = Rhi::RasterizerSettings{}.cull_mode;
+        m_rasterizer.is_front_counter_clockwise = Rhi::RasterizerSettings{}.is_front_counter_clockwise;
+    }
+    if (dynamic_states.HasAnyBit(DepthTest))
+    {
+        m_depth = Rhi::DepthSettings{};
+    }
+    if (dynamic_states.HasAnyBit(StencilTest))
+    {
+        m_stencil.enabled    = false;
+        m_stencil.front_face = Rhi::FaceOperations{};
+        m_stencil.back_face  = Rhi::FaceOperations{};
+    }
+
+    RenderPipelineHasher hasher;
+    hasher.Add(m_program)
+          .Add(m_render_pattern_ptr)
+          .Add(m_rasterizer.is_front_counter_clockwise)
+          .Add(m_rasterizer.cull_mode)
+          .Add(m_rasterizer.fill_mode)
+          .Add(m_rasterizer.sample_count)
+          .Add(m_rasterizer.alpha_to_coverage_enabled)
+          .Add(m_depth.enabled)
+          .Add(m_depth.write_enabled)
+          .Add(m_depth.compare)
+          .Add(m_stencil.enabled)
+          .Add(m_stencil.read_mask)
+          .Add(m_stencil.write_mask)
+          .Add(m_stencil.front_face)
+          .Add(m_stencil.back_face)
+          .Add(m_blending.is_independent);
+
+    for (const Rhi::RenderTargetSettings& render_target : m_blending.render_targets)
+    {
+        hasher.Add(render_target);
+    }
+
+    for (const float color_component : m_blending_color.AsArray())
+    {
+        hasher.Add(color_component);
+    }
+
+    hasher.Add(m_dynamic_states.GetValue())
+          .Add(m_view_shape_opt.has_value());
+    if (m_view_shape_opt)
+    {
+        hasher.Add(m_view_shape_opt->viewports_count)
+              .Add(m_view_shape_opt->scissor_rects_count);
+    }
+
+    hasher.Add(m_primitive_opt.has_value());
+    if (m_primitive_opt)
+    {
+        hasher.Add(*m_primitive_opt);
+    }
+
+    m_hash = hasher.GetHash();
+}
+
+} // namespace Methane::Graphics::Base
@@ -35,8 +35,12 @@ namespace Methane::Graphics::Base
 ResourceBarriers::ResourceBarriers(const Set& barriers)
 {
     META_FUNCTION_TASK();
-    std::ranges::transform(barriers, std::inserter(m_barriers_map, m_barriers_map.begin()),
-                           [](const Barrier& barrier) { return std::pair(barrier.GetId(), barrier); });
+    m_barriers_map.reserve(barriers.size());
+    for(const Barrier& barrier : barriers)
+    {
+        m_barriers_map.try_emplace(barrier.GetId(), barrier);
+    }
+    UpdateBarriersCount();
 }
 
 ResourceBarriers::Set ResourceBarriers::GetSet() const noexcept
@@ -44,7 +48,8 @@ ResourceBarriers::Set ResourceBarriers::GetSet() const noexcept
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_barriers_mutex);
     Set barriers;
-    std::ranges::transform(m_barriers_map, std::inserter(barriers, barriers.begin()),
+    // Barriers map is sorted by barrier type and resource in the same order as the set, so every insertion is done at the end
+    std::ranges::transform(m_barriers_map, std::inserter(barriers, barriers.end()),
                            [](const auto& barrier_pair) { return barrier_pair.second; });
     return barriers;
 }
@@ -108,7 +113,10 @@ ResourceBarriers::AddResult ResourceBarriers::Add(const Barrier& barrier)
 
     const auto [ barrier_id_and_state_change_it, barrier_added ] = m_barriers_map.try_emplace(barrier.GetId(), barrier);
     if (barrier_added)
+    {
+        UpdateBarriersCount();
         return Added;
+    }
 
     if (barrier_id_and_state_change_it->second == barrier)
         return Existing;
@@ -118,10 +126,25 @@ ResourceBarriers::AddResult ResourceBarriers::Add(const Barrier& barrier)
 }
 
 bool ResourceBarriers::Remove(const Barrier::Id& id)
+{
+    META_FUNCTION_TASK();
+    if (IsEmpty())
+        return false;
+
+    std::scoped_lock lock_guard(m_barriers_mutex);
+    if (!m_barriers_map.erase(id))
+        return false;
+
+    UpdateBarriersCount();
+    return true;
+}
+
+void ResourceBarriers::Clear()
 {
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_barriers_mutex);
-    return m_barriers_map.erase(id);
+    m_barriers_map.clear();
+    UpdateBarriersCount();
 }
 
 void ResourceBarriers::ApplyTransitions() const
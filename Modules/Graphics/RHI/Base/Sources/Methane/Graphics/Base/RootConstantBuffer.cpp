@@ -26,23 +26,99 @@ bound to Program using ProgramArgumentBinging as RootConstant.
 #include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/Buffer.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
-#include <Methane/Data/RangeUtils.hpp>
 #include <Methane/Data/Math.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+#include <ranges>
+#include <bit>
+#include <optional>
+#include <thread>
+
 namespace Methane::Graphics::Base
 {
 
 // Root constants memory alignment should match D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT
 static constexpr Data::Size g_root_constant_alignment = 256;
 
+// Root constants taking up to this count of aligned slots are reserved in storage chunks without locking
+static constexpr Data::Size g_chunk_root_constant_max_slots = 16U;
+static constexpr Data::Size g_chunk_size = RootConstantChunk::slots_count * g_root_constant_alignment;
+
+// Dirty data ranges separated with gaps not larger than this size are uploaded to GPU buffer as one range
+static constexpr Data::Size g_dirty_ranges_max_gap_size = g_root_constant_alignment;
+
+// Storage is compacted when its free memory outside of chunks exceeds both minimum size and minimum ratio of the storage size
+static constexpr Data::Size g_compaction_min_free_size  = 64 * g_root_constant_alignment;
+static constexpr float      g_compaction_min_free_ratio = 0.5F;
+
+[[nodiscard]] static size_t GetThreadArenaIndex(size_t arenas_count) noexcept
+{
+    static std::atomic<size_t> s_next_thread_index{ 0U };
+    thread_local const size_t t_thread_index = s_next_thread_index++;
+    return t_thread_index % arenas_count;
+}
+
+[[nodiscard]] static uint64_t GetSlotsMask(Data::Size slots_count, Data::Index slot_index) noexcept
+{
+    const uint64_t slots_mask = slots_count < RootConstantChunk::slots_count ? (1ULL << slots_count) - 1ULL : ~0ULL;
+    return slots_mask << slot_index;
+}
+
+// Returns index of the first slot in the continuous run of free slots or chunk slots count when there is no such run
+[[nodiscard]] static Data::Index FindFreeSlotsRun(uint64_t free_slots_mask, Data::Size run_slots_count) noexcept
+{
+    uint64_t run_start_slots_mask = free_slots_mask;
+    for (Data::Size slot_offset = 1U; slot_offset < run_slots_count && run_start_slots_mask; ++slot_offset)
+    {
+        run_start_slots_mask &= free_slots_mask >> slot_offset;
+    }
+    return static_cast<Data::Index>(std::countr_zero(run_start_slots_mask));
+}
+
+[[nodiscard]] static bool TryReserveChunkSlots(RootConstantChunk& chunk, Data::Size slots_count, Data::Index& slot_index) noexcept
+{
+    uint64_t free_slots_mask = chunk.free_slots_mask.load(std::memory_order_relaxed);
+    while (true)
+    {
+        slot_index = FindFreeSlotsRun(free_slots_mask, slots_count);
+        if (slot_index >= RootConstantChunk::slots_count)
+            return false;
+
+        if (chunk.free_slots_mask.compare_exchange_weak(free_slots_mask, free_slots_mask & ~GetSlotsMask(slots_count, slot_index),
+                                                        std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    }
+}
+
+// Increments atomic counter of operations in progress for the lifetime of the scope
+class ScopedAtomicCounter final
+{
+public:
+    explicit ScopedAtomicCounter(std::atomic<uint32_t>& counter) noexcept
+        : m_counter(counter)
+    { ++m_counter; }
+
+    ~ScopedAtomicCounter() { --m_counter; }
+
+    ScopedAtomicCounter(const ScopedAtomicCounter&) = delete;
+    ScopedAtomicCounter(ScopedAtomicCounter&&) = delete;
+    ScopedAtomicCounter& operator=(const ScopedAtomicCounter&) = delete;
+    ScopedAtomicCounter& operator=(ScopedAtomicCounter&&) = delete;
+
+private:
+    std::atomic<uint32_t>& m_counter;
+};
+
 //////////////////// RootConstantAccessor ////////////////////
 
-RootConstantAccessor::RootConstantAccessor(RootConstantStorage& storage, const Range& buffer_range, Data::Size data_size)
+RootConstantAccessor::RootConstantAccessor(RootConstantStorage& storage, const Range& buffer_range, Data::Size data_size,
+                                           RootConstantChunk* chunk_ptr)
     : m_storage_ref(storage)
     , m_buffer_range(buffer_range)
     , m_data_size(data_size)
+    , m_chunk_ptr(chunk_ptr)
 {
     META_CHECK_LESS_OR_EQUAL_DESCR(data_size, buffer_range.GetLength(),
                                    "root constant data size is less than reserved buffer range size");
@@ -64,21 +140,27 @@ RootConstantAccessor::~RootConstantAccessor()
 
 }
 
+RootConstantAccessor::Range RootConstantAccessor::GetBufferRange() const
+{
+    return m_chunk_ptr
+         ? Range(m_chunk_ptr->offset + m_buffer_range.GetStart(), m_chunk_ptr->offset + m_buffer_range.GetEnd())
+         : m_buffer_range;
+}
+
 Rhi::RootConstant RootConstantAccessor::GetRootConstant() const
 {
     META_FUNCTION_TASK();
     return m_is_initialized
-         ? Rhi::RootConstant(m_storage_ref.get().GetData().data() + m_buffer_range.GetStart(), m_data_size)
+         ? Rhi::RootConstant(m_storage_ref.get().GetRootConstantData(*this), m_data_size)
          : Rhi::RootConstant();
 }
 
 bool RootConstantAccessor::SetRootConstant(const Rhi::RootConstant& root_constant) const
 {
     META_FUNCTION_TASK();
-    if (root_constant == GetRootConstant())
+    if (!m_storage_ref.get().SetRootConstant(*this, root_constant))
         return false;
 
-    m_storage_ref.get().SetRootConstant(*this, root_constant);
     m_is_initialized = true;
     return true;
 }
@@ -87,76 +169,242 @@ Rhi::ResourceView RootConstantAccessor::GetResourceView() const
 {
     META_FUNCTION_TASK();
     auto& root_constant_buffer = dynamic_cast<RootConstantBuffer&>(m_storage_ref.get());
-    return root_constant_buffer.GetResourceView(m_buffer_range.GetStart(), m_data_size);
+    return root_constant_buffer.GetResourceView(GetBufferRange().GetStart(), m_data_size);
 }
 
 Data::Byte* RootConstantAccessor::GetDataPtr()
 {
     META_FUNCTION_TASK();
-    return m_storage_ref.get().GetData().data() + m_buffer_range.GetStart();
+    return m_storage_ref.get().GetRootConstantData(*this);
 }
 
 //////////////////// RootConstantStorage ////////////////////
 
+float RootConstantStorage::Statistics::GetFragmentationRatio() const noexcept
+{
+    return free_size ? 1.F - static_cast<float>(max_free_range_size) / static_cast<float>(free_size) : 0.F;
+}
+
 RootConstantStorage::~RootConstantStorage()
 {
     META_FUNCTION_TASK();
     std::lock_guard lock(m_mutex);
-    assert((!m_deferred_size && m_free_ranges.IsEmpty()) ||
-           m_free_ranges == RangeSet({ { 0, m_deferred_size } }));
+    assert(m_accessors.empty() && !m_live_size);
 }
 
 UniquePtr<RootConstantAccessor> RootConstantStorage::ReserveRootConstant(Data::Size root_constant_size)
 {
     META_FUNCTION_TASK();
+    const Data::Size aligned_constant_size = Data::AlignUp(root_constant_size, g_root_constant_alignment);
+    if (const Data::Size slots_count = aligned_constant_size / g_root_constant_alignment;
+        slots_count && slots_count <= g_chunk_root_constant_max_slots)
+        return ReserveChunkRootConstant(root_constant_size, slots_count);
+
     std::lock_guard lock(m_mutex);
+    const Accessor::Range buffer_range = ReserveFreeRange(aligned_constant_size);
 
-    const Data::Size aligned_constant_size = Data::AlignUp(root_constant_size, g_root_constant_alignment);
-    Accessor::Range buffer_range;
+    auto accessor_ptr = std::make_unique<Accessor>(*this, buffer_range, root_constant_size);
+    accessor_ptr->m_storage_index = static_cast<Data::Index>(m_accessors.size());
+    m_accessors.push_back(accessor_ptr.get());
 
-    if (m_free_ranges.IsEmpty())
-    {
-        m_deferred_size += aligned_constant_size;
-        m_data_resize_required = true;
-        buffer_range = Accessor::Range(m_deferred_size - aligned_constant_size, m_deferred_size);
-    }
-    else
-    {
-        buffer_range = ReserveRange(m_free_ranges, aligned_constant_size);
-        META_CHECK_FALSE_DESCR(buffer_range.IsEmpty(), "failed to reserve root-constant buffer range!");
-    }
-    return std::make_unique<Accessor>(*this, buffer_range, root_constant_size);
+    UpdatePeakLiveSize(m_live_size += aligned_constant_size);
+    return accessor_ptr;
 }
 
 void RootConstantStorage::ReleaseRootConstant(const Accessor& accessor)
 {
     META_FUNCTION_TASK();
+    const Data::Size data_size = accessor.m_buffer_range.GetLength();
+    if (accessor.m_chunk_ptr)
+    {
+        {
+            // Chunk can not be moved by compaction, while its data is cleared under shared lock
+            std::shared_lock data_lock(m_data_mutex);
+            ClearReleasedData(accessor, accessor.GetBufferRange());
+        }
+
+        // Chunk slots are released without locking after clearing their data,
+        // so that the cleared data is not overwritten by the root constant reserved in the same slots
+        m_live_size -= data_size;
+        m_chunked_live_size -= data_size;
+        accessor.m_chunk_ptr->free_slots_mask.fetch_or(
+            GetSlotsMask(data_size / g_root_constant_alignment,
+                         accessor.m_buffer_range.GetStart() / g_root_constant_alignment),
+            std::memory_order_release);
+        m_chunk_slots_released = true;
+        return;
+    }
+
     std::lock_guard lock(m_mutex);
+    const Accessor::Range data_range = accessor.GetBufferRange();
+    ClearReleasedData(accessor, data_range);
 
-    const Accessor::Range& data_range = accessor.GetBufferRange();
+    m_live_size -= data_size;
     m_free_ranges.Add(data_range);
 
-    if (accessor.IsInitialized() &&
-        data_range.GetEnd() <= m_buffer_data.size())
-    {
-        // Clear data range, so that root constant is updated when set again for the same range
-        std::fill(m_buffer_data.data() + data_range.GetStart(),
-                  m_buffer_data.data() + data_range.GetEnd(),
-                  std::numeric_limits<Data::Byte>::max());
-    }
+    META_CHECK_LESS(accessor.m_storage_index, m_accessors.size());
+    META_CHECK_TRUE_DESCR(m_accessors[accessor.m_storage_index] == std::addressof(accessor),
+                          "root constant accessor does not belong to this storage");
+    Accessor* last_accessor_ptr = m_accessors.back();
+    last_accessor_ptr->m_storage_index = accessor.m_storage_index;
+    m_accessors[accessor.m_storage_index] = last_accessor_ptr;
+    m_accessors.pop_back();
 }
 
-void RootConstantStorage::SetRootConstant(const Accessor& accessor, const Rhi::RootConstant& root_constant)
+bool RootConstantStorage::SetRootConstant(const Accessor& accessor, const Rhi::RootConstant& root_constant)
 {
     META_FUNCTION_TASK();
     META_CHECK_FALSE_DESCR(root_constant.IsEmptyOrNull(), "can not set empty or null root constant");
 
-    Data::Bytes&           data       = GetData();
-    const Accessor::Range& data_range = accessor.GetBufferRange();
+    Data::Bytes& data = GetData();
 
+    // Data range is taken under shared lock, since it may be moved by compaction running in parallel
+    std::shared_lock data_lock(m_data_mutex);
+    const Accessor::Range data_range = accessor.GetBufferRange();
     META_CHECK_LESS_OR_EQUAL_DESCR(root_constant.GetDataSize(), data_range.GetLength(),
                                    "root constant size should be less or equal to reserved memory range size");
-    std::copy(root_constant.GetDataPtr(), root_constant.GetDataEndPtr(), data.data() + data_range.GetStart());
+    META_CHECK_LESS_OR_EQUAL(data_range.GetEnd(), data.size());
+
+    Data::Byte* const data_ptr = data.data() + data_range.GetStart();
+    if (accessor.IsInitialized() && root_constant.GetDataSize() == accessor.GetDataSize() &&
+        std::equal(root_constant.GetDataPtr(), root_constant.GetDataEndPtr(), data_ptr))
+        return false;
+
+    std::copy(root_constant.GetDataPtr(), root_constant.GetDataEndPtr(), data_ptr);
+    data_lock.unlock();
+
+    std::lock_guard lock(m_dirty_ranges_mutex);
+    m_dirty_ranges.Add(Accessor::Range(data_range.GetStart(), data_range.GetStart() + root_constant.GetDataSize()));
+    return true;
+}
+
+Data::Byte* RootConstantStorage::GetRootConstantData(const Accessor& accessor)
+{
+    META_FUNCTION_TASK();
+    Data::Bytes& data = GetData();
+
+    // Data range is taken under shared lock, since it may be moved by compaction running in parallel
+    std::shared_lock data_lock(m_data_mutex);
+    const Accessor::Range data_range = accessor.GetBufferRange();
+    META_CHECK_LESS_OR_EQUAL(data_range.GetEnd(), data.size());
+    return data.data() + data_range.GetStart();
+}
+
+bool RootConstantStorage::Compact()
+{
+    META_FUNCTION_TASK();
+
+    // Compaction waits for completion of chunk reservations in progress before taking the storage lock,
+    // which may be required by these reservations to acquire new arena chunks
+    const ScopedAtomicCounter compaction_request(m_compaction_requests_count);
+    for (const Arena& arena : m_arenas)
+    {
+        while (arena.reservations_count)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    std::lock_guard lock(m_mutex);
+    std::unique_lock data_lock(m_data_mutex);
+
+    // Chunks without reserved slots are removed and arenas acquire chunks again on next reservation
+    for (Arena& arena : m_arenas)
+    {
+        arena.chunk_ptr = nullptr;
+    }
+    std::erase_if(m_chunks, [](const UniquePtr<RootConstantChunk>& chunk_ptr)
+                  { return chunk_ptr->free_slots_mask.load() == ~0ULL; });
+    m_chunks_size = static_cast<Data::Size>(m_chunks.size()) * g_chunk_size;
+
+    // Root constants reserved in storage and chunks of root constants are moved as continuous units
+    struct CompactionUnit
+    {
+        Accessor::Range    range;
+        Accessor*          accessor_ptr;
+        RootConstantChunk* chunk_ptr;
+    };
+
+    std::vector<CompactionUnit> compaction_units;
+    compaction_units.reserve(m_accessors.size() + m_chunks.size());
+    for (Accessor* accessor_ptr : m_accessors)
+    {
+        compaction_units.push_back({ accessor_ptr->m_buffer_range, accessor_ptr, nullptr });
+    }
+    for (const UniquePtr<RootConstantChunk>& chunk_ptr : m_chunks)
+    {
+        compaction_units.push_back({ Accessor::Range(chunk_ptr->offset, chunk_ptr->offset + g_chunk_size), nullptr, chunk_ptr.get() });
+    }
+    std::ranges::sort(compaction_units, {}, [](const CompactionUnit& unit) { return unit.range.GetStart(); });
+
+    // Units are moved towards the storage beginning in the order of their offsets,
+    // so that each unit data is copied to the lower or same offset without overwriting data of other units
+    Data::Index compact_offset = 0U;
+    for (const CompactionUnit& unit : compaction_units)
+    {
+        const Accessor::Range compact_range(compact_offset, compact_offset + unit.range.GetLength());
+        compact_offset = compact_range.GetEnd();
+        if (unit.range == compact_range)
+            continue;
+
+        if (unit.range.GetEnd() <= m_buffer_data.size())
+            std::copy(m_buffer_data.data() + unit.range.GetStart(), m_buffer_data.data() + unit.range.GetEnd(),
+                      m_buffer_data.data() + compact_range.GetStart());
+        else if (compact_range.GetStart() < m_buffer_data.size())
+            std::fill(m_buffer_data.data() + compact_range.GetStart(),
+                      m_buffer_data.data() + std::min(compact_range.GetEnd(), static_cast<Data::Index>(m_buffer_data.size())),
+                      std::numeric_limits<Data::Byte>::max());
+
+        if (unit.chunk_ptr)
+            unit.chunk_ptr->offset = compact_range.GetStart();
+        else
+            unit.accessor_ptr->m_buffer_range = compact_range;
+    }
+
+    m_free_ranges.Clear();
+    if (compact_offset == m_deferred_size)
+        return false;
+
+    META_LOG("Root constant storage compacted from {} to {} bytes", m_deferred_size.load(), compact_offset);
+
+    m_deferred_size = compact_offset;
+    if (m_buffer_data.size() > m_deferred_size)
+        m_buffer_data.resize(m_deferred_size);
+
+    m_data_resize_required = m_buffer_data.size() != m_deferred_size;
+    m_compactions_count++;
+    data_lock.unlock();
+
+    // All root constants data has to be uploaded again after moving to the new offsets
+    std::lock_guard dirty_ranges_lock(m_dirty_ranges_mutex);
+    m_dirty_ranges.Clear();
+    m_dirty_ranges.Add(Accessor::Range(0U, compact_offset));
+    return true;
+}
+
+RootConstantStorage::Statistics RootConstantStorage::GetStatistics()
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    return Statistics{
+        .live_size           = m_live_size,
+        .peak_live_size      = m_peak_live_size,
+        .buffer_size         = m_deferred_size,
+        .free_size           = m_deferred_size - m_live_size,
+        .max_free_range_size = m_free_ranges.GetMaxRangeLength(),
+        .chunks_count        = static_cast<uint32_t>(m_chunks.size()),
+        .compactions_count   = m_compactions_count
+    };
+}
+
+RootConstantStorage::RangeSet RootConstantStorage::TakeDirtyRanges()
+{
+    META_FUNCTION_TASK();
+    RangeSet dirty_ranges;
+    std::lock_guard lock(m_dirty_ranges_mutex);
+    std::swap(dirty_ranges, m_dirty_ranges);
+    return dirty_ranges;
 }
 
 std::scoped_lock<RootConstantStorage::Mutex> RootConstantStorage::GetLockGuard()
@@ -164,6 +412,77 @@ std::scoped_lock<RootConstantStorage::Mutex> RootConstantStorage::GetLockGuard()
     return std::scoped_lock<Mutex>(m_mutex);
 }
 
+bool RootConstantStorage::IsCompactionRequired() const noexcept
+{
+    META_FUNCTION_TASK();
+    // Free slots of partially reserved chunks are not taken into account, since they are not released by compaction
+    const Data::Size deferred_size = m_deferred_size;
+    const Data::Size used_size     = m_chunks_size + m_live_size - m_chunked_live_size;
+    const Data::Size free_size     = deferred_size > used_size ? deferred_size - used_size : 0U;
+    return free_size >= g_compaction_min_free_size &&
+           static_cast<float>(free_size) >= static_cast<float>(deferred_size) * g_compaction_min_free_ratio;
+}
+
+UniquePtr<RootConstantAccessor> RootConstantStorage::ReserveChunkRootConstant(Data::Size root_constant_size, Data::Size slots_count)
+{
+    META_FUNCTION_TASK();
+    Arena& arena = m_arenas[GetThreadArenaIndex(arenas_count)];
+
+    // Reservation is not started while compaction is requested, since compaction removes chunks loaded from arenas without locking
+    std::optional<ScopedAtomicCounter> arena_reservation;
+    while (true)
+    {
+        arena_reservation.emplace(arena.reservations_count);
+        if (!m_compaction_requests_count)
+            break;
+
+        arena_reservation.reset();
+        std::this_thread::yield();
+    }
+
+    RootConstantChunk* chunk_ptr = arena.chunk_ptr.load(std::memory_order_acquire);
+    Data::Index slot_index = 0U;
+    if (!chunk_ptr || !TryReserveChunkSlots(*chunk_ptr, slots_count, slot_index))
+        chunk_ptr = &AcquireArenaChunk(arena, slots_count, slot_index);
+
+    const Data::Size slots_size = slots_count * g_root_constant_alignment;
+    m_chunked_live_size += slots_size;
+    UpdatePeakLiveSize(m_live_size += slots_size);
+
+    const Accessor::Range slots_range(slot_index * g_root_constant_alignment, slot_index * g_root_constant_alignment + slots_size);
+    return std::make_unique<Accessor>(*this, slots_range, root_constant_size, chunk_ptr);
+}
+
+RootConstantChunk& RootConstantStorage::AcquireArenaChunk(Arena& arena, Data::Size slots_count, Data::Index& slot_index)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    // Reuse chunk with free slots released since the last search, starting from the recently added chunks
+    if (m_chunk_slots_released.exchange(false))
+    {
+        for (const UniquePtr<RootConstantChunk>& chunk_ptr : std::ranges::reverse_view(m_chunks))
+        {
+            if (!TryReserveChunkSlots(*chunk_ptr, slots_count, slot_index))
+                continue;
+
+            m_chunk_slots_released = true;
+            arena.chunk_ptr.store(chunk_ptr.get(), std::memory_order_release);
+            return *chunk_ptr;
+        }
+    }
+
+    auto chunk_ptr = std::make_unique<RootConstantChunk>();
+    chunk_ptr->offset = ReserveFreeRange(g_chunk_size).GetStart();
+    META_CHECK_TRUE(TryReserveChunkSlots(*chunk_ptr, slots_count, slot_index));
+
+    RootConstantChunk& chunk = *chunk_ptr;
+    m_chunks.push_back(std::move(chunk_ptr));
+    m_chunks_size += g_chunk_size;
+    arena.chunk_ptr.store(&chunk, std::memory_order_release);
+    return chunk;
+}
+
 Data::Bytes& RootConstantStorage::GetData()
 {
     META_FUNCTION_TASK();
@@ -171,6 +490,7 @@ Data::Bytes& RootConstantStorage::GetData()
         return m_buffer_data;
 
     std::lock_guard lock(m_mutex);
+    std::unique_lock data_lock(m_data_mutex);
 
     // NOTE: Buffer is initialized with byte max values,
     // so that its uninitialized state differs from the first initialized state
@@ -181,6 +501,49 @@ Data::Bytes& RootConstantStorage::GetData()
     return m_buffer_data;
 }
 
+RootConstantAccessor::Range RootConstantStorage::ReserveFreeRange(Data::Size aligned_size)
+{
+    META_FUNCTION_TASK();
+    if (const Accessor::Range free_range = m_free_ranges.ReserveBestFit(aligned_size);
+        !free_range.IsEmpty())
+        return free_range;
+
+    // Grow storage size, while reusing free range at the end of storage
+    Data::Index range_start = m_deferred_size;
+    if (!m_free_ranges.IsEmpty() && std::prev(m_free_ranges.end())->GetEnd() == m_deferred_size)
+    {
+        const Accessor::Range tail_free_range = *std::prev(m_free_ranges.end());
+        range_start = tail_free_range.GetStart();
+        m_free_ranges.Remove(tail_free_range);
+    }
+
+    m_deferred_size = range_start + aligned_size;
+    m_data_resize_required = true;
+    return Accessor::Range(range_start, range_start + aligned_size);
+}
+
+void RootConstantStorage::ClearReleasedData(const Accessor& accessor, const Accessor::Range& data_range)
+{
+    META_FUNCTION_TASK();
+    if (!accessor.IsInitialized() || data_range.GetEnd() > m_buffer_data.size())
+        return;
+
+    // Clear data range, so that root constant is updated when set again for the same range
+    std::fill(m_buffer_data.data() + data_range.GetStart(),
+              m_buffer_data.data() + data_range.GetEnd(),
+              std::numeric_limits<Data::Byte>::max());
+}
+
+void RootConstantStorage::UpdatePeakLiveSize(Data::Size live_size) noexcept
+{
+    Data::Size peak_live_size = m_peak_live_size.load(std::memory_order_relaxed);
+    while (live_size > peak_live_size &&
+           !m_peak_live_size.compare_exchange_weak(peak_live_size, live_size, std::memory_order_relaxed))
+    {
+        // peak_live_size is updated with the current value on failed exchange
+    }
+}
+
 //////////////////// RootConstantBuffer ////////////////////
 
 RootConstantBuffer::RootConstantBuffer(Context& context, std::string_view buffer_name)
@@ -200,15 +563,41 @@ UniquePtr<RootConstantStorage::Accessor> RootConstantBuffer::ReserveRootConstant
     return accessor_ptr;
 }
 
-void RootConstantBuffer::SetRootConstant(const Accessor& accessor, const Rhi::RootConstant& root_constant)
+void RootConstantBuffer::ReleaseRootConstant(const Accessor& accessor)
+{
+    META_FUNCTION_TASK();
+    RootConstantStorage::ReleaseRootConstant(accessor);
+
+    // Compaction is performed on context initialization completion at frame boundary in OnContextUploadingResources,
+    // which is followed by updating program binding descriptors with compacted buffer views
+    if (IsCompactionRequired())
+        m_context.RequestDeferredAction(Rhi::IContext::DeferredAction::CompleteInitialization);
+}
+
+bool RootConstantBuffer::SetRootConstant(const Accessor& accessor, const Rhi::RootConstant& root_constant)
 {
     META_FUNCTION_TASK();
-    RootConstantStorage::SetRootConstant(accessor, root_constant);
+    if (!RootConstantStorage::SetRootConstant(accessor, root_constant))
+        return false;
 
     m_buffer_data_changed = true;
 
     // Buffer resource data is updated in OnContextUploadingResources just before upload to GPU
     m_context.RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
+    return true;
+}
+
+bool RootConstantBuffer::Compact()
+{
+    META_FUNCTION_TASK();
+    if (!RootConstantStorage::Compact())
+        return false;
+
+    // Buffer is recreated with the compacted size instead of being overwritten while it may still be used on GPU,
+    // and OnRootConstantBufferChanged is emitted from GetBuffer to update root constant buffer views with new offsets
+    m_buffer_resize_required = true;
+    m_buffer_data_changed = true;
+    return true;
 }
 
 Rhi::IBuffer& RootConstantBuffer::GetBuffer()
@@ -228,6 +617,7 @@ Rhi::IBuffer& RootConstantBuffer::GetBuffer()
     // After recreating the buffer it has to be filled with previous arguments data in UpdateGpuBuffer
     m_buffer_resize_required = false;
     m_buffer_data_changed = true;
+    m_buffer_full_upload_required = true;
 
     // NOTE: request deferred initialization complete to update program binding descriptors on GPU with updated buffer views
     m_context.RequestDeferredAction(Rhi::IContext::DeferredAction::CompleteInitialization);
@@ -261,18 +651,58 @@ void RootConstantBuffer::UpdateGpuBuffer(Rhi::ICommandQueue& target_cmd_queue)
     if (!m_buffer_data_changed)
         return;
 
+    // Data change flag is reset before taking dirty ranges, so that root constants set in parallel are uploaded next time
+    m_buffer_data_changed = false;
+    m_uploaded_data_size = 0U;
+
     const Data::Bytes& buffer_data = GetData();
     META_CHECK_NOT_EMPTY(buffer_data);
 
-    Rhi::IBuffer& buffer = GetBuffer();
-    buffer.SetData(target_cmd_queue, Rhi::SubResource(buffer_data));
+    Rhi::IBuffer&  buffer       = GetBuffer();
+    const RangeSet dirty_ranges = TakeDirtyRanges();
 
-    m_buffer_data_changed = false;
+    if (m_buffer_full_upload_required)
+    {
+        buffer.SetData(target_cmd_queue, Rhi::SubResource(buffer_data));
+        m_buffer_full_upload_required = false;
+        m_uploaded_data_size = static_cast<Data::Size>(buffer_data.size());
+    }
+    else
+    {
+        // Dirty ranges separated with small gaps are coalesced to reduce the number of uploaded sub-resources
+        std::optional<Accessor::Range> upload_range_opt;
+        const auto upload_data_range = [this, &buffer, &buffer_data, &target_cmd_queue](const Accessor::Range& data_range)
+        {
+            buffer.SetData(target_cmd_queue, Rhi::SubResource(buffer_data.data() + data_range.GetStart(), data_range.GetLength(),
+                                                              Rhi::SubResourceIndex(), data_range));
+            m_uploaded_data_size += data_range.GetLength();
+        };
+        for (const Accessor::Range& dirty_range : dirty_ranges)
+        {
+            if (upload_range_opt && dirty_range.GetStart() <= upload_range_opt->GetEnd() + g_dirty_ranges_max_gap_size)
+            {
+                upload_range_opt = Accessor::Range(upload_range_opt->GetStart(), dirty_range.GetEnd());
+                continue;
+            }
+            if (upload_range_opt)
+                upload_data_range(*upload_range_opt);
+
+            upload_range_opt = dirty_range;
+        }
+        if (upload_range_opt)
+            upload_data_range(*upload_range_opt);
+    }
+
+    m_context.AddRootConstantsUploadedSize(m_uploaded_data_size);
 }
 
 void RootConstantBuffer::OnContextUploadingResources(Rhi::IContext& context)
 {
     META_FUNCTION_TASK();
+    if (context.IsCompletingInitialization() && IsCompactionRequired())
+    {
+        Compact();
+    }
     UpdateGpuBuffer(context.GetDefaultCommandKit(Rhi::CommandListType::Transfer).GetQueue());
 }
 
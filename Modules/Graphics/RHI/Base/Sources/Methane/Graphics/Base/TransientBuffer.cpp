@@ -0,0 +1,193 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/TransientBuffer.cpp
+Base implementation of the transient buffer interface with frame-indexed ring allocator.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/TransientBuffer.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/Buffer.h>
+
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Rhi
+{
+
+Ptr<ITransientBuffer> ITransientBuffer::Create(const IContext& context, const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<Base::TransientBuffer>(dynamic_cast<const Base::Context&>(context), settings);
+}
+
+} // namespace Methane::Graphics::Rhi
+
+namespace Methane::Graphics::Base
+{
+
+TransientRingAllocator::TransientRingAllocator(Data::Size capacity, Data::Size alignment)
+    : m_capacity(Data::AlignUp(capacity, alignment))
+    , m_alignment(alignment)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(alignment, "transient buffer alignment can not be zero");
+    META_CHECK_NOT_ZERO_DESCR(capacity, "transient buffer capacity can not be zero");
+}
+
+Opt<Data::Size> TransientRingAllocator::Allocate(Data::Size size) noexcept
+{
+    META_FUNCTION_TASK();
+    const auto aligned_size = static_cast<Position>(Data::AlignUp(size, m_alignment));
+    if (!aligned_size || aligned_size > m_capacity)
+        return std::nullopt;
+
+    Position head_position = m_head_position.load(std::memory_order_relaxed);
+    Position slice_position = 0U;
+    Position new_head_position = 0U;
+    do
+    {
+        // Slice which does not fit before the end of buffer is placed in the beginning, skipping the rest of the buffer
+        const Position head_offset = head_position % m_capacity;
+        slice_position    = head_offset + aligned_size > m_capacity ? head_position + m_capacity - head_offset : head_position;
+        new_head_position = slice_position + aligned_size;
+        if (new_head_position - m_tail_position.load(std::memory_order_acquire) > m_capacity)
+            return std::nullopt;
+    }
+    while(!m_head_position.compare_exchange_weak(head_position, new_head_position, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    const auto used_size = static_cast<Data::Size>(new_head_position - m_tail_position.load(std::memory_order_relaxed));
+    Data::Size peak_used_size = m_peak_used_size.load(std::memory_order_relaxed);
+    while(used_size > peak_used_size &&
+          !m_peak_used_size.compare_exchange_weak(peak_used_size, used_size, std::memory_order_relaxed));
+
+    m_allocations_count.fetch_add(1U, std::memory_order_relaxed);
+    return static_cast<Data::Size>(slice_position % m_capacity);
+}
+
+void TransientRingAllocator::CloseFrame(Data::Index frame_index)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_frame_markers_mutex);
+    m_frame_markers.Retire({ frame_index, m_head_position.load(std::memory_order_acquire) }, m_closed_frames_count++);
+    m_frames_in_flight = m_frame_markers.GetCount();
+}
+
+void TransientRingAllocator::CompleteFrame(Data::Index frame_index)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_frame_markers_mutex);
+    const Opt<FrameIndex> closed_frame_index_opt = m_frame_markers.FindFrame(
+        [frame_index](const FrameMarker& frame_marker) { return frame_marker.frame_buffer_index == frame_index; });
+    if (!closed_frame_index_opt)
+        return;
+
+    // Frames closed before the completed frame are completed too, since frames are executed on GPU in order
+    m_frame_markers.CompleteFrames(*closed_frame_index_opt, [this](const FrameMarker& frame_marker)
+        { m_tail_position.store(frame_marker.end_position, std::memory_order_release); });
+    m_frames_in_flight = m_frame_markers.GetCount();
+}
+
+void TransientRingAllocator::CompleteAllFrames()
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_frame_markers_mutex);
+    m_tail_position.store(m_head_position.load(std::memory_order_acquire), std::memory_order_release);
+    m_frame_markers.Clear();
+    m_frames_in_flight = 0U;
+}
+
+TransientRingAllocator::FlushRanges TransientRingAllocator::TakeFlushRanges() noexcept
+{
+    META_FUNCTION_TASK();
+    const Position head_position    = m_head_position.load(std::memory_order_acquire);
+    const Position flushed_position = m_flushed_position.exchange(head_position, std::memory_order_acq_rel);
+    if (head_position <= flushed_position)
+        return {};
+
+    if (head_position - flushed_position >= m_capacity)
+        return { Rhi::BytesRange(0U, m_capacity), {} };
+
+    const auto start_offset = static_cast<Data::Index>(flushed_position % m_capacity);
+    const auto end_offset   = static_cast<Data::Index>(head_position % m_capacity);
+    if (start_offset < end_offset)
+        return { Rhi::BytesRange(start_offset, end_offset), {} };
+
+    return { Rhi::BytesRange(start_offset, m_capacity), Rhi::BytesRange(0U, end_offset) };
+}
+
+TransientRingAllocator::Statistics TransientRingAllocator::GetStatistics() const noexcept
+{
+    META_FUNCTION_TASK();
+    return Statistics{
+        m_capacity,
+        static_cast<Data::Size>(m_head_position.load() - m_tail_position.load()),
+        m_peak_used_size.load(),
+        m_frames_in_flight.load(),
+        m_allocations_count.load()
+    };
+}
+
+TransientBuffer::TransientBuffer(const Context& context, const Settings& settings)
+    : m_context(context)
+    , m_settings(settings)
+    , m_allocator(settings.size, settings.alignment)
+    , m_buffer_ptr(Rhi::IBuffer::Create(context, Rhi::BufferSettings::ForConstantBuffer(m_allocator.GetCapacity(), true, true)))
+    , m_buffer(dynamic_cast<Buffer&>(*m_buffer_ptr))
+    , m_mapped_data_ptr(m_buffer.GetMappedDataPtr())
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL_DESCR(m_mapped_data_ptr, "transient buffer memory must be mapped persistently");
+    m_buffer.SetName("Transient Buffer");
+    m_context.AddTransientBuffer(*this);
+}
+
+TransientBuffer::~TransientBuffer()
+{
+    META_FUNCTION_TASK();
+    m_context.RemoveTransientBuffer(*this);
+}
+
+Rhi::IBuffer& TransientBuffer::GetBuffer() const noexcept
+{
+    return *m_buffer_ptr;
+}
+
+TransientBuffer::Slice TransientBuffer::Allocate(Data::Size size)
+{
+    META_FUNCTION_TASK();
+    const Opt<Data::Size> offset_opt = m_allocator.Allocate(size);
+    META_CHECK_TRUE_DESCR(offset_opt.has_value(),
+                          "transient buffer of {} bytes is full, can not allocate slice of {} bytes",
+                          m_allocator.GetCapacity(), size);
+    return Slice{ m_buffer_ptr.get(), *offset_opt, size, m_mapped_data_ptr + *offset_opt };
+}
+
+void TransientBuffer::Flush()
+{
+    META_FUNCTION_TASK();
+    for(const Rhi::BytesRange& flush_range : m_allocator.TakeFlushRanges())
+    {
+        if (!flush_range.IsEmpty())
+            m_buffer.FlushMappedData(flush_range);
+    }
+}
+
+} // namespace Methane::Graphics::Base
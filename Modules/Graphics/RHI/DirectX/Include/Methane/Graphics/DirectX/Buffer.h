@@ -46,12 +46,16 @@ public:
     SubResource GetData(Rhi::ICommandQueue& target_cmd_queue, const BytesRangeOpt& data_range = {}) override;
     Opt<Descriptor> InitializeNativeViewDescriptor(const View::Id& view_id) override;
 
+    // Base::Buffer overrides
+    Data::RawPtr GetMappedDataPtr() override;
+
     D3D12_VERTEX_BUFFER_VIEW        GetNativeVertexBufferView() const;
     D3D12_INDEX_BUFFER_VIEW         GetNativeIndexBufferView() const;
     D3D12_CONSTANT_BUFFER_VIEW_DESC GetNativeConstantBufferViewDesc() const;
 
 private:
     wrl::ComPtr<ID3D12Resource> m_upload_resource_cptr;
+    Data::RawPtr                m_mapped_data_ptr = nullptr; // persistent mapping of upload heap resource, which is never unmapped
 };
 
 } // namespace Methane::Graphics::DirectX
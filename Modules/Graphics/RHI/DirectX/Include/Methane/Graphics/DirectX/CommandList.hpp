@@ -110,10 +110,16 @@ public:
         META_FUNCTION_TASK();
         CommandListBaseT::VerifyEncodingState();
         
+        // Lock-free emptiness check skips locking of barriers for resources which are already in required states
+        if (resource_barriers.IsEmpty())
+            return;
+
         const auto lock_guard = static_cast<const Base::ResourceBarriers&>(resource_barriers).Lock();
         if (resource_barriers.IsEmpty())
             return;
 
+        CommandListBaseT::GetCommandState().has_resource_barriers = true;
+
         META_LOG("{} Command list '{}' SET RESOURCE BARRIERS:\n{}",
                  magic_enum::enum_name(CommandListBaseT::GetType()),
                  CommandListBaseT::GetName(),
@@ -58,8 +58,11 @@ public:
 private:
     using NativeCommandLists = std::vector<ID3D12CommandList*>;
 
+    void UpdateNativeCommandLists();
+
     NativeCommandLists m_native_command_lists;
     Fence              m_execution_completed_fence;
+    bool               m_has_parallel_command_lists = false;
 };
 
 } // namespace Methane::Graphics::DirectX
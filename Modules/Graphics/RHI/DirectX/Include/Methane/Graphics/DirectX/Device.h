@@ -24,12 +24,15 @@ DirectX 12 implementation of the device interface.
 #pragma once
 
 #include <Methane/Graphics/Base/Device.h>
+#include <Methane/Instrumentation.h>
 
 #include <wrl.h>
 #include <dxgi1_6.h>
 #include <directx/d3d12.h>
 
 #include <optional>
+#include <array>
+#include <mutex>
 
 // NOTE: Adapters change handling breaks many frame capture tools, like VS or RenderDoc
 //#define ADAPTERS_CHANGE_HANDLING
@@ -59,11 +62,16 @@ public:
     const wrl::ComPtr<ID3D12Device>&    GetNativeDevice() const;
     void ReleaseNativeDevice();
 
+    // Command signature of indirect draws with tightly packed arguments is created on first use
+    ID3D12CommandSignature& GetNativeDrawCommandSignature(bool is_indexed) const;
+
 private:
     const wrl::ComPtr<IDXGIAdapter>   m_adapter_cptr;
     const D3D_FEATURE_LEVEL           m_feature_level;
     mutable NativeFeatureOptions5     m_feature_options_5;
     mutable wrl::ComPtr<ID3D12Device> m_device_cptr;
+    mutable std::array<wrl::ComPtr<ID3D12CommandSignature>, 2> m_draw_command_signatures; // non-indexed and indexed draw
+    mutable TracyLockable(std::mutex, m_draw_command_signatures_mutex);
 };
 
 bool IsSoftwareAdapterDxgi(IDXGIAdapter1& adapter);
@@ -53,11 +53,19 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void MultiDrawIndexed(Primitive primitive, std::span<const Rhi::DrawIndexedArguments> draw_arguments) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
 
     void ResetNative(const Ptr<RenderState>& render_state_ptr = nullptr);
 
 private:
     void ResetRenderPass();
+    void UpdatePrimitiveTopology(Primitive primitive);
+    void ExecuteIndirectDraws(bool is_indexed, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                              Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset);
 
     RenderPass& GetDirectPass();
 };
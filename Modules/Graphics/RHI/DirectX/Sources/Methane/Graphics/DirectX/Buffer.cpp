@@ -135,7 +135,10 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& su
     );
 
     META_CHECK_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-    std::span target_data_span(sub_resource_data_ptr, sub_resource.GetDataSize());
+
+    // Sub-resource with data range is written at the range offset, so that only part of the buffer is updated
+    const Data::Index data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    std::span target_data_span(sub_resource_data_ptr + data_offset, sub_resource.GetDataSize());
     std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), target_data_span.begin());
 
     if (sub_resource.HasDataRange())
@@ -152,11 +155,31 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& su
         return;
 
     // In case of private GPU storage, copy buffer data from intermediate upload resource to the private GPU resource
+    const Data::Size copy_size = sub_resource.HasDataRange() ? sub_resource.GetDataSize() : settings.size;
     const TransferCommandList& upload_cmd_list = PrepareResourceTransfer(TransferOperation::Upload, target_cmd_queue, State::CopyDest);
-    upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), 0U, m_upload_resource_cptr.Get(), 0U, settings.size);
+    upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), data_offset, m_upload_resource_cptr.Get(), data_offset, copy_size);
     GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
 }
 
+Data::RawPtr Buffer::GetMappedDataPtr()
+{
+    META_FUNCTION_TASK();
+    if (m_mapped_data_ptr)
+        return m_mapped_data_ptr;
+
+    META_CHECK_EQUAL_DESCR(GetSettings().storage_mode, IBuffer::StorageMode::Managed,
+                           "only managed buffer in upload heap can be mapped persistently");
+
+    // Upload heap resource can stay mapped while used by GPU, nested Map calls in SetData are reference counted
+    const CD3DX12_RANGE zero_read_range(0U, 0U);
+    ThrowIfFailed(
+        GetNativeResourceRef().Map(0U, &zero_read_range, reinterpret_cast<void**>(&m_mapped_data_ptr)), // NOSONAR
+        GetDirectContext().GetDirectDevice().GetNativeDevice().Get()
+    );
+    META_CHECK_NOT_NULL_DESCR(m_mapped_data_ptr, "failed to map buffer resource persistently");
+    return m_mapped_data_ptr;
+}
+
 Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range)
 {
     META_FUNCTION_TASK();
@@ -46,27 +46,17 @@ CommandListSet::CommandListSet(const Refs<Rhi::ICommandList>& command_list_refs,
 {
     META_FUNCTION_TASK();
 
-    const Refs<Base::CommandList>& base_command_list_refs = GetBaseRefs();
-
     std::stringstream fence_name_ss;
     fence_name_ss << "Execution completed for command list set:";
 
-    m_native_command_lists.reserve(base_command_list_refs.size());
-    for(const Ref<Base::CommandList>& command_list_ref : base_command_list_refs)
+    for(const Ref<Base::CommandList>& command_list_ref : GetBaseRefs())
     {
         const Base::CommandList& command_list = command_list_ref.get();
-        if (command_list.GetType() == Rhi::CommandListType::ParallelRender)
-        {
-            const CommandListSet::NativeCommandLists parallel_native_cmd_lists = static_cast<const ParallelRenderCommandList&>(command_list).GetNativeCommandLists();
-            m_native_command_lists.insert(m_native_command_lists.end(), parallel_native_cmd_lists.begin(), parallel_native_cmd_lists.end());
-        }
-        else
-        {
-            m_native_command_lists.emplace_back(&dynamic_cast<const ICommandList&>(command_list).GetNativeCommandList());
-        }
+        m_has_parallel_command_lists |= command_list.GetType() == Rhi::CommandListType::ParallelRender;
         fence_name_ss << " '" << command_list.GetName() << "'";
     }
 
+    UpdateNativeCommandLists();
     m_execution_completed_fence.SetName(fence_name_ss.str());
 }
 
@@ -74,6 +64,11 @@ void CommandListSet::Execute(const Rhi::ICommandList::CompletedCallback& complet
 {
     META_FUNCTION_TASK();
     Base::CommandListSet::Execute(completed_callback);
+
+    // Parallel render command lists execute only thread command lists committed with the current encoding
+    if (m_has_parallel_command_lists)
+        UpdateNativeCommandLists();
+
     GetDirectCommandQueue().GetNativeCommandQueue().ExecuteCommandLists(static_cast<UINT>(m_native_command_lists.size()), m_native_command_lists.data());
     m_execution_completed_fence.Signal();
 }
@@ -85,6 +80,27 @@ void CommandListSet::WaitUntilCompleted(uint32_t /*timeout_ms*/)
     Complete();
 }
 
+void CommandListSet::UpdateNativeCommandLists()
+{
+    META_FUNCTION_TASK();
+    const Refs<Base::CommandList>& base_command_list_refs = GetBaseRefs();
+    m_native_command_lists.clear();
+    m_native_command_lists.reserve(base_command_list_refs.size());
+    for(const Ref<Base::CommandList>& command_list_ref : base_command_list_refs)
+    {
+        const Base::CommandList& command_list = command_list_ref.get();
+        if (command_list.GetType() == Rhi::CommandListType::ParallelRender)
+        {
+            const CommandListSet::NativeCommandLists parallel_native_cmd_lists = static_cast<const ParallelRenderCommandList&>(command_list).GetNativeCommandLists();
+            m_native_command_lists.insert(m_native_command_lists.end(), parallel_native_cmd_lists.begin(), parallel_native_cmd_lists.end());
+        }
+        else
+        {
+            m_native_command_lists.emplace_back(&dynamic_cast<const ICommandList&>(command_list).GetNativeCommandList());
+        }
+    }
+}
+
 CommandQueue& CommandListSet::GetDirectCommandQueue() noexcept
 {
     META_FUNCTION_TASK();
@@ -180,7 +180,36 @@ const wrl::ComPtr<ID3D12Device>& Device::GetNativeDevice() const
 void Device::ReleaseNativeDevice()
 {
     META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock_guard(m_draw_command_signatures_mutex);
+        for(wrl::ComPtr<ID3D12CommandSignature>& command_signature_cptr : m_draw_command_signatures)
+        {
+            command_signature_cptr.Reset();
+        }
+    }
     m_device_cptr.Reset();
 }
 
+ID3D12CommandSignature& Device::GetNativeDrawCommandSignature(bool is_indexed) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_draw_command_signatures_mutex);
+    wrl::ComPtr<ID3D12CommandSignature>& command_signature_cptr = m_draw_command_signatures[is_indexed ? 1U : 0U];
+    if (command_signature_cptr)
+        return *command_signature_cptr.Get();
+
+    D3D12_INDIRECT_ARGUMENT_DESC argument_desc{};
+    argument_desc.Type = is_indexed ? D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED : D3D12_INDIRECT_ARGUMENT_TYPE_DRAW;
+
+    D3D12_COMMAND_SIGNATURE_DESC command_signature_desc{};
+    command_signature_desc.ByteStride       = is_indexed ? sizeof(D3D12_DRAW_INDEXED_ARGUMENTS) : sizeof(D3D12_DRAW_ARGUMENTS);
+    command_signature_desc.NumArgumentDescs = 1U;
+    command_signature_desc.pArgumentDescs   = &argument_desc;
+
+    // Root signature is not required, since command signature does not change root arguments
+    const wrl::ComPtr<ID3D12Device>& device_cptr = GetNativeDevice();
+    ThrowIfFailed(device_cptr->CreateCommandSignature(&command_signature_desc, nullptr, IID_PPV_ARGS(&command_signature_cptr)), device_cptr.Get());
+    return *command_signature_cptr.Get();
+}
+
 } // namespace Methane::Graphics::DirectX
@@ -131,13 +131,14 @@ ParallelRenderCommandList::D3D12CommandLists ParallelRenderCommandList::GetNativ
 {
     META_FUNCTION_TASK();
     D3D12CommandLists dx_command_lists;
-    const Refs<Rhi::IRenderCommandList>& parallel_command_lists = GetParallelCommandLists();
-    dx_command_lists.reserve(parallel_command_lists.size() + 2); // 2 command lists reserved for beginning and ending
+    // Idle thread command lists are left open without commit, so only committed command lists are executed
+    const Ptrs<Base::RenderCommandList>& committed_command_list_ptrs = GetCommittedParallelCommandLists();
+    dx_command_lists.reserve(committed_command_list_ptrs.size() + 2); // 2 command lists reserved for beginning and ending
     dx_command_lists.push_back(&m_beginning_command_list.GetNativeCommandList());
 
-    for (const Ref<Rhi::IRenderCommandList>& command_list_ref : parallel_command_lists)
+    for (const Ptr<Base::RenderCommandList>& command_list_ptr : committed_command_list_ptrs)
     {
-        dx_command_lists.push_back(&static_cast<const RenderCommandList&>(command_list_ref.get()).GetNativeCommandList());
+        dx_command_lists.push_back(&static_cast<const RenderCommandList&>(*command_list_ptr).GetNativeCommandList());
     }
 
     dx_command_lists.push_back(&m_ending_command_list.GetNativeCommandList());
@@ -51,6 +51,11 @@ Ptr<Rhi::IRenderCommandList> RenderCommandList::CreateForSynchronization(Rhi::IC
 namespace Methane::Graphics::DirectX
 {
 
+static_assert(sizeof(Rhi::DrawArguments) == sizeof(D3D12_DRAW_ARGUMENTS),
+              "draw arguments layout must match DirectX indirect draw arguments");
+static_assert(sizeof(Rhi::DrawIndexedArguments) == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS),
+              "draw indexed arguments layout must match DirectX indirect draw indexed arguments");
+
 static D3D12_PRIMITIVE_TOPOLOGY PrimitiveToDXTopology(Rhi::RenderPrimitive primitive)
 {
     META_FUNCTION_TASK();
@@ -98,7 +103,7 @@ void RenderCommandList::ResetNative(const Ptr<RenderState>& render_state_ptr)
         return;
 
     DrawingState& drawing_state = GetDrawingState();
-    drawing_state.render_state_ptr    = render_state_ptr;
+    drawing_state.render_state_ptr    = render_state_ptr.get();
     drawing_state.render_state_groups = Rhi::IRenderState::Groups({
         Rhi::RenderStateGroup::Program,
         Rhi::RenderStateGroup::Rasterizer,
@@ -221,6 +226,38 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
     dx_command_list.DrawInstanced(vertex_count, instance_count, start_vertex, start_instance);
 }
 
+void RenderCommandList::MultiDrawIndexed(Primitive primitive, std::span<const Rhi::DrawIndexedArguments> draw_arguments)
+{
+    META_FUNCTION_TASK();
+    PrepareMultiDrawIndexed(primitive, draw_arguments);
+    UpdatePrimitiveTopology(primitive);
+
+    ID3D12GraphicsCommandList& dx_command_list = GetNativeCommandListRef();
+    for (const Rhi::DrawIndexedArguments& draw_args : draw_arguments)
+    {
+        dx_command_list.DrawIndexedInstanced(GetDrawIndexCount(draw_args.index_count), draw_args.instance_count, draw_args.start_index,
+                                             draw_args.start_vertex, draw_args.start_instance);
+    }
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+    UpdatePrimitiveTopology(primitive);
+    ExecuteIndirectDraws(false, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+    UpdatePrimitiveTopology(primitive);
+    ExecuteIndirectDraws(true, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+}
+
 void RenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
@@ -239,6 +276,29 @@ void RenderCommandList::Commit()
     CommandList<Base::RenderCommandList>::Commit();
 }
 
+void RenderCommandList::UpdatePrimitiveTopology(Primitive primitive)
+{
+    META_FUNCTION_TASK();
+    if (DrawingState& drawing_state = GetDrawingState();
+        drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType))
+    {
+        const D3D12_PRIMITIVE_TOPOLOGY primitive_topology = PrimitiveToDXTopology(primitive);
+        GetNativeCommandListRef().IASetPrimitiveTopology(primitive_topology);
+        drawing_state.changes.SetBitOff(DrawingState::Change::PrimitiveType);
+    }
+}
+
+void RenderCommandList::ExecuteIndirectDraws(bool is_indexed, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    ID3D12CommandSignature& dx_command_signature = GetDirectCommandQueue().GetDirectContext().GetDirectDevice().GetNativeDrawCommandSignature(is_indexed);
+    ID3D12Resource* dx_count_resource_ptr = count_buffer_ptr ? &static_cast<Buffer&>(*count_buffer_ptr).GetNativeResourceRef() : nullptr;
+    GetNativeCommandListRef().ExecuteIndirect(&dx_command_signature, max_draw_count,
+                                              &static_cast<Buffer&>(arguments_buffer).GetNativeResourceRef(), arguments_offset,
+                                              dx_count_resource_ptr, count_offset);
+}
+
 RenderPass& RenderCommandList::GetDirectPass()
 {
     META_FUNCTION_TASK();
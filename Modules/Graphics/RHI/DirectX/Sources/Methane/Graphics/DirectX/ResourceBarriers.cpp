@@ -134,6 +134,9 @@ Base::ResourceBarriers::AddResult ResourceBarriers::Add(const Barrier& barrier)
 bool ResourceBarriers::Remove(const Barrier::Id& id)
 {
     META_FUNCTION_TASK();
+    if (IsEmpty())
+        return false;
+
     const auto lock_guard = Base::ResourceBarriers::Lock();
     if (!Base::ResourceBarriers::Remove(id))
         return false;
@@ -152,6 +155,20 @@ bool ResourceBarriers::Remove(const Barrier::Id& id)
     return true;
 }
 
+void ResourceBarriers::Clear()
+{
+    META_FUNCTION_TASK();
+    const auto lock_guard = Base::ResourceBarriers::Lock();
+    for(const auto& [barrier_id, barrier] : Base::ResourceBarriers::GetMap())
+    {
+        if (barrier_id.GetType() == Barrier::Type::StateTransition)
+            static_cast<Data::IEmitter<IResourceCallback>&>(barrier_id.GetResource()).Disconnect(*this);
+    }
+
+    Base::ResourceBarriers::Clear();
+    m_native_resource_barriers.clear();
+}
+
 void ResourceBarriers::OnResourceReleased(Rhi::IResource& resource)
 {
     META_FUNCTION_TASK();
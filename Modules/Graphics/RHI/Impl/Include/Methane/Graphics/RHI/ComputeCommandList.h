@@ -77,6 +77,7 @@ public:
     META_PIMPL_API void  SetProgramBindings(const ProgramBindings& program_bindings,
                                             ProgramBindingsApplyBehaviorMask apply_behavior = ProgramBindingsApplyBehaviorMask(~0U)) const;
     META_PIMPL_API void  SetResourceBarriers(const ResourceBarriers& resource_barriers) const;
+    META_PIMPL_API void  SetProgramBindingsResourceBarriers(const Refs<IProgramBindings>& program_bindings_refs) const;
     META_PIMPL_API void  Commit() const;
     META_PIMPL_API void  WaitUntilCompleted(uint32_t timeout_ms = 0U) const;
     [[nodiscard]] META_PIMPL_API Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const;
@@ -45,6 +45,7 @@ class Buffer;
 class Texture;
 class Sampler;
 class ObjectRegistry;
+class TransientBuffer;
 
 struct ShaderSettings;
 struct ProgramSettingsImpl;
@@ -111,6 +112,9 @@ public:
     [[nodiscard]] META_PIMPL_API CommandKit GetDefaultCommandKit(const CommandQueue& cmd_queue) const;
     [[nodiscard]] META_PIMPL_API CommandKit GetUploadCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetComputeCommandKit() const;
+    [[nodiscard]] META_PIMPL_API Data::Size GetRootConstantsUploadedSize() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API TransientBuffer GetTransientBuffer() const;
+    [[nodiscard]] META_PIMPL_API PipelineCacheStatistics GetPipelineCacheStatistics() const META_PIMPL_NOEXCEPT;
 
     // Data::IEmitter<IContextCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IContextCallback>& receiver) const;
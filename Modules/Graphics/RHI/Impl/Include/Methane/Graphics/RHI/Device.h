@@ -46,7 +46,10 @@ public:
     using Interface    = IDevice;
     using FeatureMask  = DeviceFeatureMask;
     using Feature      = DeviceFeature;
-    using Capabilities = DeviceCaps;
+    using Capabilities     = DeviceCaps;
+    using MemoryStatistics = DeviceMemoryStatistics;
+    using DynamicState     = DeviceDynamicState;
+    using DynamicStateMask = DeviceDynamicStateMask;
 
     META_PIMPL_METHODS_DECLARE(Device);
     META_PIMPL_METHODS_COMPARE_INLINE(Device);
@@ -72,6 +75,8 @@ public:
     [[nodiscard]] META_PIMPL_API const std::string&  GetAdapterName() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API bool                IsSoftwareAdapter() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const Capabilities& GetCapabilities() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API MemoryStatistics    GetMemoryStatistics() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API DynamicStateMask    GetDynamicStates() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API std::string         ToString() const;
 
     // Data::IEmitter<IDeviceCallback> interface methods
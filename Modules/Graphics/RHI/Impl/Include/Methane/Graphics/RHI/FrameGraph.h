@@ -0,0 +1,94 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/FrameGraph.h
+Methane FrameGraph PIMPL wrappers for direct calls to final implementation.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Pimpl.h>
+
+#include <Methane/Graphics/RHI/IFrameGraph.h>
+
+namespace Methane::Graphics::Base
+{
+class FrameGraph;
+}
+
+namespace Methane::Graphics::Rhi
+{
+
+class RenderContext;
+class ComputeContext;
+
+class FrameGraph // NOSONAR - constructors and assignment operators are required to use forward declared Impl and Ptr<Impl> in header
+{
+public:
+    using Interface      = IFrameGraph;
+    using ResourceId     = FrameGraphResourceId;
+    using PassId         = FrameGraphPassId;
+    using PassSettings   = FrameGraphPassSettings;
+    using PassFunction   = FrameGraphPassFunction;
+    using ResourceUsage  = FrameGraphResourceUsage;
+    using ResourceAccess = FrameGraphResourceAccess;
+    using Schedule       = FrameGraphSchedule;
+
+    META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE(FrameGraph);
+    META_PIMPL_METHODS_COMPARE_INLINE(FrameGraph);
+
+    META_PIMPL_API explicit FrameGraph(const Ptr<IFrameGraph>& interface_ptr);
+    META_PIMPL_API explicit FrameGraph(IFrameGraph& interface_ref);
+    META_PIMPL_API explicit FrameGraph(const RenderContext& context);
+    META_PIMPL_API explicit FrameGraph(const ComputeContext& context);
+
+    META_PIMPL_API bool IsInitialized() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API IFrameGraph& GetInterface() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API Ptr<IFrameGraph> GetInterfacePtr() const META_PIMPL_NOEXCEPT;
+
+    // IFrameGraph interface methods
+    META_PIMPL_API ResourceId ImportResourceInterface(IResource& resource, bool is_output = false) const;
+    META_PIMPL_API ResourceId AddTransientTexture(const TextureSettings& settings) const;
+    META_PIMPL_API PassId     AddPass(const PassSettings& settings, const PassFunction& function) const;
+    META_PIMPL_API const Schedule& Compile() const;
+    META_PIMPL_API void            Execute() const;
+
+    [[nodiscard]] META_PIMPL_API bool            IsCompiled() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API const Schedule& GetSchedule() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API IResource&      GetResource(ResourceId resource_id) const;
+
+    template<typename ResourceImplType>
+    ResourceId ImportResource(const ResourceImplType& resource, bool is_output = false) const
+    {
+        return ImportResourceInterface(resource.GetInterface(), is_output);
+    }
+
+private:
+    using Impl = Methane::Graphics::Base::FrameGraph;
+
+    Ptr<Impl> m_impl_ptr;
+};
+
+} // namespace Methane::Graphics::Rhi
+
+#ifdef META_PIMPL_INLINE
+
+#include <Methane/Graphics/RHI/FrameGraph.cpp>
+
+#endif // META_PIMPL_INLINE
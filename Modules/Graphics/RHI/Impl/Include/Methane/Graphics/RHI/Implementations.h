@@ -49,3 +49,5 @@ Methane graphics RHI PIMPL implementations.
 #include "ParallelRenderCommandList.h"
 #include "TransferCommandList.h"
 #include "ComputeCommandList.h"
+#include "FrameGraph.h"
+#include "TransientBuffer.h"
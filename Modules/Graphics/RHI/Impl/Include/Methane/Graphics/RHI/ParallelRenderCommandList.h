@@ -52,6 +52,9 @@ public:
     using State       = CommandListState;
     using DebugGroup  = CommandListDebugGroup;
     using ICallback   = ICommandListCallback;
+    using DrawRange   = IParallelRenderCommandList::DrawRange;
+    using DrawRangeFunction = std::function<void(const RenderCommandList& render_cmd_list, const DrawRange& draw_range)>;
+    using DrawCostFunction  = IParallelRenderCommandList::DrawCostFunction;
 
     META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE(ParallelRenderCommandList);
     META_PIMPL_METHODS_COMPARE_INLINE(ParallelRenderCommandList);
@@ -80,6 +83,7 @@ public:
     META_PIMPL_API void  SetProgramBindings(const ProgramBindings& program_bindings,
                                             ProgramBindingsApplyBehaviorMask apply_behavior = ProgramBindingsApplyBehaviorMask(~0U)) const;
     META_PIMPL_API void  SetResourceBarriers(const ResourceBarriers& resource_barriers) const;
+    META_PIMPL_API void  SetProgramBindingsResourceBarriers(const Refs<IProgramBindings>& program_bindings_refs) const;
     META_PIMPL_API void  Commit() const;
     META_PIMPL_API void  WaitUntilCompleted(uint32_t timeout_ms = 0U) const;
     [[nodiscard]] META_PIMPL_API Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const;
@@ -93,6 +97,8 @@ public:
     // IParallelRenderCommandList interface methods
     [[nodiscard]] META_PIMPL_API bool IsValidationEnabled() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void SetValidationEnabled(bool is_validation_enabled) const;
+    [[nodiscard]] META_PIMPL_API bool IsParallelCommandListsReuseEnabled() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API void SetParallelCommandListsReuseEnabled(bool is_reuse_enabled) const;
     [[nodiscard]] META_PIMPL_API RenderPass GetRenderPass() const;
     META_PIMPL_API void ResetWithState(const RenderState& render_state, const DebugGroup* debug_group_ptr = nullptr) const;
     META_PIMPL_API void SetViewState(const ViewState& view_state) const;
@@ -100,6 +106,8 @@ public:
     META_PIMPL_API void SetEndingResourceBarriers(const ResourceBarriers& resource_barriers) const;
     META_PIMPL_API void SetParallelCommandListsCount(uint32_t count) const;
     [[nodiscard]] META_PIMPL_API const std::vector<RenderCommandList>& GetParallelCommandLists() const;
+    META_PIMPL_API void DrawParallel(Data::Size draws_count, const DrawRangeFunction& draw_range_fn,
+                                     const DrawCostFunction& draw_cost_fn = {}, Data::Size min_command_list_cost = 1U) const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::ParallelRenderCommandList;
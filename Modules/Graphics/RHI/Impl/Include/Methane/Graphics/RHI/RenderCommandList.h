@@ -82,6 +82,7 @@ public:
     META_PIMPL_API void  SetProgramBindings(const ProgramBindings& program_bindings,
                                             ProgramBindingsApplyBehaviorMask apply_behavior = ProgramBindingsApplyBehaviorMask(~0U)) const;
     META_PIMPL_API void  SetResourceBarriers(const ResourceBarriers& resource_barriers) const;
+    META_PIMPL_API void  SetProgramBindingsResourceBarriers(const Refs<IProgramBindings>& program_bindings_refs) const;
     META_PIMPL_API void  Commit() const;
     META_PIMPL_API void  WaitUntilCompleted(uint32_t timeout_ms = 0U) const;
     [[nodiscard]] META_PIMPL_API Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const;
@@ -106,6 +107,11 @@ public:
                                     uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
     META_PIMPL_API void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0U,
                              uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
+    META_PIMPL_API void MultiDrawIndexed(Primitive primitive, std::span<const DrawIndexedArguments> draw_arguments) const;
+    META_PIMPL_API void DrawIndirect(Primitive primitive, const Buffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     const Buffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0U) const;
+    META_PIMPL_API void DrawIndexedIndirect(Primitive primitive, const Buffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            const Buffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0U) const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::RenderCommandList;
@@ -47,6 +47,7 @@ class RenderState;
 class RenderPattern;
 class ComputeState;
 class ObjectRegistry;
+class TransientBuffer;
 
 struct ShaderSettings;
 struct ProgramSettingsImpl;
@@ -118,6 +119,9 @@ public:
     [[nodiscard]] META_PIMPL_API CommandKit GetUploadCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetRenderCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetComputeCommandKit() const;
+    [[nodiscard]] META_PIMPL_API Data::Size GetRootConstantsUploadedSize() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API TransientBuffer GetTransientBuffer() const;
+    [[nodiscard]] META_PIMPL_API PipelineCacheStatistics GetPipelineCacheStatistics() const META_PIMPL_NOEXCEPT;
 
     // Data::IEmitter<IContextCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IContextCallback>& receiver) const;
@@ -0,0 +1,81 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/TransientBuffer.h
+Methane TransientBuffer PIMPL wrappers for direct calls to final implementation.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Pimpl.h>
+
+#include <Methane/Graphics/RHI/ITransientBuffer.h>
+
+namespace Methane::Graphics::Base
+{
+class TransientBuffer;
+}
+
+namespace Methane::Graphics::Rhi
+{
+
+class RenderContext;
+class ComputeContext;
+class Buffer;
+
+class TransientBuffer // NOSONAR - constructors and assignment operators are required to use forward declared Impl and Ptr<Impl> in header
+{
+public:
+    using Interface  = ITransientBuffer;
+    using Settings   = TransientBufferSettings;
+    using Slice      = TransientBufferSlice;
+    using Statistics = TransientBufferStatistics;
+
+    META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE(TransientBuffer);
+    META_PIMPL_METHODS_COMPARE_INLINE(TransientBuffer);
+
+    META_PIMPL_API explicit TransientBuffer(const Ptr<ITransientBuffer>& interface_ptr);
+    META_PIMPL_API explicit TransientBuffer(ITransientBuffer& interface_ref);
+    META_PIMPL_API TransientBuffer(const RenderContext& context, const Settings& settings);
+    META_PIMPL_API TransientBuffer(const ComputeContext& context, const Settings& settings);
+
+    META_PIMPL_API bool IsInitialized() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API ITransientBuffer& GetInterface() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API Ptr<ITransientBuffer> GetInterfacePtr() const META_PIMPL_NOEXCEPT;
+
+    // ITransientBuffer interface methods
+    [[nodiscard]] META_PIMPL_API const Settings& GetSettings() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API Buffer          GetBuffer() const;
+    [[nodiscard]] META_PIMPL_API Statistics      GetStatistics() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API Slice           Allocate(Data::Size size) const;
+    META_PIMPL_API void Flush() const;
+
+private:
+    using Impl = Methane::Graphics::Base::TransientBuffer;
+
+    Ptr<Impl> m_impl_ptr;
+};
+
+} // namespace Methane::Graphics::Rhi
+
+#ifdef META_PIMPL_INLINE
+
+#include <Methane/Graphics/RHI/TransientBuffer.cpp>
+
+#endif // META_PIMPL_INLINE
@@ -121,6 +121,11 @@ void ComputeCommandList::SetResourceBarriers(const ResourceBarriers& resource_ba
     GetImpl(m_impl_ptr).SetResourceBarriers(resource_barriers.GetInterface());
 }
 
+void ComputeCommandList::SetProgramBindingsResourceBarriers(const Refs<IProgramBindings>& program_bindings_refs) const
+{
+    GetImpl(m_impl_ptr).SetProgramBindingsResourceBarriers(program_bindings_refs);
+}
+
 void ComputeCommandList::Commit() const
 {
     GetImpl(m_impl_ptr).Commit();
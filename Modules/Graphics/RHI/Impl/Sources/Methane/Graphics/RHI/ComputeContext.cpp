@@ -32,6 +32,7 @@ Methane ComputeContext PIMPL wrappers for direct calls to final implementation.
 #include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Graphics/RHI/Sampler.h>
 #include <Methane/Graphics/RHI/ObjectRegistry.h>
+#include <Methane/Graphics/RHI/TransientBuffer.h>
 
 #include <Methane/Pimpl.hpp>
 
@@ -211,6 +212,21 @@ CommandKit ComputeContext::GetComputeCommandKit() const
     return CommandKit(GetImpl(m_impl_ptr).GetComputeCommandKit());
 }
 
+Data::Size ComputeContext::GetRootConstantsUploadedSize() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetRootConstantsUploadedSize();
+}
+
+TransientBuffer ComputeContext::GetTransientBuffer() const
+{
+    return TransientBuffer(GetImpl(m_impl_ptr).GetTransientBuffer());
+}
+
+PipelineCacheStatistics ComputeContext::GetPipelineCacheStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetPipelineCacheStatistics();
+}
+
 void ComputeContext::Connect(Data::Receiver<IContextCallback>& receiver) const
 {
     GetImpl(m_impl_ptr).Data::Emitter<IContextCallback>::Connect(receiver);
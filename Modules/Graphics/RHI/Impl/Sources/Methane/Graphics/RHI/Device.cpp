@@ -106,6 +106,16 @@ const DeviceCaps& Device::GetCapabilities() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetCapabilities();
 }
 
+DeviceMemoryStatistics Device::GetMemoryStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetMemoryStatistics();
+}
+
+DeviceDynamicStateMask Device::GetDynamicStates() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetDynamicStates();
+}
+
 std::string Device::ToString() const
 {
     return GetImpl(m_impl_ptr).ToString();
@@ -0,0 +1,112 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/FrameGraph.cpp
+Methane FrameGraph PIMPL wrappers for direct calls to final implementation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/FrameGraph.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+
+#include <Methane/Graphics/Base/FrameGraph.h>
+
+#include <Methane/Pimpl.hpp>
+
+namespace Methane::Graphics::Rhi
+{
+
+META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(FrameGraph);
+
+FrameGraph::FrameGraph(const Ptr<IFrameGraph>& interface_ptr)
+    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+{
+}
+
+FrameGraph::FrameGraph(IFrameGraph& interface_ref)
+    : FrameGraph(interface_ref.GetPtr())
+{
+}
+
+FrameGraph::FrameGraph(const RenderContext& context)
+    : FrameGraph(IFrameGraph::Create(context.GetInterface()))
+{
+}
+
+FrameGraph::FrameGraph(const ComputeContext& context)
+    : FrameGraph(IFrameGraph::Create(context.GetInterface()))
+{
+}
+
+bool FrameGraph::IsInitialized() const META_PIMPL_NOEXCEPT
+{
+    return static_cast<bool>(m_impl_ptr);
+}
+
+IFrameGraph& FrameGraph::GetInterface() const META_PIMPL_NOEXCEPT
+{
+    return *m_impl_ptr;
+}
+
+Ptr<IFrameGraph> FrameGraph::GetInterfacePtr() const META_PIMPL_NOEXCEPT
+{
+    return m_impl_ptr;
+}
+
+FrameGraph::ResourceId FrameGraph::ImportResourceInterface(IResource& resource, bool is_output) const
+{
+    return GetImpl(m_impl_ptr).ImportResource(resource, is_output);
+}
+
+FrameGraph::ResourceId FrameGraph::AddTransientTexture(const TextureSettings& settings) const
+{
+    return GetImpl(m_impl_ptr).AddTransientTexture(settings);
+}
+
+FrameGraph::PassId FrameGraph::AddPass(const PassSettings& settings, const PassFunction& function) const
+{
+    return GetImpl(m_impl_ptr).AddPass(settings, function);
+}
+
+const FrameGraph::Schedule& FrameGraph::Compile() const
+{
+    return GetImpl(m_impl_ptr).Compile();
+}
+
+void FrameGraph::Execute() const
+{
+    GetImpl(m_impl_ptr).Execute();
+}
+
+bool FrameGraph::IsCompiled() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).IsCompiled();
+}
+
+const FrameGraph::Schedule& FrameGraph::GetSchedule() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetSchedule();
+}
+
+IResource& FrameGraph::GetResource(ResourceId resource_id) const
+{
+    return GetImpl(m_impl_ptr).GetResource(resource_id);
+}
+
+} // namespace Methane::Graphics::Rhi
@@ -125,6 +125,11 @@ void ParallelRenderCommandList::SetResourceBarriers(const ResourceBarriers& reso
     GetImpl(m_impl_ptr).SetResourceBarriers(resource_barriers.GetInterface());
 }
 
+void ParallelRenderCommandList::SetProgramBindingsResourceBarriers(const Refs<IProgramBindings>& program_bindings_refs) const
+{
+    GetImpl(m_impl_ptr).SetProgramBindingsResourceBarriers(program_bindings_refs);
+}
+
 void ParallelRenderCommandList::Commit() const
 {
     GetImpl(m_impl_ptr).Commit();
@@ -170,6 +175,16 @@ void ParallelRenderCommandList::SetValidationEnabled(bool is_validation_enabled)
     GetImpl(m_impl_ptr).SetValidationEnabled(is_validation_enabled);
 }
 
+bool ParallelRenderCommandList::IsParallelCommandListsReuseEnabled() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).IsParallelCommandListsReuseEnabled();
+}
+
+void ParallelRenderCommandList::SetParallelCommandListsReuseEnabled(bool is_reuse_enabled) const
+{
+    GetImpl(m_impl_ptr).SetParallelCommandListsReuseEnabled(is_reuse_enabled);
+}
+
 RenderPass ParallelRenderCommandList::GetRenderPass() const
 {
     return RenderPass(GetImpl(m_impl_ptr).GetRenderPass());
@@ -198,6 +213,7 @@ void ParallelRenderCommandList::SetEndingResourceBarriers(const ResourceBarriers
 void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count) const
 {
     GetImpl(m_impl_ptr).SetParallelCommandListsCount(count);
+    m_parallel_command_lists.clear();
 }
 
 const std::vector<RenderCommandList>& ParallelRenderCommandList::GetParallelCommandLists() const
@@ -214,4 +230,15 @@ const std::vector<RenderCommandList>& ParallelRenderCommandList::GetParallelComm
     return m_parallel_command_lists;
 }
 
+void ParallelRenderCommandList::DrawParallel(Data::Size draws_count, const DrawRangeFunction& draw_range_fn,
+                                             const DrawCostFunction& draw_cost_fn, Data::Size min_command_list_cost) const
+{
+    GetImpl(m_impl_ptr).DrawParallel(draws_count,
+        [&draw_range_fn](IRenderCommandList& render_cmd_list, const DrawRange& draw_range)
+        {
+            draw_range_fn(RenderCommandList(render_cmd_list), draw_range);
+        },
+        draw_cost_fn, min_command_list_cost);
+}
+
 } // namespace Methane::Graphics::Rhi
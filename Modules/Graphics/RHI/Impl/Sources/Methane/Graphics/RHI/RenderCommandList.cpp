@@ -125,6 +125,11 @@ void RenderCommandList::SetResourceBarriers(const ResourceBarriers& resource_bar
     GetImpl(m_impl_ptr).SetResourceBarriers(resource_barriers.GetInterface());
 }
 
+void RenderCommandList::SetProgramBindingsResourceBarriers(const Refs<IProgramBindings>& program_bindings_refs) const
+{
+    GetImpl(m_impl_ptr).SetProgramBindingsResourceBarriers(program_bindings_refs);
+}
+
 void RenderCommandList::Commit() const
 {
     GetImpl(m_impl_ptr).Commit();
@@ -219,4 +224,23 @@ void RenderCommandList::Draw(Primitive primitive,
     GetImpl(m_impl_ptr).Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
 }
 
+void RenderCommandList::MultiDrawIndexed(Primitive primitive, std::span<const DrawIndexedArguments> draw_arguments) const
+{
+    GetImpl(m_impl_ptr).MultiDrawIndexed(primitive, draw_arguments);
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, const Buffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     const Buffer* count_buffer_ptr, Data::Size count_offset) const
+{
+    GetImpl(m_impl_ptr).DrawIndirect(primitive, arguments_buffer.GetInterface(), arguments_offset, max_draw_count,
+                                     count_buffer_ptr ? &count_buffer_ptr->GetInterface() : nullptr, count_offset);
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, const Buffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            const Buffer* count_buffer_ptr, Data::Size count_offset) const
+{
+    GetImpl(m_impl_ptr).DrawIndexedIndirect(primitive, arguments_buffer.GetInterface(), arguments_offset, max_draw_count,
+                                            count_buffer_ptr ? &count_buffer_ptr->GetInterface() : nullptr, count_offset);
+}
+
 } // namespace Methane::Graphics::Rhi
@@ -34,6 +34,7 @@ Methane RenderContext PIMPL wrappers for direct calls to final implementation.
 #include <Methane/Graphics/RHI/RenderPattern.h>
 #include <Methane/Graphics/RHI/ComputeState.h>
 #include <Methane/Graphics/RHI/ObjectRegistry.h>
+#include <Methane/Graphics/RHI/TransientBuffer.h>
 
 #include <Methane/Pimpl.hpp>
 
@@ -228,6 +229,21 @@ CommandKit RenderContext::GetComputeCommandKit() const
     return CommandKit(GetImpl(m_impl_ptr).GetComputeCommandKit());
 }
 
+Data::Size RenderContext::GetRootConstantsUploadedSize() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetRootConstantsUploadedSize();
+}
+
+TransientBuffer RenderContext::GetTransientBuffer() const
+{
+    return TransientBuffer(GetImpl(m_impl_ptr).GetTransientBuffer());
+}
+
+PipelineCacheStatistics RenderContext::GetPipelineCacheStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetPipelineCacheStatistics();
+}
+
 void RenderContext::Connect(Data::Receiver<IContextCallback>& receiver) const
 {
     GetImpl(m_impl_ptr).Data::Emitter<IContextCallback>::Connect(receiver);
@@ -0,0 +1,98 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/TransientBuffer.cpp
+Methane TransientBuffer PIMPL wrappers for direct calls to final implementation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/TransientBuffer.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+
+#include <Methane/Graphics/Base/TransientBuffer.h>
+
+#include <Methane/Pimpl.hpp>
+
+namespace Methane::Graphics::Rhi
+{
+
+META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(TransientBuffer);
+
+TransientBuffer::TransientBuffer(const Ptr<ITransientBuffer>& interface_ptr)
+    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+{
+}
+
+TransientBuffer::TransientBuffer(ITransientBuffer& interface_ref)
+    : TransientBuffer(interface_ref.GetPtr())
+{
+}
+
+TransientBuffer::TransientBuffer(const RenderContext& context, const Settings& settings)
+    : TransientBuffer(ITransientBuffer::Create(context.GetInterface(), settings))
+{
+}
+
+TransientBuffer::TransientBuffer(const ComputeContext& context, const Settings& settings)
+    : TransientBuffer(ITransientBuffer::Create(context.GetInterface(), settings))
+{
+}
+
+bool TransientBuffer::IsInitialized() const META_PIMPL_NOEXCEPT
+{
+    return static_cast<bool>(m_impl_ptr);
+}
+
+ITransientBuffer& TransientBuffer::GetInterface() const META_PIMPL_NOEXCEPT
+{
+    return *m_impl_ptr;
+}
+
+Ptr<ITransientBuffer> TransientBuffer::GetInterfacePtr() const META_PIMPL_NOEXCEPT
+{
+    return m_impl_ptr;
+}
+
+const TransientBuffer::Settings& TransientBuffer::GetSettings() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetSettings();
+}
+
+Buffer TransientBuffer::GetBuffer() const
+{
+    return Buffer(GetImpl(m_impl_ptr).GetBuffer());
+}
+
+TransientBuffer::Statistics TransientBuffer::GetStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetStatistics();
+}
+
+TransientBuffer::Slice TransientBuffer::Allocate(Data::Size size) const
+{
+    return GetImpl(m_impl_ptr).Allocate(size);
+}
+
+void TransientBuffer::Flush() const
+{
+    GetImpl(m_impl_ptr).Flush();
+}
+
+} // namespace Methane::Graphics::Rhi
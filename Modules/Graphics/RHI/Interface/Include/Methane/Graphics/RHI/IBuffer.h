@@ -36,7 +36,8 @@ enum class BufferType
     Storage,
     Index,
     Vertex,
-    ReadBack
+    ReadBack,
+    Indirect
 };
 
 enum class BufferStorageMode
@@ -58,6 +59,7 @@ struct BufferSettings
     [[nodiscard]] static BufferSettings ForIndexBuffer(Data::Size size, PixelFormat format, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForConstantBuffer(Data::Size size, bool addressable = false, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForReadBackBuffer(Data::Size size);
+    [[nodiscard]] static BufferSettings ForIndirectBuffer(Data::Size size, bool is_volatile = false);
 
     [[nodiscard]] friend bool operator==(const BufferSettings& left, const BufferSettings& right) = default;
 };
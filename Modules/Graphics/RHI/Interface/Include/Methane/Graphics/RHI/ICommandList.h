@@ -88,6 +88,10 @@ struct ICommandList
     virtual void  SetProgramBindings(IProgramBindings& program_bindings,
                                      ProgramBindingsApplyBehaviorMask apply_behavior = ProgramBindingsApplyBehaviorMask(~0U)) = 0;
     virtual void  SetResourceBarriers(const IResourceBarriers& resource_barriers) = 0;
+
+    // Transitions resources of all program bindings to the states required by their arguments with one batch of resource barriers,
+    // so that following SetProgramBindings calls do not set per-binding barriers for resources already in required states
+    virtual void  SetProgramBindingsResourceBarriers(const Refs<IProgramBindings>& program_bindings_refs) = 0;
     virtual void  Commit() = 0;
     virtual void  WaitUntilCompleted(uint32_t timeout_ms = 0U) = 0;
     [[nodiscard]] virtual Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const = 0;
@@ -66,11 +66,25 @@ enum class ContextOption : uint32_t
 {
     DeferredProgramBindingsInitialization, // Defer program bindings initialization on GPU until Context::CompleteInitialization
     TransferWithD3D12DirectQueue,          // Transfer command lists and queues in DX API are created with DIRECT type instead of COPY type
-    EmulateD3D12RenderPass                 // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+    EmulateD3D12RenderPass,                // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+    AsyncPipelineCreation                  // Pipelines are created asynchronously and draw calls are skipped until render state pipeline is ready
+                                           // (unless previous pipeline is kept as placeholder after state reset), skipped draws are counted
+                                           // and logged by backend, so the first frames using new render state may miss some geometry
 };
 
 using ContextOptionMask = Data::EnumMask<ContextOption>;
 
+struct PipelineCacheStatistics
+{
+    Data::Size loaded_data_size        = 0U; // size of pipeline cache data loaded from file on context initialization
+    uint32_t   pipelines_created       = 0U;
+    uint32_t   frame_pipelines_created = 0U; // pipelines created in the previous frame
+    uint32_t   cache_hits_count        = 0U; // hits and misses are counted only when reported by the driver
+    uint32_t   cache_misses_count      = 0U;
+
+    [[nodiscard]] friend bool operator==(const PipelineCacheStatistics& left, const PipelineCacheStatistics& right) noexcept = default;
+};
+
 class ContextIncompatibleException
     : public std::runtime_error
 {
@@ -98,6 +112,7 @@ struct IComputeState;
 struct IBuffer;
 struct ITexture;
 struct ISampler;
+struct ITransientBuffer;
 
 struct ShaderSettings;
 struct ProgramSettings;
@@ -144,6 +159,9 @@ struct IContext
     [[nodiscard]] virtual const IDevice& GetDevice() const = 0;
     [[nodiscard]] virtual ICommandKit& GetDefaultCommandKit(CommandListType type) const = 0;
     [[nodiscard]] virtual ICommandKit& GetDefaultCommandKit(ICommandQueue& cmd_queue) const = 0;
+    [[nodiscard]] virtual Data::Size GetRootConstantsUploadedSize() const noexcept = 0; // bytes uploaded in the previous frame
+    [[nodiscard]] virtual ITransientBuffer& GetTransientBuffer() const = 0; // ring buffer recycled on frame completion
+    [[nodiscard]] virtual PipelineCacheStatistics GetPipelineCacheStatistics() const noexcept = 0;
 
     [[nodiscard]] ICommandKit& GetUploadCommandKit() const;
 };
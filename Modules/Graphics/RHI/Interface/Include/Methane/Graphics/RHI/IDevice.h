@@ -73,6 +73,31 @@ struct DeviceCaps
     [[nodiscard]] friend auto operator<=>(const DeviceCaps& left, const DeviceCaps& right) noexcept = default;
 };
 
+// Pipeline states which are set in command list without creating new native pipelines
+enum class DeviceDynamicState : uint32_t
+{
+    Viewports,         // viewport and scissor rect values
+    ViewportsCount,    // number of viewports and scissor rects
+    PrimitiveTopology,
+    CullMode,          // rasterizer cull mode and front face
+    DepthTest,         // depth test enable, write enable and compare function
+    StencilTest        // stencil test enable and face operations
+};
+
+using DeviceDynamicStateMask = Data::EnumMask<DeviceDynamicState>;
+
+struct DeviceMemoryStatistics
+{
+    uint64_t budget_size            = 0U; // device local memory available to the application
+    uint64_t allocated_size         = 0U; // size of native memory blocks allocated from the device
+    uint64_t used_size              = 0U; // size of resource memory sub-allocated from native memory blocks
+    uint32_t blocks_count           = 0U;
+    uint32_t dedicated_blocks_count = 0U;
+    uint32_t allocations_count      = 0U;
+
+    [[nodiscard]] friend bool operator==(const DeviceMemoryStatistics& left, const DeviceMemoryStatistics& right) noexcept = default;
+};
+
 struct IDevice;
 
 struct IDeviceCallback
@@ -94,13 +119,18 @@ struct IDevice
 {
     using FeatureMask  = DeviceFeatureMask;
     using Feature      = DeviceFeature;
-    using Capabilities = DeviceCaps;
+    using Capabilities     = DeviceCaps;
+    using MemoryStatistics = DeviceMemoryStatistics;
+    using DynamicState     = DeviceDynamicState;
+    using DynamicStateMask = DeviceDynamicStateMask;
 
     [[nodiscard]] virtual Ptr<IRenderContext>  CreateRenderContext(const Platform::AppEnvironment& env, tf::Executor& parallel_executor, const RenderContextSettings& settings) = 0;
     [[nodiscard]] virtual Ptr<IComputeContext> CreateComputeContext(tf::Executor& parallel_executor, const ComputeContextSettings& settings) = 0;
     [[nodiscard]] virtual const std::string&   GetAdapterName() const noexcept = 0;
     [[nodiscard]] virtual bool                 IsSoftwareAdapter() const noexcept = 0;
     [[nodiscard]] virtual const Capabilities&  GetCapabilities() const noexcept = 0;
+    [[nodiscard]] virtual MemoryStatistics     GetMemoryStatistics() const noexcept = 0;
+    [[nodiscard]] virtual DynamicStateMask     GetDynamicStates() const noexcept = 0;
     [[nodiscard]] virtual std::string          ToString() const = 0;
 };
 
@@ -0,0 +1,136 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/IFrameGraph.h
+Methane frame graph interface: frame passes declare usage of resources,
+so that resource transition barriers are inferred automatically.
+
+******************************************************************************/
+
+#pragma once
+
+#include "IResourceBarriers.h"
+#include "ITexture.h"
+
+#include <Methane/Memory.hpp>
+#include <Methane/Data/Types.h>
+
+#include <string>
+#include <vector>
+#include <functional>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IContext;
+struct IResource;
+
+using FrameGraphResourceId = Data::Index;
+using FrameGraphPassId     = Data::Index;
+
+enum class FrameGraphResourceAccess
+{
+    Read,
+    Write
+};
+
+struct FrameGraphResourceUsage
+{
+    FrameGraphResourceId     resource_id;
+    ResourceState            state;
+    FrameGraphResourceAccess access = FrameGraphResourceAccess::Read;
+
+    [[nodiscard]] friend bool operator==(const FrameGraphResourceUsage& left, const FrameGraphResourceUsage& right) = default;
+};
+
+using FrameGraphResourceUsages = std::vector<FrameGraphResourceUsage>;
+
+struct FrameGraphPassSettings
+{
+    std::string              name;
+    FrameGraphResourceUsages resource_usages;
+
+    // Output pass is never culled, even when resources written by this pass are not read by other passes
+    bool                     is_output = false;
+};
+
+// Pass function encodes commands of the pass with transition barriers set before any other command
+using FrameGraphPassFunction = std::function<void(const IResourceBarriers& transition_barriers)>;
+
+struct FrameGraphTransition
+{
+    FrameGraphResourceId resource_id;
+    ResourceState        state_before;
+    ResourceState        state_after;
+
+    [[nodiscard]] friend bool operator==(const FrameGraphTransition& left, const FrameGraphTransition& right) = default;
+};
+
+struct FrameGraphPassSchedule
+{
+    FrameGraphPassId                  pass_id;
+    std::vector<FrameGraphTransition> transitions;
+
+    [[nodiscard]] friend bool operator==(const FrameGraphPassSchedule& left, const FrameGraphPassSchedule& right) = default;
+};
+
+// Result of frame graph compilation: passes in order of execution with resource transitions
+// to be set before each pass, culled passes and physical texture slots shared by aliased transient textures
+struct FrameGraphSchedule
+{
+    std::vector<FrameGraphPassSchedule> passes;
+    std::vector<FrameGraphPassId>       culled_pass_ids;
+    std::vector<Opt<Data::Index>>       transient_slot_by_resource; // slot index for used transient texture resources
+    Data::Size                          transient_slots_count = 0U;
+
+    [[nodiscard]] Data::Size GetTransitionsCount() const noexcept;
+};
+
+struct IFrameGraph
+{
+    using ResourceId     = FrameGraphResourceId;
+    using PassId         = FrameGraphPassId;
+    using PassSettings   = FrameGraphPassSettings;
+    using PassFunction   = FrameGraphPassFunction;
+    using ResourceUsage  = FrameGraphResourceUsage;
+    using ResourceAccess = FrameGraphResourceAccess;
+    using Schedule       = FrameGraphSchedule;
+
+    [[nodiscard]] static Ptr<IFrameGraph> Create(const IContext& context);
+
+    // Imported resources are owned by application and must be alive until frame graph is compiled again or released;
+    // output resource is consumed outside of the frame graph, so passes writing to it are not culled
+    virtual ResourceId ImportResource(IResource& resource, bool is_output = false) = 0;
+
+    // Transient textures are created by frame graph on compilation, transient textures with the same settings
+    // and non-overlapping lifetimes between passes are aliased with the same physical texture
+    virtual ResourceId AddTransientTexture(const TextureSettings& settings) = 0;
+    virtual PassId     AddPass(const PassSettings& settings, const PassFunction& function) = 0;
+
+    virtual const Schedule& Compile() = 0;
+    virtual void            Execute() = 0;
+
+    [[nodiscard]] virtual bool            IsCompiled() const noexcept = 0;
+    [[nodiscard]] virtual const Schedule& GetSchedule() const noexcept = 0;
+    [[nodiscard]] virtual IResource&      GetResource(ResourceId resource_id) const = 0;
+    [[nodiscard]] virtual Ptr<IFrameGraph> GetPtr() = 0;
+
+    virtual ~IFrameGraph() = default;
+};
+
+} // namespace Methane::Graphics::Rhi
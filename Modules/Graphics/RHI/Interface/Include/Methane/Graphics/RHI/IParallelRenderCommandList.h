@@ -27,6 +27,10 @@ for multi-threaded rendering in the single render pass.
 #include "IRenderCommandList.h"
 
 #include <Methane/Memory.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Data/Range.hpp>
+
+#include <functional>
 
 namespace Methane::Graphics::Rhi
 {
@@ -39,12 +43,18 @@ struct IParallelRenderCommandList
 {
     static constexpr Type type = Type::ParallelRender;
 
+    using DrawRange = Data::Range<Data::Index>;
+    using DrawRangeFunction = std::function<void(IRenderCommandList& render_cmd_list, const DrawRange& draw_range)>;
+    using DrawCostFunction  = std::function<Data::Size(Data::Index draw_index)>;
+
     // Create IParallelRenderCommandList instance
     [[nodiscard]] static Ptr<IParallelRenderCommandList> Create(ICommandQueue& command_queue, IRenderPass& render_pass);
 
     // IParallelRenderCommandList interface
     [[nodiscard]] virtual bool IsValidationEnabled() const noexcept = 0;
     virtual void SetValidationEnabled(bool is_validation_enabled) = 0;
+    [[nodiscard]] virtual bool IsParallelCommandListsReuseEnabled() const noexcept = 0;
+    virtual void SetParallelCommandListsReuseEnabled(bool is_reuse_enabled) = 0;
     [[nodiscard]] virtual IRenderPass& GetRenderPass() const = 0;
     virtual void ResetWithState(IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) = 0;
     virtual void SetViewState(IViewState& view_state) = 0;
@@ -52,6 +62,12 @@ struct IParallelRenderCommandList
     virtual void SetEndingResourceBarriers(const IResourceBarriers& resource_barriers) = 0;
     virtual void SetParallelCommandListsCount(uint32_t count) = 0;
     [[nodiscard]] virtual const Refs<IRenderCommandList>& GetParallelCommandLists() const = 0;
+
+    // Draws are split in contiguous ranges of equal estimated cost (1 per draw by default), encoded in parallel threads
+    // to the thread command lists in order of their indices; thread command lists without draws are left empty when
+    // the total draws cost is less than minimal cost of one command list multiplied by the command lists count
+    virtual void DrawParallel(Data::Size draws_count, const DrawRangeFunction& draw_range_fn,
+                              const DrawCostFunction& draw_cost_fn = {}, Data::Size min_command_list_cost = 1U) = 0;
     
     using ICommandList::Reset;
 };
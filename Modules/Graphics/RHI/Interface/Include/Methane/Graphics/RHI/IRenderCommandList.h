@@ -28,6 +28,8 @@ Methane render command list interface.
 
 #include <Methane/Memory.hpp>
 
+#include <span>
+
 namespace Methane::Graphics::Rhi
 {
 
@@ -46,6 +48,29 @@ enum class RenderPrimitive
     TriangleStrip
 };
 
+// Fields order matches indirect draw arguments layout of the native graphics APIs
+struct DrawArguments
+{
+    uint32_t vertex_count   = 0U;
+    uint32_t instance_count = 1U;
+    uint32_t start_vertex   = 0U;
+    uint32_t start_instance = 0U;
+
+    [[nodiscard]] friend bool operator==(const DrawArguments& left, const DrawArguments& right) noexcept = default;
+};
+
+// Fields order matches indexed indirect draw arguments layout of the native graphics APIs
+struct DrawIndexedArguments
+{
+    uint32_t index_count    = 0U;
+    uint32_t instance_count = 1U;
+    uint32_t start_index    = 0U;
+    uint32_t start_vertex   = 0U;
+    uint32_t start_instance = 0U;
+
+    [[nodiscard]] friend bool operator==(const DrawIndexedArguments& left, const DrawIndexedArguments& right) noexcept = default;
+};
+
 struct IRenderCommandList
     : virtual ICommandList // NOSONAR
 {
@@ -70,6 +95,16 @@ struct IRenderCommandList
                              uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
     virtual void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0,
                       uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
+    virtual void MultiDrawIndexed(Primitive primitive, std::span<const DrawIndexedArguments> draw_arguments) = 0;
+
+    // Indirect draws read up to max_draw_count of tightly packed draw arguments from the indirect buffer at arguments offset.
+    // Draws count is read as uint32 value from the optional count buffer at count offset and is limited by max_draw_count.
+    // When count buffer is not supported natively (Metal or Vulkan without VK_KHR_draw_indirect_count), all max_draw_count draws are issued,
+    // so the unused draw arguments should have zero instance count.
+    virtual void DrawIndirect(Primitive primitive, IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                              IBuffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0) = 0;
+    virtual void DrawIndexedIndirect(Primitive primitive, IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     IBuffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0) = 0;
     
     using ICommandList::Reset;
 };
@@ -26,9 +26,9 @@ Methane resource barriers for manual or automatic resource state synchronization
 #include <Methane/Memory.hpp>
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
+#include <Methane/Data/FlatMap.hpp>
 
 #include <string>
-#include <map>
 #include <set>
 
 namespace Methane::Graphics::Rhi
@@ -199,7 +199,7 @@ struct IResourceBarriers
     using State   = ResourceState;
     using Barrier = ResourceBarrier;
     using Set     = std::set<Barrier>;
-    using Map     = std::map<Barrier::Id, Barrier>;
+    using Map     = Data::FlatMap<Barrier::Id, Barrier>;
 
     enum class AddResult
     {
@@ -0,0 +1,96 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/ITransientBuffer.h
+Methane transient buffer interface: persistently mapped ring buffer
+sub-allocated for per-frame dynamic data.
+
+******************************************************************************/
+
+#pragma once
+
+#include "ResourceView.h"
+
+#include <Methane/Memory.hpp>
+#include <Methane/Data/Types.h>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IContext;
+struct IBuffer;
+
+struct TransientBufferSettings
+{
+    Data::Size size      = 4U * 1024U * 1024U; // ring buffer capacity in bytes
+    Data::Size alignment = 256U;               // alignment of slice offsets required for constant buffer views
+
+    [[nodiscard]] friend bool operator==(const TransientBufferSettings& left, const TransientBufferSettings& right) = default;
+};
+
+// Sub-allocation of the transient buffer, which is valid until the frame it was allocated in is completed on GPU
+struct TransientBufferSlice
+{
+    IBuffer*    buffer_ptr = nullptr;
+    Data::Size  offset     = 0U;
+    Data::Size  size       = 0U;
+    Data::Byte* data_ptr   = nullptr; // persistently mapped CPU-visible memory of the slice
+
+    [[nodiscard]] bool         IsInitialized() const noexcept { return buffer_ptr && data_ptr; }
+    [[nodiscard]] ResourceView GetResourceView() const;
+
+    void SetData(Data::ConstRawPtr source_data_ptr, Data::Size source_data_size, Data::Size slice_offset = 0U) const;
+};
+
+struct TransientBufferStatistics
+{
+    Data::Size capacity          = 0U;
+    Data::Size used_size         = 0U; // size of slices allocated in frames not completed on GPU yet
+    Data::Size peak_used_size    = 0U;
+    uint32_t   frames_in_flight  = 0U;
+    uint32_t   allocations_count = 0U; // total count of allocated slices
+};
+
+struct ITransientBuffer
+{
+    using Settings   = TransientBufferSettings;
+    using Slice      = TransientBufferSlice;
+    using Statistics = TransientBufferStatistics;
+
+    // Context owns default transient buffer, which is recycled automatically on frame completion,
+    // see IContext::GetTransientBuffer; transient buffers created explicitly are recycled with the same context frames
+    [[nodiscard]] static Ptr<ITransientBuffer> Create(const IContext& context, const Settings& settings);
+
+    // ITransientBuffer interface
+    [[nodiscard]] virtual const Settings& GetSettings() const noexcept = 0;
+    [[nodiscard]] virtual IBuffer&        GetBuffer() const noexcept = 0;
+    [[nodiscard]] virtual Statistics      GetStatistics() const noexcept = 0;
+    [[nodiscard]] virtual Ptr<ITransientBuffer> GetPtr() = 0;
+
+    // Slices are allocated with bump-pointer by multiple threads without locking,
+    // exception is thrown when ring buffer is full with slices of the frames in flight
+    [[nodiscard]] virtual Slice Allocate(Data::Size size) = 0;
+
+    // Makes data written to slices since the previous flush visible to GPU, should be called before execution
+    // of command lists using the slices; it is no-op for backends with coherent mapped memory
+    virtual void Flush() = 0;
+
+    virtual ~ITransientBuffer() = default;
+};
+
+} // namespace Methane::Graphics::Rhi
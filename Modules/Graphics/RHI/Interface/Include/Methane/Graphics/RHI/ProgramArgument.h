@@ -97,6 +97,10 @@ enum class ProgramArgumentAccessType : uint32_t
     Mutable        // META_ARG_MUTABLE(2)
 };
 
+// Register space of the global bindless descriptor arrays META_ARG_BINDLESS(3),
+// which are indexed in shaders with values of the 'ProgramArgumentValueType::BindlessIndex' arguments
+constexpr uint32_t g_bindless_register_space = 3U;
+
 using ProgramArgumentAccessMask = Data::EnumMask<ProgramArgumentAccessType>;
 
 enum class ProgramArgumentValueType
@@ -104,7 +108,8 @@ enum class ProgramArgumentValueType
     ResourceView,       // Default argument access by descriptor from resource view
     BufferAddress,      // GPU addressable buffer view with offset and size
     RootConstantBuffer, // Root constant stored in the program-managed buffer and referenced by GPU address
-    RootConstantValue   // Root constant value stored in the root signature as 32-bit values
+    RootConstantValue,  // Root constant value stored in the root signature as 32-bit values
+    BindlessIndex       // Indices of resource views in global bindless descriptor arrays stored as root constant values
 };
 
 using ProgramArguments = std::unordered_set<ProgramArgument, ProgramArgument::Hash>;
@@ -135,6 +140,7 @@ public:
     [[nodiscard]] bool      IsRootConstantBuffer() const noexcept { return m_value_type == ValueType::RootConstantBuffer; }
     [[nodiscard]] bool      IsRootConstantValue() const noexcept  { return m_value_type == ValueType::RootConstantValue; }
     [[nodiscard]] bool      IsRootConstant() const noexcept       { return IsRootConstantBuffer() || IsRootConstantValue(); }
+    [[nodiscard]] bool      IsBindlessIndex() const noexcept      { return m_value_type == ValueType::BindlessIndex; }
     [[nodiscard]] bool      IsMutable() const noexcept            { return m_access_type == Type::Mutable; }
     [[nodiscard]] bool      IsConstant() const noexcept           { return m_access_type == Type::Constant; }
     [[nodiscard]] bool      IsFrameConstant() const noexcept      { return m_access_type == Type::FrameConstant; }
@@ -184,6 +190,20 @@ META_PROGRAM_ARG(shader_type, arg_name, access_type, Methane::Graphics::Rhi::Pro
 #define META_PROGRAM_ARG_ROOT_VALUE_MUTABLE(shader_type, arg_name) \
     META_PROGRAM_ARG_ROOT_VALUE(shader_type, arg_name, Methane::Graphics::Rhi::ProgramArgumentAccessType::Mutable)
 
+// Bindless-Index argument accessors
+
+#define META_PROGRAM_ARG_BINDLESS_INDEX(shader_type, arg_name, access_type) \
+    META_PROGRAM_ARG(shader_type, arg_name, access_type, Methane::Graphics::Rhi::ProgramArgumentValueType::BindlessIndex)
+
+#define META_PROGRAM_ARG_BINDLESS_INDEX_CONSTANT(shader_type, arg_name) \
+    META_PROGRAM_ARG_BINDLESS_INDEX(shader_type, arg_name, Methane::Graphics::Rhi::ProgramArgumentAccessType::Constant)
+
+#define META_PROGRAM_ARG_BINDLESS_INDEX_FRAME_CONSTANT(shader_type, arg_name) \
+    META_PROGRAM_ARG_BINDLESS_INDEX(shader_type, arg_name, Methane::Graphics::Rhi::ProgramArgumentAccessType::FrameConstant)
+
+#define META_PROGRAM_ARG_BINDLESS_INDEX_MUTABLE(shader_type, arg_name) \
+    META_PROGRAM_ARG_BINDLESS_INDEX(shader_type, arg_name, Methane::Graphics::Rhi::ProgramArgumentAccessType::Mutable)
+
 // Resource-View argument accessors
 
 #define META_PROGRAM_ARG_RESOURCE_VIEW(shader_type, arg_name, access_type) \
@@ -93,4 +93,17 @@ BufferSettings BufferSettings::ForReadBackBuffer(Data::Size size)
     };
 }
 
+BufferSettings BufferSettings::ForIndirectBuffer(Data::Size size, bool is_volatile)
+{
+    META_FUNCTION_TASK();
+    return Rhi::BufferSettings{
+        Rhi::BufferType::Indirect,
+        Rhi::ResourceUsageMask(),
+        size,
+        0U,
+        PixelFormat::Unknown,
+        GetBufferStorageMode(is_volatile)
+    };
+}
+
 } // namespace Methane::Graphics::Rhi
@@ -0,0 +1,43 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/IFrameGraph.cpp
+Methane frame graph interface: frame passes declare usage of resources,
+so that resource transition barriers are inferred automatically.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/IFrameGraph.h>
+
+#include <Methane/Instrumentation.h>
+
+namespace Methane::Graphics::Rhi
+{
+
+Data::Size FrameGraphSchedule::GetTransitionsCount() const noexcept
+{
+    META_FUNCTION_TASK();
+    Data::Size transitions_count = 0U;
+    for(const FrameGraphPassSchedule& pass_schedule : passes)
+    {
+        transitions_count += static_cast<Data::Size>(pass_schedule.transitions.size());
+    }
+    return transitions_count;
+}
+
+} // namespace Methane::Graphics::Rhi
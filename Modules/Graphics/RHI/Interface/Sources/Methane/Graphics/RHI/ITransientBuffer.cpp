@@ -0,0 +1,51 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/ITransientBuffer.cpp
+Methane transient buffer interface: persistently mapped ring buffer
+sub-allocated for per-frame dynamic data.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/ITransientBuffer.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+
+namespace Methane::Graphics::Rhi
+{
+
+ResourceView TransientBufferSlice::GetResourceView() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL_DESCR(buffer_ptr, "transient buffer slice is not initialized");
+    return ResourceView(*buffer_ptr, offset, size);
+}
+
+void TransientBufferSlice::SetData(Data::ConstRawPtr source_data_ptr, Data::Size source_data_size, Data::Size slice_offset) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL_DESCR(data_ptr, "transient buffer slice is not initialized");
+    META_CHECK_LESS_OR_EQUAL_DESCR(slice_offset + source_data_size, size, "data is out of transient buffer slice range");
+    std::copy(source_data_ptr, source_data_ptr + source_data_size, data_ptr + slice_offset);
+}
+
+} // namespace Methane::Graphics::Rhi
@@ -44,6 +44,10 @@ public:
 
     // IObject interface
     bool SetName(std::string_view name) override;
+
+    // Base::Buffer overrides
+    Data::RawPtr GetMappedDataPtr() override;
+    void         FlushMappedData(const BytesRange& data_range) override;
     
     const id<MTLBuffer>& GetNativeBuffer() const noexcept { return m_mtl_buffer; }
     MTLIndexType         GetNativeIndexType() const noexcept;
@@ -52,6 +52,12 @@ protected:
     // ParallelRenderCommandListBase interface
     [[nodiscard]] Ptr<Rhi::IRenderCommandList> CreateCommandList(bool is_beginning_list) override;
 
+    // Render command encoders of the parallel encoder are executed in order of their creation on reset
+    [[nodiscard]] bool IsParallelResetSupported() const noexcept override { return false; }
+
+    // All render command encoders of the parallel encoder must be ended before ending the parallel encoder
+    [[nodiscard]] bool IsIdleCommandListsSkipSupported() const noexcept override { return false; }
+
 private:
     RenderPass& GetMetalRenderPass();
     bool ResetCommandEncoder();
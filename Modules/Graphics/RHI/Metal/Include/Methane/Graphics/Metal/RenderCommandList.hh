@@ -52,10 +52,17 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void MultiDrawIndexed(Primitive primitive, std::span<const Rhi::DrawIndexedArguments> draw_arguments) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
 
 private:
     RenderPass& GetMetalRenderPass();
     void ResetCommandEncoder();
+    void EncodeDrawIndexed(MTLPrimitiveType mtl_primitive_type, const Buffer& metal_index_buffer,
+                           const Rhi::DrawIndexedArguments& draw_args);
 
     Data::Index GetStartVertexBufferIndex() const;
 
@@ -105,6 +105,25 @@ Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_
     return Rhi::SubResource(std::move(data), Rhi::SubResourceIndex(), data_range);
 }
 
+Data::RawPtr Buffer::GetMappedDataPtr()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_EQUAL(GetSettings().storage_mode, IBuffer::StorageMode::Managed);
+    META_CHECK_NOT_NULL(m_mtl_buffer);
+    return static_cast<Data::RawPtr>([m_mtl_buffer contents]);
+}
+
+void Buffer::FlushMappedData(const BytesRange& data_range)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL(m_mtl_buffer);
+#ifdef APPLE_MACOS // storage_mode == MTLStorageModeManaged
+    [m_mtl_buffer didModifyRange:NSMakeRange(data_range.GetStart(), data_range.GetLength())];
+#else
+    META_UNUSED(data_range);
+#endif
+}
+
 void Buffer::SetDataToManagedBuffer(const SubResource& sub_resource)
 {
     META_FUNCTION_TASK();
@@ -122,7 +141,7 @@ void Buffer::SetDataToManagedBuffer(const SubResource& sub_resource)
     std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), resource_data_ptr + data_offset);
 
 #ifdef APPLE_MACOS // storage_mode == MTLStorageModeManaged
-    [m_mtl_buffer didModifyRange:NSMakeRange(data_offset, data_offset + sub_resource.GetDataSize())];
+    [m_mtl_buffer didModifyRange:NSMakeRange(data_offset, sub_resource.GetDataSize())];
 #endif
 }
 
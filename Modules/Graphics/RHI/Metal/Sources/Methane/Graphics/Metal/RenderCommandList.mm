@@ -48,6 +48,11 @@ Ptr<Rhi::IRenderCommandList> Base::RenderCommandList::CreateForSynchronization(R
 namespace Methane::Graphics::Metal
 {
 
+static_assert(sizeof(Rhi::DrawArguments) == sizeof(MTLDrawPrimitivesIndirectArguments),
+              "draw arguments layout must match Metal indirect draw primitives arguments");
+static_assert(sizeof(Rhi::DrawIndexedArguments) == sizeof(MTLDrawIndexedPrimitivesIndirectArguments),
+              "draw indexed arguments layout must match Metal indirect draw indexed primitives arguments");
+
 static MTLPrimitiveType PrimitiveTypeToMetal(Rhi::RenderPrimitive primitive) noexcept
 {
     META_FUNCTION_TASK();
@@ -152,39 +157,67 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
 
     Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
 
-    const Buffer& metal_index_buffer = static_cast<const Buffer&>(*drawing_state.index_buffer_ptr);
+    EncodeDrawIndexed(PrimitiveTypeToMetal(primitive), static_cast<const Buffer&>(*drawing_state.index_buffer_ptr),
+                      Rhi::DrawIndexedArguments{ index_count, instance_count, start_index, start_vertex, start_instance });
+}
+
+void RenderCommandList::MultiDrawIndexed(Primitive primitive, std::span<const Rhi::DrawIndexedArguments> draw_arguments)
+{
+    META_FUNCTION_TASK();
+    PrepareMultiDrawIndexed(primitive, draw_arguments);
+
     const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
-    const MTLIndexType     mtl_index_type     = metal_index_buffer.GetNativeIndexType();
-    const id <MTLBuffer>&  mtl_index_buffer   = metal_index_buffer.GetNativeBuffer();
-    const uint32_t         mtl_index_stride   = mtl_index_type == MTLIndexTypeUInt32 ? 4 : 2;
+    const Buffer& metal_index_buffer = static_cast<const Buffer&>(*GetDrawingState().index_buffer_ptr);
+    for (Rhi::DrawIndexedArguments draw_args : draw_arguments)
+    {
+        draw_args.index_count = GetDrawIndexCount(draw_args.index_count);
+        EncodeDrawIndexed(mtl_primitive_type, metal_index_buffer, draw_args);
+    }
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
 
     const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
     META_CHECK_NOT_NULL(mtl_cmd_encoder);
 
-    if (m_device_supports_gpu_family_apple_3)
+    // Metal render command encoder does not support count buffer, so all draws are issued
+    // and unused draw arguments are expected to have zero instance count
+    const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
+    const id<MTLBuffer>&   mtl_arguments_buffer = static_cast<const Buffer&>(arguments_buffer).GetNativeBuffer();
+    for (uint32_t draw_index = 0U; draw_index < max_draw_count; ++draw_index)
     {
-        [mtl_cmd_encoder drawIndexedPrimitives:mtl_primitive_type
-                                    indexCount:index_count
-                                     indexType:mtl_index_type
-                                   indexBuffer:mtl_index_buffer
-                             indexBufferOffset:start_index * mtl_index_stride
-                                 instanceCount:instance_count
-                                    baseVertex:start_vertex
-                                  baseInstance:start_instance];
+        [mtl_cmd_encoder drawPrimitives:mtl_primitive_type
+                         indirectBuffer:mtl_arguments_buffer
+                   indirectBufferOffset:arguments_offset + draw_index * sizeof(MTLDrawPrimitivesIndirectArguments)];
     }
-    else
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_NOT_NULL(mtl_cmd_encoder);
+
+    // Metal render command encoder does not support count buffer, so all draws are issued
+    // and unused draw arguments are expected to have zero instance count
+    const MTLPrimitiveType mtl_primitive_type   = PrimitiveTypeToMetal(primitive);
+    const Buffer&          metal_index_buffer   = static_cast<const Buffer&>(*GetDrawingState().index_buffer_ptr);
+    const id<MTLBuffer>&   mtl_arguments_buffer = static_cast<const Buffer&>(arguments_buffer).GetNativeBuffer();
+    for (uint32_t draw_index = 0U; draw_index < max_draw_count; ++draw_index)
     {
         [mtl_cmd_encoder drawIndexedPrimitives:mtl_primitive_type
-                                    indexCount:index_count
-                                     indexType:mtl_index_type
-                                   indexBuffer:mtl_index_buffer
-                             indexBufferOffset:start_index * mtl_index_stride
-                                 instanceCount:instance_count];
-
-        if (start_vertex > 0U || start_instance > 0U)
-        {
-            NSLog(@"DrawIndexed 'start_vertex' and 'start_instance' arguments are not supported on iOS devices with GPU Family < Apple-3");
-        }
+                                     indexType:metal_index_buffer.GetNativeIndexType()
+                                   indexBuffer:metal_index_buffer.GetNativeBuffer()
+                             indexBufferOffset:0
+                                indirectBuffer:mtl_arguments_buffer
+                          indirectBufferOffset:arguments_offset + draw_index * sizeof(MTLDrawIndexedPrimitivesIndirectArguments)];
     }
 }
 
@@ -221,6 +254,44 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
     }
 }
 
+void RenderCommandList::EncodeDrawIndexed(MTLPrimitiveType mtl_primitive_type, const Buffer& metal_index_buffer,
+                                          const Rhi::DrawIndexedArguments& draw_args)
+{
+    META_FUNCTION_TASK();
+    const MTLIndexType     mtl_index_type     = metal_index_buffer.GetNativeIndexType();
+    const id <MTLBuffer>&  mtl_index_buffer   = metal_index_buffer.GetNativeBuffer();
+    const uint32_t         mtl_index_stride   = mtl_index_type == MTLIndexTypeUInt32 ? 4 : 2;
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_NOT_NULL(mtl_cmd_encoder);
+
+    if (m_device_supports_gpu_family_apple_3)
+    {
+        [mtl_cmd_encoder drawIndexedPrimitives:mtl_primitive_type
+                                    indexCount:draw_args.index_count
+                                     indexType:mtl_index_type
+                                   indexBuffer:mtl_index_buffer
+                             indexBufferOffset:draw_args.start_index * mtl_index_stride
+                                 instanceCount:draw_args.instance_count
+                                    baseVertex:draw_args.start_vertex
+                                  baseInstance:draw_args.start_instance];
+    }
+    else
+    {
+        [mtl_cmd_encoder drawIndexedPrimitives:mtl_primitive_type
+                                    indexCount:draw_args.index_count
+                                     indexType:mtl_index_type
+                                   indexBuffer:mtl_index_buffer
+                             indexBufferOffset:draw_args.start_index * mtl_index_stride
+                                 instanceCount:draw_args.instance_count];
+
+        if (draw_args.start_vertex > 0U || draw_args.start_instance > 0U)
+        {
+            NSLog(@"DrawIndexed 'start_vertex' and 'start_instance' arguments are not supported on iOS devices with GPU Family < Apple-3");
+        }
+    }
+}
+
 RenderPass& RenderCommandList::GetMetalRenderPass()
 {
     META_FUNCTION_TASK();
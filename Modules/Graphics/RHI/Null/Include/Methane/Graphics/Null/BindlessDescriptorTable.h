@@ -0,0 +1,42 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Null/BindlessDescriptorTable.h
+Null bindless descriptor table implementation.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Base/BindlessDescriptorTable.h>
+
+namespace Methane::Graphics::Null
+{
+
+class BindlessDescriptorTable final
+    : public Base::BindlessDescriptorTable
+{
+public:
+    using Base::BindlessDescriptorTable::BindlessDescriptorTable;
+
+protected:
+    // Base::BindlessDescriptorTable interface
+    void WriteDescriptor(Rhi::ResourceType, uint32_t, const Rhi::ResourceView&) override { /* no native descriptors to write */ }
+};
+
+} // namespace Methane::Graphics::Null
@@ -37,6 +37,12 @@ public:
     Buffer(const Base::Context& context, const Settings& settings);
 
     SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt&) override;
+
+    // Base::Buffer overrides
+    Data::RawPtr GetMappedDataPtr() override;
+
+private:
+    Data::Bytes m_mapped_data;
 };
 
 } // namespace Methane::Graphics::Null
@@ -23,7 +23,10 @@ Null base template implementation of the command list interface.
 
 #pragma once
 
+#include "CommandStream.h"
+
 #include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
 
 namespace Methane::Graphics::Null
 {
@@ -35,10 +38,42 @@ class CommandList
 public:
     using CommandListBaseT::CommandListBaseT;
 
-    void SetResourceBarriers(const Rhi::IResourceBarriers&) final
+    // ICommandList interface
+    void Reset(Rhi::ICommandListDebugGroup* debug_group_ptr = nullptr) override
+    {
+        CommandListBaseT::Reset(debug_group_ptr);
+        RecordCommand(CommandStream::ResetPacket{ debug_group_ptr });
+    }
+
+    void SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) override
+    {
+        CommandListBaseT::SetProgramBindings(program_bindings, apply_behavior);
+        RecordCommand(CommandStream::SetProgramBindingsPacket{ &program_bindings, apply_behavior.GetValue() });
+    }
+
+    void SetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) final
     {
         CommandListBaseT::VerifyEncodingState();
+        if (!resource_barriers.IsEmpty())
+            CommandListBaseT::GetCommandState().has_resource_barriers = true;
+        if (m_command_stream_ptr)
+            m_command_stream_ptr->RecordResourceBarriers(resource_barriers);
+    }
+
+    // Commands are recorded to the stream only when it is set, stream is not owned by command list
+    void           SetCommandStream(CommandStream* command_stream_ptr) noexcept { m_command_stream_ptr = command_stream_ptr; }
+    CommandStream* GetCommandStream() const noexcept                            { return m_command_stream_ptr; }
+
+protected:
+    template<typename PacketType>
+    void RecordCommand(const PacketType& packet)
+    {
+        if (m_command_stream_ptr)
+            m_command_stream_ptr->Record(packet);
     }
+
+private:
+    CommandStream* m_command_stream_ptr = nullptr;
 };
 
 } // namespace Methane::Graphics::Null
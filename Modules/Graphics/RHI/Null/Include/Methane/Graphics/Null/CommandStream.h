@@ -0,0 +1,285 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Null/CommandStream.h
+Null compact binary stream of the recorded commands with replay and dump functions.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IRenderCommandList.h>
+#include <Methane/Graphics/RHI/IComputeCommandList.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
+#include <Methane/Checks.hpp>
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IRenderState;
+struct IViewState;
+struct IComputeState;
+struct IProgramBindings;
+struct IBufferSet;
+struct IBuffer;
+
+} // namespace Methane::Graphics::Rhi
+
+namespace Methane::Graphics::Null
+{
+
+// Commands recorded by Null command lists are serialized to the linear byte buffer as POD packets,
+// which is reused between recordings, so that recording does not allocate memory after warm-up.
+// Recorded packets reference objects by raw pointers, which must be alive during replay and dump,
+// except resource barriers which are serialized by value, because they are often temporary.
+class CommandStream
+{
+public:
+    enum class CommandType : uint16_t
+    {
+        Reset,
+        SetRenderState,
+        SetViewState,
+        SetComputeState,
+        SetProgramBindings,
+        SetResourceBarriers,
+        ResourceBarrier,
+        SetVertexBuffers,
+        SetIndexBuffer,
+        Draw,
+        DrawIndexed,
+        DrawIndirect,
+        DrawIndexedIndirect,
+        Dispatch
+    };
+
+    struct ResetPacket
+    {
+        static constexpr CommandType type = CommandType::Reset;
+        Rhi::ICommandListDebugGroup* debug_group_ptr;
+    };
+
+    struct SetRenderStatePacket
+    {
+        static constexpr CommandType type = CommandType::SetRenderState;
+        Rhi::IRenderState* render_state_ptr;
+        uint32_t           state_groups_mask;
+    };
+
+    struct SetViewStatePacket
+    {
+        static constexpr CommandType type = CommandType::SetViewState;
+        Rhi::IViewState* view_state_ptr;
+    };
+
+    struct SetComputeStatePacket
+    {
+        static constexpr CommandType type = CommandType::SetComputeState;
+        Rhi::IComputeState* compute_state_ptr;
+    };
+
+    struct SetProgramBindingsPacket
+    {
+        static constexpr CommandType type = CommandType::SetProgramBindings;
+        Rhi::IProgramBindings* program_bindings_ptr;
+        uint32_t               apply_behavior_mask;
+    };
+
+    // Command packet is followed by the barriers_count of resource barrier packets
+    struct SetResourceBarriersPacket
+    {
+        static constexpr CommandType type = CommandType::SetResourceBarriers;
+        uint32_t barriers_count;
+    };
+
+    // Resource barrier packet is a part of the set resource barriers command and is not counted as a separate command
+    struct ResourceBarrierPacket
+    {
+        static constexpr CommandType type = CommandType::ResourceBarrier;
+        Rhi::IResource*          resource_ptr;
+        Rhi::ResourceBarrierType barrier_type;
+        Rhi::ResourceState       state_before;        // valid for state transition barrier only
+        Rhi::ResourceState       state_after;         // valid for state transition barrier only
+        uint32_t                 queue_family_before; // valid for owner transition barrier only
+        uint32_t                 queue_family_after;  // valid for owner transition barrier only
+    };
+
+    struct SetVertexBuffersPacket
+    {
+        static constexpr CommandType type = CommandType::SetVertexBuffers;
+        Rhi::IBufferSet* vertex_buffers_ptr;
+        bool             set_resource_barriers;
+    };
+
+    struct SetIndexBufferPacket
+    {
+        static constexpr CommandType type = CommandType::SetIndexBuffer;
+        Rhi::IBuffer* index_buffer_ptr;
+        bool          set_resource_barriers;
+    };
+
+    struct DrawPacket
+    {
+        static constexpr CommandType type = CommandType::Draw;
+        Rhi::RenderPrimitive primitive;
+        uint32_t             vertex_count;
+        uint32_t             start_vertex;
+        uint32_t             instance_count;
+        uint32_t             start_instance;
+    };
+
+    struct DrawIndexedPacket
+    {
+        static constexpr CommandType type = CommandType::DrawIndexed;
+        Rhi::RenderPrimitive primitive;
+        uint32_t             index_count;
+        uint32_t             start_index;
+        uint32_t             start_vertex;
+        uint32_t             instance_count;
+        uint32_t             start_instance;
+    };
+
+    struct DrawIndirectPacket
+    {
+        static constexpr CommandType type = CommandType::DrawIndirect;
+        Rhi::RenderPrimitive primitive;
+        Rhi::IBuffer*        arguments_buffer_ptr;
+        Data::Size           arguments_offset;
+        uint32_t             max_draw_count;
+        Rhi::IBuffer*        count_buffer_ptr;
+        Data::Size           count_offset;
+    };
+
+    struct DrawIndexedIndirectPacket
+    {
+        static constexpr CommandType type = CommandType::DrawIndexedIndirect;
+        Rhi::RenderPrimitive primitive;
+        Rhi::IBuffer*        arguments_buffer_ptr;
+        Data::Size           arguments_offset;
+        uint32_t             max_draw_count;
+        Rhi::IBuffer*        count_buffer_ptr;
+        Data::Size           count_offset;
+    };
+
+    struct DispatchPacket
+    {
+        static constexpr CommandType type = CommandType::Dispatch;
+        uint32_t thread_groups_x;
+        uint32_t thread_groups_y;
+        uint32_t thread_groups_z;
+    };
+
+    CommandStream() = default;
+    explicit CommandStream(size_t reserved_size) { m_data.reserve(reserved_size); }
+
+    [[nodiscard]] bool   IsEmpty() const noexcept          { return m_data.empty(); }
+    [[nodiscard]] size_t GetCommandsCount() const noexcept { return m_commands_count; }
+    [[nodiscard]] size_t GetDataSize() const noexcept      { return m_data.size(); }
+    [[nodiscard]] const std::vector<std::byte>& GetData() const noexcept { return m_data; }
+
+    // Clear keeps allocated memory to let next recording run without memory allocations
+    void Clear() noexcept { m_data.clear(); m_commands_count = 0U; }
+
+    template<typename PacketType>
+    void Record(const PacketType& packet)
+    {
+        WritePacket(packet);
+        m_commands_count++;
+    }
+
+    // Resource barriers are serialized by value, so that the barriers object does not have to be alive during replay
+    void RecordResourceBarriers(const Rhi::IResourceBarriers& resource_barriers);
+
+    // Visitor is called for every recorded packet in order of recording with the packet structure argument
+    template<typename VisitorType>
+    void Visit(VisitorType&& visitor) const
+    {
+        size_t packet_offset = 0U;
+        while(packet_offset < m_data.size())
+        {
+            PacketHeader packet_header{};
+            std::memcpy(&packet_header, m_data.data() + packet_offset, sizeof(PacketHeader));
+            const std::byte* packet_data = m_data.data() + packet_offset + sizeof(PacketHeader);
+
+            switch(packet_header.type)
+            {
+            case CommandType::Reset:               visitor(ReadPacket<ResetPacket>(packet_data)); break;
+            case CommandType::SetRenderState:      visitor(ReadPacket<SetRenderStatePacket>(packet_data)); break;
+            case CommandType::SetViewState:        visitor(ReadPacket<SetViewStatePacket>(packet_data)); break;
+            case CommandType::SetComputeState:     visitor(ReadPacket<SetComputeStatePacket>(packet_data)); break;
+            case CommandType::SetProgramBindings:  visitor(ReadPacket<SetProgramBindingsPacket>(packet_data)); break;
+            case CommandType::SetResourceBarriers: visitor(ReadPacket<SetResourceBarriersPacket>(packet_data)); break;
+            case CommandType::ResourceBarrier:     visitor(ReadPacket<ResourceBarrierPacket>(packet_data)); break;
+            case CommandType::SetVertexBuffers:    visitor(ReadPacket<SetVertexBuffersPacket>(packet_data)); break;
+            case CommandType::SetIndexBuffer:      visitor(ReadPacket<SetIndexBufferPacket>(packet_data)); break;
+            case CommandType::Draw:                visitor(ReadPacket<DrawPacket>(packet_data)); break;
+            case CommandType::DrawIndexed:         visitor(ReadPacket<DrawIndexedPacket>(packet_data)); break;
+            case CommandType::DrawIndirect:        visitor(ReadPacket<DrawIndirectPacket>(packet_data)); break;
+            case CommandType::DrawIndexedIndirect: visitor(ReadPacket<DrawIndexedIndirectPacket>(packet_data)); break;
+            case CommandType::Dispatch:            visitor(ReadPacket<DispatchPacket>(packet_data)); break;
+            default:                               META_UNEXPECTED(packet_header.type);
+            }
+            packet_offset += sizeof(PacketHeader) + packet_header.size;
+        }
+    }
+
+    // Replay recorded commands to the command list of any graphics backend
+    void Replay(Rhi::ICommandList& command_list) const;
+
+    // Dump recorded commands to text with one command per line, objects are identified by names
+    // or by ordinal numbers in order of the first usage, so that dumps can be compared between runs
+    [[nodiscard]] explicit operator std::string() const;
+
+private:
+    // Packets are not aligned in the stream to keep it compact, so they are copied on reading
+    struct PacketHeader
+    {
+        CommandType type;
+        uint16_t    size;
+    };
+
+    template<typename PacketType>
+    void WritePacket(const PacketType& packet)
+    {
+        static_assert(std::is_trivially_copyable_v<PacketType>, "command packet type must be trivially copyable");
+        const PacketHeader packet_header{ PacketType::type, static_cast<uint16_t>(sizeof(PacketType)) };
+        const size_t packet_offset = m_data.size();
+        m_data.resize(packet_offset + sizeof(PacketHeader) + packet_header.size);
+        std::memcpy(m_data.data() + packet_offset, &packet_header, sizeof(PacketHeader));
+        std::memcpy(m_data.data() + packet_offset + sizeof(PacketHeader), &packet, sizeof(PacketType));
+    }
+
+    template<typename PacketType>
+    [[nodiscard]] static PacketType ReadPacket(const std::byte* packet_data) noexcept
+    {
+        PacketType packet{};
+        std::memcpy(&packet, packet_data, sizeof(PacketType));
+        return packet;
+    }
+
+    std::vector<std::byte> m_data;
+    size_t                 m_commands_count = 0U;
+};
+
+} // namespace Methane::Graphics::Null
@@ -38,6 +38,7 @@ class ComputeCommandList final // NOSONAR - inheritance hierarchy depth is highe
 public:
     explicit ComputeCommandList(CommandQueue& command_queue);
 
+    void SetComputeState(Rhi::IComputeState& compute_state) override;
     void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
 
 private:
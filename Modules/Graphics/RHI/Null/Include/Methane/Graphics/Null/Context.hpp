@@ -30,6 +30,7 @@ Null template implementation of the base context interface.
 #include "Buffer.h"
 #include "Texture.h"
 #include "Sampler.h"
+#include "BindlessDescriptorTable.h"
 
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/Base/Context.h>
@@ -84,6 +85,14 @@ public:
     {
         return std::make_shared<Sampler>(*this, settings);
     }
+
+protected:
+    // Base::Context overrides
+
+    [[nodiscard]] Ptr<Base::BindlessDescriptorTable> CreateBindlessDescriptorTable(const Base::BindlessDescriptorTableSettings& settings) const override
+    {
+        return std::make_shared<BindlessDescriptorTable>(settings);
+    }
 };
 
 } // namespace Methane::Graphics::Null
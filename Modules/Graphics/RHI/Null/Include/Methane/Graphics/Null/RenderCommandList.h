@@ -46,12 +46,18 @@ public:
     // IRenderCommandList interface
     void Reset(IDebugGroup* debug_group_ptr = nullptr) override;
     void ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) override;
+    void SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups = Rhi::RenderStateGroupMask(~0U)) override;
+    void SetViewState(Rhi::IViewState& view_state) override;
     bool SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers) override;
     bool SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers) override;
     void DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
 
     using Base::RenderCommandList::GetDrawingState;
     using Base::CommandList::GetCommandState;
@@ -38,4 +38,13 @@ Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt&)
     return {};
 }
 
+Data::RawPtr Buffer::GetMappedDataPtr()
+{
+    if (m_mapped_data.empty())
+    {
+        m_mapped_data.resize(GetSettings().size);
+    }
+    return m_mapped_data.data();
+}
+
 } // namespace Methane::Graphics::Null
@@ -0,0 +1,367 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Null/CommandStream.cpp
+Null compact binary stream of the recorded commands with replay and dump functions.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Null/CommandStream.h>
+
+#include <Methane/Graphics/RHI/ICommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/IRenderState.h>
+#include <Methane/Graphics/RHI/IComputeState.h>
+#include <Methane/Graphics/RHI/IProgramBindings.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
+#include <Methane/Graphics/RHI/IBufferSet.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Instrumentation.h>
+
+#include <magic_enum/magic_enum.hpp>
+#include <fmt/format.h>
+
+#include <map>
+
+namespace Methane::Graphics::Null
+{
+
+class CommandStreamReplayer
+{
+public:
+    explicit CommandStreamReplayer(Rhi::ICommandList& command_list)
+        : m_command_list(command_list)
+        , m_render_command_list_ptr(dynamic_cast<Rhi::IRenderCommandList*>(&command_list))
+        , m_compute_command_list_ptr(dynamic_cast<Rhi::IComputeCommandList*>(&command_list))
+    { }
+
+    void operator()(const CommandStream::ResetPacket& packet) const
+    {
+        m_command_list.Reset(packet.debug_group_ptr);
+    }
+
+    void operator()(const CommandStream::SetRenderStatePacket& packet) const
+    {
+        GetRenderCommandList().SetRenderState(*packet.render_state_ptr, Rhi::RenderStateGroupMask(packet.state_groups_mask));
+    }
+
+    void operator()(const CommandStream::SetViewStatePacket& packet) const
+    {
+        GetRenderCommandList().SetViewState(*packet.view_state_ptr);
+    }
+
+    void operator()(const CommandStream::SetComputeStatePacket& packet) const
+    {
+        GetComputeCommandList().SetComputeState(*packet.compute_state_ptr);
+    }
+
+    void operator()(const CommandStream::SetProgramBindingsPacket& packet) const
+    {
+        m_command_list.SetProgramBindings(*packet.program_bindings_ptr, Rhi::ProgramBindingsApplyBehaviorMask(packet.apply_behavior_mask));
+    }
+
+    // Resource barriers are collected from the barrier packets following the command packet
+    // and set to command list when all barriers are read
+    void operator()(const CommandStream::SetResourceBarriersPacket& packet)
+    {
+        META_CHECK_EQUAL_DESCR(m_pending_barriers_count, 0U, "previous resource barriers command was not completed");
+        m_resource_barriers_ptr  = Rhi::IResourceBarriers::Create();
+        m_pending_barriers_count = packet.barriers_count;
+        if (!m_pending_barriers_count)
+            SetResourceBarriers();
+    }
+
+    void operator()(const CommandStream::ResourceBarrierPacket& packet)
+    {
+        META_CHECK_NOT_ZERO_DESCR(m_pending_barriers_count, "resource barrier packet is not expected outside of resource barriers command");
+        META_CHECK_NOT_NULL(packet.resource_ptr);
+        switch(packet.barrier_type)
+        {
+        case Rhi::ResourceBarrierType::StateTransition:
+            m_resource_barriers_ptr->AddStateTransition(*packet.resource_ptr, packet.state_before, packet.state_after);
+            break;
+        case Rhi::ResourceBarrierType::OwnerTransition:
+            m_resource_barriers_ptr->AddOwnerTransition(*packet.resource_ptr, packet.queue_family_before, packet.queue_family_after);
+            break;
+        default:
+            META_UNEXPECTED(packet.barrier_type);
+        }
+        if (!--m_pending_barriers_count)
+            SetResourceBarriers();
+    }
+
+    void operator()(const CommandStream::SetVertexBuffersPacket& packet) const
+    {
+        GetRenderCommandList().SetVertexBuffers(*packet.vertex_buffers_ptr, packet.set_resource_barriers);
+    }
+
+    void operator()(const CommandStream::SetIndexBufferPacket& packet) const
+    {
+        GetRenderCommandList().SetIndexBuffer(*packet.index_buffer_ptr, packet.set_resource_barriers);
+    }
+
+    void operator()(const CommandStream::DrawPacket& packet) const
+    {
+        GetRenderCommandList().Draw(packet.primitive, packet.vertex_count, packet.start_vertex,
+                                    packet.instance_count, packet.start_instance);
+    }
+
+    void operator()(const CommandStream::DrawIndexedPacket& packet) const
+    {
+        GetRenderCommandList().DrawIndexed(packet.primitive, packet.index_count, packet.start_index, packet.start_vertex,
+                                           packet.instance_count, packet.start_instance);
+    }
+
+    void operator()(const CommandStream::DrawIndirectPacket& packet) const
+    {
+        GetRenderCommandList().DrawIndirect(packet.primitive, *packet.arguments_buffer_ptr, packet.arguments_offset,
+                                            packet.max_draw_count, packet.count_buffer_ptr, packet.count_offset);
+    }
+
+    void operator()(const CommandStream::DrawIndexedIndirectPacket& packet) const
+    {
+        GetRenderCommandList().DrawIndexedIndirect(packet.primitive, *packet.arguments_buffer_ptr, packet.arguments_offset,
+                                                   packet.max_draw_count, packet.count_buffer_ptr, packet.count_offset);
+    }
+
+    void operator()(const CommandStream::DispatchPacket& packet) const
+    {
+        GetComputeCommandList().Dispatch(Rhi::ThreadGroupsCount(packet.thread_groups_x, packet.thread_groups_y, packet.thread_groups_z));
+    }
+
+private:
+    void SetResourceBarriers()
+    {
+        m_command_list.SetResourceBarriers(*m_resource_barriers_ptr);
+        m_resource_barriers_ptr.reset();
+    }
+
+    Rhi::IRenderCommandList& GetRenderCommandList() const
+    {
+        META_CHECK_NOT_NULL_DESCR(m_render_command_list_ptr, "render command can not be replayed to command list '{}' of non-render type",
+                                  m_command_list.GetName());
+        return *m_render_command_list_ptr;
+    }
+
+    Rhi::IComputeCommandList& GetComputeCommandList() const
+    {
+        META_CHECK_NOT_NULL_DESCR(m_compute_command_list_ptr, "compute command can not be replayed to command list '{}' of non-compute type",
+                                  m_command_list.GetName());
+        return *m_compute_command_list_ptr;
+    }
+
+    Rhi::ICommandList&          m_command_list;
+    Rhi::IRenderCommandList*    m_render_command_list_ptr;
+    Rhi::IComputeCommandList*   m_compute_command_list_ptr;
+    Ptr<Rhi::IResourceBarriers> m_resource_barriers_ptr;
+    uint32_t                    m_pending_barriers_count = 0U;
+};
+
+class CommandStreamDumper
+{
+public:
+    void operator()(const CommandStream::ResetPacket& packet)
+    {
+        AddLine("Reset", packet.debug_group_ptr ? fmt::format("debug group {}", GetObjectLabel(packet.debug_group_ptr)) : "");
+    }
+
+    void operator()(const CommandStream::SetRenderStatePacket& packet)
+    {
+        AddLine("SetRenderState", fmt::format("{} with groups mask {:#x}",
+                                              GetObjectLabel(packet.render_state_ptr), packet.state_groups_mask));
+    }
+
+    void operator()(const CommandStream::SetViewStatePacket& packet)
+    {
+        AddLine("SetViewState", GetOrdinalLabel(packet.view_state_ptr));
+    }
+
+    void operator()(const CommandStream::SetComputeStatePacket& packet)
+    {
+        AddLine("SetComputeState", GetObjectLabel(packet.compute_state_ptr));
+    }
+
+    void operator()(const CommandStream::SetProgramBindingsPacket& packet)
+    {
+        AddLine("SetProgramBindings", fmt::format("{} with apply behavior mask {:#x}",
+                                                  GetObjectLabel(packet.program_bindings_ptr), packet.apply_behavior_mask));
+    }
+
+    void operator()(const CommandStream::SetResourceBarriersPacket& packet)
+    {
+        AddLine("SetResourceBarriers", fmt::format("{} barriers", packet.barriers_count));
+    }
+
+    void operator()(const CommandStream::ResourceBarrierPacket& packet)
+    {
+        switch(packet.barrier_type)
+        {
+        case Rhi::ResourceBarrierType::StateTransition:
+            AddPayloadLine(fmt::format("{} state transition of {} from {} to {}",
+                                       GetResourceTypeName(packet.resource_ptr), GetObjectLabel(packet.resource_ptr),
+                                       magic_enum::enum_name(packet.state_before), magic_enum::enum_name(packet.state_after)));
+            break;
+        case Rhi::ResourceBarrierType::OwnerTransition:
+            AddPayloadLine(fmt::format("{} owner transition of {} from queue family {} to {}",
+                                       GetResourceTypeName(packet.resource_ptr), GetObjectLabel(packet.resource_ptr),
+                                       packet.queue_family_before, packet.queue_family_after));
+            break;
+        default:
+            META_UNEXPECTED(packet.barrier_type);
+        }
+    }
+
+    void operator()(const CommandStream::SetVertexBuffersPacket& packet)
+    {
+        AddLine("SetVertexBuffers", fmt::format("{}{}", GetObjectLabel(packet.vertex_buffers_ptr),
+                                                packet.set_resource_barriers ? " with barriers" : ""));
+    }
+
+    void operator()(const CommandStream::SetIndexBufferPacket& packet)
+    {
+        AddLine("SetIndexBuffer", fmt::format("{}{}", GetObjectLabel(packet.index_buffer_ptr),
+                                              packet.set_resource_barriers ? " with barriers" : ""));
+    }
+
+    void operator()(const CommandStream::DrawPacket& packet)
+    {
+        AddLine("Draw", fmt::format("{} {} vertices from {} with {} instances from {}",
+                                    magic_enum::enum_name(packet.primitive), packet.vertex_count, packet.start_vertex,
+                                    packet.instance_count, packet.start_instance));
+    }
+
+    void operator()(const CommandStream::DrawIndexedPacket& packet)
+    {
+        AddLine("DrawIndexed", fmt::format("{} {} indices from {} and vertex {} with {} instances from {}",
+                                           magic_enum::enum_name(packet.primitive), packet.index_count, packet.start_index,
+                                           packet.start_vertex, packet.instance_count, packet.start_instance));
+    }
+
+    void operator()(const CommandStream::DrawIndirectPacket& packet)
+    {
+        AddLine("DrawIndirect", GetDrawIndirectArgs(packet));
+    }
+
+    void operator()(const CommandStream::DrawIndexedIndirectPacket& packet)
+    {
+        AddLine("DrawIndexedIndirect", GetDrawIndirectArgs(packet));
+    }
+
+    void operator()(const CommandStream::DispatchPacket& packet)
+    {
+        AddLine("Dispatch", fmt::format("{}x{}x{} thread groups",
+                                        packet.thread_groups_x, packet.thread_groups_y, packet.thread_groups_z));
+    }
+
+    [[nodiscard]] const std::string& GetDump() const noexcept { return m_dump; }
+
+private:
+    void AddLine(std::string_view command_name, std::string_view command_args)
+    {
+        m_dump += fmt::format("{:>6}: {}{}{}\n", m_commands_count++, command_name, command_args.empty() ? "" : " ", command_args);
+    }
+
+    // Payload lines are printed under the command line without command number
+    void AddPayloadLine(std::string_view payload)
+    {
+        m_dump += fmt::format("{:>8}- {}\n", "", payload);
+    }
+
+    static std::string_view GetResourceTypeName(const Rhi::IResource* resource_ptr)
+    {
+        return resource_ptr ? magic_enum::enum_name(resource_ptr->GetResourceType()) : std::string_view("Unknown");
+    }
+
+    template<typename DrawIndirectPacketType>
+    std::string GetDrawIndirectArgs(const DrawIndirectPacketType& packet)
+    {
+        return fmt::format("{} up to {} draws from {} at {}{}",
+                           magic_enum::enum_name(packet.primitive), packet.max_draw_count,
+                           GetObjectLabel(packet.arguments_buffer_ptr), packet.arguments_offset,
+                           packet.count_buffer_ptr ? fmt::format(" with count from {} at {}", GetObjectLabel(packet.count_buffer_ptr), packet.count_offset) : "");
+    }
+
+    std::string GetOrdinalLabel(const void* object_ptr)
+    {
+        const auto [ordinal_it, ordinal_added] = m_ordinal_by_object_ptr.try_emplace(object_ptr, static_cast<uint32_t>(m_ordinal_by_object_ptr.size()));
+        return fmt::format("#{}", ordinal_it->second);
+    }
+
+    std::string GetObjectLabel(const Rhi::IObject* object_ptr)
+    {
+        if (!object_ptr)
+            return "null";
+
+        const std::string_view object_name = object_ptr->GetName();
+        return object_name.empty() ? GetOrdinalLabel(object_ptr) : fmt::format("'{}'", object_name);
+    }
+
+    std::string GetObjectLabel(const Rhi::IBufferSet* buffer_set_ptr)
+    {
+        if (!buffer_set_ptr)
+            return "null";
+
+        return buffer_set_ptr->GetName().empty() ? buffer_set_ptr->GetNames() : fmt::format("'{}'", buffer_set_ptr->GetName());
+    }
+
+    std::map<const void*, uint32_t> m_ordinal_by_object_ptr;
+    size_t                          m_commands_count = 0U;
+    std::string                     m_dump;
+};
+
+void CommandStream::RecordResourceBarriers(const Rhi::IResourceBarriers& resource_barriers)
+{
+    META_FUNCTION_TASK();
+    const Rhi::IResourceBarriers::Map& barriers = resource_barriers.GetMap();
+    Record(SetResourceBarriersPacket{ static_cast<uint32_t>(barriers.size()) });
+
+    for(const auto& [barrier_id, barrier] : barriers)
+    {
+        ResourceBarrierPacket barrier_packet{ &barrier_id.GetResource(), barrier_id.GetType(),
+                                              Rhi::ResourceState::Undefined, Rhi::ResourceState::Undefined, 0U, 0U };
+        switch(barrier_id.GetType())
+        {
+        case Rhi::ResourceBarrierType::StateTransition:
+            barrier_packet.state_before = barrier.GetStateChange().GetStateBefore();
+            barrier_packet.state_after  = barrier.GetStateChange().GetStateAfter();
+            break;
+        case Rhi::ResourceBarrierType::OwnerTransition:
+            barrier_packet.queue_family_before = barrier.GetOwnerChange().GetQueueFamilyBefore();
+            barrier_packet.queue_family_after  = barrier.GetOwnerChange().GetQueueFamilyAfter();
+            break;
+        default:
+            META_UNEXPECTED(barrier_id.GetType());
+        }
+        WritePacket(barrier_packet);
+    }
+}
+
+void CommandStream::Replay(Rhi::ICommandList& command_list) const
+{
+    META_FUNCTION_TASK();
+    Visit(CommandStreamReplayer(command_list));
+}
+
+CommandStream::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    CommandStreamDumper dumper;
+    Visit(dumper);
+    return dumper.GetDump();
+}
+
+} // namespace Methane::Graphics::Null
@@ -32,10 +32,19 @@ ComputeCommandList::ComputeCommandList(CommandQueue& command_queue)
     : CommandList(command_queue)
 { }
 
+void ComputeCommandList::SetComputeState(Rhi::IComputeState& compute_state)
+{
+    Base::ComputeCommandList::SetComputeState(compute_state);
+    RecordCommand(CommandStream::SetComputeStatePacket{ &compute_state });
+}
+
 void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count)
 {
     m_dispatched_thread_groups_count = thread_groups_count;
     Base::ComputeCommandList::Dispatch(thread_groups_count);
+    RecordCommand(CommandStream::DispatchPacket{
+        thread_groups_count.GetWidth(), thread_groups_count.GetHeight(), thread_groups_count.GetDepth()
+    });
 }
 
 } // namespace Methane::Graphics::Null
@@ -67,31 +67,45 @@ void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGr
     META_FUNCTION_TASK();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
-    CommandList::SetRenderState(render_state);
+    RenderCommandList::SetRenderState(render_state);
 }
 
-bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
+void RenderCommandList::SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups)
 {
     META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetVertexBuffers(vertex_buffers, set_resource_barriers))
-        return false;
+    CommandList::SetRenderState(render_state, state_groups);
+    RecordCommand(CommandStream::SetRenderStatePacket{ &render_state, state_groups.GetValue() });
+}
 
-    return true;
+void RenderCommandList::SetViewState(Rhi::IViewState& view_state)
+{
+    META_FUNCTION_TASK();
+    CommandList::SetViewState(view_state);
+    RecordCommand(CommandStream::SetViewStatePacket{ &view_state });
 }
 
-bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers)
+bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
 {
     META_FUNCTION_TASK();
-    if (!Base::RenderCommandList::SetIndexBuffer(index_buffer, set_resource_barriers))
-        return false;
+    const bool vertex_buffers_changed = Base::RenderCommandList::SetVertexBuffers(vertex_buffers, set_resource_barriers);
+    RecordCommand(CommandStream::SetVertexBuffersPacket{ &vertex_buffers, set_resource_barriers });
+    return vertex_buffers_changed;
+}
 
-    return true;
+bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers)
+{
+    META_FUNCTION_TASK();
+    const bool index_buffer_changed = Base::RenderCommandList::SetIndexBuffer(index_buffer, set_resource_barriers);
+    RecordCommand(CommandStream::SetIndexBufferPacket{ &index_buffer, set_resource_barriers });
+    return index_buffer_changed;
 }
 
 void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
                                     uint32_t instance_count, uint32_t start_instance)
 {
     META_FUNCTION_TASK();
+    // Draw command is recorded with original arguments to let replay target resolve the default index count itself
+    const CommandStream::DrawIndexedPacket draw_indexed_packet{ primitive, index_count, start_index, start_vertex, instance_count, start_instance };
     if (const DrawingState& drawing_state = GetDrawingState();
         index_count == 0 && drawing_state.index_buffer_ptr)
     {
@@ -99,6 +113,7 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
     }
 
     Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    RecordCommand(draw_indexed_packet);
 }
 
 void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
@@ -106,6 +121,23 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
 {
     META_FUNCTION_TASK();
     Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    RecordCommand(CommandStream::DrawPacket{ primitive, vertex_count, start_vertex, instance_count, start_instance });
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+    RecordCommand(CommandStream::DrawIndirectPacket{ primitive, &arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset });
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+    RecordCommand(CommandStream::DrawIndexedIndirectPacket{ primitive, &arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset });
 }
 
 } // namespace Methane::Graphics::Null
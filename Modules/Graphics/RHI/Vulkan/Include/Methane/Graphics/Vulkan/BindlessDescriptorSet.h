@@ -0,0 +1,59 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/BindlessDescriptorSet.h
+Vulkan descriptor set with global bindless arrays of buffers, textures and samplers,
+which is updated after bind and shared by all programs of the context.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Base/BindlessDescriptorTable.h>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class Device;
+
+class BindlessDescriptorSet final
+    : public Base::BindlessDescriptorTable
+{
+public:
+    [[nodiscard]] static uint32_t           GetBinding(Rhi::ResourceType resource_type);
+    [[nodiscard]] static vk::DescriptorType GetDescriptorType(Rhi::ResourceType resource_type);
+
+    BindlessDescriptorSet(const Device& device, const Settings& settings = {});
+
+    [[nodiscard]] const vk::DescriptorSetLayout& GetNativeDescriptorSetLayout() const noexcept { return m_vk_unique_descriptor_set_layout.get(); }
+    [[nodiscard]] const vk::DescriptorSet&       GetNativeDescriptorSet() const noexcept       { return m_vk_descriptor_set; }
+
+protected:
+    // Base::BindlessDescriptorTable interface
+    void WriteDescriptor(Rhi::ResourceType resource_type, uint32_t index, const Rhi::ResourceView& resource_view) override;
+
+private:
+    const Device&                 m_device;
+    vk::UniqueDescriptorSetLayout m_vk_unique_descriptor_set_layout;
+    vk::UniqueDescriptorPool      m_vk_unique_descriptor_pool;
+    vk::DescriptorSet             m_vk_descriptor_set; // released with descriptor pool
+};
+
+} // namespace Methane::Graphics::Vulkan
@@ -46,6 +46,9 @@ public:
     // IObject interface
     bool SetName(std::string_view name) override;
 
+    // Base::Buffer overrides
+    Data::RawPtr GetMappedDataPtr() override;
+
 protected:
     // Resource override
     Ptr<ResourceView::ViewDescriptorVariant> CreateNativeViewDescriptor(const View::Id& view_id) override;
@@ -54,9 +57,9 @@ private:
     Data::Bytes GetDataFromSharedBuffer(const BytesRange& data_range) const;
     Data::Bytes GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue);
 
-    vk::UniqueBuffer       m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory m_vk_unique_staging_memory;
-    vk::BufferCopy         m_vk_copy_region;
+    vk::UniqueBuffer m_vk_unique_staging_buffer;
+    MemoryAllocation m_staging_memory; // sub-allocated from host-visible memory blocks shared by all staging buffers
+    vk::BufferCopy   m_vk_copy_region;
 };
 
 } // namespace Methane::Graphics::Vulkan
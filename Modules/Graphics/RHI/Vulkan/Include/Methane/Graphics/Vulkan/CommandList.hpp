@@ -175,10 +175,16 @@ public:
         META_FUNCTION_TASK();
         CommandListBaseT::VerifyEncodingState();
 
+        // Lock-free emptiness check skips locking of barriers for resources which are already in required states
+        if (resource_barriers.IsEmpty())
+            return;
+
         const auto lock_guard = static_cast<const Base::ResourceBarriers&>(resource_barriers).Lock();
         if (resource_barriers.IsEmpty())
             return;
 
+        CommandListBaseT::GetCommandState().has_resource_barriers = true;
+
         META_LOG("{} Command list '{}' SET RESOURCE BARRIERS:\n{}",
             magic_enum::enum_name(Base::CommandList::GetType()),
             Base::CommandList::GetName(),
@@ -320,6 +326,8 @@ protected:
         );
     }
 
+    // Every command list owns its command pool, so that thread command lists of the parallel render command list
+    // can be reset and encoded in parallel without external synchronization of the pool
     vk::UniqueCommandPool CreateVulkanCommandPool(uint32_t queue_family_index)
     {
         META_FUNCTION_TASK();
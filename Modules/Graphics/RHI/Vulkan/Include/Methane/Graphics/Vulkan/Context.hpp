@@ -33,6 +33,8 @@ Vulkan template implementation of the base context interface.
 #include "Texture.h"
 #include "Sampler.h"
 #include "DescriptorManager.h"
+#include "BindlessDescriptorSet.h"
+#include "PipelineCache.h"
 
 #include <Methane/Graphics/RHI/IRenderContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
@@ -52,7 +54,35 @@ class Context
 public:
     Context(Base::Device& device, tf::Executor& parallel_executor, const typename ContextBaseT::Settings& settings)
         : ContextBaseT(device, std::make_unique<DescriptorManager>(*this), parallel_executor, settings)
-    { }
+        , m_pipeline_cache_ptr(std::make_unique<PipelineCache>(static_cast<const Device&>(device)))
+    {
+        META_FUNCTION_TASK();
+        UpdateDescriptorSetsRetireFramesCount();
+    }
+
+    ~Context() override
+    {
+        META_FUNCTION_TASK();
+        try
+        {
+            SavePipelineCache();
+        }
+        catch(const std::exception& e)
+        {
+            META_UNUSED(e);
+            META_LOG("WARNING: Unexpected error during pipeline cache saving: {}", e.what());
+        }
+    }
+
+    void Initialize(Base::Device& device, bool is_callback_emitted) override
+    {
+        META_FUNCTION_TASK();
+        // Pipeline cache is created with context and has to be recreated only after release on context reset
+        if (!m_pipeline_cache_ptr)
+            m_pipeline_cache_ptr = std::make_unique<PipelineCache>(static_cast<const Device&>(device));
+
+        ContextBaseT::Initialize(device, is_callback_emitted);
+    }
 
     void Release() override
     {
@@ -62,9 +92,18 @@ public:
         // to release all descriptor sets using live device instance
         ContextBaseT::GetDescriptorManager().Release();
 
+        // Pipeline cache is saved to file on every context release to be reused by the next application run
+        SavePipelineCache();
+
         ContextBaseT::Release();
     }
 
+    [[nodiscard]] Rhi::PipelineCacheStatistics GetPipelineCacheStatistics() const noexcept final
+    {
+        META_FUNCTION_TASK();
+        return m_pipeline_cache_ptr ? m_pipeline_cache_ptr->GetStatistics() : Rhi::PipelineCacheStatistics{};
+    }
+
     // IContext overrides
 
     [[nodiscard]] Ptr<Rhi::ICommandQueue> CreateCommandQueue(Rhi::CommandListType type) const final
@@ -125,6 +164,69 @@ public:
     {
         return static_cast<DescriptorManager&>(ContextBaseT::GetDescriptorManager());
     }
+
+    PipelineCache& GetVulkanPipelineCache() const final
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_NULL_DESCR(m_pipeline_cache_ptr, "pipeline cache is not available for released context");
+        return *m_pipeline_cache_ptr;
+    }
+
+    Ptr<BindlessDescriptorSet> GetVulkanBindlessDescriptorSetPtr() const final
+    {
+        META_FUNCTION_TASK();
+        return std::static_pointer_cast<BindlessDescriptorSet>(ContextBaseT::GetBindlessDescriptorTablePtr());
+    }
+
+protected:
+    // Released descriptor sets are not reused until all frames in flight, which may access them, are completed,
+    // so retire frames count has to be updated on every change of the frame buffers count
+    void UpdateDescriptorSetsRetireFramesCount()
+    {
+        META_FUNCTION_TASK();
+        if constexpr (requires(const ContextBaseT& context) { context.GetSettings().frame_buffers_count; })
+        {
+            GetVulkanDescriptorManager().SetRetireFramesCount(
+                Base::FrameRetireCounter::GetRetireFramesCountOf(ContextBaseT::GetSettings().frame_buffers_count));
+        }
+    }
+
+    // Base::Context overrides
+
+    [[nodiscard]] Ptr<Base::BindlessDescriptorTable> CreateBindlessDescriptorTable(const Base::BindlessDescriptorTableSettings& settings) const override
+    {
+        META_FUNCTION_TASK();
+        const Device& device = GetVulkanDevice();
+        if (!device.IsDescriptorIndexingSupported())
+            return nullptr;
+
+        return std::make_shared<BindlessDescriptorSet>(device, settings);
+    }
+
+    void OnGpuWaitComplete(Rhi::ContextWaitFor wait_for) override
+    {
+        META_FUNCTION_TASK();
+        // Descriptor sets are recycled before the base handler, which may perform requested context reset
+        if (wait_for == Rhi::ContextWaitFor::FramePresented)
+            GetVulkanDescriptorManager().CompleteFrame();
+        else if (wait_for != Rhi::ContextWaitFor::ResourcesUploaded)
+            GetVulkanDescriptorManager().CompleteAllFrames();
+
+        ContextBaseT::OnGpuWaitComplete(wait_for);
+    }
+
+private:
+    void SavePipelineCache()
+    {
+        META_FUNCTION_TASK();
+        if (!m_pipeline_cache_ptr)
+            return;
+
+        m_pipeline_cache_ptr->Save();
+        m_pipeline_cache_ptr.reset();
+    }
+
+    UniquePtr<PipelineCache> m_pipeline_cache_ptr;
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -17,18 +17,20 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/Vulkan/DescriptorManager.h
-Vulkan descriptor manager with descriptor sets allocator.
+Vulkan descriptor manager with descriptor sets allocator,
+which recycles released descriptor sets per layout after GPU completion.
 
 ******************************************************************************/
 
 #pragma once
 
 #include <Methane/Graphics/Base/DescriptorManager.h>
+#include <Methane/Graphics/Base/DescriptorSetRecycler.h>
 #include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
 #include <map>
-#include <optional>
+#include <vector>
 #include <mutex>
 
 namespace Methane::Graphics::Rhi
@@ -50,11 +52,23 @@ namespace Methane::Graphics::Vulkan
 
 struct IContext;
 
+using DescriptorSetLayoutStatistics = Base::DescriptorSetLayoutStatistics;
+using DescriptorSetRecycler         = Base::DescriptorSetRecycler<vk::DescriptorSetLayout, vk::DescriptorSet, vk::DescriptorPool>;
+
+struct DescriptorManagerStatistics
+    : Base::DescriptorSetRecyclerStatistics
+{
+    uint32_t pools_count = 0U;
+};
+
 class DescriptorManager final
     : public Base::DescriptorManager
+    , private DescriptorSetRecycler
 {
 public:
     using PoolSizeRatioByDescType = std::map<vk::DescriptorType, float>;
+    using Statistics              = DescriptorManagerStatistics;
+    using LayoutStatistics        = DescriptorSetLayoutStatistics;
 
     DescriptorManager(Base::Context& context, uint32_t pool_sets_count = 1000U,
                       const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type = {
@@ -75,21 +89,48 @@ public:
     void Release() override;
 
     void SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio);
+    using DescriptorSetRecycler::SetRetireFramesCount;
+
+    // Layouts are registered by programs to count descriptors of allocated sets and to free their sets on program destruction
+    void RegisterDescriptorSetLayout(vk::DescriptorSetLayout layout, const std::vector<vk::DescriptorSetLayoutBinding>& layout_bindings);
+    void UnregisterDescriptorSetLayout(vk::DescriptorSetLayout layout);
+
     vk::DescriptorSet AllocDescriptorSet(vk::DescriptorSetLayout layout);
+    std::vector<vk::DescriptorSet> AllocDescriptorSets(vk::DescriptorSetLayout layout, uint32_t sets_count);
+
+    // Released descriptor sets are reused for the same layout only after the retire frames count has passed or when GPU is idle
+    void ReleaseDescriptorSet(vk::DescriptorSet descriptor_set);
+    using DescriptorSetRecycler::CompleteFrame;
+    using DescriptorSetRecycler::CompleteAllFrames;
+
+    [[nodiscard]] Statistics GetStatistics() const;
+    using DescriptorSetRecycler::GetLayoutStatistics;
+
+protected:
+    // Base::DescriptorSetRecycler interface
+    void AllocateNativeSets(vk::DescriptorSetLayout layout, uint32_t sets_count, PooledSets& pooled_sets) override;
+    void FreeNativeSets(const PooledSets& pooled_sets) override;
+    void ResetNativePools() override;
 
 private:
-    vk::DescriptorPool CreateDescriptorPool();
-    vk::DescriptorPool AcquireDescriptorPool();
+    void AddUsedDescriptors(vk::DescriptorSetLayout layout, uint32_t sets_count);
+    vk::DescriptorPool CreateDescriptorPool(uint32_t min_sets_count);
+    vk::DescriptorPool AcquireDescriptorPool(uint32_t min_sets_count);
     const IContext&    GetContextVk();
 
-    const IContext*                       m_vk_context_ptr = nullptr;
-    uint32_t                              m_pool_sets_count;
-    PoolSizeRatioByDescType               m_pool_size_ratio_by_desc_type;
-    std::vector<vk::UniqueDescriptorPool> m_vk_descriptor_pools;
-    std::vector<vk::DescriptorPool>       m_vk_used_pools;
-    std::vector<vk::DescriptorPool>       m_vk_free_pools;
-    vk::DescriptorPool                    m_vk_current_pool;
-    TracyLockable(std::mutex,             m_descriptor_pool_mutex);
+    using DescriptorSizes = std::vector<vk::DescriptorPoolSize>; // descriptors count of each type in one set
+
+    const IContext*                                    m_vk_context_ptr = nullptr;
+    uint32_t                                           m_pool_sets_count;
+    PoolSizeRatioByDescType                            m_pool_size_ratio_by_desc_type;
+    std::vector<vk::UniqueDescriptorPool>              m_vk_descriptor_pools;
+    std::vector<vk::DescriptorPool>                    m_vk_used_pools;
+    std::vector<vk::DescriptorPool>                    m_vk_free_pools;
+    vk::DescriptorPool                                 m_vk_current_pool;
+    std::map<vk::DescriptorSetLayout, DescriptorSizes> m_descriptor_sizes_by_layout;
+    std::map<vk::DescriptorType, uint64_t>             m_used_descriptors_count_by_type;
+    uint64_t                                           m_used_sets_count = 0U;
+    mutable TracyLockable(std::mutex,                  m_descriptor_pool_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
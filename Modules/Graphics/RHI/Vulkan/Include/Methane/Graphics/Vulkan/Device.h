@@ -23,6 +23,8 @@ Vulkan implementation of the device interface.
 
 #pragma once
 
+#include "MemoryAllocator.h"
+
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/RHI/ICommandQueue.h>
 #include <Methane/Platform/AppEnvironment.h>
@@ -88,6 +90,9 @@ public:
     [[nodiscard]] Ptr<Rhi::IRenderContext> CreateRenderContext(const Methane::Platform::AppEnvironment& env, tf::Executor& parallel_executor, const Rhi::RenderContextSettings& settings) override;
     [[nodiscard]] Ptr<Rhi::IComputeContext> CreateComputeContext(tf::Executor& parallel_executor, const Rhi::ComputeContextSettings& settings) override;
 
+    [[nodiscard]] MemoryStatistics GetMemoryStatistics() const noexcept override;
+    [[nodiscard]] DynamicStateMask GetDynamicStates() const noexcept override { return m_dynamic_states; }
+
     // IObject interface
     bool SetName(std::string_view name) override;
 
@@ -101,6 +106,11 @@ public:
     const vk::QueueFamilyProperties& GetNativeQueueFamilyProperties(uint32_t queue_family_index) const;
     bool                             IsExtensionSupported(std::string_view required_extension) const;
     bool                             IsDynamicStateSupported() const noexcept { return m_is_dynamic_state_supported; }
+    bool                             IsPipelineCreationFeedbackSupported() const noexcept { return m_is_pipeline_creation_feedback_supported; }
+    bool                             IsDescriptorIndexingSupported() const noexcept { return m_is_descriptor_indexing_supported; }
+    bool                             IsMultiDrawIndirectSupported() const noexcept { return m_is_multi_draw_indirect_supported; }
+    bool                             IsDrawIndirectCountSupported() const noexcept { return m_is_draw_indirect_count_supported; }
+    MemoryAllocator&                 GetMemoryAllocator() const noexcept      { return m_memory_allocator; }
 
 private:
     using QueueFamilyReservationByType = std::map<Rhi::CommandListType, Ptr<QueueFamilyReservation>>;
@@ -115,9 +125,15 @@ private:
     const std::vector<std::string>         m_supported_extension_names_storage;
     const std::set<std::string_view>       m_supported_extension_names_set;
     const bool                             m_is_dynamic_state_supported = false;
+    const bool                             m_is_pipeline_creation_feedback_supported = false;
+    const bool                             m_is_descriptor_indexing_supported = false;
+    const bool                             m_is_multi_draw_indirect_supported = false;
+    const bool                             m_is_draw_indirect_count_supported = false;
+    const Rhi::DeviceDynamicStateMask      m_dynamic_states;
     std::vector<vk::QueueFamilyProperties> m_vk_queue_family_properties;
     vk::UniqueDevice                       m_vk_unique_device;
     QueueFamilyReservationByType           m_queue_family_reservation_by_type;
+    mutable MemoryAllocator                m_memory_allocator; // memory blocks are released before the device
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -24,6 +24,7 @@ Vulkan context accessor interface for template class ContextMT<ContextBaseT>
 #pragma once
 
 #include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Memory.hpp>
 
 namespace Methane::Graphics::Vulkan
 {
@@ -31,12 +32,16 @@ namespace Methane::Graphics::Vulkan
 class Device;
 class CommandQueue;
 class DescriptorManager;
+class PipelineCache;
+class BindlessDescriptorSet;
 
 struct IContext
 {
     virtual const Device& GetVulkanDevice() const noexcept = 0;
     virtual CommandQueue& GetVulkanDefaultCommandQueue(Rhi::CommandListType type) = 0;
     virtual DescriptorManager& GetVulkanDescriptorManager() const = 0;
+    virtual PipelineCache& GetVulkanPipelineCache() const = 0;
+    virtual Ptr<BindlessDescriptorSet> GetVulkanBindlessDescriptorSetPtr() const = 0;
 
     virtual ~IContext() = default;
 };
@@ -0,0 +1,102 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.h
+Vulkan device memory allocator with resource memory sub-allocated from memory blocks
+of the same memory type and persistently mapped host-visible memory blocks.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Base/DeviceMemoryAllocator.h>
+#include <Methane/Data/Types.h>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <vector>
+#include <mutex>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class Device;
+class MemoryAllocator;
+
+class MemoryAllocation // NOSONAR - custom destructor is required
+{
+public:
+    MemoryAllocation() = default;
+    MemoryAllocation(MemoryAllocator& allocator, const Base::DeviceMemoryAllocation& allocation, const vk::DeviceMemory& vk_device_memory) noexcept;
+    ~MemoryAllocation();
+
+    MemoryAllocation(const MemoryAllocation&) = delete;
+    MemoryAllocation(MemoryAllocation&& other) noexcept;
+    MemoryAllocation& operator=(const MemoryAllocation&) = delete;
+    MemoryAllocation& operator=(MemoryAllocation&& other) noexcept;
+
+    [[nodiscard]] bool                    IsInitialized() const noexcept         { return m_allocation.IsInitialized(); }
+    [[nodiscard]] const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept { return m_vk_device_memory; }
+    [[nodiscard]] vk::DeviceSize          GetOffset() const noexcept             { return m_allocation.offset; }
+    [[nodiscard]] vk::DeviceSize          GetSize() const noexcept               { return m_allocation.size; }
+
+    // Returns pointer to the beginning of allocation in the persistently mapped host-visible memory block
+    [[nodiscard]] Data::RawPtr GetMappedDataPtr() const;
+
+    void Release() noexcept;
+
+private:
+    MemoryAllocator*             m_allocator_ptr = nullptr;
+    Base::DeviceMemoryAllocation m_allocation;
+    vk::DeviceMemory             m_vk_device_memory;
+};
+
+class MemoryAllocator final
+    : public Base::DeviceMemoryAllocator
+{
+public:
+    explicit MemoryAllocator(const Device& device, const Settings& settings = {});
+
+    // Returns uninitialized allocation when suitable memory type was not found or device memory is exhausted
+    [[nodiscard]] MemoryAllocation Allocate(const vk::MemoryRequirements& vk_memory_requirements,
+                                            vk::MemoryPropertyFlags vk_memory_property_flags,
+                                            bool is_image_memory);
+
+    [[nodiscard]] Data::RawPtr GetMappedDataPtr(const Allocation& allocation);
+    [[nodiscard]] uint64_t     GetBudgetSize() const;
+
+protected:
+    // Base::DeviceMemoryAllocator interface
+    bool AllocateMemoryBlock(Data::Index pool_index, Data::Index block_index, uint64_t size) override;
+    void FreeMemoryBlock(Data::Index block_index) override;
+
+private:
+    struct MemoryBlock
+    {
+        vk::UniqueDeviceMemory vk_unique_memory;
+        Data::RawPtr           mapped_data_ptr = nullptr;
+    };
+
+    const Device&            m_device;
+    const bool               m_is_memory_budget_supported;
+    std::vector<MemoryBlock> m_memory_blocks;
+    TracyLockable(std::mutex, m_memory_blocks_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
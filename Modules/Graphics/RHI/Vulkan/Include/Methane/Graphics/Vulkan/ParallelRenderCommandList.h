@@ -49,7 +49,6 @@ public:
     void ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) override;
     void SetBeginningResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) override;
     void SetEndingResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) override;
-    void SetParallelCommandListsCount(uint32_t count) override;
 
     // ICommandList interface
     void Commit() override;
@@ -0,0 +1,76 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PipelineCache.h
+Vulkan pipeline cache used for creation of all context pipelines,
+which is loaded from file on context initialization and saved on release.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Base/PipelineCacheFile.h>
+#include <Methane/Graphics/RHI/IContext.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <atomic>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class Device;
+
+class PipelineCache
+{
+public:
+    using Statistics = Rhi::PipelineCacheStatistics;
+
+    [[nodiscard]] static std::string GetDefaultFilePath(const Device& device);
+
+    explicit PipelineCache(const Device& device);
+    PipelineCache(const Device& device, const std::string& file_path);
+
+    [[nodiscard]] vk::UniquePipeline CreateGraphicsPipeline(const vk::GraphicsPipelineCreateInfo& vk_pipeline_create_info);
+    [[nodiscard]] vk::UniquePipeline CreateComputePipeline(const vk::ComputePipelineCreateInfo& vk_pipeline_create_info);
+
+    bool Save() const;
+    void CompleteFrame() noexcept;
+
+    [[nodiscard]] const vk::PipelineCache& GetNativePipelineCache() const noexcept { return m_vk_unique_pipeline_cache.get(); }
+    [[nodiscard]] const std::string&       GetFilePath() const noexcept            { return m_file.GetFilePath(); }
+    [[nodiscard]] Statistics               GetStatistics() const noexcept;
+
+private:
+    template<typename PipelineCreateInfoType>
+    vk::UniquePipeline CreatePipeline(PipelineCreateInfoType vk_pipeline_create_info, uint32_t stages_count);
+
+    void AddCreationFeedback(const vk::PipelineCreationFeedbackEXT& vk_feedback) noexcept;
+
+    const Device&                 m_device;
+    const Base::PipelineCacheFile m_file;
+    Data::Size                    m_loaded_data_size = 0U;
+    vk::UniquePipelineCache       m_vk_unique_pipeline_cache;
+    std::atomic<uint32_t>         m_pipelines_created{ 0U };
+    std::atomic<uint32_t>         m_frame_pipelines_creating{ 0U };
+    std::atomic<uint32_t>         m_frame_pipelines_created{ 0U };
+    std::atomic<uint32_t>         m_cache_hits_count{ 0U };
+    std::atomic<uint32_t>         m_cache_misses_count{ 0U };
+};
+
+} // namespace Methane::Graphics::Vulkan
@@ -57,6 +57,7 @@ public:
     };
 
     Program(Base::Context& context, const Settings& settings);
+    ~Program() override;
 
     // IProgram interface
     [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateBindings(const BindingValueByArgument& binding_value_by_argument, Data::Index frame_index) override;
@@ -77,11 +78,14 @@ public:
     const vk::PipelineLayout& AcquireNativePipelineLayout();
     const vk::DescriptorSet& AcquireConstantDescriptorSet();
     const vk::DescriptorSet& AcquireFrameConstantDescriptorSet(Data::Index frame_index);
+    const Opt<uint32_t>&     GetBindlessDescriptorSetIndex() const noexcept { return m_bindless_descriptor_set_index_opt; }
+    const vk::DescriptorSet& GetNativeBindlessDescriptorSet() const noexcept { return m_vk_bindless_descriptor_set; }
 
 private:
     using DescriptorSetLayoutInfoByAccessType = std::array<DescriptorSetLayoutInfo, magic_enum::enum_count<ArgumentAccessor::Type>()>;
 
     void InitializeDescriptorSetLayouts();
+    void InitializeBindlessDescriptorSetLayout();
     void UpdatePipelineName();
     void UpdateDescriptorSetLayoutNames() const;
     void UpdateConstantDescriptorSetName();
@@ -95,6 +99,8 @@ private:
     vk::UniquePipelineLayout                   m_vk_unique_pipeline_layout;
     std::optional<vk::DescriptorSet>           m_vk_constant_descriptor_set_opt;
     std::vector<vk::DescriptorSet>             m_vk_frame_constant_descriptor_sets;
+    Opt<uint32_t>                              m_bindless_descriptor_set_index_opt;
+    vk::DescriptorSet                          m_vk_bindless_descriptor_set; // owned by context bindless descriptor set
     TracyLockable(std::mutex,                  m_mutex);
 };
 
@@ -46,6 +46,7 @@ public:
 
     ProgramBindings(Program& program, const BindingValueByArgument& binding_value_by_argument, Data::Index frame_index);
     ProgramBindings(const ProgramBindings& other_program_bindings, const BindingValueByArgument& replace_resource_view_by_argument, const Opt<Data::Index>& frame_index);
+    ~ProgramBindings() override;
 
     // IProgramBindings interface
     [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateCopy(const BindingValueByArgument& replace_binding_value_by_argument, const Opt<Data::Index>& frame_index) override;
@@ -67,6 +68,7 @@ private:
     // IObjectCallback interface
     void OnObjectNameChanged(Rhi::IObject&, const std::string&) override; // IProgram name changed
 
+    void InitializePushConstantSetters();
     void SetResourcesForArguments(const BindingValueByArgument& binding_value_by_argument);
 
     template<typename FuncType> // function void(const ProgramArgument&, ArgumentBinding&)
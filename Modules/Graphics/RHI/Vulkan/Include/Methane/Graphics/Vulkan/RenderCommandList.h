@@ -60,18 +60,30 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void MultiDrawIndexed(Primitive primitive, std::span<const Rhi::DrawIndexedArguments> draw_arguments) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
 
     bool IsDynamicStateSupported() const noexcept { return m_is_dynamic_state_supported; }
+    void SetNativePipelinePending(bool is_pending) noexcept { m_is_native_pipeline_pending = is_pending; }
 
     // IRenderPassCallback
     void OnRenderPassUpdated(const Rhi::IRenderPass& render_pass) override;
 
 private:
     void UpdatePrimitiveTopology(Primitive primitive);
+    // Returns false when render state pipeline is still being created asynchronously and draw call has to be skipped,
+    // which is counted in the render pipeline registry statistics of the render context
+    bool IsNativePipelineBound();
+    void EncodeIndirectDraws(bool is_indexed, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset);
 
     RenderPass& GetVulkanPass();
 
     const bool m_is_dynamic_state_supported;
+    bool       m_is_native_pipeline_pending = false;
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -26,6 +26,8 @@ Vulkan implementation of the render context interface.
 #include "Context.hpp"
 
 #include <Methane/Graphics/Base/RenderContext.h>
+#include <Methane/Graphics/Base/RenderPipelineKey.h>
+#include <Methane/Graphics/Base/PipelineRegistry.h>
 #include <Methane/Platform/AppEnvironment.h>
 #include <Methane/Data/Emitter.hpp>
 
@@ -45,6 +47,9 @@ namespace Methane::Graphics::Vulkan
 
 class RenderContext;
 
+using RenderPipelineRegistry = Base::PipelineRegistry<Base::RenderPipelineKey, vk::UniquePipeline, Base::RenderPipelineKey::Hash>;
+using RenderPipeline         = RenderPipelineRegistry::Pipeline;
+
 struct IRenderContextCallback
 {
     virtual void OnRenderContextSwapchainChanged(RenderContext& context) = 0;
@@ -91,7 +96,9 @@ public:
     const vk::Semaphore&    GetNativeFrameImageAvailableSemaphore(uint32_t frame_buffer_index) const;
     const vk::Semaphore&    GetNativeFrameImageAvailableSemaphore(Opt<uint32_t> frame_buffer_index_opt) const;
 
-    void DeferredRelease(vk::UniquePipeline&& pipeline) const { m_vk_deferred_release_pipelines.emplace_back(std::move(pipeline)); }
+    RenderPipelineRegistry& GetRenderPipelineRegistry() const noexcept { return m_render_pipeline_registry; }
+
+    void DeferredRelease(RenderPipeline&& pipeline) const { m_vk_deferred_release_pipelines.emplace_back(std::move(pipeline)); }
 
 protected:
     // Base::RenderContext overrides
@@ -129,7 +136,8 @@ private:
     std::vector<vk::Image>                  m_vk_frame_images;
     std::vector<FrameSync>                  m_frame_sync_pool;
     std::vector<vk::Semaphore>              m_vk_frame_image_available_semaphores;
-    mutable std::deque<vk::UniquePipeline>  m_vk_deferred_release_pipelines;
+    mutable std::deque<RenderPipeline>      m_vk_deferred_release_pipelines;
+    mutable RenderPipelineRegistry          m_render_pipeline_registry;
 };
 
 } // namespace Methane::Graphics::Vulkan
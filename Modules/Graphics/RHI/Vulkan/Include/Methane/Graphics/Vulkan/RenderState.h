@@ -25,6 +25,7 @@ Vulkan implementation of the render state interface.
 
 #include <Methane/Graphics/RHI/IViewState.h>
 #include <Methane/Graphics/Base/RenderState.h>
+#include <Methane/Graphics/Base/PipelineRegistry.h>
 #include <Methane/Data/Receiver.hpp>
 #include <Methane/Instrumentation.h>
 
@@ -41,6 +42,7 @@ enum class RenderPrimitive;
 namespace Methane::Graphics::Base
 {
 struct RenderDrawingState;
+class RenderPipelineKey;
 }
 
 namespace Methane::Graphics::Vulkan
@@ -50,6 +52,8 @@ struct IContext;
 class ViewState;
 class RenderContext;
 
+using RenderPipeline = Base::PipelineReference<vk::UniquePipeline>;
+
 class RenderState final
     : public Base::RenderState
     , private Data::Receiver<Rhi::IViewStateCallback>
@@ -70,23 +74,32 @@ public:
     bool SetName(std::string_view name) override;
 
     bool                IsNativePipelineDynamic() const noexcept  { return !Base::RenderState::IsDeferred(); }
+    bool                IsNativePipelineAsync() const noexcept    { return m_is_native_pipeline_async; }
     const vk::Pipeline& GetNativePipelineDynamic() const;
+    const vk::Pipeline* GetNativePipelineDynamicIfReady();
     const vk::Pipeline& GetNativePipelineMonolithic(ViewState& viewState, Rhi::RenderPrimitive renderPrimitive);
     const vk::Pipeline& GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state);
 
 private:
-    vk::UniquePipeline CreateNativePipeline(const ViewState* viewState = nullptr, Opt<Rhi::RenderPrimitive> renderPrimitive = {}) const;
+    RenderPipeline GetRegistryPipeline(const ViewState* view_state_ptr = nullptr, Opt<Rhi::RenderPrimitive> render_primitive_opt = {}) const;
+    void SetNativeDynamicStates(const vk::CommandBuffer& vk_command_buffer, Groups state_groups) const;
+
+    static vk::UniquePipeline CreateNativePipeline(const RenderContext& render_context, const Settings& settings, std::string_view name,
+                                                   const Base::RenderPipelineKey& pipeline_key);
 
     // IViewStateCallback overrides
     void OnViewStateChanged(Rhi::IViewState& view_state) override;
     void OnViewStateDestroyed(Rhi::IViewState& view_state) override;
 
     using PipelineId = std::tuple<Rhi::IViewState*, Rhi::RenderPrimitive>;
-    using MonolithicPipelineById = std::map<PipelineId, vk::UniquePipeline>;
-
-    const RenderContext&      m_vk_render_context;
-    vk::UniquePipeline        m_vk_pipeline_dynamic;
-    MonolithicPipelineById    m_vk_pipeline_monolithic_by_id;
+    using MonolithicPipelineById = std::map<PipelineId, RenderPipeline>;
+
+    const RenderContext&              m_vk_render_context;
+    const bool                        m_is_native_pipeline_async;
+    const Rhi::DeviceDynamicStateMask m_dynamic_states;
+    RenderPipeline                    m_vk_pipeline_dynamic;
+    RenderPipeline                    m_vk_pipeline_dynamic_placeholder; // previous pipeline is used after reset until the new one is ready
+    MonolithicPipelineById            m_vk_pipeline_monolithic_by_id;
     TracyLockable(std::mutex, m_mutex);
 };
 
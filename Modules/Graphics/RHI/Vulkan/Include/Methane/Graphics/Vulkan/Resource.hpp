@@ -26,6 +26,7 @@ Vulkan implementation of the resource interface.
 #include "IResource.h"
 #include "IContext.h"
 #include "Device.h"
+#include "MemoryAllocator.h"
 #include "TransferCommandList.h"
 #include "Utils.hpp"
 
@@ -145,7 +146,12 @@ public:
 
     const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept final
     {
-        return m_vk_unique_device_memory.get();
+        return m_memory_allocation.GetNativeDeviceMemory();
+    }
+
+    vk::DeviceSize GetNativeDeviceMemoryOffset() const noexcept final
+    {
+        return m_memory_allocation.GetOffset();
     }
 
     const vk::Device& GetNativeDevice() const noexcept final
@@ -179,28 +185,29 @@ public:
     }
 
 protected:
-    vk::UniqueDeviceMemory AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
+    MemoryAllocation AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                          bool is_image_memory = false) const
     {
         META_FUNCTION_TASK();
-        const Opt<uint32_t> memory_type_opt = GetVulkanContext().GetVulkanDevice().FindMemoryType(memory_requirements.memoryTypeBits, memory_property_flags);
-        if (!memory_type_opt)
-            throw IResource::AllocationError(*this, "suitable memory type was not found");
+        MemoryAllocation memory_allocation = GetVulkanContext().GetVulkanDevice().GetMemoryAllocator()
+                                                               .Allocate(memory_requirements, memory_property_flags, is_image_memory);
+        if (!memory_allocation.IsInitialized())
+            throw IResource::AllocationError(*this, "suitable device memory was not found or device memory is exhausted");
 
-        try
-        {
-            return GetNativeDevice().allocateMemoryUnique(vk::MemoryAllocateInfo(memory_requirements.size, *memory_type_opt));
-        }
-        catch(const vk::SystemError& error)
-        {
-            throw IResource::AllocationError(*this, error.what());
-        }
+        return memory_allocation;
     }
 
     void AllocateResourceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
     {
         META_FUNCTION_TASK();
-        m_vk_unique_device_memory.release();
-        m_vk_unique_device_memory = AllocateDeviceMemory(memory_requirements, memory_property_flags);
+        m_memory_allocation = AllocateDeviceMemory(memory_requirements, memory_property_flags, std::is_same_v<NativeResourceType, vk::Image>);
+    }
+
+    // Resource memory is mapped persistently with the whole host-visible memory block
+    Data::RawPtr GetMappedDeviceMemoryPtr() const
+    {
+        META_FUNCTION_TASK();
+        return m_memory_allocation.GetMappedDataPtr();
     }
 
     template<typename T = ResourceStorageType>
@@ -264,7 +271,7 @@ private:
     using ViewDescriptorByViewId = std::map<ResourceView::Id, Ptr<ResourceView::ViewDescriptorVariant>>;
 
     vk::Device                   m_vk_device;
-    vk::UniqueDeviceMemory       m_vk_unique_device_memory;
+    MemoryAllocation             m_memory_allocation;
     ResourceStorageType          m_vk_resource;
     ViewDescriptorByViewId       m_view_descriptor_by_view_id;
     TracyLockable(std::mutex,    m_view_descriptors_mutex);
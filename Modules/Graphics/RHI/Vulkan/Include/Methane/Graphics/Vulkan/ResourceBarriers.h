@@ -56,6 +56,9 @@ public:
     AddResult Add(const Barrier& barrier) override;
     bool Remove(const Barrier::Id& id) override;
 
+    // Base::ResourceBarriers overrides
+    void Clear() override;
+
     const NativePipelineBarrier& GetNativePipelineBarrierData(const CommandQueue& target_cmd_queue) const;
 
 private:
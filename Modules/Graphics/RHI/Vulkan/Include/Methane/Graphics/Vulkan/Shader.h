@@ -31,6 +31,7 @@ Vulkan implementation of the shader interface.
 #include <vulkan/vulkan.hpp>
 
 #include <string>
+#include <vector>
 #include <mutex>
 
 namespace spirv_cross // NOSONAR
@@ -53,6 +54,15 @@ class Shader final
     : public Base::Shader
 {
 public:
+    struct BindlessByteCodeMap
+    {
+        Rhi::ResourceType resource_type;
+        uint32_t          descriptor_set_offset;
+        uint32_t          binding_offset;
+    };
+
+    using BindlessByteCodeMaps = std::vector<BindlessByteCodeMap>;
+
     Shader(Type shader_type, const Base::Context& context, const Settings& settings);
     ~Shader() override;
 
@@ -64,6 +74,7 @@ public:
     const spirv_cross::Compiler&           GetNativeCompiler() const;
     vk::PipelineShaderStageCreateInfo      GetNativeStageCreateInfo() const;
     vk::PipelineVertexInputStateCreateInfo GetNativeVertexInputStateCreateInfo(const Program& program);
+    BindlessByteCodeMaps                   GetBindlessByteCodeMaps() const;
 
     Data::MutableChunk& GetMutableByteCode() noexcept;
 
@@ -76,7 +76,7 @@ private:
 
     vk::UniqueImage                  m_vk_unique_image;
     vk::UniqueBuffer                 m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory           m_vk_unique_staging_memory;
+    MemoryAllocation                 m_staging_memory;
     std::vector<vk::BufferImageCopy> m_vk_copy_regions;
 };
 
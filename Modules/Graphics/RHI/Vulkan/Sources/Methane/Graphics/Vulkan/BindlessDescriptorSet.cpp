@@ -0,0 +1,142 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/BindlessDescriptorSet.cpp
+Vulkan descriptor set with global bindless arrays of buffers, textures and samplers,
+which is updated after bind and shared by all programs of the context.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/BindlessDescriptorSet.h>
+#include <Methane/Graphics/Vulkan/ResourceView.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+#include <Methane/Graphics/Vulkan/Utils.hpp>
+
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace Methane::Graphics::Vulkan
+{
+
+static BindlessDescriptorSet::Settings GetDeviceLimitedSettings(const Device& device, BindlessDescriptorSet::Settings settings)
+{
+    META_FUNCTION_TASK();
+    const auto vk_properties_chain = device.GetNativePhysicalDevice().getProperties2<vk::PhysicalDeviceProperties2,
+                                                                                     vk::PhysicalDeviceDescriptorIndexingPropertiesEXT>();
+    const auto& vk_indexing_properties = vk_properties_chain.get<vk::PhysicalDeviceDescriptorIndexingPropertiesEXT>();
+    settings.buffers_count  = std::min(settings.buffers_count,  vk_indexing_properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+    settings.textures_count = std::min(settings.textures_count, vk_indexing_properties.maxPerStageDescriptorUpdateAfterBindSampledImages);
+    settings.samplers_count = std::min(settings.samplers_count, vk_indexing_properties.maxPerStageDescriptorUpdateAfterBindSamplers);
+    return settings;
+}
+
+uint32_t BindlessDescriptorSet::GetBinding(Rhi::ResourceType resource_type)
+{
+    META_FUNCTION_TASK();
+    switch (resource_type)
+    {
+    using enum Rhi::ResourceType;
+    case Buffer:  return 0U;
+    case Texture: return 1U;
+    case Sampler: return 2U;
+    default:      META_UNEXPECTED_RETURN(resource_type, 0U);
+    }
+}
+
+vk::DescriptorType BindlessDescriptorSet::GetDescriptorType(Rhi::ResourceType resource_type)
+{
+    META_FUNCTION_TASK();
+    switch (resource_type)
+    {
+    using enum Rhi::ResourceType;
+    using enum vk::DescriptorType;
+    case Buffer:  return eStorageBuffer;
+    case Texture: return eSampledImage;
+    case Sampler: return eSampler;
+    default:      META_UNEXPECTED_RETURN(resource_type, eStorageBuffer);
+    }
+}
+
+BindlessDescriptorSet::BindlessDescriptorSet(const Device& device, const Settings& settings)
+    : Base::BindlessDescriptorTable(GetDeviceLimitedSettings(device, settings))
+    , m_device(device)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(device.IsDescriptorIndexingSupported(), "bindless descriptor set requires descriptor indexing support by device");
+
+    constexpr std::array<Rhi::ResourceType, 3U> resource_types{ Rhi::ResourceType::Buffer, Rhi::ResourceType::Texture, Rhi::ResourceType::Sampler };
+    std::vector<vk::DescriptorSetLayoutBinding> vk_layout_bindings;
+    std::vector<vk::DescriptorBindingFlagsEXT>  vk_binding_flags;
+    std::vector<vk::DescriptorPoolSize>         vk_pool_sizes;
+    for (Rhi::ResourceType resource_type : resource_types)
+    {
+        const vk::DescriptorType vk_descriptor_type = GetDescriptorType(resource_type);
+        const uint32_t           descriptors_count  = GetCapacity(resource_type);
+        vk_layout_bindings.emplace_back(GetBinding(resource_type), vk_descriptor_type, descriptors_count, vk::ShaderStageFlagBits::eAll);
+        vk_pool_sizes.emplace_back(vk_descriptor_type, descriptors_count);
+
+        // Descriptor arrays are filled sparsely and updated while being bound in command lists recorded for the frames in flight
+        vk_binding_flags.emplace_back(vk::DescriptorBindingFlagBitsEXT::ePartiallyBound |
+                                      vk::DescriptorBindingFlagBitsEXT::eUpdateAfterBind |
+                                      vk::DescriptorBindingFlagBitsEXT::eUpdateUnusedWhilePending);
+    }
+
+    const vk::Device& vk_device = device.GetNativeDevice();
+    const vk::DescriptorSetLayoutBindingFlagsCreateInfoEXT vk_layout_binding_flags_info(vk_binding_flags);
+    vk::DescriptorSetLayoutCreateInfo vk_layout_info(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPoolEXT, vk_layout_bindings);
+    vk_layout_info.setPNext(&vk_layout_binding_flags_info);
+    m_vk_unique_descriptor_set_layout = vk_device.createDescriptorSetLayoutUnique(vk_layout_info);
+
+    m_vk_unique_descriptor_pool = vk_device.createDescriptorPoolUnique(
+        vk::DescriptorPoolCreateInfo(vk::DescriptorPoolCreateFlagBits::eUpdateAfterBindEXT, 1U, vk_pool_sizes));
+
+    const auto vk_descriptor_sets = vk_device.allocateDescriptorSets(
+        vk::DescriptorSetAllocateInfo(m_vk_unique_descriptor_pool.get(), m_vk_unique_descriptor_set_layout.get()));
+    META_CHECK_NOT_EMPTY(vk_descriptor_sets);
+    m_vk_descriptor_set = vk_descriptor_sets.front();
+
+    SetVulkanObjectName(vk_device, m_vk_unique_descriptor_set_layout.get(), "Bindless Descriptors Layout");
+    SetVulkanObjectName(vk_device, m_vk_descriptor_set, "Bindless Descriptors");
+}
+
+void BindlessDescriptorSet::WriteDescriptor(Rhi::ResourceType resource_type, uint32_t index, const Rhi::ResourceView& resource_view)
+{
+    META_FUNCTION_TASK();
+    if (resource_type == Rhi::ResourceType::Buffer)
+    {
+        [[maybe_unused]] const auto& buffer = dynamic_cast<const Rhi::IBuffer&>(resource_view.GetResource());
+        META_CHECK_EQUAL_DESCR(buffer.GetSettings().type, Rhi::BufferType::Storage,
+                               "only storage buffers can be accessed with bindless descriptors");
+    }
+
+    const ResourceView resource_view_vk(resource_view, Rhi::ResourceUsageMask{ Rhi::ResourceUsage::ShaderRead });
+    vk::WriteDescriptorSet vk_write_descriptor_set(m_vk_descriptor_set, GetBinding(resource_type), index, 1U, GetDescriptorType(resource_type));
+    if (resource_type == Rhi::ResourceType::Buffer)
+        vk_write_descriptor_set.setPBufferInfo(resource_view_vk.GetNativeDescriptorBufferInfoPtr());
+    else
+        vk_write_descriptor_set.setPImageInfo(resource_view_vk.GetNativeDescriptorImageInfoPtr());
+
+    // Descriptor is written once on view registration and never changes until its index is retired
+    m_device.GetNativeDevice().updateDescriptorSets(vk_write_descriptor_set, {});
+}
+
+} // namespace Methane::Graphics::Vulkan
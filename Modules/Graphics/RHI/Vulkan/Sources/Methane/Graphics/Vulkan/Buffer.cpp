@@ -45,6 +45,7 @@ static vk::BufferUsageFlags GetVulkanBufferUsageFlags(Rhi::BufferType buffer_typ
     case Constant: vk_usage_flags |= eUniformBuffer; break;
     case Index:    vk_usage_flags |= eIndexBuffer;   break;
     case Vertex:   vk_usage_flags |= eVertexBuffer;  break;
+    case Indirect: vk_usage_flags |= eIndirectBuffer; break;
     // Buffer::Type::ReadBack - unsupported
     default: META_UNEXPECTED_DESCR(buffer_type, "Unsupported buffer type");
     }
@@ -67,6 +68,7 @@ static Rhi::ResourceState GetTargetResourceStateByBufferType(Rhi::BufferType buf
     case Index:    return IndexBuffer;
     case Vertex:   return VertexBuffer;
     case ReadBack: return StreamOut;
+    case Indirect: return IndirectArgument;
     default: META_UNEXPECTED_RETURN_DESCR(buffer_type, Rhi::ResourceState::Undefined, "Unsupported buffer type");
     }
 }
@@ -87,7 +89,7 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
 
     // Allocate resource primary memory
     AllocateResourceMemory(GetNativeDevice().getBufferMemoryRequirements(GetNativeResource()), vk_memory_property_flags);
-    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), GetNativeDeviceMemoryOffset());
 
     if (!is_private_storage)
         return;
@@ -100,8 +102,8 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
             vk::SharingMode::eExclusive)
     );
 
-    m_vk_unique_staging_memory = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    GetNativeDevice().bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    m_staging_memory = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
+    GetNativeDevice().bindBufferMemory(m_vk_unique_staging_buffer.get(), m_staging_memory.GetNativeDeviceMemory(), m_staging_memory.GetOffset());
 }
 
 void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResource& sub_resource)
@@ -111,27 +113,18 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResourc
 
     const Settings& buffer_settings = GetSettings();
     const bool is_private_storage = buffer_settings.storage_mode == Rhi::IBuffer::StorageMode::Private;
-    const vk::DeviceMemory& vk_device_memory = is_private_storage ? m_vk_unique_staging_memory.get() : GetNativeDeviceMemory();
 
-    const vk::DeviceSize sub_resource_offset = 0U;
-    Data::RawPtr sub_resource_data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
-
-    META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-
-    if (is_private_storage)
-    {
-        m_vk_copy_region = vk::BufferCopy(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
-    }
+    // Sub-resource with data range is written at the range offset, so that only part of the buffer is updated,
+    // host-visible memory is written directly with persistent mapping, since memory blocks can not be mapped twice
+    const vk::DeviceSize sub_resource_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    const Data::RawPtr   mapped_data_ptr     = is_private_storage ? m_staging_memory.GetMappedDataPtr() : GetMappedDeviceMemoryPtr();
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), mapped_data_ptr + sub_resource_offset);
 
     if (!is_private_storage)
         return;
 
+    m_vk_copy_region = vk::BufferCopy(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
+
     // In case of private GPU storage, copy buffer data from staging upload resource to the device-local GPU resource
     TransferCommandList& upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
     upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(m_vk_unique_staging_buffer.get(), GetNativeResource(), 1U, &m_vk_copy_region);
@@ -159,20 +152,19 @@ Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue& target_cmd_queue, const Byt
     return Rhi::SubResource(std::move(data), Rhi::SubResourceIndex(), data_range);
 }
 
-Data::Bytes Buffer::GetDataFromSharedBuffer(const BytesRange& data_range) const
+Data::RawPtr Buffer::GetMappedDataPtr()
 {
     META_FUNCTION_TASK();
-    Data::RawPtr data_ptr = nullptr;
-    const vk::DeviceMemory& vk_device_memory = GetNativeDeviceMemory();
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, data_range.GetStart(), data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-
-    META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(vk_device_memory);
+    META_CHECK_EQUAL_DESCR(GetSettings().storage_mode, Rhi::IBuffer::StorageMode::Managed,
+                           "only managed buffer memory is host-visible and can be mapped persistently");
+    return GetMappedDeviceMemoryPtr();
+}
 
-    return data;
+Data::Bytes Buffer::GetDataFromSharedBuffer(const BytesRange& data_range) const
+{
+    META_FUNCTION_TASK();
+    const Data::RawPtr mapped_data_ptr = GetMappedDeviceMemoryPtr();
+    return Data::Bytes(mapped_data_ptr + data_range.GetStart(), mapped_data_ptr + data_range.GetEnd());
 }
 
 Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue)
@@ -190,15 +182,8 @@ Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::
     GetBaseContext().UploadResources();
 
     // Copy buffer data from mapped staging resource
-    Data::RawPtr data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(m_vk_unique_staging_memory.get(), 0U, data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-    META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(m_vk_unique_staging_memory.get());
-
-    return data;
+    const Data::RawPtr data_ptr = m_staging_memory.GetMappedDataPtr();
+    return Data::Bytes(data_ptr, data_ptr + data_range.GetLength());
 }
 
 bool Buffer::SetName(std::string_view name)
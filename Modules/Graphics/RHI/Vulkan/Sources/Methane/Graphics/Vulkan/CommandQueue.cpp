@@ -205,19 +205,12 @@ void CommandQueue::WaitForSemaphore(const vk::Semaphore& semaphore, vk::Pipeline
 const CommandQueue::WaitInfo& CommandQueue::GetWaitForExecutionCompleted() const
 {
     META_FUNCTION_TASK();
-    const auto           executing_command_lists_guard = GetExecutingCommandListsGuard();
-    CommandListSetsQueue executing_command_list_sets   = executing_command_lists_guard.GetCommandListsQueue(); // copy the queue for iterating
-
     m_wait_execution_completed.semaphores.clear();
-    m_wait_execution_completed.semaphores.reserve(executing_command_list_sets.size());
-
-    while(!executing_command_list_sets.empty())
+    ForEachExecutingCommandListSet([this](const Base::CommandListSet& executing_command_list_set)
     {
-        META_CHECK_NOT_NULL(executing_command_list_sets.front());
-        const auto& executing_command_list_set = static_cast<const CommandListSet&>(*executing_command_list_sets.front());
-        m_wait_execution_completed.semaphores.emplace_back(executing_command_list_set.GetNativeExecutionCompletedSemaphore());
-        executing_command_list_sets.pop();
-    }
+        const auto& vulkan_command_list_set = static_cast<const CommandListSet&>(executing_command_list_set);
+        m_wait_execution_completed.semaphores.emplace_back(vulkan_command_list_set.GetNativeExecutionCompletedSemaphore());
+    });
 
     m_wait_execution_completed.stages.resize(m_wait_execution_completed.semaphores.size(), vk::PipelineStageFlagBits::eBottomOfPipe);
     return m_wait_execution_completed;
@@ -27,6 +27,7 @@ Vulkan implementation of the compute state interface.
 #include <Methane/Graphics/Vulkan/ComputeContext.h>
 #include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/ComputeCommandList.h>
+#include <Methane/Graphics/Vulkan/PipelineCache.h>
 #include <Methane/Graphics/Vulkan/Program.h>
 #include <Methane/Graphics/Vulkan/Shader.h>
 #include <Methane/Graphics/Vulkan/Types.h>
@@ -75,9 +76,7 @@ void ComputeState::Reset(const Settings& settings)
         program.AcquireNativePipelineLayout()
     );
 
-    auto pipe = m_vk_context.GetVulkanDevice().GetNativeDevice().createComputePipelineUnique(nullptr, vk_pipeline_create_info);
-    META_CHECK_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
-    m_vk_unique_pipeline = std::move(pipe.value);
+    m_vk_unique_pipeline = m_vk_context.GetVulkanPipelineCache().CreateComputePipeline(vk_pipeline_create_info);
 }
 
 void ComputeState::Apply(Base::ComputeCommandList& compute_command_list)
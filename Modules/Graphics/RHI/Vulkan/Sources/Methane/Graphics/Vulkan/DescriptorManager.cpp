@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/Vulkan/DescriptorManager.cpp
-Vulkan descriptor manager with descriptor sets allocator.
+Vulkan descriptor manager with descriptor sets allocator,
+which recycles released descriptor sets per layout after GPU completion.
 
 ******************************************************************************/
 
@@ -30,6 +31,10 @@ Vulkan descriptor manager with descriptor sets allocator.
 #include <Methane/Graphics/RHI/ICommandKit.h>
 #include <Methane/Graphics/RHI/ICommandList.h>
 #include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 namespace Methane::Graphics::Vulkan
 {
@@ -44,38 +49,89 @@ void DescriptorManager::Release()
 {
     META_FUNCTION_TASK();
     Base::DescriptorManager::Release();
+    ReleaseAllSets();
+}
+
+void DescriptorManager::SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio)
+{
+    META_FUNCTION_TASK();
+    m_pool_size_ratio_by_desc_type[descriptor_type] = size_ratio;
+}
+
+void DescriptorManager::RegisterDescriptorSetLayout(vk::DescriptorSetLayout layout, const std::vector<vk::DescriptorSetLayoutBinding>& layout_bindings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(!!layout, "can not register empty descriptor set layout");
+    RegisterLayout(layout);
 
     std::scoped_lock lock_guard(m_descriptor_pool_mutex);
-    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
-    for(vk::DescriptorPool& vk_pool : m_vk_used_pools)
+    DescriptorSizes& descriptor_sizes = m_descriptor_sizes_by_layout[layout];
+    for(const vk::DescriptorSetLayoutBinding& layout_binding : layout_bindings)
     {
-        vk_device.resetDescriptorPool(vk_pool);
-        m_vk_free_pools.emplace_back(vk_pool);
+        const auto descriptor_size_it = std::ranges::find_if(descriptor_sizes,
+            [&layout_binding](const vk::DescriptorPoolSize& descriptor_size)
+            { return descriptor_size.type == layout_binding.descriptorType; });
+
+        if (descriptor_size_it == descriptor_sizes.end())
+            descriptor_sizes.emplace_back(layout_binding.descriptorType, layout_binding.descriptorCount);
+        else
+            descriptor_size_it->descriptorCount += layout_binding.descriptorCount;
     }
-    m_vk_used_pools.clear();
-    m_vk_current_pool = nullptr;
 }
 
-void DescriptorManager::SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio)
+void DescriptorManager::UnregisterDescriptorSetLayout(vk::DescriptorSetLayout layout)
 {
     META_FUNCTION_TASK();
-    m_pool_size_ratio_by_desc_type[descriptor_type] = size_ratio;
+    UnregisterLayout(layout);
+
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    m_descriptor_sizes_by_layout.erase(layout);
 }
 
 vk::DescriptorSet DescriptorManager::AllocDescriptorSet(vk::DescriptorSetLayout layout)
+{
+    META_FUNCTION_TASK();
+    return AllocDescriptorSets(layout, 1U).front();
+}
+
+std::vector<vk::DescriptorSet> DescriptorManager::AllocDescriptorSets(vk::DescriptorSetLayout layout, uint32_t sets_count)
+{
+    META_FUNCTION_TASK();
+    return AllocateSets(layout, sets_count);
+}
+
+void DescriptorManager::ReleaseDescriptorSet(vk::DescriptorSet descriptor_set)
+{
+    META_FUNCTION_TASK();
+    if (descriptor_set)
+        ReleaseSet(descriptor_set);
+}
+
+DescriptorManager::Statistics DescriptorManager::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    Statistics statistics{ DescriptorSetRecycler::GetStatistics() };
+
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    statistics.pools_count = static_cast<uint32_t>(m_vk_descriptor_pools.size());
+    return statistics;
+}
+
+void DescriptorManager::AllocateNativeSets(vk::DescriptorSetLayout layout, uint32_t sets_count, PooledSets& pooled_sets)
 {
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_descriptor_pool_mutex);
     if (!m_vk_current_pool)
-        m_vk_current_pool = AcquireDescriptorPool();
+        m_vk_current_pool = AcquireDescriptorPool(sets_count);
 
     const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    const std::vector<vk::DescriptorSetLayout> layouts(sets_count, layout);
+    std::vector<vk::DescriptorSet> new_descriptor_sets;
 
     try
     {
-        const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, 1, &layout));
-        if (!descriptor_sets.empty())
-            return descriptor_sets.back();
+        // All sets are allocated in one call to amortize the allocation cost
+        new_descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, layouts));
     }
     catch(const vk::OutOfPoolMemoryError&)
     {
@@ -88,40 +144,115 @@ vk::DescriptorSet DescriptorManager::AllocDescriptorSet(vk::DescriptorSetLayout
         META_LOG("Fragmented descriptor pool, reallocating.");
     }
 
-    // Reallocate descriptor set for the new pool
-    m_vk_current_pool = AcquireDescriptorPool();
-    const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, 1, &layout));
-    META_CHECK_NOT_EMPTY(descriptor_sets);
-    return descriptor_sets.back();
+    if (new_descriptor_sets.empty())
+    {
+        // Reallocate descriptor sets for the new pool
+        m_vk_current_pool = AcquireDescriptorPool(sets_count);
+        new_descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, layouts));
+    }
+    META_CHECK_EQUAL(new_descriptor_sets.size(), sets_count);
+
+    for(const vk::DescriptorSet& new_descriptor_set : new_descriptor_sets)
+    {
+        pooled_sets.push_back({ new_descriptor_set, m_vk_current_pool });
+    }
+    AddUsedDescriptors(layout, sets_count);
+}
+
+void DescriptorManager::FreeNativeSets(const PooledSets& pooled_sets)
+{
+    META_FUNCTION_TASK();
+    std::map<vk::DescriptorPool, std::vector<vk::DescriptorSet>> sets_by_pool;
+    for(const PooledSet& pooled_set : pooled_sets)
+    {
+        sets_by_pool[pooled_set.pool].emplace_back(pooled_set.set);
+    }
+
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    for(const auto& [vk_pool, vk_sets] : sets_by_pool)
+    {
+        vk_device.freeDescriptorSets(vk_pool, vk_sets);
+    }
+}
+
+void DescriptorManager::ResetNativePools()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    for(vk::DescriptorPool& vk_pool : m_vk_used_pools)
+    {
+        vk_device.resetDescriptorPool(vk_pool);
+        m_vk_free_pools.emplace_back(vk_pool);
+    }
+    m_vk_used_pools.clear();
+    m_vk_current_pool = nullptr;
+}
+
+void DescriptorManager::AddUsedDescriptors(vk::DescriptorSetLayout layout, uint32_t sets_count)
+{
+    META_FUNCTION_TASK();
+    const auto descriptor_sizes_it = m_descriptor_sizes_by_layout.find(layout);
+    if (descriptor_sizes_it == m_descriptor_sizes_by_layout.end())
+        return;
+
+    for(const vk::DescriptorPoolSize& descriptor_size : descriptor_sizes_it->second)
+    {
+        m_used_descriptors_count_by_type[descriptor_size.type] += static_cast<uint64_t>(descriptor_size.descriptorCount) * sets_count;
+    }
+    m_used_sets_count += sets_count;
 }
 
-vk::DescriptorPool DescriptorManager::CreateDescriptorPool()
+vk::DescriptorPool DescriptorManager::CreateDescriptorPool(uint32_t min_sets_count)
 {
     META_FUNCTION_TASK();
+
+    // Pool grows with the number of live descriptor sets, so that each new pool at least doubles the total capacity
+    const uint32_t pool_sets_count = std::max({ m_pool_sets_count, min_sets_count, GetLiveSetsCount() });
+
+    // Descriptor type ratios are taken from the observed usage by allocated sets, falling back to the configured ratios
+    PoolSizeRatioByDescType pool_size_ratio_by_desc_type = m_pool_size_ratio_by_desc_type;
+    if (m_used_sets_count)
+    {
+        for(const auto& [desc_type, used_descriptors_count] : m_used_descriptors_count_by_type)
+        {
+            pool_size_ratio_by_desc_type[desc_type] = static_cast<float>(used_descriptors_count) / static_cast<float>(m_used_sets_count);
+        }
+    }
+
     std::vector<vk::DescriptorPoolSize> pool_sizes;
-    pool_sizes.reserve(m_pool_size_ratio_by_desc_type.size());
-    for (const auto& [desc_type, size_ratio] : m_pool_size_ratio_by_desc_type)
+    pool_sizes.reserve(pool_size_ratio_by_desc_type.size());
+    for (const auto& [desc_type, size_ratio] : pool_size_ratio_by_desc_type)
     {
-        pool_sizes.emplace_back(desc_type, static_cast<uint32_t>(static_cast<float>(m_pool_sets_count) * size_ratio));
+        const auto descriptors_count = static_cast<uint32_t>(std::ceil(static_cast<float>(pool_sets_count) * size_ratio));
+        pool_sizes.emplace_back(desc_type, std::max(descriptors_count, 1U));
     }
+
+    META_LOG("Create descriptor pool for {} descriptor sets", pool_sets_count);
     const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
-    m_vk_descriptor_pools.emplace_back(vk_device.createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo({}, m_pool_sets_count, pool_sizes)));
+    m_vk_descriptor_pools.emplace_back(vk_device.createDescriptorPoolUnique(
+        vk::DescriptorPoolCreateInfo(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet, pool_sets_count, pool_sizes)));
     return m_vk_descriptor_pools.back().get();
 }
 
-vk::DescriptorPool DescriptorManager::AcquireDescriptorPool()
+vk::DescriptorPool DescriptorManager::AcquireDescriptorPool(uint32_t min_sets_count)
 {
     META_FUNCTION_TASK();
+    vk::DescriptorPool vk_pool;
     if (m_vk_free_pools.empty())
     {
-        vk::DescriptorPool new_pool = CreateDescriptorPool();
-        m_vk_used_pools.emplace_back(new_pool);
-        return new_pool;
+        vk_pool = CreateDescriptorPool(min_sets_count);
+    }
+    else
+    {
+        vk_pool = m_vk_free_pools.back();
+        m_vk_free_pools.pop_back();
     }
 
-    vk::DescriptorPool free_pool = m_vk_free_pools.back();
-    m_vk_free_pools.pop_back();
-    return free_pool;
+    // Acquired pool is reset on release with all other used pools
+    m_vk_used_pools.emplace_back(vk_pool);
+    return vk_pool;
 }
 
 const IContext& DescriptorManager::GetContextVk()
@@ -152,6 +152,35 @@ static std::vector<std::string> GetDeviceSupportedExtensionNames(const vk::Physi
     return supported_extensions;
 }
 
+static Rhi::DeviceDynamicStateMask GetDeviceDynamicStates(bool is_extended_dynamic_state_supported)
+{
+    META_FUNCTION_TASK();
+    using enum Rhi::DeviceDynamicState;
+
+    // Viewports and scissor rects are dynamic in Vulkan core, while their count and other states require extended dynamic state
+    if (!is_extended_dynamic_state_supported)
+        return Rhi::DeviceDynamicStateMask{ Viewports };
+
+    return Rhi::DeviceDynamicStateMask{ Viewports, ViewportsCount, PrimitiveTopology, CullMode, DepthTest, StencilTest };
+}
+
+static bool IsDescriptorIndexingSupportedByDevice(const vk::PhysicalDevice& vk_physical_device, bool is_descriptor_indexing_extension_supported)
+{
+    META_FUNCTION_TASK();
+    if (!is_descriptor_indexing_extension_supported)
+        return false;
+
+    // Bindless descriptor arrays are partially bound and updated after bind, while previously recorded command lists are pending
+    const auto vk_features_chain = vk_physical_device.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDescriptorIndexingFeaturesEXT>();
+    const auto& vk_indexing_features = vk_features_chain.get<vk::PhysicalDeviceDescriptorIndexingFeaturesEXT>();
+    return vk_indexing_features.runtimeDescriptorArray &&
+           vk_indexing_features.descriptorBindingPartiallyBound &&
+           vk_indexing_features.descriptorBindingSampledImageUpdateAfterBind &&
+           vk_indexing_features.descriptorBindingStorageBufferUpdateAfterBind &&
+           vk_indexing_features.descriptorBindingUpdateUnusedWhilePending &&
+           vk_indexing_features.shaderSampledImageArrayNonUniformIndexing;
+}
+
 QueueFamilyReservation::QueueFamilyReservation(uint32_t family_index, vk::QueueFlags queue_flags, uint32_t queues_count, bool can_present_to_window)
     : m_family_index(family_index)
     , m_queue_flags(queue_flags)
@@ -213,7 +242,13 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     , m_supported_extension_names_storage(GetDeviceSupportedExtensionNames(vk_physical_device))
     , m_supported_extension_names_set(m_supported_extension_names_storage.begin(), m_supported_extension_names_storage.end())
     , m_is_dynamic_state_supported(IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+    , m_is_pipeline_creation_feedback_supported(IsExtensionSupported(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME))
+    , m_is_descriptor_indexing_supported(IsDescriptorIndexingSupportedByDevice(vk_physical_device, IsExtensionSupported(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME)))
+    , m_is_multi_draw_indirect_supported(vk_physical_device.getFeatures().multiDrawIndirect)
+    , m_is_draw_indirect_count_supported(IsExtensionSupported(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME))
+    , m_dynamic_states(GetDeviceDynamicStates(m_is_dynamic_state_supported))
     , m_vk_queue_family_properties(vk_physical_device.getQueueFamilyProperties())
+    , m_memory_allocator(*this)
 {
     META_FUNCTION_TASK();
     if (const Rhi::DeviceFeatureMask device_supported_features = GetSupportedFeatures();
@@ -251,6 +286,27 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
         }
     }
 
+    if (m_is_pipeline_creation_feedback_supported)
+    {
+        enabled_extension_names.emplace_back(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+    }
+
+    if (m_is_descriptor_indexing_supported)
+    {
+        enabled_extension_names.emplace_back(VK_KHR_MAINTENANCE3_EXTENSION_NAME);
+        enabled_extension_names.emplace_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+    }
+
+    if (m_is_draw_indirect_count_supported)
+    {
+        enabled_extension_names.emplace_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    }
+
+    if (IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+    {
+        enabled_extension_names.emplace_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+
     if (IsExtensionSupported(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME))
     {
         enabled_extension_names.emplace_back(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME);
@@ -264,11 +320,20 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     vk::PhysicalDeviceFeatures vk_device_features;
     vk_device_features.samplerAnisotropy = capabilities.features.HasBit(Rhi::DeviceFeature::AnisotropicFiltering);
     vk_device_features.imageCubeArray    = capabilities.features.HasBit(Rhi::DeviceFeature::ImageCubeArray);
+    vk_device_features.multiDrawIndirect = m_is_multi_draw_indirect_supported;
 
     // Add descriptions of enabled device features:
     vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT vk_device_dynamic_state_feature(m_is_dynamic_state_supported);
     vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR    vk_device_timeline_semaphores_feature(true);
     vk::PhysicalDeviceHostQueryResetFeatures          vk_device_host_query_reset_feature(true);
+    vk::PhysicalDeviceDescriptorIndexingFeaturesEXT   vk_device_descriptor_indexing_feature;
+    vk_device_descriptor_indexing_feature
+        .setRuntimeDescriptorArray(m_is_descriptor_indexing_supported)
+        .setDescriptorBindingPartiallyBound(m_is_descriptor_indexing_supported)
+        .setDescriptorBindingSampledImageUpdateAfterBind(m_is_descriptor_indexing_supported)
+        .setDescriptorBindingStorageBufferUpdateAfterBind(m_is_descriptor_indexing_supported)
+        .setDescriptorBindingUpdateUnusedWhilePending(m_is_descriptor_indexing_supported)
+        .setShaderSampledImageArrayNonUniformIndexing(m_is_descriptor_indexing_supported);
     vk::DeviceCreateInfo vk_device_info(
         vk::DeviceCreateFlags{},
         vk_queue_create_infos,
@@ -279,6 +344,10 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     vk_device_info.setPNext(&vk_device_dynamic_state_feature);
     vk_device_dynamic_state_feature.setPNext(&vk_device_timeline_semaphores_feature);
     vk_device_timeline_semaphores_feature.setPNext(&vk_device_host_query_reset_feature);
+    if (m_is_descriptor_indexing_supported)
+    {
+        vk_device_host_query_reset_feature.setPNext(&vk_device_descriptor_indexing_feature);
+    }
 
     m_vk_unique_device = vk_physical_device.createDeviceUnique(vk_device_info);
     VULKAN_HPP_DEFAULT_DISPATCHER.init(m_vk_unique_device.get());
@@ -300,6 +369,23 @@ Ptr<Rhi::IComputeContext> Device::CreateComputeContext(tf::Executor& parallel_ex
     return compute_context_ptr;
 }
 
+Rhi::DeviceMemoryStatistics Device::GetMemoryStatistics() const noexcept
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        MemoryStatistics memory_statistics = m_memory_allocator.GetStatistics();
+        memory_statistics.budget_size = m_memory_allocator.GetBudgetSize();
+        return memory_statistics;
+    }
+    catch (const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Failed to get device memory statistics: {}", e.what());
+        return {};
+    }
+}
+
 bool Device::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
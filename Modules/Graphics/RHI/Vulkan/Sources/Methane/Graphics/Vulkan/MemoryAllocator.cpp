@@ -0,0 +1,209 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.cpp
+Vulkan device memory allocator with resource memory sub-allocated from memory blocks
+of the same memory type and persistently mapped host-visible memory blocks.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/MemoryAllocator.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <utility>
+#include <cassert>
+
+namespace Methane::Graphics::Vulkan
+{
+
+// Images and buffers are sub-allocated from different memory blocks of the same memory type,
+// so that their memory ranges never violate buffer-image granularity of the device
+static Data::Index GetMemoryPoolIndex(uint32_t memory_type_index, bool is_image_memory) noexcept
+{
+    return memory_type_index * 2U + (is_image_memory ? 1U : 0U);
+}
+
+static uint32_t GetMemoryTypeIndex(Data::Index pool_index) noexcept
+{
+    return pool_index / 2U;
+}
+
+MemoryAllocation::MemoryAllocation(MemoryAllocator& allocator, const Base::DeviceMemoryAllocation& allocation, const vk::DeviceMemory& vk_device_memory) noexcept
+    : m_allocator_ptr(&allocator)
+    , m_allocation(allocation)
+    , m_vk_device_memory(vk_device_memory)
+{ }
+
+MemoryAllocation::~MemoryAllocation()
+{
+    Release();
+}
+
+MemoryAllocation::MemoryAllocation(MemoryAllocation&& other) noexcept
+    : m_allocator_ptr(std::exchange(other.m_allocator_ptr, nullptr))
+    , m_allocation(std::exchange(other.m_allocation, {}))
+    , m_vk_device_memory(std::exchange(other.m_vk_device_memory, {}))
+{ }
+
+MemoryAllocation& MemoryAllocation::operator=(MemoryAllocation&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    Release();
+    m_allocator_ptr    = std::exchange(other.m_allocator_ptr, nullptr);
+    m_allocation       = std::exchange(other.m_allocation, {});
+    m_vk_device_memory = std::exchange(other.m_vk_device_memory, {});
+    return *this;
+}
+
+Data::RawPtr MemoryAllocation::GetMappedDataPtr() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL_DESCR(m_allocator_ptr, "can not map uninitialized memory allocation");
+    return m_allocator_ptr->GetMappedDataPtr(m_allocation);
+}
+
+void MemoryAllocation::Release() noexcept
+{
+    if (!m_allocator_ptr)
+        return;
+
+    try
+    {
+        m_allocator_ptr->Free(m_allocation);
+    }
+    catch (const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during device memory release: {}", e.what());
+        assert(false);
+    }
+
+    m_allocator_ptr    = nullptr;
+    m_allocation       = {};
+    m_vk_device_memory = vk::DeviceMemory();
+}
+
+MemoryAllocator::MemoryAllocator(const Device& device, const Settings& settings)
+    : Base::DeviceMemoryAllocator(settings)
+    , m_device(device)
+    , m_is_memory_budget_supported(device.IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+{ }
+
+MemoryAllocation MemoryAllocator::Allocate(const vk::MemoryRequirements& vk_memory_requirements,
+                                           vk::MemoryPropertyFlags vk_memory_property_flags,
+                                           bool is_image_memory)
+{
+    META_FUNCTION_TASK();
+    const Opt<uint32_t> memory_type_opt = m_device.FindMemoryType(vk_memory_requirements.memoryTypeBits, vk_memory_property_flags);
+    if (!memory_type_opt)
+        return {};
+
+    const Allocation allocation = Base::DeviceMemoryAllocator::Allocate(GetMemoryPoolIndex(*memory_type_opt, is_image_memory),
+                                                                        vk_memory_requirements.size, vk_memory_requirements.alignment);
+    if (!allocation.IsInitialized())
+        return {};
+
+    std::lock_guard lock(m_memory_blocks_mutex);
+    return MemoryAllocation(*this, allocation, m_memory_blocks[allocation.block_index].vk_unique_memory.get());
+}
+
+Data::RawPtr MemoryAllocator::GetMappedDataPtr(const Allocation& allocation)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_memory_blocks_mutex);
+    META_CHECK_LESS(allocation.block_index, m_memory_blocks.size());
+    MemoryBlock& memory_block = m_memory_blocks[allocation.block_index];
+    if (!memory_block.mapped_data_ptr)
+    {
+        // Device memory can not be mapped twice, so the whole memory block is mapped once and unmapped on release
+        const vk::Result vk_map_result = m_device.GetNativeDevice().mapMemory(memory_block.vk_unique_memory.get(), 0U, VK_WHOLE_SIZE, vk::MemoryMapFlags{},
+                                                                              reinterpret_cast<void**>(&memory_block.mapped_data_ptr)); // NOSONAR
+        META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map device memory block persistently");
+        META_CHECK_NOT_NULL_DESCR(memory_block.mapped_data_ptr, "failed to map device memory block persistently");
+    }
+    return memory_block.mapped_data_ptr + allocation.offset;
+}
+
+uint64_t MemoryAllocator::GetBudgetSize() const
+{
+    META_FUNCTION_TASK();
+    const vk::PhysicalDevice& vk_physical_device = m_device.GetNativePhysicalDevice();
+    uint64_t budget_size = 0U;
+    if (m_is_memory_budget_supported)
+    {
+        const auto vk_memory_props_chain = vk_physical_device.getMemoryProperties2<vk::PhysicalDeviceMemoryProperties2,
+                                                                                   vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+        const vk::PhysicalDeviceMemoryProperties& vk_memory_props = vk_memory_props_chain.get<vk::PhysicalDeviceMemoryProperties2>().memoryProperties;
+        const auto& vk_memory_budget_props = vk_memory_props_chain.get<vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+        for(uint32_t heap_index = 0U; heap_index < vk_memory_props.memoryHeapCount; ++heap_index)
+        {
+            if (vk_memory_props.memoryHeaps[heap_index].flags & vk::MemoryHeapFlagBits::eDeviceLocal)
+                budget_size += vk_memory_budget_props.heapBudget[heap_index];
+        }
+        return budget_size;
+    }
+
+    // Without memory budget extension, the whole size of device local heaps is available to the application
+    const vk::PhysicalDeviceMemoryProperties vk_memory_props = vk_physical_device.getMemoryProperties();
+    for(uint32_t heap_index = 0U; heap_index < vk_memory_props.memoryHeapCount; ++heap_index)
+    {
+        if (vk_memory_props.memoryHeaps[heap_index].flags & vk::MemoryHeapFlagBits::eDeviceLocal)
+            budget_size += vk_memory_props.memoryHeaps[heap_index].size;
+    }
+    return budget_size;
+}
+
+bool MemoryAllocator::AllocateMemoryBlock(Data::Index pool_index, Data::Index block_index, uint64_t size)
+{
+    META_FUNCTION_TASK();
+    vk::UniqueDeviceMemory vk_unique_memory;
+    try
+    {
+        vk_unique_memory = m_device.GetNativeDevice().allocateMemoryUnique(vk::MemoryAllocateInfo(size, GetMemoryTypeIndex(pool_index)));
+    }
+    catch(const vk::SystemError& error)
+    {
+        META_UNUSED(error);
+        META_LOG("WARNING: Failed to allocate device memory block of {} bytes: {}", size, error.what());
+        return false;
+    }
+
+    std::lock_guard lock(m_memory_blocks_mutex);
+    if (block_index >= m_memory_blocks.size())
+        m_memory_blocks.resize(block_index + 1U);
+
+    m_memory_blocks[block_index] = MemoryBlock{ std::move(vk_unique_memory), nullptr };
+    return true;
+}
+
+void MemoryAllocator::FreeMemoryBlock(Data::Index block_index)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_memory_blocks_mutex);
+    META_CHECK_LESS(block_index, m_memory_blocks.size());
+
+    // Mapped memory is implicitly unmapped when memory is freed
+    m_memory_blocks[block_index] = MemoryBlock{};
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -85,26 +85,20 @@ void ParallelRenderCommandList::SetEndingResourceBarriers(const Rhi::IResourceBa
     m_ending_command_list.SetResourceBarriers(resource_barriers);
 }
 
-void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count)
-{
-    META_FUNCTION_TASK();
-    Base::ParallelRenderCommandList::SetParallelCommandListsCount(count);
-    UpdateParallelCommandBuffers();
-}
-
 void ParallelRenderCommandList::UpdateParallelCommandBuffers()
 {
     META_FUNCTION_TASK();
     m_vk_parallel_sync_cmd_buffers.clear();
     m_vk_parallel_pass_cmd_buffers.clear();
 
-    const Refs<Rhi::IRenderCommandList>& parallel_cmd_list_refs = GetParallelCommandLists();
-    m_vk_parallel_sync_cmd_buffers.reserve(parallel_cmd_list_refs.size());
-    m_vk_parallel_pass_cmd_buffers.reserve(parallel_cmd_list_refs.size());
+    // Only committed command lists are executed, while idle command lists are left in encoding state
+    const Ptrs<Base::RenderCommandList>& committed_cmd_list_ptrs = GetCommittedParallelCommandLists();
+    m_vk_parallel_sync_cmd_buffers.reserve(committed_cmd_list_ptrs.size());
+    m_vk_parallel_pass_cmd_buffers.reserve(committed_cmd_list_ptrs.size());
 
-    for(const Ref<Rhi::IRenderCommandList>& parallel_cmd_list_ref : parallel_cmd_list_refs)
+    for(const Ptr<Base::RenderCommandList>& committed_cmd_list_ptr : committed_cmd_list_ptrs)
     {
-        const auto& parallel_cmd_list_vk = static_cast<const RenderCommandList&>(parallel_cmd_list_ref.get());
+        const auto& parallel_cmd_list_vk = static_cast<const RenderCommandList&>(*committed_cmd_list_ptr);
         m_vk_parallel_sync_cmd_buffers.emplace_back(parallel_cmd_list_vk.GetNativeCommandBuffer(Vulkan::CommandBufferType::Primary));
         m_vk_parallel_pass_cmd_buffers.emplace_back(parallel_cmd_list_vk.GetNativeCommandBuffer(Vulkan::CommandBufferType::SecondaryRenderPass));
     }
@@ -115,14 +109,17 @@ void ParallelRenderCommandList::Commit()
     META_FUNCTION_TASK();
     META_CHECK_FALSE(IsCommitted());
     Base::ParallelRenderCommandList::Commit();
+    UpdateParallelCommandBuffers();
 
     const vk::CommandBuffer& vk_beginning_primary_cmd_buffer = m_beginning_command_list.GetNativeCommandBuffer(CommandBufferType::Primary);
-    vk_beginning_primary_cmd_buffer.executeCommands(m_vk_parallel_sync_cmd_buffers);
+    if (!m_vk_parallel_sync_cmd_buffers.empty())
+        vk_beginning_primary_cmd_buffer.executeCommands(m_vk_parallel_sync_cmd_buffers);
 
     RenderPass& render_pass = GetVulkanRenderPass();
     render_pass.Begin(m_beginning_command_list);
 
-    vk_beginning_primary_cmd_buffer.executeCommands(m_vk_parallel_pass_cmd_buffers);
+    if (!m_vk_parallel_pass_cmd_buffers.empty())
+        vk_beginning_primary_cmd_buffer.executeCommands(m_vk_parallel_pass_cmd_buffers);
 
     render_pass.End(m_beginning_command_list);
 
@@ -186,7 +183,11 @@ void ParallelRenderCommandList::OnRenderPassUpdated(const Rhi::IRenderPass& rend
         static_cast<RenderCommandList&>(parallel_cmd_list_ref.get()).OnRenderPassUpdated(render_pass);
     }
 
-    UpdateParallelCommandBuffers();
+    // Reserved command lists keep their command buffers for reuse, so inheritance info of these buffers is updated too
+    for(const Ptr<Base::RenderCommandList>& reserved_cmd_list_ptr : GetReservedParallelCommandLists())
+    {
+        static_cast<RenderCommandList&>(*reserved_cmd_list_ptr).OnRenderPassUpdated(render_pass);
+    }
 }
 
 } // namespace Methane::Graphics::Vulkan
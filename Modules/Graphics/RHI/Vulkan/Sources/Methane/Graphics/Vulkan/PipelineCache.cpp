@@ -0,0 +1,169 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PipelineCache.cpp
+Vulkan pipeline cache used for creation of all context pipelines,
+which is loaded from file on context initialization and saved on release.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/PipelineCache.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+
+#include <Methane/Platform/Utils.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace Methane::Graphics::Vulkan
+{
+
+static Base::PipelineCacheDeviceKey GetPipelineCacheDeviceKey(const vk::PhysicalDevice& vk_physical_device)
+{
+    META_FUNCTION_TASK();
+    const vk::PhysicalDeviceProperties vk_device_props = vk_physical_device.getProperties();
+    Base::PipelineCacheDeviceKey device_key{
+        vk_device_props.vendorID,
+        vk_device_props.deviceID,
+        vk_device_props.driverVersion
+    };
+    std::ranges::copy(vk_device_props.pipelineCacheUUID, device_key.cache_uuid.begin());
+    return device_key;
+}
+
+std::string PipelineCache::GetDefaultFilePath(const Device& device)
+{
+    META_FUNCTION_TASK();
+    const vk::PhysicalDeviceProperties vk_device_props = device.GetNativePhysicalDevice().getProperties();
+    return fmt::format("{}/VulkanPipelineCache_{:04x}_{:04x}.bin",
+                       Methane::Platform::GetExecutableDir(), vk_device_props.vendorID, vk_device_props.deviceID);
+}
+
+PipelineCache::PipelineCache(const Device& device)
+    : PipelineCache(device, GetDefaultFilePath(device))
+{ }
+
+PipelineCache::PipelineCache(const Device& device, const std::string& file_path)
+    : m_device(device)
+    , m_file(file_path, GetPipelineCacheDeviceKey(device.GetNativePhysicalDevice()))
+{
+    META_FUNCTION_TASK();
+    const Data::Bytes cache_data = m_file.Load();
+    try
+    {
+        m_vk_unique_pipeline_cache = device.GetNativeDevice().createPipelineCacheUnique(
+            vk::PipelineCacheCreateInfo(vk::PipelineCacheCreateFlags{}, cache_data.size(), cache_data.data()));
+        m_loaded_data_size = static_cast<Data::Size>(cache_data.size());
+    }
+    catch(const vk::SystemError& error)
+    {
+        // Driver may reject loaded cache data, in this case empty pipeline cache is created
+        META_UNUSED(error);
+        META_LOG("WARNING: Failed to load Vulkan pipeline cache from file '{}': {}", m_file.GetFilePath(), error.what());
+        m_vk_unique_pipeline_cache = device.GetNativeDevice().createPipelineCacheUnique(vk::PipelineCacheCreateInfo());
+    }
+}
+
+vk::UniquePipeline PipelineCache::CreateGraphicsPipeline(const vk::GraphicsPipelineCreateInfo& vk_pipeline_create_info)
+{
+    META_FUNCTION_TASK();
+    return CreatePipeline(vk_pipeline_create_info, vk_pipeline_create_info.stageCount);
+}
+
+vk::UniquePipeline PipelineCache::CreateComputePipeline(const vk::ComputePipelineCreateInfo& vk_pipeline_create_info)
+{
+    META_FUNCTION_TASK();
+    return CreatePipeline(vk_pipeline_create_info, 1U);
+}
+
+bool PipelineCache::Save() const
+{
+    META_FUNCTION_TASK();
+    const std::vector<uint8_t> vk_cache_data = m_device.GetNativeDevice().getPipelineCacheData(m_vk_unique_pipeline_cache.get());
+    const auto cache_data_ptr = reinterpret_cast<const std::byte*>(vk_cache_data.data()); // NOSONAR
+    if (m_file.Save(Data::Bytes(cache_data_ptr, cache_data_ptr + vk_cache_data.size())))
+        return true;
+
+    META_LOG("WARNING: Failed to save Vulkan pipeline cache to file '{}'", m_file.GetFilePath());
+    return false;
+}
+
+void PipelineCache::CompleteFrame() noexcept
+{
+    META_FUNCTION_TASK();
+    m_frame_pipelines_created = m_frame_pipelines_creating.exchange(0U);
+}
+
+PipelineCache::Statistics PipelineCache::GetStatistics() const noexcept
+{
+    META_FUNCTION_TASK();
+    return Statistics{
+        m_loaded_data_size,
+        m_pipelines_created.load(),
+        m_frame_pipelines_created.load(),
+        m_cache_hits_count.load(),
+        m_cache_misses_count.load()
+    };
+}
+
+template<typename PipelineCreateInfoType>
+vk::UniquePipeline PipelineCache::CreatePipeline(PipelineCreateInfoType vk_pipeline_create_info, uint32_t stages_count)
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = m_device.GetNativeDevice();
+
+    // Pipeline creation feedback is chained to the create info to get cache hit status reported by the driver
+    vk::PipelineCreationFeedbackEXT vk_feedback;
+    std::vector<vk::PipelineCreationFeedbackEXT> vk_stage_feedbacks(stages_count);
+    vk::PipelineCreationFeedbackCreateInfoEXT vk_feedback_info(&vk_feedback, vk_stage_feedbacks);
+    if (m_device.IsPipelineCreationFeedbackSupported())
+    {
+        vk_feedback_info.setPNext(vk_pipeline_create_info.pNext);
+        vk_pipeline_create_info.setPNext(&vk_feedback_info);
+    }
+
+    vk::ResultValue<vk::UniquePipeline> pipe(vk::Result::eIncomplete, vk::UniquePipeline());
+    if constexpr (std::is_same_v<PipelineCreateInfoType, vk::GraphicsPipelineCreateInfo>)
+        pipe = vk_device.createGraphicsPipelineUnique(m_vk_unique_pipeline_cache.get(), vk_pipeline_create_info);
+    else
+        pipe = vk_device.createComputePipelineUnique(m_vk_unique_pipeline_cache.get(), vk_pipeline_create_info);
+    META_CHECK_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
+
+    m_pipelines_created++;
+    m_frame_pipelines_creating++;
+    AddCreationFeedback(vk_feedback);
+    return std::move(pipe.value);
+}
+
+void PipelineCache::AddCreationFeedback(const vk::PipelineCreationFeedbackEXT& vk_feedback) noexcept
+{
+    if (!(vk_feedback.flags & vk::PipelineCreationFeedbackFlagBitsEXT::eValid))
+        return;
+
+    if (vk_feedback.flags & vk::PipelineCreationFeedbackFlagBitsEXT::eApplicationPipelineCacheHit)
+        m_cache_hits_count++;
+    else
+        m_cache_misses_count++;
+}
+
+} // namespace Methane::Graphics::Vulkan
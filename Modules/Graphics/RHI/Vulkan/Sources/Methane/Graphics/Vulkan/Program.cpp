@@ -29,6 +29,7 @@ Vulkan implementation of the program interface.
 #include <Methane/Graphics/Vulkan/Utils.hpp>
 #include <Methane/Graphics/Vulkan/ProgramBindings.h>
 #include <Methane/Graphics/Vulkan/DescriptorManager.h>
+#include <Methane/Graphics/Vulkan/BindlessDescriptorSet.h>
 
 #include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/RenderContext.h>
@@ -36,6 +37,7 @@ Vulkan implementation of the program interface.
 
 #include <magic_enum/magic_enum.hpp>
 #include <sstream>
+#include <cassert>
 
 namespace Methane::Graphics::Vulkan
 {
@@ -49,6 +51,34 @@ Program::Program(Base::Context& context, const Settings& settings)
     InitializeDescriptorSetLayouts();
 }
 
+Program::~Program()
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        // Released descriptor sets are recycled by descriptor manager after GPU completes frames in flight
+        DescriptorManager& descriptor_manager = GetVulkanContext().GetVulkanDescriptorManager();
+        if (m_vk_constant_descriptor_set_opt.has_value())
+            descriptor_manager.ReleaseDescriptorSet(m_vk_constant_descriptor_set_opt.value());
+
+        for(const vk::DescriptorSet& vk_frame_constant_descriptor_set : m_vk_frame_constant_descriptor_sets)
+        {
+            descriptor_manager.ReleaseDescriptorSet(vk_frame_constant_descriptor_set);
+        }
+
+        for(const vk::UniqueDescriptorSetLayout& vk_unique_descriptor_set_layout : m_vk_unique_descriptor_set_layouts)
+        {
+            descriptor_manager.UnregisterDescriptorSetLayout(vk_unique_descriptor_set_layout.get());
+        }
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during Vulkan program destruction: {}", e.what());
+        assert(false);
+    }
+}
+
 Ptr<Rhi::IProgramBindings> Program::CreateBindings(const BindingValueByArgument& binding_value_by_argument, Data::Index frame_index)
 {
     META_FUNCTION_TASK();
@@ -183,11 +213,8 @@ const vk::DescriptorSet& Program::AcquireFrameConstantDescriptorSet(Data::Index
     if (!layout)
         return m_vk_frame_constant_descriptor_sets.at(frame_index);
 
-    DescriptorManager& descriptor_manager = GetVulkanContext().GetVulkanDescriptorManager();
-    for(vk::DescriptorSet& frame_descriptor_set : m_vk_frame_constant_descriptor_sets)
-    {
-        frame_descriptor_set = descriptor_manager.AllocDescriptorSet(layout);
-    }
+    // Descriptor sets of all frames are allocated with one call
+    m_vk_frame_constant_descriptor_sets = GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSets(layout, static_cast<uint32_t>(frames_count));
 
     UpdateFrameConstantDescriptorSetNames();
     return m_vk_frame_constant_descriptor_sets.at(frame_index);
@@ -206,7 +233,8 @@ void Program::InitializeDescriptorSetLayouts()
         const size_t accessor_type_index = magic_enum::enum_index(vulkan_binding_settings.argument.GetAccessorType()).value();
 
         DescriptorSetLayoutInfo& layout_info = m_descriptor_set_layout_info_by_access_type[accessor_type_index];
-        if (vulkan_binding_settings.argument.IsRootConstantValue())
+        if (vulkan_binding_settings.argument.IsRootConstantValue() ||
+            vulkan_binding_settings.argument.IsBindlessIndex())
         {
             vulkan_argument_binding.SetPushConstantsOffset(push_constants_offset);
             m_vk_push_constant_ranges.emplace_back(
@@ -237,6 +265,7 @@ void Program::InitializeDescriptorSetLayouts()
 
     const vk::Device& vk_device = GetVulkanContext().GetVulkanDevice().GetNativeDevice();
 
+    DescriptorManager& descriptor_manager = GetVulkanContext().GetVulkanDescriptorManager();
     m_vk_unique_descriptor_set_layouts.clear();
     for(DescriptorSetLayoutInfo& layout_info : m_descriptor_set_layout_info_by_access_type)
     {
@@ -274,15 +303,60 @@ void Program::InitializeDescriptorSetLayouts()
             vk_device.createDescriptorSetLayoutUnique(
                 vk::DescriptorSetLayoutCreateInfo({}, layout_info.bindings)
             ));
+        descriptor_manager.RegisterDescriptorSetLayout(m_vk_unique_descriptor_set_layouts.back().get(), layout_info.bindings);
     }
 
     META_LOG("{}", log_ss.str());
 
     m_vk_descriptor_set_layouts = vk::uniqueToRaw(m_vk_unique_descriptor_set_layouts);
 
+    InitializeBindlessDescriptorSetLayout();
     UpdateDescriptorSetLayoutNames();
 }
 
+void Program::InitializeBindlessDescriptorSetLayout()
+{
+    META_FUNCTION_TASK();
+    std::vector<std::pair<Shader*, Shader::BindlessByteCodeMaps>> bindless_byte_code_maps_by_shader;
+    for(Rhi::ShaderType shader_type : GetShaderTypes())
+    {
+        Shader& shader = GetVulkanShader(shader_type);
+        if (Shader::BindlessByteCodeMaps bindless_byte_code_maps = shader.GetBindlessByteCodeMaps();
+            !bindless_byte_code_maps.empty())
+        {
+            bindless_byte_code_maps_by_shader.emplace_back(&shader, std::move(bindless_byte_code_maps));
+        }
+    }
+
+    m_bindless_descriptor_set_index_opt.reset();
+    m_vk_bindless_descriptor_set = vk::DescriptorSet();
+    if (bindless_byte_code_maps_by_shader.empty())
+        return;
+
+    const Ptr<BindlessDescriptorSet> bindless_descriptor_set_ptr = GetVulkanContext().GetVulkanBindlessDescriptorSetPtr();
+    META_CHECK_NOT_NULL_DESCR(bindless_descriptor_set_ptr, "program '{}' uses bindless descriptor arrays, which are not supported by device",
+                              GetName());
+
+    // Bindless descriptor set is bound after all argument descriptor sets, so it does not change their indices
+    const auto bindless_set_index = static_cast<uint32_t>(m_vk_descriptor_set_layouts.size());
+    m_bindless_descriptor_set_index_opt = bindless_set_index;
+    m_vk_bindless_descriptor_set = bindless_descriptor_set_ptr->GetNativeDescriptorSet();
+    m_vk_descriptor_set_layouts.emplace_back(bindless_descriptor_set_ptr->GetNativeDescriptorSetLayout());
+
+    // Patch shaders SPIRV byte code with descriptor set and binding decorations of the global descriptor arrays
+    for(const auto& [shader_ptr, bindless_byte_code_maps] : bindless_byte_code_maps_by_shader)
+    {
+        Data::MutableChunk& spirv_shader_bytecode = shader_ptr->GetMutableByteCode();
+        for(const Shader::BindlessByteCodeMap& byte_code_map : bindless_byte_code_maps)
+        {
+            spirv_shader_bytecode.PatchData(byte_code_map.descriptor_set_offset, bindless_set_index);
+            spirv_shader_bytecode.PatchData(byte_code_map.binding_offset, BindlessDescriptorSet::GetBinding(byte_code_map.resource_type));
+        }
+    }
+
+    META_LOG("Program '{}' with bindless descriptor set layout {}", GetName(), bindless_set_index);
+}
+
 void Program::UpdatePipelineName()
 {
     if (!m_vk_unique_pipeline_layout)
@@ -303,11 +377,12 @@ void Program::UpdateDescriptorSetLayoutNames() const
     if (program_name.empty())
         return;
 
+    // Bindless descriptor set layout is shared by all programs of the context, so it is not named by program
     size_t layout_index = 0u;
-    for (const vk::DescriptorSetLayout& descriptor_set_layout : m_vk_descriptor_set_layouts)
+    for (const vk::UniqueDescriptorSetLayout& descriptor_set_layout : m_vk_unique_descriptor_set_layouts)
     {
         Rhi::ProgramArgumentAccessType access_type = magic_enum::enum_value<Rhi::ProgramArgumentAccessType>(layout_index);
-        SetVulkanObjectName(GetVulkanContext().GetVulkanDevice().GetNativeDevice(), descriptor_set_layout,
+        SetVulkanObjectName(GetVulkanContext().GetVulkanDevice().GetNativeDevice(), descriptor_set_layout.get(),
                             fmt::format("{} {} Arguments Layout", program_name, magic_enum::enum_name(access_type)));
         layout_index++;
     }
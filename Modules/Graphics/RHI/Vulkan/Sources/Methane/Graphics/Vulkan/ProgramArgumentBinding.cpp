@@ -123,7 +123,11 @@ bool ProgramArgumentBinding::SetResourceViewSpan(Rhi::ResourceViewSpan resource_
     if (!Base::ProgramArgumentBinding::SetResourceViewSpan(resource_views))
         return false;
 
-    SetDescriptorsForResourceViews(resource_views);
+    // Bindless argument views are written once to the global descriptor arrays on registration, only their indices are set
+    if (!m_settings_vk.argument.IsBindlessIndex())
+    {
+        SetDescriptorsForResourceViews(resource_views);
+    }
     return true;
 }
 
@@ -34,12 +34,19 @@ Vulkan implementation of the program bindings interface.
 #include <Methane/Checks.hpp>
 
 #include <algorithm>
+#include <cassert>
 
 //#define DYNAMIC_BUFFER_OFFSETS_ENABLED
 
 namespace Methane::Graphics::Vulkan
 {
 
+static bool IsPushConstantArgument(const Rhi::ProgramArgumentAccessor& argument_accessor) noexcept
+{
+    // Bindless arguments are indices of the views in global descriptor arrays, which are set with push constants as root values
+    return argument_accessor.IsRootConstantValue() || argument_accessor.IsBindlessIndex();
+}
+
 ProgramBindings::PushConstantSetter::PushConstantSetter(Rhi::ProgramArgumentAccessType access_type,
                                                         vk::ShaderStageFlags shader_stages, uint32_t offset,
                                                         Base::RootConstantAccessor& root_const_accessor_ref)
@@ -99,22 +106,11 @@ ProgramBindings::ProgramBindings(Program& program,
     };
 
     // Initialize each argument binding with descriptor set pointer and binding index
-    ForEachArgumentBinding([this, &program, &descriptor_set_selector]
+    ForEachArgumentBinding([&program, &descriptor_set_selector]
                            (const Rhi::ProgramArgument& program_argument, ArgumentBinding& argument_binding)
     {
         const ArgumentBinding::Settings& argument_binding_settings = argument_binding.GetVulkanSettings();
-        if (argument_binding_settings.argument.GetValueType() == Rhi::ProgramArgumentValueType::RootConstantValue)
-        {
-            Base::RootConstantAccessor* root_const_accessor_ptr = argument_binding.GetRootConstantAccessorPtr();
-            META_CHECK_NOT_NULL(root_const_accessor_ptr);
-            m_push_constant_setters.emplace_back(
-                argument_binding_settings.argument.GetAccessorType(),
-                argument_binding.GetNativeShaderStageFlags(),
-                argument_binding.GetPushConstantsOffset(),
-                *root_const_accessor_ptr
-            );
-        }
-        else
+        if (!IsPushConstantArgument(argument_binding_settings.argument))
         {
             const Rhi::ProgramArgumentAccessType access_type = argument_binding_settings.argument.GetAccessorType();
             const Program::DescriptorSetLayoutInfo& layout_info = program.GetDescriptorSetLayoutInfo(access_type);
@@ -127,6 +123,7 @@ ProgramBindings::ProgramBindings(Program& program,
         }
     });
 
+    InitializePushConstantSetters();
     UpdateMutableDescriptorSetName();
     SetResourcesForArguments(binding_value_by_argument);
     VerifyAllArgumentsAreBoundToResources();
@@ -171,11 +168,32 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
         });
     }
 
+    InitializePushConstantSetters();
     UpdateMutableDescriptorSetName();
     SetResourcesForArguments(ReplaceBindingValues(other_program_bindings.GetArgumentBindings(), replace_resource_view_by_argument));
     VerifyAllArgumentsAreBoundToResources();
 }
 
+ProgramBindings::~ProgramBindings()
+{
+    META_FUNCTION_TASK();
+    if (!m_has_mutable_descriptor_set)
+        return;
+
+    try
+    {
+        // Mutable descriptor set may still be used by GPU in the frames in flight, so it is recycled by descriptor manager after completion
+        const auto& program = static_cast<const Program&>(GetProgram());
+        program.GetVulkanContext().GetVulkanDescriptorManager().ReleaseDescriptorSet(m_descriptor_sets.back());
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during Vulkan program bindings destruction: {}", e.what());
+        assert(false);
+    }
+}
+
 Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const BindingValueByArgument& replace_binding_value_by_argument,
                                                        const Opt<Data::Index>& frame_index)
 {
@@ -185,6 +203,27 @@ Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const BindingValueByArgum
     return program_bindings_ptr;
 }
 
+void ProgramBindings::InitializePushConstantSetters()
+{
+    META_FUNCTION_TASK();
+    m_push_constant_setters.clear();
+    ForEachArgumentBinding([this](const Rhi::ProgramArgument&, ArgumentBinding& argument_binding)
+    {
+        const ArgumentBinding::Settings& argument_binding_settings = argument_binding.GetVulkanSettings();
+        if (!IsPushConstantArgument(argument_binding_settings.argument))
+            return;
+
+        Base::RootConstantAccessor* root_const_accessor_ptr = argument_binding.GetRootConstantAccessorPtr();
+        META_CHECK_NOT_NULL(root_const_accessor_ptr);
+        m_push_constant_setters.emplace_back(
+            argument_binding_settings.argument.GetAccessorType(),
+            argument_binding.GetNativeShaderStageFlags(),
+            argument_binding.GetPushConstantsOffset(),
+            *root_const_accessor_ptr
+        );
+    });
+}
+
 void ProgramBindings::SetResourcesForArguments(const BindingValueByArgument& binding_value_by_argument)
 {
     META_FUNCTION_TASK();
@@ -238,6 +277,14 @@ void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQu
                                         root_constant_accessor.GetDataPtr());
     }
 
+    // Bind global bindless descriptor set, which is shared by all program bindings and updated after bind
+    if (const Opt<uint32_t>& bindless_set_index_opt = program.GetBindlessDescriptorSetIndex();
+        bindless_set_index_opt && !is_constant_binding_applied)
+    {
+        vk_command_buffer.bindDescriptorSets(vk_pipeline_bind_point, vk_pipeline_layout, *bindless_set_index_opt,
+                                             program.GetNativeBindlessDescriptorSet(), {});
+    }
+
     // Bind descriptor sets...
     if (m_descriptor_sets.empty())
         return;
@@ -315,7 +362,7 @@ void ProgramBindings::UpdateDynamicDescriptorOffsets()
         {
             const Rhi::ProgramArgumentAccessor& program_argument_accessor = argument_binding.GetSettings().argument;
             if (!program_argument_accessor.IsAddressable() ||
-                 program_argument_accessor.IsRootConstantValue())
+                 IsPushConstantArgument(program_argument_accessor))
                 return;
 
             const Program::DescriptorSetLayoutInfo& layout_info = program.GetDescriptorSetLayoutInfo(program_argument_accessor.GetAccessorType());
@@ -25,8 +25,10 @@ Vulkan implementation of the render command list interface.
 #include <Methane/Graphics/Vulkan/ParallelRenderCommandList.h>
 #include <Methane/Graphics/Vulkan/RenderState.h>
 #include <Methane/Graphics/Vulkan/RenderPattern.h>
+#include <Methane/Graphics/Vulkan/RenderContext.h>
 #include <Methane/Graphics/Vulkan/RenderPass.h>
 #include <Methane/Graphics/Vulkan/CommandQueue.h>
+#include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/IContext.h>
 #include <Methane/Graphics/Vulkan/Buffer.h>
 #include <Methane/Graphics/Vulkan/BufferSet.h>
@@ -34,6 +36,8 @@ Vulkan implementation of the render command list interface.
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <magic_enum/magic_enum.hpp>
+
 namespace Methane::Graphics::Base
 {
 
@@ -48,6 +52,11 @@ Ptr<Rhi::IRenderCommandList> RenderCommandList::CreateForSynchronization(Rhi::IC
 namespace Methane::Graphics::Vulkan
 {
 
+static_assert(sizeof(Rhi::DrawArguments) == sizeof(vk::DrawIndirectCommand),
+              "draw arguments layout must match Vulkan indirect draw command");
+static_assert(sizeof(Rhi::DrawIndexedArguments) == sizeof(vk::DrawIndexedIndirectCommand),
+              "draw indexed arguments layout must match Vulkan indirect draw indexed command");
+
 static vk::IndexType GetVulkanIndexTypeByStride(Data::Size index_stride_bytes)
 {
     META_FUNCTION_TASK();
@@ -96,6 +105,7 @@ void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
     META_FUNCTION_TASK();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
+    m_is_native_pipeline_pending = false;
 }
 
 void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr)
@@ -103,6 +113,7 @@ void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGr
     META_FUNCTION_TASK();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
+    m_is_native_pipeline_pending = false;
     CommandList::SetRenderState(render_state);
 }
 
@@ -153,6 +164,8 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
     }
 
     Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    if (!IsNativePipelineBound())
+        return;
 
     UpdatePrimitiveTopology(primitive);
     GetNativeCommandBufferDefault().drawIndexed(index_count, instance_count, start_index, start_vertex, start_instance);
@@ -163,11 +176,53 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
 {
     META_FUNCTION_TASK();
     Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    if (!IsNativePipelineBound())
+        return;
 
     UpdatePrimitiveTopology(primitive);
     GetNativeCommandBufferDefault().draw(vertex_count, instance_count, start_vertex, start_instance);
 }
 
+void RenderCommandList::MultiDrawIndexed(Primitive primitive, std::span<const Rhi::DrawIndexedArguments> draw_arguments)
+{
+    META_FUNCTION_TASK();
+    PrepareMultiDrawIndexed(primitive, draw_arguments);
+    if (!IsNativePipelineBound())
+        return;
+
+    UpdatePrimitiveTopology(primitive);
+    const vk::CommandBuffer& vk_command_buffer = GetNativeCommandBufferDefault();
+    for (const Rhi::DrawIndexedArguments& draw_args : draw_arguments)
+    {
+        vk_command_buffer.drawIndexed(GetDrawIndexCount(draw_args.index_count), draw_args.instance_count, draw_args.start_index,
+                                      draw_args.start_vertex, draw_args.start_instance);
+    }
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+    if (!IsNativePipelineBound())
+        return;
+
+    UpdatePrimitiveTopology(primitive);
+    EncodeIndirectDraws(false, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+    if (!IsNativePipelineBound())
+        return;
+
+    UpdatePrimitiveTopology(primitive);
+    EncodeIndirectDraws(true, arguments_buffer, arguments_offset, max_draw_count, count_buffer_ptr, count_offset);
+}
+
 void RenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
@@ -216,6 +271,58 @@ void RenderCommandList::UpdatePrimitiveTopology(Primitive primitive)
     }
 }
 
+bool RenderCommandList::IsNativePipelineBound()
+{
+    META_FUNCTION_TASK();
+    if (!m_is_native_pipeline_pending)
+        return true;
+
+    // Render state pipeline created asynchronously is bound on the first draw call after it becomes ready,
+    // while draw calls before that are skipped to never block rendering thread on pipeline creation
+    auto& render_state = static_cast<RenderState&>(*GetDrawingState().render_state_ptr);
+    render_state.Apply(*this, Rhi::RenderStateGroupMask{});
+    if (!m_is_native_pipeline_pending)
+        return true;
+
+    // Skipped draws are counted in render pipeline registry statistics to detect missing geometry caused by pipeline creation latency
+    static_cast<const RenderContext&>(render_state.GetRenderContext()).GetRenderPipelineRegistry().AddSkippedUse();
+    META_LOG("{} Command list '{}' SKIPPED DRAW while render state '{}' pipeline is being created",
+             magic_enum::enum_name(GetType()), GetName(), render_state.GetName());
+    return false;
+}
+
+void RenderCommandList::EncodeIndirectDraws(bool is_indexed, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    const Device&            vulkan_device       = GetVulkanCommandQueue().GetVulkanDevice();
+    const vk::CommandBuffer& vk_command_buffer   = GetNativeCommandBufferDefault();
+    const vk::Buffer&        vk_arguments_buffer = static_cast<Buffer&>(arguments_buffer).GetNativeResource();
+    const auto               arguments_stride    = static_cast<uint32_t>(is_indexed ? sizeof(vk::DrawIndexedIndirectCommand) : sizeof(vk::DrawIndirectCommand));
+
+    if (count_buffer_ptr && vulkan_device.IsDrawIndirectCountSupported())
+    {
+        const vk::Buffer& vk_count_buffer = static_cast<Buffer&>(*count_buffer_ptr).GetNativeResource();
+        if (is_indexed)
+            vk_command_buffer.drawIndexedIndirectCountKHR(vk_arguments_buffer, arguments_offset, vk_count_buffer, count_offset, max_draw_count, arguments_stride);
+        else
+            vk_command_buffer.drawIndirectCountKHR(vk_arguments_buffer, arguments_offset, vk_count_buffer, count_offset, max_draw_count, arguments_stride);
+        return;
+    }
+
+    // Without native count buffer support all draws are issued, so that unused draw arguments must have zero instance count;
+    // without multi-draw indirect support draws are issued one by one
+    const uint32_t draws_per_call = vulkan_device.IsMultiDrawIndirectSupported() ? max_draw_count : 1U;
+    for (uint32_t draw_index = 0U; draw_index < max_draw_count; draw_index += draws_per_call)
+    {
+        const vk::DeviceSize draw_arguments_offset = arguments_offset + draw_index * arguments_stride;
+        if (is_indexed)
+            vk_command_buffer.drawIndexedIndirect(vk_arguments_buffer, draw_arguments_offset, draws_per_call, arguments_stride);
+        else
+            vk_command_buffer.drawIndirect(vk_arguments_buffer, draw_arguments_offset, draws_per_call, arguments_stride);
+    }
+}
+
 RenderPass& RenderCommandList::GetVulkanPass()
 {
     META_FUNCTION_TASK();
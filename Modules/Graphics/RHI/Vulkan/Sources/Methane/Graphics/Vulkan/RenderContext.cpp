@@ -56,6 +56,7 @@ RenderContext::RenderContext(const Methane::Platform::AppEnvironment& app_env, D
     , m_app_env(app_env)
     , m_vk_device(device.GetNativeDevice())
     , m_vk_unique_surface(Platform::CreateVulkanSurfaceForWindow(static_cast<System&>(Rhi::ISystem::Get()).GetNativeInstance(), app_env))
+    , m_render_pipeline_registry(parallel_executor)
 { }
 
 #endif // #ifndef __APPLE__
@@ -100,6 +101,10 @@ void RenderContext::Release()
 {
     META_FUNCTION_TASK();
     ReleaseNativeSwapchainResources();
+
+    // Pipelines created asynchronously use pipeline cache and device, which are released with context
+    m_render_pipeline_registry.WaitForPendingPipelines();
+
     Context<Base::RenderContext>::Release();
 }
 
@@ -190,6 +195,9 @@ void RenderContext::Present()
 
     render_command_queue.ResetWaitForFrameExecution(image_index);
 
+    // Pipelines created during the frame are counted to detect pipeline creation stalls in rendering loop
+    GetVulkanPipelineCache().CompleteFrame();
+
     Context<Base::RenderContext>::OnCpuPresentComplete();
     UpdateFrameBufferIndex();
 }
@@ -214,6 +222,7 @@ bool RenderContext::SetFrameBuffersCount(uint32_t frame_buffers_count)
     META_FUNCTION_TASK();
     if (Base::RenderContext::SetFrameBuffersCount(frame_buffers_count))
     {
+        UpdateDescriptorSetsRetireFramesCount();
         ResetNativeSwapchain();
         return true;
     }
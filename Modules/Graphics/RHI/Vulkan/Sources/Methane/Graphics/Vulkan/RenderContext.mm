@@ -36,6 +36,7 @@ RenderContext::RenderContext(const Methane::Platform::AppEnvironment& app_env, D
     , m_app_env(app_env)
     , m_vk_device(device.GetNativeDevice())
     , m_vk_unique_surface(Platform::CreateVulkanSurfaceForWindow(static_cast<System&>(Rhi::ISystem::Get()).GetNativeInstance(), app_env))
+    , m_render_pipeline_registry(parallel_executor)
 {
     META_FUNCTION_TASK();
 
@@ -27,6 +27,7 @@ Vulkan implementation of the render state interface.
 #include <Methane/Graphics/Vulkan/IContext.h>
 #include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/RenderCommandList.h>
+#include <Methane/Graphics/Vulkan/PipelineCache.h>
 #include <Methane/Graphics/Vulkan/Program.h>
 #include <Methane/Graphics/Vulkan/Shader.h>
 #include <Methane/Graphics/Vulkan/ViewState.h>
@@ -34,6 +35,7 @@ Vulkan implementation of the render state interface.
 #include <Methane/Graphics/Vulkan/Utils.hpp>
 
 #include <Methane/Graphics/Base/RenderContext.h>
+#include <Methane/Graphics/Base/RenderPipelineKey.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
@@ -188,6 +190,9 @@ RenderState::RenderState(const Base::RenderContext& context, const Settings& set
     : Base::RenderState(context, settings,
                         !dynamic_cast<const IContext&>(context).GetVulkanDevice().IsDynamicStateSupported())
     , m_vk_render_context(static_cast<const RenderContext&>(GetRenderContext()))
+    , m_is_native_pipeline_async(IsNativePipelineDynamic() &&
+                                 context.GetOptions().HasBit(Rhi::ContextOption::AsyncPipelineCreation))
+    , m_dynamic_states(dynamic_cast<const IContext&>(context).GetVulkanDevice().GetDynamicStates())
 {
     META_FUNCTION_TASK();
     Reset(settings);
@@ -196,11 +201,25 @@ RenderState::RenderState(const Base::RenderContext& context, const Settings& set
 void RenderState::Reset(const Settings& settings)
 {
     META_FUNCTION_TASK();
+    // Previous pipeline can be used as a placeholder only with the same pipeline layout and render pass
+    const bool is_pipeline_layout_changed = GetSettings().program_ptr != settings.program_ptr ||
+                                            GetSettings().render_pattern_ptr != settings.render_pattern_ptr;
     Base::RenderState::Reset(settings);
 
     if (IsNativePipelineDynamic())
     {
-        m_vk_pipeline_dynamic = CreateNativePipeline();
+        std::lock_guard lock(m_mutex);
+        const bool is_placeholder_updated = m_vk_pipeline_dynamic.IsReady();
+        if (m_vk_pipeline_dynamic_placeholder.IsInitialized() &&
+            (!m_is_native_pipeline_async || is_pipeline_layout_changed || is_placeholder_updated))
+        {
+            m_vk_render_context.DeferredRelease(std::move(m_vk_pipeline_dynamic_placeholder));
+        }
+        if (m_is_native_pipeline_async && !is_pipeline_layout_changed && is_placeholder_updated)
+        {
+            m_vk_pipeline_dynamic_placeholder = std::move(m_vk_pipeline_dynamic);
+        }
+        m_vk_pipeline_dynamic = GetRegistryPipeline();
     }
     else
     {
@@ -208,14 +227,21 @@ void RenderState::Reset(const Settings& settings)
     }
 }
 
-void RenderState::Apply(Base::RenderCommandList& render_command_list, Groups /*state_groups*/)
+void RenderState::Apply(Base::RenderCommandList& render_command_list, Groups state_groups)
 {
     META_FUNCTION_TASK();
-    const auto& vulkan_render_command_list = static_cast<RenderCommandList&>(render_command_list);
-    const vk::Pipeline& vk_pipeline_state = IsNativePipelineDynamic()
-                                          ? GetNativePipelineDynamic()
-                                          : GetNativePipelineMonolithic(vulkan_render_command_list.GetDrawingState());
-    vulkan_render_command_list.GetNativeCommandBufferDefault().bindPipeline(vk::PipelineBindPoint::eGraphics, vk_pipeline_state);
+    auto& vulkan_render_command_list = static_cast<RenderCommandList&>(render_command_list);
+    const vk::Pipeline* vk_pipeline_state_ptr = IsNativePipelineDynamic()
+                                              ? GetNativePipelineDynamicIfReady()
+                                              : &GetNativePipelineMonolithic(vulkan_render_command_list.GetDrawingState());
+
+    // Draw calls are skipped by command list until pipeline created asynchronously is ready to be bound
+    vulkan_render_command_list.SetNativePipelinePending(!vk_pipeline_state_ptr);
+    if (vk_pipeline_state_ptr)
+    {
+        vulkan_render_command_list.GetNativeCommandBufferDefault().bindPipeline(vk::PipelineBindPoint::eGraphics, *vk_pipeline_state_ptr);
+    }
+    SetNativeDynamicStates(vulkan_render_command_list.GetNativeCommandBufferDefault(), state_groups);
 }
 
 bool RenderState::SetName(std::string_view name)
@@ -224,15 +250,21 @@ bool RenderState::SetName(std::string_view name)
     if (!Base::RenderState::SetName(name))
         return false;
 
+    // Pipelines shared with other render states through registry are renamed too
+    const vk::Device& vk_device = m_vk_render_context.GetVulkanDevice().GetNativeDevice();
+    std::lock_guard lock(m_mutex);
     if (IsNativePipelineDynamic())
     {
-        SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), m_vk_pipeline_dynamic.get(), name);
+        if (const vk::UniquePipeline* vk_pipeline_dynamic_ptr = m_vk_pipeline_dynamic.GetIfReady())
+        {
+            SetVulkanObjectName(vk_device, vk_pipeline_dynamic_ptr->get(), name);
+        }
     }
     else
     {
         for(const auto& [pipeline_id, vk_pipeline_monolithic] : m_vk_pipeline_monolithic_by_id)
         {
-            SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), vk_pipeline_monolithic.get(), name);
+            SetVulkanObjectName(vk_device, vk_pipeline_monolithic.Get().get(), name);
         }
     }
     return true;
@@ -242,7 +274,23 @@ const vk::Pipeline& RenderState::GetNativePipelineDynamic() const
 {
     META_FUNCTION_TASK();
     META_CHECK_TRUE_DESCR(IsNativePipelineDynamic(), "dynamic pipeline is not supported by device");
-    return m_vk_pipeline_dynamic.get();
+    return m_vk_pipeline_dynamic.Get().get();
+}
+
+const vk::Pipeline* RenderState::GetNativePipelineDynamicIfReady()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(IsNativePipelineDynamic(), "dynamic pipeline is not supported by device");
+    if (!m_is_native_pipeline_async)
+        return &m_vk_pipeline_dynamic.Get().get();
+
+    // Placeholder pipeline is kept until the next reset, since it can not be released from parallel command lists encoding
+    std::lock_guard lock(m_mutex);
+    if (const vk::UniquePipeline* vk_pipeline_dynamic_ptr = m_vk_pipeline_dynamic.GetIfReady())
+        return &vk_pipeline_dynamic_ptr->get();
+
+    const vk::UniquePipeline* vk_pipeline_placeholder_ptr = m_vk_pipeline_dynamic_placeholder.GetIfReady();
+    return vk_pipeline_placeholder_ptr ? &vk_pipeline_placeholder_ptr->get() : nullptr;
 }
 
 const vk::Pipeline& RenderState::GetNativePipelineMonolithic(ViewState& view_state, Rhi::RenderPrimitive render_primitive)
@@ -256,10 +304,10 @@ const vk::Pipeline& RenderState::GetNativePipelineMonolithic(ViewState& view_sta
     if (pipeline_monolithic_by_id_it == m_vk_pipeline_monolithic_by_id.end())
     {
         view_state.Connect(*this);
-        return m_vk_pipeline_monolithic_by_id.try_emplace(pipeline_id, CreateNativePipeline(&view_state, render_primitive)).first->second.get();
+        return m_vk_pipeline_monolithic_by_id.try_emplace(pipeline_id, GetRegistryPipeline(&view_state, render_primitive)).first->second.Get().get();
     }
 
-    return pipeline_monolithic_by_id_it->second.get();
+    return pipeline_monolithic_by_id_it->second.Get().get();
 }
 
 const vk::Pipeline& RenderState::GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state)
@@ -270,11 +318,70 @@ const vk::Pipeline& RenderState::GetNativePipelineMonolithic(const Base::RenderD
     return GetNativePipelineMonolithic(static_cast<ViewState&>(*drawing_state.view_state_ptr), drawing_state.primitive_type_opt.value());
 }
 
-vk::UniquePipeline RenderState::CreateNativePipeline(const ViewState* view_state_ptr, Opt<Rhi::RenderPrimitive> render_primitive_opt) const
+RenderPipeline RenderState::GetRegistryPipeline(const ViewState* view_state_ptr, Opt<Rhi::RenderPrimitive> render_primitive_opt) const
+{
+    META_FUNCTION_TASK();
+    const Settings& settings = GetSettings();
+    const Base::RenderPipelineKey pipeline_key(settings, m_dynamic_states,
+                                               view_state_ptr ? &view_state_ptr->GetSettings() : nullptr,
+                                               render_primitive_opt);
+
+    // Only dynamic pipelines are created asynchronously, since monolithic pipelines are required right before the draw call
+    return m_vk_render_context.GetRenderPipelineRegistry().GetPipeline(pipeline_key,
+        [&render_context = m_vk_render_context, settings, name = std::string(GetName()), pipeline_key]()
+        {
+            return CreateNativePipeline(render_context, settings, name, pipeline_key);
+        },
+        m_is_native_pipeline_async);
+}
+
+void RenderState::SetNativeDynamicStates(const vk::CommandBuffer& vk_command_buffer, Groups state_groups) const
 {
     META_FUNCTION_TASK();
+    using enum Rhi::DeviceDynamicState;
     const Settings& settings = GetSettings();
 
+    // Dynamic states are kept by command buffer between pipeline bindings, so they are set only for changed state groups
+    if (state_groups.HasAnyBit(Rhi::RenderStateGroup::Rasterizer) && m_dynamic_states.HasAnyBit(CullMode))
+    {
+        vk_command_buffer.setCullModeEXT(RasterizerCullModeToVulkan(settings.rasterizer.cull_mode));
+        vk_command_buffer.setFrontFaceEXT(settings.rasterizer.is_front_counter_clockwise ? vk::FrontFace::eCounterClockwise : vk::FrontFace::eClockwise);
+    }
+
+    if (!state_groups.HasAnyBit(Rhi::RenderStateGroup::DepthStencil))
+        return;
+
+    if (m_dynamic_states.HasAnyBit(DepthTest))
+    {
+        vk_command_buffer.setDepthTestEnableEXT(settings.depth.enabled);
+        vk_command_buffer.setDepthWriteEnableEXT(settings.depth.write_enabled);
+        vk_command_buffer.setDepthCompareOpEXT(TypeConverter::CompareFunctionToVulkan(settings.depth.compare));
+    }
+
+    if (m_dynamic_states.HasAnyBit(StencilTest))
+    {
+        vk_command_buffer.setStencilTestEnableEXT(settings.stencil.enabled);
+        for (const auto& [vk_face_flags, face_operations] : { std::pair(vk::StencilFaceFlagBits::eFront, settings.stencil.front_face),
+                                                              std::pair(vk::StencilFaceFlagBits::eBack,  settings.stencil.back_face) })
+        {
+            vk_command_buffer.setStencilOpEXT(vk_face_flags,
+                                              StencilOperationToVulkan(face_operations.stencil_failure),
+                                              StencilOperationToVulkan(face_operations.stencil_pass),
+                                              StencilOperationToVulkan(face_operations.depth_failure),
+                                              TypeConverter::CompareFunctionToVulkan(face_operations.compare));
+        }
+    }
+}
+
+vk::UniquePipeline RenderState::CreateNativePipeline(const RenderContext& render_context, const Settings& settings, std::string_view name,
+                                                     const Base::RenderPipelineKey& pipeline_key)
+{
+    META_FUNCTION_TASK();
+    using enum Rhi::DeviceDynamicState;
+    const Rhi::DeviceDynamicStateMask         dynamic_states       = pipeline_key.GetDynamicStates();
+    const Opt<Base::RenderPipelineViewShape>& view_shape_opt       = pipeline_key.GetViewShape();
+    const Opt<Rhi::RenderPrimitive>&          render_primitive_opt = pipeline_key.GetPrimitive();
+
     vk::PipelineRasterizationStateCreateInfo rasterizer_info(
         vk::PipelineRasterizationStateCreateFlags{},
         false, // depthClampEnable
@@ -364,29 +471,52 @@ vk::UniquePipeline RenderState::CreateNativePipeline(const ViewState* view_state
         false
     );
 
-    vk::PipelineViewportStateCreateInfo empty_viewport_info(
+    // Viewports and scissor rects are always set dynamically, so only their count is baked in pipeline without dynamic count
+    vk::PipelineViewportStateCreateInfo viewport_info(
         vk::PipelineViewportStateCreateFlags{},
-        0, nullptr, 0, nullptr
+        view_shape_opt ? view_shape_opt->viewports_count : 0U, nullptr,
+        view_shape_opt ? view_shape_opt->scissor_rects_count : 0U, nullptr
     );
 
-    std::vector<vk::DynamicState> dynamic_states;
-    if (!view_state_ptr)
+    std::vector<vk::DynamicState> vk_dynamic_states;
+    if (dynamic_states.HasAnyBit(ViewportsCount))
+    {
+        vk_dynamic_states.push_back(vk::DynamicState::eViewportWithCountEXT);
+        vk_dynamic_states.push_back(vk::DynamicState::eScissorWithCountEXT);
+    }
+    else if (dynamic_states.HasAnyBit(Viewports))
+    {
+        vk_dynamic_states.push_back(vk::DynamicState::eViewport);
+        vk_dynamic_states.push_back(vk::DynamicState::eScissor);
+    }
+    if (dynamic_states.HasAnyBit(PrimitiveTopology))
     {
-        dynamic_states.push_back(vk::DynamicState::eViewportWithCountEXT);
-        dynamic_states.push_back(vk::DynamicState::eScissorWithCountEXT);
+        vk_dynamic_states.push_back(vk::DynamicState::ePrimitiveTopologyEXT);
     }
-    if (!render_primitive_opt)
+    if (dynamic_states.HasAnyBit(CullMode))
     {
-        dynamic_states.push_back(vk::DynamicState::ePrimitiveTopologyEXT);
+        vk_dynamic_states.push_back(vk::DynamicState::eCullModeEXT);
+        vk_dynamic_states.push_back(vk::DynamicState::eFrontFaceEXT);
+    }
+    if (dynamic_states.HasAnyBit(DepthTest))
+    {
+        vk_dynamic_states.push_back(vk::DynamicState::eDepthTestEnableEXT);
+        vk_dynamic_states.push_back(vk::DynamicState::eDepthWriteEnableEXT);
+        vk_dynamic_states.push_back(vk::DynamicState::eDepthCompareOpEXT);
+    }
+    if (dynamic_states.HasAnyBit(StencilTest))
+    {
+        vk_dynamic_states.push_back(vk::DynamicState::eStencilTestEnableEXT);
+        vk_dynamic_states.push_back(vk::DynamicState::eStencilOpEXT);
     }
 
     vk::PipelineDynamicStateCreateInfo dynamic_info(
         vk::PipelineDynamicStateCreateFlags{},
-        dynamic_states
+        vk_dynamic_states
     );
 
-    auto& program = static_cast<Program&>(*GetSettings().program_ptr);
-    const auto& render_pattern = static_cast<RenderPattern&>(*GetSettings().render_pattern_ptr);
+    auto& program = static_cast<Program&>(*settings.program_ptr);
+    const auto& render_pattern = static_cast<RenderPattern&>(*settings.render_pattern_ptr);
 
     const vk::PipelineVertexInputStateCreateInfo vk_vertex_input_state_info = program.GetNativeVertexInputStateCreateInfo();
     const std::vector<vk::PipelineShaderStageCreateInfo> vk_stages_info = program.GetNativeShaderStageCreateInfos();
@@ -397,21 +527,19 @@ vk::UniquePipeline RenderState::CreateNativePipeline(const ViewState* view_state
         &vk_vertex_input_state_info,
         &assembly_info,
         nullptr, // no tesselation support yet
-        view_state_ptr ? &view_state_ptr->GetNativeViewportStateCreateInfo() : &empty_viewport_info,
+        &viewport_info,
         &rasterizer_info,
         &multisample_info,
         &depth_stencil_info,
         &blending_info,
-        IsNativePipelineDynamic() ? &dynamic_info : nullptr,
+        vk_dynamic_states.empty() ? nullptr : &dynamic_info,
         program.AcquireNativePipelineLayout(),
         render_pattern.GetNativeRenderPass()
     );
 
-    auto pipe = m_vk_render_context.GetVulkanDevice().GetNativeDevice().createGraphicsPipelineUnique(nullptr, vk_pipeline_create_info);
-    META_CHECK_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
-
-    SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), pipe.value.get(), Base::Object::GetName());
-    return std::move(pipe.value);
+    vk::UniquePipeline vk_unique_pipeline = render_context.GetVulkanPipelineCache().CreateGraphicsPipeline(vk_pipeline_create_info);
+    SetVulkanObjectName(render_context.GetVulkanDevice().GetNativeDevice(), vk_unique_pipeline.get(), name);
+    return vk_unique_pipeline;
 }
 
 void RenderState::OnViewStateChanged(Rhi::IViewState& view_state)
@@ -419,11 +547,16 @@ void RenderState::OnViewStateChanged(Rhi::IViewState& view_state)
     META_FUNCTION_TASK();
     std::lock_guard lock(m_mutex);
 
+    // Pipeline is replaced only when viewports or scissor rects count has changed, since their values are set dynamically
     for(auto& [pipeline_id, vk_pipeline_monolithic] : m_vk_pipeline_monolithic_by_id)
         if (std::get<0>(pipeline_id) == &view_state)
         {
+            RenderPipeline vk_pipeline = GetRegistryPipeline(static_cast<const ViewState*>(&view_state), std::get<1>(pipeline_id));
+            if (vk_pipeline == vk_pipeline_monolithic)
+                continue;
+
             m_vk_render_context.DeferredRelease(std::move(vk_pipeline_monolithic));
-            vk_pipeline_monolithic = CreateNativePipeline(static_cast<const ViewState*>(&view_state), std::get<1>(pipeline_id));
+            vk_pipeline_monolithic = std::move(vk_pipeline);
         }
 }
 
@@ -109,6 +109,9 @@ Base::ResourceBarriers::AddResult ResourceBarriers::Add(const Rhi::ResourceBarri
 bool ResourceBarriers::Remove(const Rhi::ResourceBarrier::Id& id)
 {
     META_FUNCTION_TASK();
+    if (IsEmpty())
+        return false;
+
     const auto lock_guard = Base::ResourceBarriers::Lock();
     if (!Base::ResourceBarriers::Remove(id))
         return false;
@@ -134,6 +137,25 @@ bool ResourceBarriers::Remove(const Rhi::ResourceBarrier::Id& id)
     return true;
 }
 
+void ResourceBarriers::Clear()
+{
+    META_FUNCTION_TASK();
+    const auto lock_guard = Base::ResourceBarriers::Lock();
+    for(const auto& [barrier_id, barrier] : Base::ResourceBarriers::GetMap())
+    {
+        if (barrier_id.GetType() == Rhi::ResourceBarrier::Type::StateTransition)
+            static_cast<Data::IEmitter<IResourceCallback>&>(barrier_id.GetResource()).Disconnect(*this);
+    }
+
+    Base::ResourceBarriers::Clear();
+    m_vk_default_barrier.vk_buffer_memory_barriers.clear();
+    m_vk_default_barrier.vk_image_memory_barriers.clear();
+    m_vk_default_barrier.vk_memory_barriers.clear();
+    m_vk_default_barrier.vk_src_stage_mask = {};
+    m_vk_default_barrier.vk_dst_stage_mask = {};
+    m_vk_barrier_by_queue_family.clear();
+}
+
 template<typename T>
 void UpdateNativeBarrierAccessFlags(std::vector<T>& vk_native_barriers, vk::AccessFlags vk_supported_access_flags)
 {
@@ -155,6 +155,13 @@ static vk::DescriptorType UpdateDescriptorType(vk::DescriptorType vk_shader_desc
     }
 }
 
+static bool IsBindlessDescriptorType(vk::DescriptorType vk_descriptor_type) noexcept
+{
+    return vk_descriptor_type == vk::DescriptorType::eStorageBuffer ||
+           vk_descriptor_type == vk::DescriptorType::eSampledImage  ||
+           vk_descriptor_type == vk::DescriptorType::eSampler;
+}
+
 static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spirv_compiler,
                                                 const spirv_cross::SmallVector<spirv_cross::Resource>& spirv_resources,
                                                 const vk::DescriptorType vk_descriptor_type,
@@ -177,6 +184,18 @@ static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spi
                                    ? static_cast<uint32_t>(spirv_compiler.get_declared_struct_size(spirv_type))
                                    : 0U;
 
+        // Global bindless descriptor arrays are bound by the context-wide descriptor set instead of argument bindings
+        const uint32_t descriptor_set_id = spirv_compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
+        if (vk_descriptor_type != vk::DescriptorType::eInlineUniformBlock &&
+            descriptor_set_id == Rhi::g_bindless_register_space)
+        {
+            META_CHECK_TRUE_DESCR(IsBindlessDescriptorType(vk_descriptor_type),
+                                  "bindless descriptor array '{}' has unsupported descriptor type {}, only storage buffers, "
+                                  "separate textures and samplers are supported", spirv_compiler.get_name(resource.id),
+                                  vk::to_string(vk_descriptor_type));
+            continue;
+        }
+
         ProgramBindings::ArgumentBinding::ByteCodeMap byte_code_map{ shader_type };
         if (vk_descriptor_type != vk::DescriptorType::eInlineUniformBlock)
         {
@@ -184,7 +203,6 @@ static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spi
             META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationBinding, byte_code_map.binding_offset));
         }
 
-        const uint32_t descriptor_set_id = spirv_compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
         const Rhi::ProgramArgumentAccessType arg_access_type = Rhi::ProgramArgumentAccessor::GetTypeByRegisterSpace(descriptor_set_id);
         const Rhi::ProgramArgumentValueType arg_value_type = vk_descriptor_type == vk::DescriptorType::eInlineUniformBlock
                                                            ? Rhi::ProgramArgumentValueType::RootConstantValue
@@ -267,6 +285,33 @@ Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::Progra
     return argument_bindings;
 }
 
+Shader::BindlessByteCodeMaps Shader::GetBindlessByteCodeMaps() const
+{
+    META_FUNCTION_TASK();
+    BindlessByteCodeMaps bindless_byte_code_maps;
+    const spirv_cross::Compiler& spirv_compiler = GetNativeCompiler();
+    const auto add_bindless_byte_code_maps = [&spirv_compiler, &bindless_byte_code_maps]
+                                             (const spirv_cross::SmallVector<spirv_cross::Resource>& spirv_resources,
+                                              Rhi::ResourceType resource_type)
+    {
+        for (const spirv_cross::Resource& resource : spirv_resources)
+        {
+            if (spirv_compiler.get_decoration(resource.id, spv::DecorationDescriptorSet) != Rhi::g_bindless_register_space)
+                continue;
+
+            BindlessByteCodeMap& byte_code_map = bindless_byte_code_maps.emplace_back(BindlessByteCodeMap{ resource_type, 0U, 0U });
+            META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationDescriptorSet, byte_code_map.descriptor_set_offset));
+            META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationBinding, byte_code_map.binding_offset));
+        }
+    };
+
+    const spirv_cross::ShaderResources spirv_resources = spirv_compiler.get_shader_resources(spirv_compiler.get_active_interface_variables());
+    add_bindless_byte_code_maps(spirv_resources.storage_buffers,   Rhi::ResourceType::Buffer);
+    add_bindless_byte_code_maps(spirv_resources.separate_images,   Rhi::ResourceType::Texture);
+    add_bindless_byte_code_maps(spirv_resources.separate_samplers, Rhi::ResourceType::Sampler);
+    return bindless_byte_code_maps;
+}
+
 const vk::ShaderModule& Shader::GetNativeModule() const
 {
     META_FUNCTION_TASK();
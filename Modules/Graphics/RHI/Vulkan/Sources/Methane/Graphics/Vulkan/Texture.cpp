@@ -281,7 +281,7 @@ void Texture::InitializeAsImage()
     const vk::Device& vk_device = GetNativeDevice();
     const vk::MemoryRequirements vk_image_memory_requirements = vk_device.getImageMemoryRequirements(GetNativeResource());
     AllocateResourceMemory(vk_image_memory_requirements, vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetNativeDeviceMemoryOffset());
 
     // Create staging buffer and allocate staging memory
     m_vk_unique_staging_buffer = vk_device.createBufferUnique(
@@ -292,8 +292,8 @@ void Texture::InitializeAsImage()
     );
 
     const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    m_vk_unique_staging_memory = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    vk_device.bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    m_staging_memory = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
+    vk_device.bindBufferMemory(m_vk_unique_staging_buffer.get(), m_staging_memory.GetNativeDeviceMemory(), m_staging_memory.GetOffset());
 }
 
 void Texture::InitializeAsRenderTarget()
@@ -305,7 +305,7 @@ void Texture::InitializeAsRenderTarget()
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
     AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetNativeDeviceMemoryOffset());
 }
 
 void Texture::InitializeAsDepthStencil()
@@ -322,7 +322,7 @@ void Texture::InitializeAsDepthStencil()
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
     AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetNativeDeviceMemoryOffset());
 }
 
 void Texture::ResetNativeFrameImage()
@@ -351,21 +351,13 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
     m_vk_copy_regions.reserve(sub_resources.size());
 
     const SubResource::Count& subresource_count = GetSubresourceCount();
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
+    const Data::RawPtr staging_data_ptr = m_staging_memory.GetMappedDataPtr();
     vk::DeviceSize sub_resource_offset = 0U;
 
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
-        Data::RawPtr sub_resource_data_ptr = nullptr;
-        const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                     reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
-
-        META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-        META_CHECK_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
-
-        GetNativeDevice().unmapMemory(vk_device_memory);
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), staging_data_ptr + sub_resource_offset);
 
         m_vk_copy_regions.emplace_back(
             sub_resource_offset, 0, 0,
@@ -434,26 +426,17 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const Su
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
 
-    // Map staging buffer memory and copy texture subresource data
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
-    Data::Size   staging_data_offset = 0U;
-    Data::Size   staging_data_size   = bytes_per_image;
-    Data::RawPtr staging_data_ptr    = nullptr;
+    // Copy texture subresource data from persistently mapped staging buffer memory
+    Data::Size staging_data_offset = 0U;
+    Data::Size staging_data_size   = bytes_per_image;
     if (data_range)
     {
         META_CHECK_LESS_DESCR(data_range->GetEnd(), staging_data_size, "provided texture subresource data range is out of bounds");
         staging_data_offset = data_range->GetStart();
         staging_data_size   = data_range->GetLength();
     }
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, staging_data_offset, staging_data_size, vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&staging_data_ptr)); // NOSONAR
-
-    META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-    META_CHECK_NOT_NULL_DESCR(staging_data_ptr, "failed to map buffer subresource");
-    Rhi::SubResource sub_resource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-    return sub_resource;
+    const Data::RawPtr staging_data_ptr = m_staging_memory.GetMappedDataPtr() + staging_data_offset;
+    return Rhi::SubResource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
 }
 
 bool Texture::SetName(std::string_view name)
@@ -91,7 +91,6 @@ ViewState::ViewState(const Settings& settings)
     : Base::ViewState(settings)
     , m_vk_viewports(ViewportsToVulkan(settings.viewports))
     , m_vk_scissor_rects(ScissorRectsToVulkan(settings.scissor_rects))
-    , m_vk_viewport_state_info({}, m_vk_viewports, m_vk_scissor_rects)
 { }
 
 bool ViewState::Reset(const Settings& settings)
@@ -100,9 +99,8 @@ bool ViewState::Reset(const Settings& settings)
     if (!Base::ViewState::Reset(settings))
         return false;
 
-    m_vk_viewports           = ViewportsToVulkan(settings.viewports);
-    m_vk_scissor_rects       = ScissorRectsToVulkan(settings.scissor_rects);
-    m_vk_viewport_state_info = vk::PipelineViewportStateCreateInfo({}, m_vk_viewports, m_vk_scissor_rects);
+    m_vk_viewports     = ViewportsToVulkan(settings.viewports);
+    m_vk_scissor_rects = ScissorRectsToVulkan(settings.scissor_rects);
 
     Data::Emitter<ICallback>::Emit(&ICallback::OnViewStateChanged, *this);
     return true;
@@ -115,7 +113,6 @@ bool ViewState::SetViewports(const Viewports& viewports)
         return false;
 
     m_vk_viewports = ViewportsToVulkan(GetSettings().viewports);
-    m_vk_viewport_state_info.setViewports(m_vk_viewports);
 
     Data::Emitter<ICallback>::Emit(&ICallback::OnViewStateChanged, *this);
     return true;
@@ -128,7 +125,6 @@ bool ViewState::SetScissorRects(const ScissorRects& scissor_rects)
         return false;
 
     m_vk_scissor_rects = ScissorRectsToVulkan(GetSettings().scissor_rects);
-    m_vk_viewport_state_info.setScissors(m_vk_scissor_rects);
 
     Data::Emitter<ICallback>::Emit(&ICallback::OnViewStateChanged, *this);
     return true;
@@ -138,12 +134,18 @@ void ViewState::Apply(Base::RenderCommandList& command_list)
 {
     META_FUNCTION_TASK();
     const auto& vulkan_command_list = static_cast<RenderCommandList&>(command_list);
-    if (!vulkan_command_list.IsDynamicStateSupported())
-        return;
-
     const vk::CommandBuffer& vk_command_buffer = vulkan_command_list.GetNativeCommandBufferDefault();
-    vk_command_buffer.setViewportWithCountEXT(m_vk_viewports);
-    vk_command_buffer.setScissorWithCountEXT(m_vk_scissor_rects);
+    if (vulkan_command_list.IsDynamicStateSupported())
+    {
+        vk_command_buffer.setViewportWithCountEXT(m_vk_viewports);
+        vk_command_buffer.setScissorWithCountEXT(m_vk_scissor_rects);
+    }
+    else
+    {
+        // Viewports count is baked in monolithic pipelines, while their values are still set dynamically
+        vk_command_buffer.setViewport(0U, m_vk_viewports);
+        vk_command_buffer.setScissor(0U, m_vk_scissor_rects);
+    }
 }
 
 } // namespace Methane::Graphics::Vulkan
@@ -156,6 +156,7 @@ private:
     bool            m_is_resizing = false;
     bool            m_is_resize_required_to_render = false;
     bool            m_has_keyboard_focus = false;
+    uint32_t        m_rendered_frames_count = 0U;
     Input::State    m_input_state;
 
     mutable UniquePtr<tf::Executor> m_parallel_executor_ptr;
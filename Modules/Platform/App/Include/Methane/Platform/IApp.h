@@ -41,12 +41,14 @@ struct AppSettings
     Data::FrameSize  min_size { 640U, 480U };
     bool             is_full_screen = false;
     Data::IProvider* icon_provider_ptr  = nullptr;
+    uint32_t         frames_count_limit = 0U; // application is closed after rendering this number of frames, unlimited when zero
 
     AppSettings& SetName(std::string&& new_name) noexcept;
     AppSettings& SetSize(Data::FloatSize&& new_size) noexcept;
     AppSettings& SetMinSize(Data::FrameSize&& new_min_size) noexcept;
     AppSettings& SetFullScreen(bool new_full_screen) noexcept;
     AppSettings& SetIconProvider(Data::IProvider* new_icon_provider) noexcept;
+    AppSettings& SetFramesCountLimit(uint32_t new_frames_count_limit) noexcept;
 };
 
 struct AppRunArgs
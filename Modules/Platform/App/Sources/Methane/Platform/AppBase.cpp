@@ -149,6 +149,13 @@ IApp::Settings& IApp::Settings::SetIconProvider(Data::IProvider* new_icon_provid
     return *this;
 }
 
+IApp::Settings& IApp::Settings::SetFramesCountLimit(uint32_t new_frames_count_limit) noexcept
+{
+    META_FUNCTION_TASK();
+    frames_count_limit = new_frames_count_limit;
+    return *this;
+}
+
 AppBase::AppBase(const AppBase::Settings& settings)
     : CLI::App(settings.name, GetExecutableFileName())
     , m_settings(settings)
@@ -159,6 +166,7 @@ AppBase::AppBase(const AppBase::Settings& settings)
 
     AddRectSizeOption(*this, "-w,--wnd-size", m_settings.size, "Window size in pixels or as ratio of desktop size", true);
     add_option("-f,--full-screen", m_settings.is_full_screen, "Full-screen mode");
+    add_option("--frames-limit", m_settings.frames_count_limit, "Close application after rendering the given number of frames, unlimited when zero");
 
 #ifdef __APPLE__
     // When application is opened on MacOS with its Bundle,
@@ -371,7 +379,8 @@ bool AppBase::UpdateAndRender()
 
     try
     {
-        Render();
+        if (Render())
+            m_rendered_frames_count++;
     }
     catch(const AppViewResizeRequiredError&)
     {
@@ -380,6 +389,11 @@ bool AppBase::UpdateAndRender()
         // see https://github.com/MethanePowered/MethaneKit/issues/105
         m_is_resize_required_to_render = true;
     }
+
+    // Frames count limit is used to run applications non-interactively, for example in smoke tests
+    if (m_settings.frames_count_limit && m_rendered_frames_count >= m_settings.frames_count_limit)
+        Close();
+
     return true;
 }
 
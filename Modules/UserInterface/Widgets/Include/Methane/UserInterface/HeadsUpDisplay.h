@@ -55,6 +55,7 @@ public:
         Color4F              background_color    { 0.F,  0.F,  0.F,  0.66F };
         pin::Keyboard::State help_shortcut       { pin::Keyboard::Key::F1 };
         double               update_interval_sec = 0.33;
+        double               frame_time_budget_ms = 1000.0 / 60.0;
 
         Settings& SetMajorFont(const Font::Description& new_major_font) noexcept;
         Settings& SetMinorFont(const Font::Description& new_minor_font) noexcept;
@@ -67,6 +68,7 @@ public:
         Settings& SetBackgroundColor(const Color4F& new_background_color) noexcept;
         Settings& SetHelpShortcut(const pin::Keyboard::State& new_help_shortcut) noexcept;
         Settings& SetUpdateIntervalSec(double new_update_interval_sec) noexcept;
+        Settings& SetFrameTimeBudgetMSec(double new_frame_time_budget_ms) noexcept;
     };
 
     HeadsUpDisplay(Context& ui_context, const FontContext& font_context, const Settings& settings);
@@ -89,6 +91,7 @@ private:
         HelpKey,
         FrameBuffersAndApi,
         VSync,
+        FrameStats,
 
         Count
     };
@@ -26,6 +26,10 @@ Heads-Up-Display widget for displaying runtime rendering parameters.
  | CPU Time %    |                                |
  |-------------- |--------------------------------|
  | VSync ON/OFF  | W x H       N FB      GFX API  |
+ |-------------- ---------------------------------|
+ | Frame time percentiles: p50, p90, p99, p99.9   |
+ | Present and GPU wait time percentiles: p99     |
+ | Frame time deviation and over budget frames    |
  --------------------------------------------------
 
 ******************************************************************************/
@@ -141,6 +145,13 @@ HeadsUpDisplay::Settings& HeadsUpDisplay::Settings::SetUpdateIntervalSec(double
     return *this;
 }
 
+HeadsUpDisplay::Settings& HeadsUpDisplay::Settings::SetFrameTimeBudgetMSec(double new_frame_time_budget_ms) noexcept
+{
+    META_FUNCTION_TASK();
+    frame_time_budget_ms = new_frame_time_budget_ms;
+    return *this;
+}
+
 HeadsUpDisplay::HeadsUpDisplay(Context& ui_context, const FontContext& font_context, const Settings& settings)
     : Panel(ui_context, { }, { "Heads Up Display" })
     , m_settings(settings)
@@ -231,6 +242,16 @@ HeadsUpDisplay::HeadsUpDisplay(Context& ui_context, const FontContext& font_cont
                 Text::Layout{ Text::Wrap::None, Text::HorizontalAlignment::Left, Text::VerticalAlignment::Top },
                 m_settings.on_color
             }
+        ),
+        std::make_shared<TextItem>(ui_context, m_minor_font,
+            Text::SettingsUtf8
+            {
+                "Frame Statistics",
+                "Frame p50/90/99/99.9: 00.00 / 00.00 / 00.00 / 00.00 ms",
+                UnitRect{ Units::Dots, gfx::Point2I{ }, gfx::FrameSize{ 0U, GetTextHeightInDots(ui_context, m_minor_font) * 3U } },
+                Text::Layout{ Text::Wrap::None, Text::HorizontalAlignment::Left, Text::VerticalAlignment::Top },
+                m_settings.text_color
+            }
         )
     })
 {
@@ -291,6 +312,16 @@ void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
     GetTextBlock(VSync).SetText(context_settings.vsync_enabled ? "VSync ON" : "VSync OFF");
     GetTextBlock(VSync).SetColor(context_settings.vsync_enabled ? m_settings.on_color : m_settings.off_color);
 
+    const Data::FrameTimingStatistics frame_stats = fps_counter.GetFrameTimingStatistics(m_settings.frame_time_budget_ms / 1000.0);
+    GetTextBlock(FrameStats).SetText(fmt::format("Frame p50/90/99/99.9: {:.2f} / {:.2f} / {:.2f} / {:.2f} ms\n"
+                                                 "Present p99: {:.2f} ms   GPU wait p99: {:.2f} ms\n"
+                                                 "Deviation: {:.2f} ms   Over {:.2f} ms budget: {:d} of {:d}",
+                                                 frame_stats.p50.GetTotalTimeMSec(), frame_stats.p90.GetTotalTimeMSec(),
+                                                 frame_stats.p99.GetTotalTimeMSec(), frame_stats.p99_9.GetTotalTimeMSec(),
+                                                 frame_stats.p99.GetPresentTimeMSec(), frame_stats.p99.GetGpuWaitTimeMSec(),
+                                                 frame_stats.GetTotalTimeDeviationMSec(), m_settings.frame_time_budget_ms,
+                                                 frame_stats.over_budget_frames_count, frame_stats.frames_count));
+
     LayoutTextBlocks();
     UpdateAllTextBlocks(render_attachment_size);
     m_update_timer.Reset();
@@ -358,13 +389,20 @@ void HeadsUpDisplay::LayoutTextBlocks()
     position.SetY(position.GetY() + gpu_name_size.GetHeight() + text_margins_in_dots.GetHeight());
     GetTextBlock(Fps).SetRelOrigin(position);
 
+    // Layout frame statistics text block in the bottom row under both columns
+    const FrameSize frame_stats_size = GetTextBlock(FrameStats).GetRectInDots().size;
+    position.SetX(text_margins_in_dots.GetWidth());
+    position.SetY(right_bottom_position.GetY() + vsync_size.GetHeight() + text_margins_in_dots.GetHeight());
+    GetTextBlock(FrameStats).SetRelOrigin(position);
+
     Panel::SetRect(UnitRect{
         Units::Dots,
         m_settings.position,
         gfx::FrameSize
         {
-            right_bottom_position.GetX() + right_column_width + text_margins_in_dots.GetWidth(),
-            right_bottom_position.GetY() + vsync_size.GetHeight() + text_margins_in_dots.GetHeight()
+            std::max(right_bottom_position.GetX() + right_column_width, frame_stats_size.GetWidth() + text_margins_in_dots.GetWidth())
+                + text_margins_in_dots.GetWidth(),
+            position.GetY() + frame_stats_size.GetHeight() + text_margins_in_dots.GetHeight()
         }
     });
 }
@@ -0,0 +1,267 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/ScopeTimerTest.cpp
+Unit tests of ScopeTimer aggregation of per-thread scope timings and percentile statistics
+
+******************************************************************************/
+
+#include <Methane/ScopeTimer.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <limits>
+
+using namespace Methane;
+
+using Aggregator = ScopeTimer::Aggregator;
+using Timing = Aggregator::Timing;
+
+namespace
+{
+
+class TestLogger final : public ILogger
+{
+public:
+    void Log(std::string_view message) override { m_messages.emplace_back(message); }
+
+    [[nodiscard]] const std::vector<std::string>& GetMessages() const noexcept { return m_messages; }
+
+private:
+    std::vector<std::string> m_messages;
+};
+
+[[nodiscard]] std::string GetLoggedTimings()
+{
+    TestLogger logger;
+    Aggregator::Get().LogTimings(logger);
+    return logger.GetMessages().empty() ? std::string() : logger.GetMessages().back();
+}
+
+[[nodiscard]] bool IsScopeLogged(const std::string& log, std::string_view scope_name, uint32_t count)
+{
+    const std::string scope_prefix = std::string("  - ") + std::string(scope_name) + ": ";
+    const size_t scope_pos = log.find(scope_prefix);
+    if (scope_pos == std::string::npos)
+        return false;
+
+    const size_t line_end_pos = log.find('\n', scope_pos);
+    const std::string scope_line = log.substr(scope_pos, line_end_pos - scope_pos);
+    return scope_line.find(" with " + std::to_string(count) + " invocations count;") != std::string::npos;
+}
+
+[[nodiscard]] Timing MakeTiming(const std::vector<uint64_t>& durations_ns)
+{
+    Timing timing;
+    for(const uint64_t duration_ns : durations_ns)
+    {
+        const Timer::TimeDuration duration = std::chrono::duration_cast<Timer::TimeDuration>(std::chrono::nanoseconds(duration_ns));
+        timing.duration    += duration;
+        timing.min_duration = std::min(timing.min_duration, duration);
+        timing.max_duration = std::max(timing.max_duration, duration);
+        timing.count++;
+        timing.histogram[Aggregator::GetHistogramBucketIndex(duration_ns)]++;
+    }
+    return timing;
+}
+
+[[nodiscard]] uint64_t GetNanoseconds(Timer::TimeDuration duration)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+
+} // anonymous namespace
+
+TEST_CASE("Scope timer histogram buckets", "[instrumentation][scope-timer]")
+{
+    SECTION("Zero duration is counted in the first bucket")
+    {
+        CHECK(Aggregator::GetHistogramBucketIndex(0U) == 0U);
+    }
+
+    SECTION("Too long duration is counted in the last bucket")
+    {
+        CHECK(Aggregator::GetHistogramBucketIndex(std::numeric_limits<uint64_t>::max()) == Aggregator::histogram_buckets_count - 1U);
+    }
+
+    SECTION("Bucket index is not decreasing with duration growth")
+    {
+        uint32_t prev_bucket_index = 0U;
+        for(uint64_t duration_ns = 1U; duration_ns < 1'000'000'000U; duration_ns += duration_ns / 7U + 1U)
+        {
+            const uint32_t bucket_index = Aggregator::GetHistogramBucketIndex(duration_ns);
+            CHECK(bucket_index >= prev_bucket_index);
+            CHECK(bucket_index < Aggregator::histogram_buckets_count);
+            prev_bucket_index = bucket_index;
+        }
+    }
+
+    SECTION("Bucket duration approximates durations counted in bucket with relative error below octave sub-bucket size")
+    {
+        for(uint64_t duration_ns = 64U; duration_ns < 1'000'000'000U; duration_ns += duration_ns / 5U + 3U)
+        {
+            const uint64_t bucket_duration_ns = Aggregator::GetHistogramBucketDuration(Aggregator::GetHistogramBucketIndex(duration_ns));
+            const uint64_t duration_error_ns  = bucket_duration_ns > duration_ns ? bucket_duration_ns - duration_ns : duration_ns - bucket_duration_ns;
+            CHECK(duration_error_ns * Aggregator::histogram_octave_buckets_count <= duration_ns);
+        }
+    }
+}
+
+TEST_CASE("Scope timer timing statistics", "[instrumentation][scope-timer]")
+{
+    SECTION("Empty timing has zero average and percentile durations")
+    {
+        const Timing timing;
+        CHECK(timing.GetAverageDuration() == Timer::TimeDuration::zero());
+        CHECK(timing.GetPercentileDuration(50U) == Timer::TimeDuration::zero());
+        CHECK(timing.GetPercentileDuration(99U) == Timer::TimeDuration::zero());
+    }
+
+    SECTION("Average duration of timings")
+    {
+        const Timing timing = MakeTiming({ 1000U, 2000U, 3000U, 6000U });
+        CHECK(GetNanoseconds(timing.GetAverageDuration()) == 3000U);
+    }
+
+    SECTION("Percentile durations of uniformly distributed timings")
+    {
+        std::vector<uint64_t> durations_ns;
+        for(uint64_t duration_us = 1U; duration_us <= 1000U; ++duration_us)
+        {
+            durations_ns.push_back(duration_us * 1000U);
+        }
+        const Timing timing = MakeTiming(durations_ns);
+
+        const uint64_t p50_ns = GetNanoseconds(timing.GetPercentileDuration(50U));
+        const uint64_t p95_ns = GetNanoseconds(timing.GetPercentileDuration(95U));
+        const uint64_t p99_ns = GetNanoseconds(timing.GetPercentileDuration(99U));
+        CHECK(p50_ns >= 500'000U * 7U / 8U);
+        CHECK(p50_ns <= 500'000U * 9U / 8U);
+        CHECK(p95_ns >= 950'000U * 7U / 8U);
+        CHECK(p95_ns <= 950'000U * 9U / 8U);
+        CHECK(p50_ns <= p95_ns);
+        CHECK(p95_ns <= p99_ns);
+    }
+
+    SECTION("Percentile durations are clamped to the minimum and maximum durations")
+    {
+        const Timing timing = MakeTiming({ 1001U, 1001U, 1001U });
+        CHECK(GetNanoseconds(timing.GetPercentileDuration(0U)) == 1001U);
+        CHECK(GetNanoseconds(timing.GetPercentileDuration(50U)) == 1001U);
+        CHECK(GetNanoseconds(timing.GetPercentileDuration(100U)) == 1001U);
+    }
+
+    SECTION("Rare long timing affects only the highest percentile")
+    {
+        std::vector<uint64_t> durations_ns(99U, 1000U);
+        durations_ns.push_back(1'000'000U);
+        const Timing timing = MakeTiming(durations_ns);
+
+        CHECK(GetNanoseconds(timing.GetPercentileDuration(50U)) <= 1000U * 9U / 8U);
+        CHECK(GetNanoseconds(timing.GetPercentileDuration(99U)) <= 1000U * 9U / 8U);
+        CHECK(GetNanoseconds(timing.GetPercentileDuration(100U)) == 1'000'000U);
+    }
+}
+
+TEST_CASE("Scope timer aggregation", "[instrumentation][scope-timer]")
+{
+    Aggregator& aggregator = Aggregator::Get();
+    aggregator.Flush();
+
+    SECTION("Scope is registered once by name")
+    {
+        const ScopeTimer::Registration registration   = aggregator.RegisterScope("ScopeTimerTest.Registration");
+        const ScopeTimer::Registration registration_2 = aggregator.RegisterScope("ScopeTimerTest.Registration");
+        const ScopeTimer::Registration registration_3 = aggregator.RegisterScope("ScopeTimerTest.OtherRegistration");
+        CHECK(registration.id == registration_2.id);
+        CHECK(registration.id != registration_3.id);
+        CHECK(std::string_view(registration.name) == "ScopeTimerTest.Registration");
+    }
+
+    SECTION("Timings are not logged without measured scopes")
+    {
+        CHECK(GetLoggedTimings().empty());
+    }
+
+    SECTION("Scope timings measured on one thread are logged")
+    {
+        const ScopeTimer::Registration registration = aggregator.RegisterScope("ScopeTimerTest.SingleThread");
+        for(uint32_t index = 0U; index < 10U; ++index)
+        {
+            ScopeTimer scope_timer(registration);
+            CHECK(scope_timer.GetScopeId() == registration.id);
+        }
+        CHECK(IsScopeLogged(GetLoggedTimings(), "ScopeTimerTest.SingleThread", 10U));
+    }
+
+    SECTION("Scope timings are accumulated between logging and reset on flush")
+    {
+        const ScopeTimer::Registration registration = aggregator.RegisterScope("ScopeTimerTest.Flush");
+        { ScopeTimer scope_timer(registration); }
+        CHECK(IsScopeLogged(GetLoggedTimings(), "ScopeTimerTest.Flush", 1U));
+
+        { ScopeTimer scope_timer(registration); }
+        CHECK(IsScopeLogged(GetLoggedTimings(), "ScopeTimerTest.Flush", 2U));
+
+        aggregator.Flush();
+        CHECK(GetLoggedTimings().empty());
+
+        { ScopeTimer scope_timer(registration); }
+        CHECK(IsScopeLogged(GetLoggedTimings(), "ScopeTimerTest.Flush", 1U));
+    }
+
+    SECTION("Scope timings measured on parallel threads are merged without losses")
+    {
+        constexpr uint32_t threads_count = 4U;
+        constexpr uint32_t thread_timings_count = 1000U;
+        const ScopeTimer::Registration registration = aggregator.RegisterScope("ScopeTimerTest.ParallelThreads");
+
+        std::vector<std::thread> threads;
+        for(uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            threads.emplace_back([&registration]()
+            {
+                for(uint32_t index = 0U; index < thread_timings_count; ++index)
+                {
+                    ScopeTimer scope_timer(registration);
+                }
+            });
+        }
+
+        // Timings are merged in parallel with measurements on other threads
+        for(uint32_t index = 0U; index < 10U; ++index)
+        {
+            CHECK_NOTHROW(GetLoggedTimings());
+        }
+
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Timings of finished threads are kept until flush
+        CHECK(IsScopeLogged(GetLoggedTimings(), "ScopeTimerTest.ParallelThreads", threads_count * thread_timings_count));
+    }
+
+    aggregator.Flush();
+}
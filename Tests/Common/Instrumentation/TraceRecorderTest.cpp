@@ -0,0 +1,339 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/TraceRecorderTest.cpp
+Unit tests of TraceRecorder output to Chrome trace JSON and per-thread scope ring buffers
+
+******************************************************************************/
+
+#include <Methane/TraceRecorder.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <filesystem>
+#include <thread>
+#include <future>
+#include <optional>
+#include <algorithm>
+#include <cmath>
+
+using namespace Methane;
+
+namespace
+{
+
+struct TraceEvent
+{
+    std::string phase;
+    std::string name;
+    uint32_t    process_id = 0U;
+    uint32_t    thread_id  = 0U;
+    double      timestamp_us = 0.0;
+    double      duration_us  = 0.0;
+    std::string arg_name;
+};
+
+[[nodiscard]] std::optional<std::string> GetStringField(const std::string& line, std::string_view field_name)
+{
+    const std::string field_prefix = "\"" + std::string(field_name) + "\":\"";
+    const size_t field_pos = line.find(field_prefix);
+    if (field_pos == std::string::npos)
+        return std::nullopt;
+
+    std::string value;
+    for(size_t char_pos = field_pos + field_prefix.size(); char_pos < line.size() && line[char_pos] != '"'; ++char_pos)
+    {
+        if (line[char_pos] != '\\' || char_pos + 1 == line.size())
+        {
+            value += line[char_pos];
+            continue;
+        }
+
+        switch(line[++char_pos])
+        {
+        case 'n': value += '\n'; break;
+        case 'r': value += '\r'; break;
+        case 't': value += '\t'; break;
+        default:  value += line[char_pos];
+        }
+    }
+    return value;
+}
+
+[[nodiscard]] double GetNumberField(const std::string& line, std::string_view field_name)
+{
+    const std::string field_prefix = "\"" + std::string(field_name) + "\":";
+    const size_t field_pos = line.find(field_prefix);
+    return field_pos == std::string::npos ? -1.0 : std::stod(line.substr(field_pos + field_prefix.size()));
+}
+
+[[nodiscard]] std::vector<TraceEvent> ParseTraceEvents(const std::string& trace)
+{
+    std::vector<TraceEvent> events;
+    std::istringstream trace_stream(trace);
+    std::string line;
+    while(std::getline(trace_stream, line))
+    {
+        if (line.rfind("{\"ph\":", 0) != 0)
+            continue;
+
+        const size_t args_pos = line.find("\"args\":");
+        const std::string event_line = line.substr(0, args_pos);
+        TraceEvent event;
+        event.phase        = GetStringField(event_line, "ph").value_or("");
+        event.name         = GetStringField(event_line, "name").value_or("");
+        event.process_id   = static_cast<uint32_t>(GetNumberField(event_line, "pid"));
+        event.thread_id    = static_cast<uint32_t>(std::max(0.0, GetNumberField(event_line, "tid")));
+        event.timestamp_us = GetNumberField(event_line, "ts");
+        event.duration_us  = GetNumberField(event_line, "dur");
+        if (args_pos != std::string::npos)
+            event.arg_name = GetStringField(line.substr(args_pos), "name").value_or("");
+        events.push_back(std::move(event));
+    }
+    return events;
+}
+
+[[nodiscard]] std::string WriteTrace()
+{
+    std::stringstream trace_stream;
+    TraceRecorder::Get().WriteChromeTrace(trace_stream);
+    return trace_stream.str();
+}
+
+[[nodiscard]] std::optional<uint32_t> FindThreadId(const std::vector<TraceEvent>& events, uint32_t process_id, std::string_view thread_name)
+{
+    const auto event_it = std::ranges::find_if(events, [process_id, thread_name](const TraceEvent& event)
+    {
+        return event.phase == "M" && event.name == "thread_name" && event.process_id == process_id && event.arg_name == thread_name;
+    });
+    return event_it == events.end() ? std::nullopt : std::optional<uint32_t>(event_it->thread_id);
+}
+
+[[nodiscard]] size_t CountScopes(const std::vector<TraceEvent>& events, std::string_view scope_name,
+                                 std::optional<uint32_t> thread_id = std::nullopt)
+{
+    return static_cast<size_t>(std::ranges::count_if(events, [scope_name, thread_id](const TraceEvent& event)
+    {
+        return event.phase == "X" && event.process_id == 1U && event.name == scope_name &&
+               (!thread_id || event.thread_id == *thread_id);
+    }));
+}
+
+[[nodiscard]] int64_t GetDurationNs(const TraceEvent& event)
+{
+    return static_cast<int64_t>(std::llround(event.duration_us * 1000.0));
+}
+
+} // anonymous namespace
+
+TEST_CASE("Trace recorder Chrome trace output", "[instrumentation][trace-recorder]")
+{
+    TraceRecorder& trace_recorder = TraceRecorder::Get();
+    const uint64_t begin_ns = TraceRecorder::GetTimestampNs();
+
+    std::thread recording_thread([&trace_recorder, begin_ns]()
+    {
+        trace_recorder.SetThreadName("TraceRecorderTest \"Output\"\tThread");
+        trace_recorder.AddScope("TraceRecorderTest.OutputScope", begin_ns, begin_ns + 2500U);
+        TraceRecorder::Scope scope("TraceRecorderTest.RaiiScope");
+    });
+    recording_thread.join();
+    trace_recorder.AddGpuRange("TraceRecorderTest.GpuRange", "TraceRecorderTest.GpuQueue", begin_ns, begin_ns + 1000U);
+
+    const std::string trace = WriteTrace();
+    const std::vector<TraceEvent> events = ParseTraceEvents(trace);
+
+    SECTION("Trace is a JSON object with trace events array")
+    {
+        CHECK(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", 0) == 0);
+        CHECK(trace.ends_with("\n]}\n"));
+    }
+
+    SECTION("CPU and GPU processes are named")
+    {
+        const auto is_process_named = [&events](uint32_t process_id, std::string_view process_name)
+        {
+            return std::ranges::any_of(events, [process_id, process_name](const TraceEvent& event)
+            {
+                return event.phase == "M" && event.name == "process_name" && event.process_id == process_id && event.arg_name == process_name;
+            });
+        };
+        CHECK(is_process_named(1U, "CPU"));
+        CHECK(is_process_named(2U, "GPU"));
+    }
+
+    SECTION("Thread name is escaped in JSON string")
+    {
+        CHECK(trace.find("\"TraceRecorderTest \\\"Output\\\"\\tThread\"") != std::string::npos);
+    }
+
+    SECTION("CPU scopes are written as complete events of the named thread")
+    {
+        const std::optional<uint32_t> thread_id = FindThreadId(events, 1U, "TraceRecorderTest \"Output\"\tThread");
+        REQUIRE(thread_id.has_value());
+
+        const auto scope_it = std::ranges::find_if(events, [](const TraceEvent& event)
+        {
+            return event.phase == "X" && event.name == "TraceRecorderTest.OutputScope";
+        });
+        REQUIRE(scope_it != events.end());
+        CHECK(scope_it->process_id == 1U);
+        CHECK(scope_it->thread_id == *thread_id);
+        CHECK(scope_it->timestamp_us >= 0.0);
+        CHECK(GetDurationNs(*scope_it) == 2500);
+        CHECK(CountScopes(events, "TraceRecorderTest.RaiiScope", thread_id) == 1U);
+    }
+
+    SECTION("GPU ranges are written as complete events of the named GPU track")
+    {
+        const std::optional<uint32_t> track_id = FindThreadId(events, 2U, "TraceRecorderTest.GpuQueue");
+        REQUIRE(track_id.has_value());
+
+        const auto range_it = std::ranges::find_if(events, [](const TraceEvent& event)
+        {
+            return event.phase == "X" && event.name == "TraceRecorderTest.GpuRange";
+        });
+        REQUIRE(range_it != events.end());
+        CHECK(range_it->process_id == 2U);
+        CHECK(range_it->thread_id == *track_id);
+        CHECK(GetDurationNs(*range_it) == 1000);
+    }
+
+    SECTION("Trace is written to file")
+    {
+        const std::filesystem::path trace_file_path = std::filesystem::temp_directory_path() / "MethaneTraceRecorderTest.json";
+        REQUIRE(trace_recorder.WriteChromeTrace(trace_file_path.string()));
+
+        std::ifstream trace_file(trace_file_path);
+        const std::string file_trace((std::istreambuf_iterator<char>(trace_file)), std::istreambuf_iterator<char>());
+        trace_file.close();
+        std::filesystem::remove(trace_file_path);
+
+        CHECK(CountScopes(ParseTraceEvents(file_trace), "TraceRecorderTest.OutputScope") > 0U);
+    }
+}
+
+TEST_CASE("Trace recorder thread scopes ring buffer", "[instrumentation][trace-recorder]")
+{
+    TraceRecorder& trace_recorder = TraceRecorder::Get();
+
+    SECTION("Only the latest scopes fitting in ring buffer are kept after wrap-around")
+    {
+        std::promise<void> scopes_recorded_promise;
+        std::promise<void> thread_exit_promise;
+        std::thread recording_thread([&trace_recorder, &scopes_recorded_promise, exit_future = thread_exit_promise.get_future()]()
+        {
+            trace_recorder.SetThreadName("TraceRecorderTest.WrapAround");
+            const uint64_t begin_ns = TraceRecorder::GetTimestampNs();
+            for(uint64_t index = 0U; index < 100U; ++index)
+            {
+                trace_recorder.AddScope("TraceRecorderTest.EarlyScope", begin_ns + index, begin_ns + index + 1U);
+            }
+            for(uint64_t index = 0U; index < TraceRecorder::thread_scopes_capacity; ++index)
+            {
+                trace_recorder.AddScope("TraceRecorderTest.LateScope", begin_ns + index, begin_ns + index + 1U);
+            }
+            scopes_recorded_promise.set_value();
+            exit_future.wait();
+        });
+        scopes_recorded_promise.get_future().wait();
+
+        std::vector<TraceEvent> events = ParseTraceEvents(WriteTrace());
+        std::optional<uint32_t> thread_id = FindThreadId(events, 1U, "TraceRecorderTest.WrapAround");
+        REQUIRE(thread_id.has_value());
+        // The earliest scope in ring buffer of the running thread is dropped, because it could be overwritten during reading
+        CHECK(CountScopes(events, "TraceRecorderTest.EarlyScope", thread_id) == 0U);
+        CHECK(CountScopes(events, "TraceRecorderTest.LateScope", thread_id) == TraceRecorder::thread_scopes_capacity - 1U);
+
+        thread_exit_promise.set_value();
+        recording_thread.join();
+
+        // All scopes of the finished thread are kept in trace after its ring buffer is released
+        events = ParseTraceEvents(WriteTrace());
+        thread_id = FindThreadId(events, 1U, "TraceRecorderTest.WrapAround");
+        REQUIRE(thread_id.has_value());
+        CHECK(CountScopes(events, "TraceRecorderTest.EarlyScope", thread_id) == 0U);
+        CHECK(CountScopes(events, "TraceRecorderTest.LateScope", thread_id) == TraceRecorder::thread_scopes_capacity);
+    }
+
+    SECTION("Scopes overwritten during trace writing are dropped")
+    {
+        // Even and odd scopes have different durations, so that scope fields torn by overwriting are detected
+        std::atomic<bool> is_recording{ true };
+        std::promise<void> thread_named_promise;
+        std::thread recording_thread([&trace_recorder, &is_recording, &thread_named_promise]()
+        {
+            trace_recorder.SetThreadName("TraceRecorderTest.Overwrite");
+            thread_named_promise.set_value();
+            const uint64_t begin_ns = TraceRecorder::GetTimestampNs();
+            for(uint64_t index = 0U; is_recording || index < 4U * TraceRecorder::thread_scopes_capacity; ++index)
+            {
+                const bool is_even = index % 2U == 0U;
+                trace_recorder.AddScope(is_even ? "TraceRecorderTest.EvenScope" : "TraceRecorderTest.OddScope",
+                                        begin_ns + index * 10U, begin_ns + index * 10U + (is_even ? 5U : 7U));
+            }
+        });
+        thread_named_promise.get_future().wait();
+
+        for(uint32_t write_index = 0U; write_index < 8U; ++write_index)
+        {
+            const std::vector<TraceEvent> events = ParseTraceEvents(WriteTrace());
+            const std::optional<uint32_t> thread_id = FindThreadId(events, 1U, "TraceRecorderTest.Overwrite");
+            REQUIRE(thread_id.has_value());
+
+            size_t scopes_count = 0U;
+            for(const TraceEvent& event : events)
+            {
+                if (event.phase != "X" || event.thread_id != *thread_id || event.process_id != 1U)
+                    continue;
+
+                scopes_count++;
+                CHECK(GetDurationNs(event) == (event.name == "TraceRecorderTest.EvenScope" ? 5 : 7));
+            }
+            CHECK(scopes_count <= TraceRecorder::thread_scopes_capacity);
+        }
+
+        is_recording = false;
+        recording_thread.join();
+    }
+
+    SECTION("Scopes of the earliest finished threads are dropped")
+    {
+        constexpr size_t threads_count = 4U;
+        constexpr size_t thread_scopes_count = TraceRecorder::finished_threads_scopes_capacity / 2U;
+        for(size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            std::thread recording_thread([&trace_recorder]()
+            {
+                const uint64_t begin_ns = TraceRecorder::GetTimestampNs();
+                for(uint64_t index = 0U; index < thread_scopes_count; ++index)
+                {
+                    trace_recorder.AddScope("TraceRecorderTest.FinishedThreadScope", begin_ns + index, begin_ns + index + 1U);
+                }
+            });
+            recording_thread.join();
+        }
+
+        const std::vector<TraceEvent> events = ParseTraceEvents(WriteTrace());
+        CHECK(CountScopes(events, "TraceRecorderTest.FinishedThreadScope") == TraceRecorder::finished_threads_scopes_capacity);
+    }
+}
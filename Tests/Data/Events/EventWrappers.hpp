@@ -61,6 +61,21 @@ public:
         Emit(&ITestEvents::Call, f);
     }
 
+    void EmitFooDeferred()
+    {
+        EmitDeferred(&ITestEvents::Foo);
+    }
+
+    void EmitBarDeferred(int a, bool b, float c)
+    {
+        EmitDeferred(&ITestEvents::Bar, a, b, c);
+    }
+
+    void EmitCallDeferred(const ITestEvents::CallFunc& f)
+    {
+        EmitDeferred(&ITestEvents::Call, f);
+    }
+
     using Emitter<ITestEvents>::GetConnectedReceiversCount;
 };
 
@@ -26,8 +26,54 @@ Benchmark connection and emit of events with emitter and receiver classes.
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 
+#include <atomic>
+#include <thread>
+
 using namespace Methane::Data;
 
+static constexpr uint32_t g_thread_emits_count = 1000U;
+
+// Receiver counting calls with atomics to be emitted from multiple threads
+class ThreadSafeTestReceiver
+    : public Receiver<ITestEvents>
+{
+public:
+    void Bind(TestEmitter& emitter)   { emitter.Connect(*this); }
+    void Unbind(TestEmitter& emitter) { emitter.Disconnect(*this); }
+
+    uint32_t GetBarCallCount() const { return m_bar_call_count.load(); }
+
+protected:
+    // ITestEvent implementation
+    void Foo() override                      { m_foo_call_count.fetch_add(1U, std::memory_order_relaxed); }
+    void Bar(int, bool, float) override      { m_bar_call_count.fetch_add(1U, std::memory_order_relaxed); }
+    void Call(const CallFunc&) override      { /* not used in benchmark */ }
+
+private:
+    std::atomic<uint32_t> m_foo_call_count{ 0U };
+    std::atomic<uint32_t> m_bar_call_count{ 0U };
+};
+
+static void EmitBarInParallelThreads(TestEmitter& emitter, uint32_t threads_count)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(threads_count);
+    for(uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+    {
+        threads.emplace_back([&emitter]()
+        {
+            for(uint32_t emit_index = 0U; emit_index < g_thread_emits_count; ++emit_index)
+            {
+                emitter.EmitBar(g_bar_a, g_bar_b, g_bar_c);
+            }
+        });
+    }
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
 static uint32_t MeasureEmitToManyReceivers(uint32_t receivers_count, Catch::Benchmark::Chronometer meter)
 {
     TestEmitter emitter;
@@ -119,6 +165,78 @@ static uint32_t MeasureConnectAndReceiveFromManyEmitters(uint32_t emitters_count
     return received_calls_count;
 }
 
+static uint32_t MeasureParallelEmitToManyReceivers(uint32_t threads_count, uint32_t receivers_count, Catch::Benchmark::Chronometer meter)
+{
+    TestEmitter emitter;
+    std::vector<ThreadSafeTestReceiver> receivers(receivers_count);
+
+    for(ThreadSafeTestReceiver& receiver : receivers)
+    {
+        receiver.Bind(emitter);
+    }
+
+    meter.measure([&]()
+    {
+        EmitBarInParallelThreads(emitter, threads_count);
+    });
+
+    // Prevent code removal by optimizer and check received calls count
+    uint32_t received_calls_count = 0U;
+    for(const ThreadSafeTestReceiver& receiver : receivers)
+    {
+        received_calls_count += receiver.GetBarCallCount();
+    }
+    CHECK(received_calls_count == receivers_count * threads_count * g_thread_emits_count * static_cast<uint32_t>(meter.runs()));
+    return received_calls_count;
+}
+
+static uint32_t MeasureParallelEmitWithConnectionsChange(uint32_t threads_count, uint32_t receivers_count, uint32_t changing_receivers_count,
+                                                        Catch::Benchmark::Chronometer meter)
+{
+    TestEmitter emitter;
+    std::vector<ThreadSafeTestReceiver> receivers(receivers_count);
+    std::vector<ThreadSafeTestReceiver> changing_receivers(changing_receivers_count);
+
+    for(ThreadSafeTestReceiver& receiver : receivers)
+    {
+        receiver.Bind(emitter);
+    }
+
+    uint32_t connections_changes_count = 0U;
+    meter.measure([&]()
+    {
+        // Receivers are connected and disconnected in a separate thread while emitting in parallel threads
+        std::atomic<bool> is_emitting{ true };
+        std::thread connections_thread([&]()
+        {
+            while(is_emitting)
+            {
+                for(ThreadSafeTestReceiver& receiver : changing_receivers)
+                {
+                    receiver.Bind(emitter);
+                }
+                for(ThreadSafeTestReceiver& receiver : changing_receivers)
+                {
+                    receiver.Unbind(emitter);
+                }
+                connections_changes_count++;
+            }
+        });
+        EmitBarInParallelThreads(emitter, threads_count);
+        is_emitting = false;
+        connections_thread.join();
+    });
+
+    // Prevent code removal by optimizer and check received calls count of permanently connected receivers
+    uint32_t received_calls_count = 0U;
+    for(const ThreadSafeTestReceiver& receiver : receivers)
+    {
+        received_calls_count += receiver.GetBarCallCount();
+    }
+    CHECK(received_calls_count == receivers_count * threads_count * g_thread_emits_count * static_cast<uint32_t>(meter.runs()));
+    return received_calls_count + connections_changes_count;
+}
+
 TEST_CASE("Benchmark connect and emit events", "[events][benchmark]")
 {
     SECTION("Emit to many receivers")
@@ -184,4 +302,36 @@ TEST_CASE("Benchmark connect and emit events", "[events][benchmark]")
             return MeasureConnectAndReceiveFromManyEmitters(1000, meter);
         };
     }
-}
\ No newline at end of file
+
+    SECTION("Emit to many receivers from parallel threads")
+    {
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 2 threads")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureParallelEmitToManyReceivers(2, 100, meter);
+        };
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 4 threads")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureParallelEmitToManyReceivers(4, 100, meter);
+        };
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 8 threads")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureParallelEmitToManyReceivers(8, 100, meter);
+        };
+    }
+
+    SECTION("Emit from parallel threads with connect and disconnect contention")
+    {
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 2 threads with 10 receivers reconnected")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureParallelEmitWithConnectionsChange(2, 100, 10, meter);
+        };
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 4 threads with 10 receivers reconnected")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureParallelEmitWithConnectionsChange(4, 100, 10, meter);
+        };
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 8 threads with 10 receivers reconnected")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureParallelEmitWithConnectionsChange(8, 100, 10, meter);
+        };
+    }
+}
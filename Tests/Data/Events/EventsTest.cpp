@@ -24,10 +24,14 @@ Unit tests of event connections with Emitter and Receiver classes
 #include "EventWrappers.hpp"
 
 #include <Methane/Data/Transmitter.hpp>
+#include <Methane/Data/EventQueue.h>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <thread>
+#include <atomic>
+#include <memory>
 
 using namespace Methane;
 using namespace Methane::Data;
@@ -522,4 +526,157 @@ TEST_CASE("Connect emitter to receiver through the transmitter", "[events]")
         CHECK_THROWS_AS(transmitter.Connect(receiver), TestTransmitter::NoTargetError);
         CHECK_THROWS_AS(transmitter.Disconnect(receiver), TestTransmitter::NoTargetError);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Emit deferred events through the event queue", "[events]")
+{
+    EventQueue   event_queue;
+    TestEmitter  emitter;
+    TestReceiver receiver;
+    receiver.CheckBind(emitter);
+
+    SECTION("Deferred events are emitted immediately when queue is not active")
+    {
+        CHECK_FALSE(EventQueue::GetDefault().IsActive());
+        CHECK_NOTHROW(emitter.EmitFooDeferred());
+        CHECK(receiver.GetFooCallCount() == 1U);
+
+        event_queue.SetActive(false);
+        emitter.SetEventQueue(&event_queue);
+        CHECK_NOTHROW(emitter.EmitFooDeferred());
+        CHECK(receiver.GetFooCallCount() == 2U);
+        CHECK(event_queue.GetQueuedEventsCount() == 0U);
+    }
+
+    SECTION("Deferred events are emitted on queue flush")
+    {
+        emitter.SetEventQueue(&event_queue);
+        CHECK(emitter.GetEventQueue() == &event_queue);
+
+        CHECK_NOTHROW(emitter.EmitFooDeferred());
+        CHECK_NOTHROW(emitter.EmitBarDeferred(g_bar_a, g_bar_b, g_bar_c));
+        CHECK_FALSE(receiver.IsFooCalled());
+        CHECK_FALSE(receiver.IsBarCalled());
+        CHECK(event_queue.GetQueuedEventsCount() == 2U);
+
+        CHECK_NOTHROW(event_queue.Flush());
+        CHECK(receiver.GetFooCallCount() == 1U);
+        CHECK(receiver.GetBarCallCount() == 1U);
+        CHECK(receiver.GetBarA() == g_bar_a);
+        CHECK(receiver.GetBarB() == g_bar_b);
+        CHECK(receiver.GetBarC() == g_bar_c);
+        CHECK(event_queue.GetQueuedEventsCount() == 0U);
+
+        CHECK_NOTHROW(event_queue.Flush());
+        CHECK(receiver.GetFooCallCount() == 1U);
+    }
+
+    SECTION("Identical deferred events are deduplicated")
+    {
+        emitter.SetEventQueue(&event_queue);
+
+        for(int i = 0; i < 5; ++i)
+        {
+            CHECK_NOTHROW(emitter.EmitFooDeferred());
+            CHECK_NOTHROW(emitter.EmitBarDeferred(g_bar_a, g_bar_b, g_bar_c));
+        }
+        CHECK_NOTHROW(emitter.EmitBarDeferred(g_bar_a + 1, g_bar_b, g_bar_c));
+        CHECK(event_queue.GetQueuedEventsCount() == 3U);
+        CHECK(event_queue.GetDeduplicatedEventsCount() == 8U);
+
+        CHECK_NOTHROW(event_queue.Flush());
+        CHECK(receiver.GetFooCallCount() == 1U);
+        CHECK(receiver.GetBarCallCount() == 2U);
+        CHECK(receiver.GetBarA() == g_bar_a + 1);
+    }
+
+    SECTION("Deferred events of destroyed emitter are discarded")
+    {
+        TestReceiver other_receiver;
+        {
+            TestEmitter other_emitter;
+            other_emitter.SetEventQueue(&event_queue);
+            other_receiver.CheckBind(other_emitter);
+            CHECK_NOTHROW(other_emitter.EmitFooDeferred());
+            CHECK(event_queue.GetQueuedEventsCount() == 1U);
+        }
+        CHECK(event_queue.GetQueuedEventsCount() == 0U);
+        CHECK_NOTHROW(event_queue.Flush());
+        CHECK_FALSE(other_receiver.IsFooCalled());
+    }
+
+    SECTION("Deferred events of emitter destroyed during flush are discarded")
+    {
+        TestReceiver other_receiver;
+        auto other_emitter_ptr = std::make_unique<TestEmitter>();
+        other_emitter_ptr->SetEventQueue(&event_queue);
+        other_receiver.CheckBind(*other_emitter_ptr);
+        emitter.SetEventQueue(&event_queue);
+
+        CHECK_NOTHROW(emitter.EmitCallDeferred([&other_emitter_ptr](int32_t) { other_emitter_ptr.reset(); }));
+        CHECK_NOTHROW(other_emitter_ptr->EmitFooDeferred());
+        CHECK(event_queue.GetQueuedEventsCount() == 2U);
+
+        CHECK_NOTHROW(event_queue.Flush());
+        CHECK(receiver.GetFuncCallCount() == 1U);
+        CHECK_FALSE(other_receiver.IsFooCalled());
+        CHECK(event_queue.GetQueuedEventsCount() == 0U);
+    }
+
+    SECTION("Emitter without deferred events is destroyed without waiting for flush on other thread")
+    {
+        emitter.SetEventQueue(&event_queue);
+
+        std::atomic<bool> is_flush_started{ false };
+        std::atomic<bool> is_emitter_destroyed{ false };
+        CHECK_NOTHROW(emitter.EmitCallDeferred([&is_flush_started, &is_emitter_destroyed](int32_t)
+        {
+            is_flush_started = true;
+            while (!is_emitter_destroyed)
+                std::this_thread::yield();
+        }));
+        CHECK_NOTHROW(emitter.EmitFooDeferred());
+
+        std::thread flushing_thread([&event_queue] { event_queue.Flush(); });
+        while (!is_flush_started)
+            std::this_thread::yield();
+        {
+            TestEmitter other_emitter;
+            other_emitter.SetEventQueue(&event_queue);
+        }
+        is_emitter_destroyed = true;
+        flushing_thread.join();
+
+        CHECK(receiver.GetFuncCallCount() == 1U);
+        CHECK(receiver.GetFooCallCount() == 1U);
+    }
+
+    SECTION("Deferred events emitted during flush are emitted on the next flush")
+    {
+        emitter.SetEventQueue(&event_queue);
+
+        CHECK_NOTHROW(emitter.EmitCallDeferred([&emitter](int32_t) { emitter.EmitFooDeferred(); }));
+        CHECK_NOTHROW(event_queue.Flush());
+        CHECK(receiver.GetFuncCallCount() == 1U);
+        CHECK_FALSE(receiver.IsFooCalled());
+        CHECK(event_queue.GetQueuedEventsCount() == 1U);
+
+        CHECK_NOTHROW(event_queue.Flush());
+        CHECK(receiver.GetFooCallCount() == 1U);
+    }
+
+    SECTION("Deferred events pushed from other thread are emitted on flush thread")
+    {
+        emitter.SetEventQueue(&event_queue);
+
+        std::thread emitting_thread([&emitter]
+        {
+            emitter.EmitFooDeferred();
+            emitter.EmitFooDeferred();
+        });
+        emitting_thread.join();
+        CHECK_FALSE(receiver.IsFooCalled());
+
+        CHECK_NOTHROW(event_queue.Flush());
+        CHECK(receiver.GetFooCallCount() == 1U);
+    }
+}
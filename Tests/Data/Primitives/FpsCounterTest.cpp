@@ -0,0 +1,216 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/FpsCounterTest.cpp
+Unit tests of FpsCounter moving average and frame timing statistics
+
+******************************************************************************/
+
+#include <Methane/Data/FpsCounter.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <vector>
+
+using namespace Methane::Data;
+using Catch::Matchers::WithinRel;
+using Catch::Matchers::WithinAbs;
+
+using Histogram = FpsCounter::Histogram;
+
+// Relative error of durations approximated by histogram bucket
+static constexpr double g_bucket_precision = 1.0 / Histogram::octave_buckets_count;
+
+static void AddFrameTimings(FpsCounter& fps_counter, const std::vector<double>& total_times_ms)
+{
+    for(const double total_time_ms : total_times_ms)
+    {
+        fps_counter.OnFramePresented(FrameTiming(total_time_ms / 1000.0, total_time_ms / 4000.0, total_time_ms / 8000.0));
+    }
+}
+
+TEST_CASE("FPS counter frame durations histogram", "[fps-counter]")
+{
+    SECTION("Bucket index is not decreasing with duration growth")
+    {
+        uint32_t prev_bucket_index = 0U;
+        for(uint64_t duration_us = 0U; duration_us < 10'000'000U; duration_us += duration_us / 17U + 1U)
+        {
+            const uint32_t bucket_index = Histogram::GetBucketIndex(duration_us);
+            CHECK(bucket_index >= prev_bucket_index);
+            CHECK(bucket_index < Histogram::buckets_count);
+            prev_bucket_index = bucket_index;
+        }
+    }
+
+    SECTION("Duration is within its bucket bounds")
+    {
+        for(uint64_t duration_us = Histogram::octave_buckets_count; duration_us < 10'000'000U; duration_us += duration_us / 13U + 1U)
+        {
+            const uint32_t bucket_index = Histogram::GetBucketIndex(duration_us);
+            CHECK(Histogram::GetBucketBeginDuration(bucket_index) <= duration_us);
+            CHECK(Histogram::GetBucketBeginDuration(bucket_index + 1U) > duration_us);
+        }
+    }
+
+    SECTION("Empty histogram has zero percentiles")
+    {
+        const Histogram histogram;
+        CHECK(histogram.GetCount() == 0U);
+        CHECK(histogram.GetPercentileDurationSec(50.0) == 0.0);
+    }
+
+    SECTION("Percentiles of uniformly distributed durations")
+    {
+        Histogram histogram;
+        for(uint32_t duration_ms = 1U; duration_ms <= 100U; ++duration_ms)
+        {
+            histogram.Add(duration_ms / 1000.0);
+        }
+        CHECK(histogram.GetCount() == 100U);
+        CHECK_THAT(histogram.GetPercentileDurationSec(50.0), WithinRel(0.050, g_bucket_precision));
+        CHECK_THAT(histogram.GetPercentileDurationSec(90.0), WithinRel(0.090, g_bucket_precision));
+        CHECK_THAT(histogram.GetPercentileDurationSec(99.0), WithinRel(0.099, g_bucket_precision));
+        CHECK_THAT(histogram.GetPercentileDurationSec(100.0), WithinRel(0.100, g_bucket_precision));
+    }
+
+    SECTION("Removed durations are not counted in percentiles")
+    {
+        Histogram histogram;
+        histogram.Add(0.010);
+        histogram.Add(0.020);
+        histogram.Add(0.100);
+        histogram.Remove(0.100);
+        CHECK(histogram.GetCount() == 2U);
+        CHECK_THAT(histogram.GetPercentileDurationSec(100.0), WithinRel(0.020, g_bucket_precision));
+
+        histogram.Clear();
+        CHECK(histogram.GetCount() == 0U);
+        CHECK(histogram.GetPercentileDurationSec(100.0) == 0.0);
+    }
+}
+
+TEST_CASE("FPS counter moving average of frame timings", "[fps-counter]")
+{
+    SECTION("Counter without frames has zero timings")
+    {
+        const FpsCounter fps_counter;
+        CHECK(fps_counter.GetAveragedTimingsCount() == 0U);
+        CHECK(fps_counter.GetFramesPerSecond() == 0U);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeSec() == 0.0);
+        CHECK(fps_counter.GetPercentileFrameTiming(50.0).GetTotalTimeSec() == 0.0);
+        CHECK(fps_counter.GetFrameTimingStatistics(0.016).frames_count == 0U);
+    }
+
+    SECTION("Average frame timing and frames per second")
+    {
+        FpsCounter fps_counter(10U);
+        AddFrameTimings(fps_counter, { 10.0, 20.0, 30.0 });
+
+        const FrameTiming average_timing = fps_counter.GetAverageFrameTiming();
+        CHECK(fps_counter.GetAveragedTimingsCount() == 3U);
+        CHECK(fps_counter.GetFramesPerSecond() == 50U);
+        CHECK_THAT(average_timing.GetTotalTimeMSec(), WithinRel(20.0, 1E-9));
+        CHECK_THAT(average_timing.GetPresentTimeMSec(), WithinRel(5.0, 1E-9));
+        CHECK_THAT(average_timing.GetGpuWaitTimeMSec(), WithinRel(2.5, 1E-9));
+        CHECK_THAT(average_timing.GetCpuTimeMSec(), WithinRel(12.5, 1E-9));
+    }
+
+    SECTION("Only the latest frame timings are averaged in window")
+    {
+        FpsCounter fps_counter(4U);
+        AddFrameTimings(fps_counter, { 100.0, 100.0, 10.0, 20.0, 30.0, 40.0 });
+
+        CHECK(fps_counter.GetAveragedTimingsCount() == 4U);
+        CHECK_THAT(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec(), WithinRel(25.0, 1E-9));
+        CHECK_THAT(fps_counter.GetPercentileFrameTiming(100.0).GetTotalTimeMSec(), WithinRel(40.0, g_bucket_precision));
+        CHECK(fps_counter.GetFrameTimingStatistics(0.0).frames_count == 4U);
+    }
+
+    SECTION("Frame timings are not collected with zero window size")
+    {
+        FpsCounter fps_counter(0U);
+        AddFrameTimings(fps_counter, { 10.0, 20.0 });
+        CHECK(fps_counter.GetAveragedTimingsCount() == 0U);
+        CHECK(fps_counter.GetFramesPerSecond() == 0U);
+    }
+
+    SECTION("Reset clears frame timings and changes window size")
+    {
+        FpsCounter fps_counter(4U);
+        AddFrameTimings(fps_counter, { 10.0, 20.0, 30.0 });
+        fps_counter.Reset(2U);
+
+        CHECK(fps_counter.GetAveragedTimingsCount() == 0U);
+        CHECK(fps_counter.GetPercentileFrameTiming(50.0).GetTotalTimeSec() == 0.0);
+
+        AddFrameTimings(fps_counter, { 10.0, 20.0, 30.0 });
+        CHECK(fps_counter.GetAveragedTimingsCount() == 2U);
+        CHECK_THAT(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec(), WithinRel(25.0, 1E-9));
+    }
+}
+
+TEST_CASE("FPS counter frame timing statistics", "[fps-counter]")
+{
+    SECTION("Percentiles are calculated for every component of frame timing")
+    {
+        FpsCounter fps_counter(100U);
+        std::vector<double> total_times_ms;
+        for(uint32_t frame_index = 1U; frame_index <= 100U; ++frame_index)
+        {
+            total_times_ms.push_back(static_cast<double>(frame_index));
+        }
+        AddFrameTimings(fps_counter, total_times_ms);
+
+        const FrameTimingStatistics statistics = fps_counter.GetFrameTimingStatistics(0.0);
+        CHECK(statistics.frames_count == 100U);
+        CHECK_THAT(statistics.p50.GetTotalTimeMSec(), WithinRel(50.0, g_bucket_precision));
+        CHECK_THAT(statistics.p90.GetTotalTimeMSec(), WithinRel(90.0, g_bucket_precision));
+        CHECK_THAT(statistics.p99.GetTotalTimeMSec(), WithinRel(99.0, g_bucket_precision));
+        CHECK_THAT(statistics.p99_9.GetTotalTimeMSec(), WithinRel(100.0, g_bucket_precision));
+        CHECK_THAT(statistics.p50.GetPresentTimeMSec(), WithinRel(12.5, g_bucket_precision));
+        CHECK_THAT(statistics.p90.GetGpuWaitTimeMSec(), WithinRel(11.25, g_bucket_precision));
+    }
+
+    SECTION("Frame time deviation and over budget frames count")
+    {
+        FpsCounter fps_counter(10U);
+        AddFrameTimings(fps_counter, { 10.0, 30.0, 10.0, 30.0 });
+
+        const FrameTimingStatistics statistics = fps_counter.GetFrameTimingStatistics(0.020);
+        CHECK(statistics.frames_count == 4U);
+        CHECK(statistics.over_budget_frames_count == 2U);
+        CHECK_THAT(statistics.total_time_variance_sec2, WithinRel(1E-4, 1E-9));
+        CHECK_THAT(statistics.GetTotalTimeDeviationMSec(), WithinRel(10.0, 1E-9));
+    }
+
+    SECTION("Frames are not counted over budget when budget is not set")
+    {
+        FpsCounter fps_counter(10U);
+        AddFrameTimings(fps_counter, { 10.0, 30.0 });
+        CHECK(fps_counter.GetFrameTimingStatistics(0.0).over_budget_frames_count == 0U);
+    }
+
+    SECTION("Stable frame timings have zero deviation")
+    {
+        FpsCounter fps_counter(10U);
+        AddFrameTimings(fps_counter, { 16.0, 16.0, 16.0 });
+        CHECK_THAT(fps_counter.GetFrameTimingStatistics(0.020).GetTotalTimeDeviationMSec(), WithinAbs(0.0, 1E-6));
+    }
+}
@@ -0,0 +1,142 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/FreeRangeSetTest.cpp
+Unit tests of the FreeRangeSet with best-fit reservation of ranges
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Data/FreeRangeSet.hpp>
+
+#include <random>
+#include <vector>
+#include <algorithm>
+
+using namespace Methane::Data;
+
+using Ranges = std::vector<Range<uint32_t>>;
+
+// Reference best-fit search: the first of the shortest free ranges fitting the reserved length
+static Range<uint32_t> FindBestFitRange(const RangeSet<uint32_t>& free_ranges, uint32_t reserved_length)
+{
+    Range<uint32_t> best_range;
+    for (const Range<uint32_t>& free_range : free_ranges)
+    {
+        if (free_range.GetLength() >= reserved_length &&
+            (best_range.IsEmpty() || free_range.GetLength() < best_range.GetLength()))
+            best_range = free_range;
+    }
+    return best_range.IsEmpty() ? best_range : Range<uint32_t>(best_range.GetStart(), best_range.GetStart() + reserved_length);
+}
+
+TEST_CASE("Free range set best-fit reservation", "[range-set][free-range-set]")
+{
+    FreeRangeSet<uint32_t> free_ranges;
+    free_ranges.Add({ 0, 64 });
+    free_ranges.Add({ 100, 116 });
+    free_ranges.Add({ 200, 212 });
+    free_ranges.Add({ 300, 312 });
+
+    SECTION("Smallest fitting range is reserved")
+    {
+        CHECK(free_ranges.ReserveBestFit(10) == Range<uint32_t>(200, 210));
+        CHECK(free_ranges.GetRanges() == Ranges{ { 0, 64 }, { 100, 116 }, { 210, 212 }, { 300, 312 } });
+    }
+
+    SECTION("Range with exact length is reserved entirely")
+    {
+        CHECK(free_ranges.ReserveBestFit(16) == Range<uint32_t>(100, 116));
+        CHECK(free_ranges.GetRanges() == Ranges{ { 0, 64 }, { 200, 212 }, { 300, 312 } });
+    }
+
+    SECTION("Range of larger size-class is reserved when size-class of length has no fitting range")
+    {
+        CHECK(free_ranges.ReserveBestFit(13) == Range<uint32_t>(100, 113));
+        CHECK(free_ranges.ReserveBestFit(17) == Range<uint32_t>(0, 17));
+    }
+
+    SECTION("Empty range is returned when no range fits")
+    {
+        CHECK(free_ranges.ReserveBestFit(65).IsEmpty());
+        CHECK(free_ranges.ReserveBestFit(0).IsEmpty());
+        CHECK(free_ranges.Size() == 4);
+    }
+
+    SECTION("Merged ranges are reserved with their merged length")
+    {
+        free_ranges.Add({ 64, 100 });
+        CHECK(free_ranges.GetMaxRangeLength() == 116);
+        CHECK(free_ranges.ReserveBestFit(116) == Range<uint32_t>(0, 116));
+        CHECK(free_ranges.GetMaxRangeLength() == 12);
+    }
+
+    SECTION("Removed ranges are not reserved")
+    {
+        free_ranges.Remove({ 100, 312 });
+        CHECK(free_ranges.ReserveBestFit(12) == Range<uint32_t>(0, 12));
+        CHECK(free_ranges.GetRanges() == Ranges{ { 12, 64 } });
+    }
+
+    SECTION("Cleared set has no ranges to reserve")
+    {
+        free_ranges.Clear();
+        CHECK(free_ranges.IsEmpty());
+        CHECK(free_ranges.GetMaxRangeLength() == 0);
+        CHECK(free_ranges.ReserveBestFit(1).IsEmpty());
+    }
+}
+
+TEST_CASE("Free range set matches linear best-fit search", "[range-set][free-range-set]")
+{
+    std::mt19937 random_engine(1234U);
+    std::uniform_int_distribution<uint32_t> offset_distribution(0U, 4095U);
+    std::uniform_int_distribution<uint32_t> length_distribution(1U, 64U);
+
+    FreeRangeSet<uint32_t> free_ranges;
+    RangeSet<uint32_t>     reference_ranges;
+    free_ranges.Add({ 0U, 4096U });
+    reference_ranges.Add({ 0U, 4096U });
+
+    for (uint32_t step = 0U; step < 10000U; ++step)
+    {
+        const uint32_t length = length_distribution(random_engine);
+        if (step % 3U)
+        {
+            const Range<uint32_t> expected_range = FindBestFitRange(reference_ranges, length);
+            reference_ranges.Remove(expected_range);
+            REQUIRE(free_ranges.ReserveBestFit(length) == expected_range);
+        }
+        else
+        {
+            const uint32_t offset = offset_distribution(random_engine);
+            const Range<uint32_t> released_range(offset, std::min(offset + length, 4096U));
+            free_ranges.Add(released_range);
+            reference_ranges.Add(released_range);
+        }
+        REQUIRE(free_ranges.GetRanges() == reference_ranges);
+
+        uint32_t max_range_length = 0U;
+        for (const Range<uint32_t>& reference_range : reference_ranges)
+        {
+            max_range_length = std::max(max_range_length, reference_range.GetLength());
+        }
+        REQUIRE(free_ranges.GetMaxRangeLength() == max_range_length);
+    }
+}
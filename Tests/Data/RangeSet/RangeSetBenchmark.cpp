@@ -0,0 +1,298 @@
+/******************************************************************************
+
+Copyright 2020 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/RangeSetBenchmark.cpp
+Benchmark of flat RangeSet operations in comparison with node-based range set
+and of FreeRangeSet best-fit reservation in comparison with linear search.
+
+******************************************************************************/
+
+#include "NodeRangeSet.hpp"
+
+#include <Methane/Data/RangeSet.hpp>
+#include <Methane/Data/FreeRangeSet.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane::Data;
+
+// Ranges [2*i, 2*i+1) are not mergeable with each other, so every range is stored separately
+static std::vector<Range<uint32_t>> GetSparseRanges(uint32_t ranges_count, uint32_t offset = 0U)
+{
+    std::vector<Range<uint32_t>> ranges;
+    ranges.reserve(ranges_count);
+    for (uint32_t i = 0U; i < ranges_count; ++i)
+    {
+        ranges.emplace_back(2U * i + offset, 2U * i + offset + 1U);
+    }
+    return ranges;
+}
+
+template<typename RangeSetType>
+static size_t MeasureAddRanges(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    const std::vector<Range<uint32_t>> ranges = GetSparseRanges(ranges_count);
+    size_t ranges_size = 0U;
+    meter.measure([&]()
+    {
+        RangeSetType range_set;
+        for (const Range<uint32_t>& range : ranges)
+        {
+            range_set.Add(range);
+        }
+        ranges_size += range_set.Size();
+    });
+    return ranges_size;
+}
+
+template<typename RangeSetType>
+static size_t MeasureReserveAndReleaseRanges(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    RangeSetType range_set;
+    for (const Range<uint32_t>& range : GetSparseRanges(ranges_count))
+    {
+        range_set.Add(range);
+    }
+
+    // Release range between two free ranges merges them together and reserve splits them back
+    const Range<uint32_t> churn_range(ranges_count - 1U, ranges_count);
+    meter.measure([&]()
+    {
+        range_set.Add(churn_range);
+        range_set.Remove(churn_range);
+    });
+
+    CHECK(range_set.Size() == ranges_count);
+    return range_set.Size();
+}
+
+static size_t MeasureBulkAddRanges(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    const std::vector<Range<uint32_t>> ranges = GetSparseRanges(ranges_count);
+    const std::vector<Range<uint32_t>> joint_ranges = GetSparseRanges(ranges_count, 1U);
+    size_t ranges_size = 0U;
+    meter.measure([&]()
+    {
+        RangeSet<uint32_t> range_set;
+        range_set.AddRanges(ranges);
+        range_set.AddRanges(joint_ranges);
+        ranges_size += range_set.Size();
+    });
+    return ranges_size;
+}
+
+static size_t MeasureBulkRemoveRanges(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    const std::vector<Range<uint32_t>> ranges = GetSparseRanges(ranges_count, 1U);
+    size_t ranges_size = 0U;
+    meter.measure([&]()
+    {
+        RangeSet<uint32_t> range_set{ { 0U, 2U * ranges_count } };
+        range_set.RemoveRanges(ranges);
+        ranges_size += range_set.Size();
+    });
+    return ranges_size;
+}
+
+// Free ranges of odd lengths 3, 5, ... 65 repeated and separated with reserved gaps, similar to fragmented root constant storage
+static std::vector<Range<uint32_t>> GetFragmentedFreeRanges(uint32_t ranges_count)
+{
+    std::vector<Range<uint32_t>> ranges;
+    ranges.reserve(ranges_count);
+    uint32_t offset = 0U;
+    for (uint32_t i = 0U; i < ranges_count; ++i)
+    {
+        const uint32_t length = 3U + 2U * (i % 32U);
+        ranges.emplace_back(offset, offset + length);
+        offset += length + 1U;
+    }
+    return ranges;
+}
+
+// Best-fit reservation with linear search of the smallest fitting range in range set
+static Range<uint32_t> ReserveBestFitRangeLinear(RangeSet<uint32_t>& free_ranges, uint32_t reserved_length)
+{
+    auto best_range_it = free_ranges.end();
+    for (auto range_it = free_ranges.begin(); range_it != free_ranges.end(); ++range_it)
+    {
+        if (range_it->GetLength() < reserved_length ||
+            (best_range_it != free_ranges.end() && range_it->GetLength() >= best_range_it->GetLength()))
+            continue;
+
+        best_range_it = range_it;
+        if (range_it->GetLength() == reserved_length)
+            break;
+    }
+
+    if (best_range_it == free_ranges.end())
+        return Range<uint32_t>();
+
+    const Range<uint32_t> reserved_range(best_range_it->GetStart(), best_range_it->GetStart() + reserved_length);
+    free_ranges.Remove(reserved_range);
+    return reserved_range;
+}
+
+template<typename RangeSetType, typename ReserveFuncType>
+static size_t MeasureBestFitReserveAndRelease(uint32_t ranges_count, Catch::Benchmark::Chronometer meter, const ReserveFuncType& reserve_range)
+{
+    RangeSetType free_ranges;
+    for (const Range<uint32_t>& range : GetFragmentedFreeRanges(ranges_count))
+    {
+        free_ranges.Add(range);
+    }
+
+    // Even reserved lengths are never available exactly, so the best fit is searched among all larger ranges
+    uint32_t reserved_length = 0U;
+    meter.measure([&]()
+    {
+        reserved_length = reserved_length % 64U + 2U;
+        const Range<uint32_t> reserved_range = reserve_range(free_ranges, reserved_length);
+        free_ranges.Add(reserved_range);
+        return reserved_range.GetStart();
+    });
+
+    CHECK(free_ranges.Size() == ranges_count);
+    return free_ranges.Size();
+}
+
+static size_t MeasureLinearBestFit(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    return MeasureBestFitReserveAndRelease<RangeSet<uint32_t>>(ranges_count, meter, ReserveBestFitRangeLinear);
+}
+
+static size_t MeasureBucketsBestFit(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    return MeasureBestFitReserveAndRelease<FreeRangeSet<uint32_t>>(ranges_count, meter,
+        [](FreeRangeSet<uint32_t>& free_ranges, uint32_t reserved_length) { return free_ranges.ReserveBestFit(reserved_length); });
+}
+
+TEST_CASE("Benchmark range set operations", "[range-set][benchmark]")
+{
+    SECTION("Add many ranges")
+    {
+        BENCHMARK_ADVANCED("Add 10 ranges to node range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureAddRanges<NodeRangeSet<uint32_t>>(10, meter);
+        };
+        BENCHMARK_ADVANCED("Add 10 ranges to flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureAddRanges<RangeSet<uint32_t>>(10, meter);
+        };
+        BENCHMARK_ADVANCED("Add 1000 ranges to node range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureAddRanges<NodeRangeSet<uint32_t>>(1000, meter);
+        };
+        BENCHMARK_ADVANCED("Add 1000 ranges to flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureAddRanges<RangeSet<uint32_t>>(1000, meter);
+        };
+        BENCHMARK_ADVANCED("Add 100000 ranges to node range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureAddRanges<NodeRangeSet<uint32_t>>(100000, meter);
+        };
+        BENCHMARK_ADVANCED("Add 100000 ranges to flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureAddRanges<RangeSet<uint32_t>>(100000, meter);
+        };
+    }
+
+    SECTION("Reserve and release range in set of many ranges")
+    {
+        BENCHMARK_ADVANCED("Reserve and release in node range set of 10 ranges")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureReserveAndReleaseRanges<NodeRangeSet<uint32_t>>(10, meter);
+        };
+        BENCHMARK_ADVANCED("Reserve and release in flat range set of 10 ranges")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureReserveAndReleaseRanges<RangeSet<uint32_t>>(10, meter);
+        };
+        BENCHMARK_ADVANCED("Reserve and release in node range set of 1000 ranges")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureReserveAndReleaseRanges<NodeRangeSet<uint32_t>>(1000, meter);
+        };
+        BENCHMARK_ADVANCED("Reserve and release in flat range set of 1000 ranges")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureReserveAndReleaseRanges<RangeSet<uint32_t>>(1000, meter);
+        };
+        BENCHMARK_ADVANCED("Reserve and release in node range set of 100000 ranges")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureReserveAndReleaseRanges<NodeRangeSet<uint32_t>>(100000, meter);
+        };
+        BENCHMARK_ADVANCED("Reserve and release in flat range set of 100000 ranges")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureReserveAndReleaseRanges<RangeSet<uint32_t>>(100000, meter);
+        };
+    }
+
+    SECTION("Bulk add and remove of many ranges")
+    {
+        BENCHMARK_ADVANCED("Bulk add 10 ranges to flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureBulkAddRanges(10, meter);
+        };
+        BENCHMARK_ADVANCED("Bulk add 1000 ranges to flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureBulkAddRanges(1000, meter);
+        };
+        BENCHMARK_ADVANCED("Bulk add 100000 ranges to flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureBulkAddRanges(100000, meter);
+        };
+        BENCHMARK_ADVANCED("Bulk remove 10 ranges from flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureBulkRemoveRanges(10, meter);
+        };
+        BENCHMARK_ADVANCED("Bulk remove 1000 ranges from flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureBulkRemoveRanges(1000, meter);
+        };
+        BENCHMARK_ADVANCED("Bulk remove 100000 ranges from flat range set")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureBulkRemoveRanges(100000, meter);
+        };
+    }
+}
+
+TEST_CASE("Benchmark best-fit reservation of free ranges", "[range-set][free-range-set][benchmark]")
+{
+    BENCHMARK_ADVANCED("Best-fit reserve and release with linear search in 16 free ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureLinearBestFit(16, meter);
+    };
+    BENCHMARK_ADVANCED("Best-fit reserve and release with size-class buckets in 16 free ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureBucketsBestFit(16, meter);
+    };
+    BENCHMARK_ADVANCED("Best-fit reserve and release with linear search in 256 free ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureLinearBestFit(256, meter);
+    };
+    BENCHMARK_ADVANCED("Best-fit reserve and release with size-class buckets in 256 free ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureBucketsBestFit(256, meter);
+    };
+    BENCHMARK_ADVANCED("Best-fit reserve and release with linear search in 4096 free ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureLinearBestFit(4096, meter);
+    };
+    BENCHMARK_ADVANCED("Best-fit reserve and release with size-class buckets in 4096 free ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureBucketsBestFit(4096, meter);
+    };
+}
@@ -156,4 +156,76 @@ TEST_CASE("Range set remove", "[range-set]")
         const std::set<Range<uint32_t>> reference_set{ { 0, 2 }, { 4, 8 }, { 11, 12 }, { 17, 20 } };
         CHECK(range_set == reference_set);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Range set bulk operations", "[range-set]")
+{
+    const RangeSet<uint32_t> test_range_set{
+        { 0, 2 }, { 4, 8 }, { 11, 12 }, { 17, 20 }, { 25, 29 }
+    };
+
+    SECTION("Add sorted ranges")
+    {
+        RangeSet<uint32_t> range_set(test_range_set);
+        const std::vector<Range<uint32_t>> add_ranges{ { 2, 3 }, { 9, 10 }, { 12, 17 }, { 30, 32 } };
+        range_set.AddRanges(add_ranges);
+
+        const std::set<Range<uint32_t>> reference_set{ { 0, 3 }, { 4, 8 }, { 9, 10 }, { 11, 20 }, { 25, 29 }, { 30, 32 } };
+        CHECK(range_set == reference_set);
+    }
+
+    SECTION("Add unsorted overlapping ranges")
+    {
+        RangeSet<uint32_t> range_set(test_range_set);
+        const std::vector<Range<uint32_t>> add_ranges{ { 26, 35 }, { 5, 12 }, { 6, 14 } };
+        range_set.AddRanges(add_ranges);
+
+        const std::set<Range<uint32_t>> reference_set{ { 0, 2 }, { 4, 14 }, { 17, 20 }, { 25, 35 } };
+        CHECK(range_set == reference_set);
+    }
+
+    SECTION("Remove sorted ranges")
+    {
+        RangeSet<uint32_t> range_set(test_range_set);
+        const std::vector<Range<uint32_t>> remove_ranges{ { 1, 5 }, { 6, 7 }, { 10, 18 }, { 26, 27 } };
+        range_set.RemoveRanges(remove_ranges);
+
+        const std::set<Range<uint32_t>> reference_set{ { 0, 1 }, { 5, 6 }, { 7, 8 }, { 18, 20 }, { 25, 26 }, { 27, 29 } };
+        CHECK(range_set == reference_set);
+    }
+
+    SECTION("Remove unsorted ranges")
+    {
+        RangeSet<uint32_t> range_set(test_range_set);
+        const std::vector<Range<uint32_t>> remove_ranges{ { 26, 27 }, { 1, 5 }, { 10, 18 }, { 6, 7 } };
+        range_set.RemoveRanges(remove_ranges);
+
+        const std::set<Range<uint32_t>> reference_set{ { 0, 1 }, { 5, 6 }, { 7, 8 }, { 18, 20 }, { 25, 26 }, { 27, 29 } };
+        CHECK(range_set == reference_set);
+    }
+
+    SECTION("Union of range sets")
+    {
+        RangeSet<uint32_t> range_set(test_range_set);
+        range_set.Union({ { 2, 4 }, { 12, 15 }, { 40, 50 } });
+
+        const std::set<Range<uint32_t>> reference_set{ { 0, 8 }, { 11, 15 }, { 17, 20 }, { 25, 29 }, { 40, 50 } };
+        CHECK(range_set == reference_set);
+    }
+
+    SECTION("Intersection of range sets")
+    {
+        RangeSet<uint32_t> range_set(test_range_set);
+        range_set.Intersect({ { 1, 5 }, { 6, 7 }, { 10, 26 } });
+
+        const std::set<Range<uint32_t>> reference_set{ { 1, 2 }, { 4, 5 }, { 6, 7 }, { 11, 12 }, { 17, 20 }, { 25, 26 } };
+        CHECK(range_set == reference_set);
+    }
+
+    SECTION("Intersection with empty range set")
+    {
+        RangeSet<uint32_t> range_set(test_range_set);
+        range_set.Intersect({ });
+        CHECK(range_set.IsEmpty());
+    }
+}
@@ -0,0 +1,146 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Types/FlatMapTest.cpp
+Unit-tests of the FlatMap data type.
+
+******************************************************************************/
+
+#include <Methane/Data/FlatMap.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Methane::Data;
+
+using TestFlatMap = FlatMap<int, std::string>;
+
+static std::vector<int> GetKeys(const TestFlatMap& flat_map)
+{
+    std::vector<int> keys;
+    for(const auto& [key, value] : flat_map)
+        keys.push_back(key);
+    return keys;
+}
+
+TEST_CASE("Flat Map Initialization", "[flat-map][init]")
+{
+    SECTION("Default Initialization")
+    {
+        const TestFlatMap flat_map;
+        CHECK(flat_map.empty());
+        CHECK(flat_map.size() == 0U);
+        CHECK(flat_map.begin() == flat_map.end());
+    }
+
+    SECTION("Initialization from Range of Pairs")
+    {
+        const std::vector<std::pair<int, std::string>> pairs{ { 3, "c" }, { 1, "a" }, { 2, "b" }, { 1, "x" } };
+        const TestFlatMap flat_map(pairs.begin(), pairs.end());
+        CHECK(flat_map.size() == 3U);
+        CHECK(GetKeys(flat_map) == std::vector<int>{ 1, 2, 3 });
+        CHECK(flat_map.find(1)->second == "a");
+    }
+
+    SECTION("Initialization from Standard Map")
+    {
+        const std::map<int, std::string> std_map{ { 5, "e" }, { 4, "d" } };
+        const TestFlatMap flat_map(std_map.begin(), std_map.end());
+        CHECK(GetKeys(flat_map) == std::vector<int>{ 4, 5 });
+    }
+}
+
+TEST_CASE("Flat Map Modification", "[flat-map][modify]")
+{
+    TestFlatMap flat_map;
+    flat_map.try_emplace(20, "twenty");
+    flat_map.try_emplace(10, "ten");
+    flat_map.try_emplace(30, "thirty");
+
+    SECTION("Elements are Sorted by Key")
+    {
+        CHECK(GetKeys(flat_map) == std::vector<int>{ 10, 20, 30 });
+    }
+
+    SECTION("Emplace New Element")
+    {
+        const auto [it, is_added] = flat_map.try_emplace(15, "fifteen");
+        CHECK(is_added);
+        CHECK(it->first == 15);
+        CHECK(it->second == "fifteen");
+        CHECK(GetKeys(flat_map) == std::vector<int>{ 10, 15, 20, 30 });
+    }
+
+    SECTION("Emplace Existing Element Does Not Change It")
+    {
+        const auto [it, is_added] = flat_map.try_emplace(20, "other");
+        CHECK_FALSE(is_added);
+        CHECK(it->second == "twenty");
+        CHECK(flat_map.size() == 3U);
+    }
+
+    SECTION("Find and Contains Elements")
+    {
+        CHECK(flat_map.contains(10));
+        CHECK(flat_map.contains(30));
+        CHECK_FALSE(flat_map.contains(25));
+        CHECK(flat_map.find(25) == flat_map.end());
+        REQUIRE(flat_map.find(30) != flat_map.end());
+        CHECK(flat_map.find(30)->second == "thirty");
+    }
+
+    SECTION("Modify Found Element Value")
+    {
+        flat_map.find(10)->second = "TEN";
+        CHECK(flat_map.find(10)->second == "TEN");
+    }
+
+    SECTION("Erase Element by Key")
+    {
+        CHECK(flat_map.erase(20) == 1U);
+        CHECK(flat_map.erase(20) == 0U);
+        CHECK(GetKeys(flat_map) == std::vector<int>{ 10, 30 });
+    }
+
+    SECTION("Erase Element by Iterator")
+    {
+        const auto next_it = flat_map.erase(flat_map.find(10));
+        REQUIRE(next_it != flat_map.end());
+        CHECK(next_it->first == 20);
+        CHECK(GetKeys(flat_map) == std::vector<int>{ 20, 30 });
+    }
+
+    SECTION("Clear Keeps Capacity")
+    {
+        const size_t capacity = flat_map.capacity();
+        flat_map.clear();
+        CHECK(flat_map.empty());
+        CHECK(flat_map.capacity() == capacity);
+    }
+
+    SECTION("Copies are Equal")
+    {
+        const TestFlatMap flat_map_copy = flat_map;
+        CHECK(flat_map_copy == flat_map);
+        flat_map.erase(10);
+        CHECK_FALSE(flat_map_copy == flat_map);
+    }
+}
@@ -0,0 +1,142 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/MeshBuffersTest.cpp
+Unit-tests of the mesh buffers instanced drawing with merged subset ranges
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshBuffersBase.h>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Graphics/QuadMesh.hpp>
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include <vector>
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using DrawArguments = std::vector<Rhi::DrawIndexedArguments>;
+
+struct MeshVertex
+{
+    Mesh::Position position;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position
+    };
+};
+
+template<>
+struct Catch::StringMaker<Rhi::DrawIndexedArguments>
+{
+    static std::string convert(const Rhi::DrawIndexedArguments& args)
+    {
+        return fmt::format("{{ index_count={}, instance_count={}, start_index={}, start_vertex={}, start_instance={} }}",
+                           args.index_count, args.instance_count, args.start_index, args.start_vertex, args.start_instance);
+    }
+};
+
+class TestMeshBuffers final
+    : public MeshBuffersBase
+{
+public:
+    using SubsetIndices = std::vector<Data::Index>;
+
+    TestMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<MeshVertex>& uber_mesh, const SubsetIndices& subset_by_instance)
+        : MeshBuffersBase(render_cmd_queue, uber_mesh, "Test Mesh", uber_mesh.GetSubsets())
+        , m_subset_by_instance(subset_by_instance)
+    { }
+
+protected:
+    // MeshBuffersBase overrides
+    Data::Index GetSubsetByInstanceIndex(Data::Index instance_index) const override
+    {
+        return m_subset_by_instance.at(instance_index);
+    }
+
+private:
+    const SubsetIndices m_subset_by_instance;
+};
+
+static tf::Executor g_parallel_executor;
+
+static Rhi::Device GetTestDevice()
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    REQUIRE(devices.size() > 0);
+    return devices[0];
+}
+
+TEST_CASE("Mesh Buffers Instanced Draw Arguments", "[mesh][buffers]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor,
+                                            Rhi::RenderContextSettings{ .frame_size = { 640U, 480U } });
+    const Rhi::CommandQueue render_cmd_queue(render_context, Rhi::CommandListType::Render);
+
+    // Quad subsets have 4 vertices and 6 indices each, where indices of the second subset are not adjusted to its vertices offset
+    UberMesh<MeshVertex> uber_mesh(MeshVertex::layout);
+    uber_mesh.AddSubMesh(QuadMesh<MeshVertex>(MeshVertex::layout, 1.F, 1.F, 0.F, 0U, QuadFaceType::XY), true);
+    uber_mesh.AddSubMesh(QuadMesh<MeshVertex>(MeshVertex::layout, 1.F, 1.F, 0.F, 0U, QuadFaceType::XZ), false);
+    uber_mesh.AddSubMesh(QuadMesh<MeshVertex>(MeshVertex::layout, 1.F, 1.F, 0.F, 0U, QuadFaceType::YZ), true);
+
+    const TestMeshBuffers mesh_buffers(render_cmd_queue, uber_mesh, { 0U, 0U, 1U, 1U, 1U, 2U, 0U, 3U });
+    REQUIRE(mesh_buffers.GetSubsetsCount() == 3U);
+
+    SECTION("Consecutive instances of the same subset are merged in one draw")
+    {
+        CHECK(mesh_buffers.GetInstancedDrawArguments(7U) == DrawArguments{
+            { .index_count = 6U, .instance_count = 2U, .start_index = 0U,  .start_vertex = 0U, .start_instance = 0U },
+            { .index_count = 6U, .instance_count = 3U, .start_index = 6U,  .start_vertex = 4U, .start_instance = 2U },
+            { .index_count = 6U, .instance_count = 1U, .start_index = 12U, .start_vertex = 0U, .start_instance = 5U },
+            { .index_count = 6U, .instance_count = 1U, .start_index = 0U,  .start_vertex = 0U, .start_instance = 6U },
+        });
+    }
+
+    SECTION("Instances range starting from the first instance index is drawn")
+    {
+        CHECK(mesh_buffers.GetInstancedDrawArguments(3U, 3U) == DrawArguments{
+            { .index_count = 6U, .instance_count = 2U, .start_index = 6U,  .start_vertex = 4U, .start_instance = 3U },
+            { .index_count = 6U, .instance_count = 1U, .start_index = 12U, .start_vertex = 0U, .start_instance = 5U },
+        });
+    }
+
+    SECTION("Single subset instances are drawn with one instanced draw")
+    {
+        CHECK(mesh_buffers.GetInstancedDrawArguments(1U, 6U) == DrawArguments{
+            { .index_count = 6U, .instance_count = 1U, .start_index = 0U, .start_vertex = 0U, .start_instance = 6U },
+        });
+    }
+
+    SECTION("Can not draw zero instances")
+    {
+        CHECK_THROWS_AS(mesh_buffers.GetInstancedDrawArguments(0U), std::invalid_argument);
+    }
+
+    SECTION("Can not draw instance of subset out of bounds")
+    {
+        CHECK_THROWS_AS(mesh_buffers.GetInstancedDrawArguments(8U), std::out_of_range);
+    }
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/BindlessDescriptorTableTest.cpp
+Unit-tests of the backend-agnostic bindless descriptor table
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/Base/BindlessDescriptorTable.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Sampler.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using Statistics = Base::BindlessDescriptorTableStatistics;
+
+static tf::Executor g_parallel_executor;
+
+class TestBindlessDescriptorTable final
+    : public Base::BindlessDescriptorTable
+{
+public:
+    struct WrittenDescriptor
+    {
+        Rhi::ResourceType     resource_type;
+        uint32_t              index;
+        const Rhi::IResource* resource_ptr;
+    };
+
+    using Base::BindlessDescriptorTable::BindlessDescriptorTable;
+
+    const std::vector<WrittenDescriptor>& GetWrittenDescriptors() const noexcept { return m_written_descriptors; }
+
+protected:
+    void WriteDescriptor(Rhi::ResourceType resource_type, uint32_t index, const Rhi::ResourceView& resource_view) override
+    {
+        m_written_descriptors.push_back({ resource_type, index, &resource_view.GetResource() });
+    }
+
+private:
+    std::vector<WrittenDescriptor> m_written_descriptors;
+};
+
+TEST_CASE("Bindless Descriptor Table", "[rhi][bindless][descriptor]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::Buffer  buffer_a = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+    const Rhi::Buffer  buffer_b = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+    const Rhi::Texture texture  = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(64, 64), {}, PixelFormat::RGBA8, false));
+    const Rhi::Sampler sampler  = compute_context.CreateSampler({});
+
+    const Rhi::ResourceView buffer_a_view(buffer_a.GetInterface());
+    const Rhi::ResourceView buffer_b_view(buffer_b.GetInterface());
+    const Rhi::ResourceView texture_view(texture.GetInterface());
+    const Rhi::ResourceView sampler_view(sampler.GetInterface());
+
+    TestBindlessDescriptorTable table(Base::BindlessDescriptorTableSettings{ 2U, 4U, 4U, 2U });
+
+    SECTION("Resource views are indexed in descriptor arrays of their types")
+    {
+        CHECK(table.AddResourceView(buffer_a_view) == 0U);
+        CHECK(table.AddResourceView(buffer_b_view) == 1U);
+        CHECK(table.AddResourceView(texture_view) == 0U);
+        CHECK(table.AddResourceView(sampler_view) == 0U);
+
+        const std::vector<TestBindlessDescriptorTable::WrittenDescriptor>& written_descriptors = table.GetWrittenDescriptors();
+        REQUIRE(written_descriptors.size() == 4U);
+        CHECK(written_descriptors[1].resource_type == Rhi::ResourceType::Buffer);
+        CHECK(written_descriptors[1].resource_ptr == buffer_b.GetInterfacePtr().get());
+        CHECK(written_descriptors[2].resource_type == Rhi::ResourceType::Texture);
+        CHECK(written_descriptors[3].resource_type == Rhi::ResourceType::Sampler);
+        CHECK(table.GetCapacity(Rhi::ResourceType::Buffer) == 2U);
+        CHECK(table.GetCapacity(Rhi::ResourceType::Texture) == 4U);
+    }
+
+    SECTION("Descriptor of resource view is written only once")
+    {
+        const uint32_t index = table.AddResourceView(texture_view);
+        CHECK(table.AddResourceView(texture_view) == index);
+        CHECK(table.AddResourceView(Rhi::ResourceView(texture.GetInterface())) == index);
+        CHECK(table.GetWrittenDescriptors().size() == 1U);
+        CHECK(table.GetStatistics() == Statistics{ 1U, 0U, 1U, 2U });
+    }
+
+    SECTION("Different views of the same resource are indexed separately")
+    {
+        const uint32_t index_a = table.AddResourceView(Rhi::ResourceView(buffer_a.GetInterface(), 0U, 128U));
+        const uint32_t index_b = table.AddResourceView(Rhi::ResourceView(buffer_a.GetInterface(), 128U, 128U));
+        CHECK(index_a != index_b);
+        CHECK(table.GetStatistics().views_count == 2U);
+    }
+
+    SECTION("Resource view is kept registered until the last reference is removed")
+    {
+        const uint32_t index = table.AddResourceView(texture_view);
+        CHECK(table.AddResourceView(texture_view) == index);
+        table.RemoveResourceView(texture_view);
+        CHECK(table.GetStatistics() == Statistics{ 1U, 0U, 1U, 1U });
+        table.RemoveResourceView(texture_view);
+        CHECK(table.GetStatistics() == Statistics{ 0U, 1U, 1U, 1U });
+    }
+
+    SECTION("Removing not registered resource view throws")
+    {
+        CHECK_THROWS_AS(table.RemoveResourceView(texture_view), std::invalid_argument);
+    }
+
+    SECTION("Index of removed view is reused after retire frames")
+    {
+        CHECK(table.AddResourceView(buffer_a_view) == 0U);
+        table.RemoveResourceView(buffer_a_view);
+        CHECK(table.AddResourceView(buffer_b_view) == 1U);
+
+        table.CompleteFrame();
+        CHECK(table.GetStatistics().retired_count == 1U);
+        table.CompleteFrame();
+        CHECK(table.GetStatistics().retired_count == 0U);
+
+        table.RemoveResourceView(buffer_b_view);
+        CHECK(table.AddResourceView(buffer_a_view) == 0U);
+        CHECK(table.GetWrittenDescriptors().size() == 3U);
+    }
+
+    SECTION("Index of removed view is retired for the updated retire frames count")
+    {
+        table.SetRetireFramesCount(3U);
+        CHECK(table.GetSettings().retire_frames_count == 3U);
+
+        CHECK(table.AddResourceView(buffer_a_view) == 0U);
+        table.RemoveResourceView(buffer_a_view);
+        table.CompleteFrame();
+        table.CompleteFrame();
+        CHECK(table.GetStatistics().retired_count == 1U);
+        table.CompleteFrame();
+        CHECK(table.GetStatistics().retired_count == 0U);
+    }
+
+    SECTION("All retired indices are reused when GPU is idle")
+    {
+        CHECK(table.AddResourceView(buffer_a_view) == 0U);
+        CHECK(table.AddResourceView(buffer_b_view) == 1U);
+        table.RemoveResourceView(buffer_a_view);
+        table.RemoveResourceView(buffer_b_view);
+        table.CompleteAllFrames();
+        CHECK(table.GetStatistics().retired_count == 0U);
+        CHECK(table.AddResourceView(buffer_a_view) < 2U);
+        CHECK(table.AddResourceView(buffer_b_view) < 2U);
+    }
+
+    SECTION("Exceeding descriptor array capacity throws")
+    {
+        CHECK(table.AddResourceView(buffer_a_view) == 0U);
+        CHECK(table.AddResourceView(buffer_b_view) == 1U);
+        CHECK_THROWS_AS(table.AddResourceView(Rhi::ResourceView(buffer_a.GetInterface(), 128U, 128U)), std::out_of_range);
+
+        // Retired index is not available until its frames are completed
+        table.RemoveResourceView(buffer_a_view);
+        CHECK_THROWS_AS(table.AddResourceView(Rhi::ResourceView(buffer_a.GetInterface(), 128U, 128U)), std::out_of_range);
+    }
+
+    SECTION("Resource views are registered from multiple threads")
+    {
+        constexpr size_t threads_count = 8U;
+        std::vector<uint32_t> indices(threads_count);
+        std::vector<std::thread> threads;
+        for (size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            threads.emplace_back([&table, &indices, &texture, thread_index]()
+            {
+                indices[thread_index] = table.AddResourceView(Rhi::ResourceView(texture.GetInterface()));
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(std::ranges::count(indices, indices.front()) == static_cast<std::ptrdiff_t>(threads_count));
+        CHECK(table.GetStatistics() == Statistics{ 1U, 0U, 1U, static_cast<uint32_t>(threads_count - 1U) });
+    }
+}
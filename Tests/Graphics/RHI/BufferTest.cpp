@@ -174,6 +174,23 @@ TEST_CASE("RHI Buffer Functions", "[rhi][buffer][resource]")
         CHECK(vertex_buffer.GetFormattedItemsCount() == 256);
     }
 
+    SECTION("Set Data in Range")
+    {
+        const Rhi::Buffer constant_buffer = compute_context.CreateBuffer(constant_buffer_settings);
+        std::vector<std::byte> test_data(256, std::byte(8));
+        REQUIRE_NOTHROW(constant_buffer.SetData(compute_context.GetUploadCommandKit().GetQueue(), Rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(test_data.data()), // NOSONAR
+            static_cast<Data::Size>(test_data.size()),
+            Rhi::SubResourceIndex(), Rhi::BytesRange(1024U, 1280U)
+        )));
+        CHECK(constant_buffer.GetDataSize(Data::MemoryState::Initialized) == 1280U);
+        CHECK_THROWS(constant_buffer.SetData(compute_context.GetUploadCommandKit().GetQueue(), Rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(test_data.data()), // NOSONAR
+            static_cast<Data::Size>(test_data.size()),
+            Rhi::SubResourceIndex(), Rhi::BytesRange(41900U, 42156U)
+        )));
+    }
+
     SECTION("Get Data")
     {
         CHECK_NOTHROW(buffer.GetData(compute_context.GetUploadCommandKit().GetQueue()));
@@ -0,0 +1,148 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/CommandQueueTrackingTest.cpp
+Unit-tests of the command queue execution tracking with completion thread
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Base/CommandQueueTracking.h>
+#include <Methane/Graphics/Base/CommandListSet.h>
+#include <Methane/Graphics/Base/Context.h>
+
+#include <atomic>
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+// Tracking queue executes command list sets created with Null command queue,
+// which are completed immediately on the completion thread by the Null command list set wait
+class TestCommandQueueTracking final // NOSONAR - destructor is required
+    : public Base::CommandQueueTracking
+{
+public:
+    explicit TestCommandQueueTracking(const Rhi::ComputeContext& compute_context)
+        : Base::CommandQueueTracking(dynamic_cast<const Base::Context&>(compute_context.GetInterface()), Rhi::CommandListType::Compute)
+    { }
+
+    ~TestCommandQueueTracking() override
+    {
+        ShutdownQueueExecution();
+    }
+
+    TestCommandQueueTracking(const TestCommandQueueTracking&) = delete;
+    TestCommandQueueTracking(TestCommandQueueTracking&&) = delete;
+    TestCommandQueueTracking& operator=(const TestCommandQueueTracking&) = delete;
+    TestCommandQueueTracking& operator=(TestCommandQueueTracking&&) = delete;
+
+    // ICommandQueue interface
+    [[nodiscard]] Ptr<Rhi::IFence>                     CreateFence() override                                  { return nullptr; }
+    [[nodiscard]] Ptr<Rhi::ITransferCommandList>       CreateTransferCommandList() override                    { return nullptr; }
+    [[nodiscard]] Ptr<Rhi::IComputeCommandList>        CreateComputeCommandList() override                     { return nullptr; }
+    [[nodiscard]] Ptr<Rhi::IRenderCommandList>         CreateRenderCommandList(Rhi::IRenderPass&) override         { return nullptr; }
+    [[nodiscard]] Ptr<Rhi::IParallelRenderCommandList> CreateParallelRenderCommandList(Rhi::IRenderPass&) override { return nullptr; }
+    [[nodiscard]] Ptr<Rhi::ITimestampQueryPool>        CreateTimestampQueryPool(uint32_t) override             { return nullptr; }
+    [[nodiscard]] uint32_t                             GetFamilyIndex() const noexcept override                { return 0U; }
+
+    [[nodiscard]] size_t GetExecutingCommandListSetsCount() const
+    {
+        size_t executing_sets_count = 0U;
+        ForEachExecutingCommandListSet([&executing_sets_count](const Base::CommandListSet&) { executing_sets_count++; });
+        return executing_sets_count;
+    }
+};
+
+TEST_CASE("RHI Command Queue Tracking", "[rhi][queue][tracking]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue   compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+
+    SECTION("Complete Executed Command List Set")
+    {
+        TestCommandQueueTracking tracking_queue(compute_context);
+        const Rhi::ComputeCommandList compute_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+        const Rhi::CommandListSet cmd_list_set({ compute_cmd_list.GetInterface() });
+        REQUIRE_NOTHROW(compute_cmd_list.Reset());
+        REQUIRE_NOTHROW(compute_cmd_list.Commit());
+
+        std::atomic<Rhi::ICommandList*> completed_command_list_ptr = nullptr;
+        REQUIRE_NOTHROW(tracking_queue.Execute(cmd_list_set.GetInterface(),
+            [&completed_command_list_ptr](Rhi::ICommandList& command_list) {
+                completed_command_list_ptr = &command_list;
+            }));
+
+        REQUIRE_NOTHROW(tracking_queue.WaitUntilCompleted());
+        CHECK(compute_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        CHECK(completed_command_list_ptr == compute_cmd_list.GetInterfacePtr().get());
+        CHECK(tracking_queue.GetExecutingCommandListSetsCount() == 0U);
+        CHECK_FALSE(tracking_queue.GetLastExecutingCommandListSet());
+    }
+
+    SECTION("Stress Execution of Command List Sets")
+    {
+#ifdef NDEBUG
+        constexpr uint32_t executed_sets_count = 1'000'000U;
+#else
+        constexpr uint32_t executed_sets_count = 10'000U;
+#endif
+        constexpr uint32_t cmd_lists_count = 8U;
+
+        TestCommandQueueTracking tracking_queue(compute_context);
+        std::vector<Rhi::ComputeCommandList> compute_cmd_lists;
+        std::vector<Rhi::CommandListSet>     cmd_list_sets;
+        for(uint32_t cmd_list_index = 0U; cmd_list_index < cmd_lists_count; ++cmd_list_index)
+        {
+            const Rhi::ComputeCommandList& compute_cmd_list = compute_cmd_lists.emplace_back(compute_cmd_queue.CreateComputeCommandList());
+            cmd_list_sets.emplace_back(Refs<Rhi::ICommandList>{ compute_cmd_list.GetInterface() });
+        }
+
+        std::atomic<uint32_t> completed_sets_count = 0U;
+        const Rhi::ICommandList::CompletedCallback completed_callback = [&completed_sets_count](Rhi::ICommandList&)
+        {
+            completed_sets_count.fetch_add(1U, std::memory_order_relaxed);
+        };
+
+        for(uint32_t set_index = 0U; set_index < executed_sets_count; ++set_index)
+        {
+            const Rhi::ComputeCommandList& compute_cmd_list = compute_cmd_lists[set_index % cmd_lists_count];
+            compute_cmd_list.WaitUntilCompleted();
+            compute_cmd_list.Reset();
+            compute_cmd_list.Commit();
+            tracking_queue.Execute(cmd_list_sets[set_index % cmd_lists_count].GetInterface(), completed_callback);
+        }
+
+        REQUIRE_NOTHROW(tracking_queue.WaitUntilCompleted());
+        CHECK(completed_sets_count == executed_sets_count);
+        CHECK(tracking_queue.GetExecutingCommandListSetsCount() == 0U);
+        for(const Rhi::ComputeCommandList& compute_cmd_list : compute_cmd_lists)
+        {
+            CHECK(compute_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        }
+    }
+}
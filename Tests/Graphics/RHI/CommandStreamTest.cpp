@@ -0,0 +1,193 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/CommandStreamTest.cpp
+Unit-tests of the Null command stream recording, replay and dump.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+#include "RhiSettings.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+#include <Methane/Graphics/Null/CommandStream.h>
+#include <Methane/Graphics/Null/Buffer.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static const Platform::AppEnvironment test_app_env{ nullptr };
+
+TEST_CASE("RHI Null Command Stream Functions", "[rhi][list][render][stream]")
+{
+    const Rhi::RenderContext render_context   = Rhi::RenderContext(test_app_env, GetTestDevice(), g_parallel_executor, Test::GetRenderContextSettings());
+    const Rhi::CommandQueue  render_cmd_queue = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+    const Rhi::RenderPattern render_pattern   = render_context.CreateRenderPattern(Test::GetRenderPatternSettings());
+    const Test::RenderPassResources render_pass_resources = Test::GetRenderPassResources(render_pattern);
+    const Rhi::RenderPass    render_pass      = render_pattern.CreateRenderPass(render_pass_resources.settings);
+    const Rhi::Program       render_program   = render_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            .shader_set = Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Render", "MainVS" } } },
+                { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Render", "MainPS" } } }
+            },
+            .input_buffer_layouts = Rhi::ProgramInputBufferLayouts
+            {
+                Rhi::ProgramInputBufferLayout
+                {
+                    .argument_semantics = Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" , "COLOR" },
+                    .step_type = Rhi::ProgramInputBufferLayout::StepType::PerVertex,
+                    .step_rate = 1U
+                }
+            },
+            .attachment_formats = render_pattern.GetAttachmentFormats()
+        });
+    const Rhi::RenderState render_state = render_context.CreateRenderState(Test::GetRenderStateSettings(render_context, render_pattern, render_program));
+    render_state.SetName("Render State");
+    const Rhi::ViewState view_state(Test::GetViewStateSettings());
+
+    const Rhi::Buffer vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(144U, 12U));
+    vertex_buffer.SetName("Vertex Buffer");
+    dynamic_cast<Null::Buffer&>(vertex_buffer.GetInterface()).SetInitializedDataSize(144U);
+    const Rhi::BufferSet vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer });
+
+    const Rhi::Buffer index_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(24U, PixelFormat::R32Uint));
+    index_buffer.SetName("Index Buffer");
+    dynamic_cast<Null::Buffer&>(index_buffer.GetInterface()).SetInitializedDataSize(24U);
+
+    const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+    auto& null_cmd_list = dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface());
+
+    Null::CommandStream command_stream;
+    null_cmd_list.SetCommandStream(&command_stream);
+
+    const auto record_commands = [&]()
+    {
+        cmd_list.ResetWithState(render_state);
+        cmd_list.SetViewState(view_state);
+        cmd_list.SetVertexBuffers(vertex_buffer_set);
+        cmd_list.SetIndexBuffer(index_buffer, false);
+        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle);
+        cmd_list.Draw(Rhi::RenderPrimitive::Line, 6U, 2U, 3U, 1U);
+    };
+
+    static const std::string s_expected_dump =
+        "     0: Reset\n"
+        "     1: SetRenderState 'Render State' with groups mask 0xffffffff\n"
+        "     2: SetViewState #0\n"
+        "     3: SetVertexBuffers 'Vertex Buffer' with barriers\n"
+        "     4: SetIndexBuffer 'Index Buffer'\n"
+        "     5: DrawIndexed Triangle 0 indices from 0 and vertex 0 with 1 instances from 0\n"
+        "     6: Draw Line 6 vertices from 2 with 3 instances from 1\n";
+
+    SECTION("Commands are not Recorded without Stream")
+    {
+        null_cmd_list.SetCommandStream(nullptr);
+        REQUIRE_NOTHROW(record_commands());
+        CHECK(null_cmd_list.GetCommandStream() == nullptr);
+        CHECK(command_stream.IsEmpty());
+        CHECK(command_stream.GetCommandsCount() == 0U);
+    }
+
+    SECTION("Recorded Commands are Dumped in Order of Encoding")
+    {
+        REQUIRE_NOTHROW(record_commands());
+        CHECK(null_cmd_list.GetCommandStream() == &command_stream);
+        CHECK(command_stream.GetCommandsCount() == 7U);
+        CHECK(static_cast<std::string>(command_stream) == s_expected_dump);
+    }
+
+    SECTION("Cleared Stream Keeps Memory and Records Same Data Again")
+    {
+        REQUIRE_NOTHROW(record_commands());
+        const std::vector<std::byte> recorded_data = command_stream.GetData();
+        const size_t data_capacity = command_stream.GetData().capacity();
+
+        command_stream.Clear();
+        CHECK(command_stream.IsEmpty());
+        CHECK(command_stream.GetCommandsCount() == 0U);
+        CHECK(command_stream.GetData().capacity() == data_capacity);
+
+        REQUIRE_NOTHROW(record_commands());
+        CHECK(command_stream.GetData() == recorded_data);
+        CHECK(command_stream.GetData().capacity() == data_capacity);
+    }
+
+    SECTION("Recorded Commands are Replayed to Other Command List")
+    {
+        REQUIRE_NOTHROW(record_commands());
+
+        const Rhi::RenderCommandList replay_cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        auto& null_replay_cmd_list = dynamic_cast<Null::RenderCommandList&>(replay_cmd_list.GetInterface());
+        Null::CommandStream replay_command_stream;
+        null_replay_cmd_list.SetCommandStream(&replay_command_stream);
+
+        REQUIRE_NOTHROW(command_stream.Replay(replay_cmd_list.GetInterface()));
+        CHECK(replay_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+        CHECK(null_replay_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
+        CHECK(null_replay_cmd_list.GetDrawingState().index_buffer_ptr == index_buffer.GetInterfacePtr().get());
+        CHECK(replay_command_stream.GetData() == command_stream.GetData());
+        CHECK(static_cast<std::string>(replay_command_stream) == s_expected_dump);
+    }
+
+    SECTION("Resource Barriers are Serialized by Value and Replayed after Barriers Release")
+    {
+        REQUIRE_NOTHROW(record_commands());
+        {
+            // Barriers object is released right after recording, like temporary barriers of the render code
+            const Ptr<Rhi::IResourceBarriers> resource_barriers_ptr = Rhi::IResourceBarriers::Create({
+                Rhi::ResourceBarrier(vertex_buffer.GetInterface(), Rhi::ResourceState::VertexBuffer, Rhi::ResourceState::CopyDest),
+                Rhi::ResourceBarrier(index_buffer.GetInterface(), 0U, 1U)
+            });
+            REQUIRE_NOTHROW(null_cmd_list.SetResourceBarriers(*resource_barriers_ptr));
+        }
+        CHECK(command_stream.GetCommandsCount() == 8U);
+
+        const std::string expected_barriers_dump = s_expected_dump +
+            "     7: SetResourceBarriers 2 barriers\n"
+            "        - Buffer state transition of 'Vertex Buffer' from VertexBuffer to CopyDest\n"
+            "        - Buffer owner transition of 'Index Buffer' from queue family 0 to 1\n";
+        CHECK(static_cast<std::string>(command_stream) == expected_barriers_dump);
+
+        const Rhi::RenderCommandList replay_cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        auto& null_replay_cmd_list = dynamic_cast<Null::RenderCommandList&>(replay_cmd_list.GetInterface());
+        Null::CommandStream replay_command_stream;
+        null_replay_cmd_list.SetCommandStream(&replay_command_stream);
+
+        REQUIRE_NOTHROW(command_stream.Replay(replay_cmd_list.GetInterface()));
+        CHECK(replay_command_stream.GetCommandsCount() == 8U);
+        CHECK(static_cast<std::string>(replay_command_stream) == expected_barriers_dump);
+    }
+}
@@ -43,10 +43,13 @@ Unit-tests of the RHI Compute Command List
 #include <Methane/Graphics/Null/ComputeState.h>
 #include <Methane/Graphics/Null/CommandListDebugGroup.h>
 #include <Methane/Graphics/Null/ProgramBindings.h>
+#include <Methane/Graphics/Null/CommandStream.h>
 
 #include <chrono>
 #include <future>
 #include <memory>
+#include <vector>
+#include <type_traits>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <thread>
@@ -241,6 +244,69 @@ TEST_CASE("RHI Compute Command List Functions", "[rhi][list][compute]")
         REQUIRE_NOTHROW(cmd_list.SetResourceBarriers(barriers));
     }
 
+    SECTION("Set Program Bindings Resource Barriers in One Batch")
+    {
+        const auto create_texture = [&compute_context](const std::string& name)
+        {
+            Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+            texture.SetName(name);
+            return texture;
+        };
+
+        const Rhi::Texture texture_a = create_texture("A");
+        const Rhi::Texture texture_b = create_texture("B");
+        const Rhi::Sampler sampler = compute_context.CreateSampler(
+            rhi::SamplerSettings
+            {
+                .filter  = rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+                .address = rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+            });
+        const Rhi::Buffer  buffer  = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+
+        using enum Rhi::ShaderType;
+        const Rhi::ProgramBindings program_bindings_a = compute_program.CreateBindings({
+            { { Compute, "InTexture" }, texture_a.GetResourceView() },
+            { { Compute, "InSampler" }, sampler.GetResourceView() },
+            { { Compute, "OutBuffer" }, buffer.GetResourceView()  },
+        });
+        const Rhi::ProgramBindings program_bindings_b = compute_program.CreateBindings({
+            { { Compute, "InTexture" }, texture_b.GetResourceView() },
+            { { Compute, "InSampler" }, sampler.GetResourceView() },
+            { { Compute, "OutBuffer" }, buffer.GetResourceView()  },
+        });
+        const Refs<Rhi::IProgramBindings> program_bindings_refs{
+            program_bindings_a.GetInterface(),
+            program_bindings_b.GetInterface()
+        };
+
+        Null::CommandStream command_stream;
+        const auto get_set_barrier_counts = [&command_stream]()
+        {
+            std::vector<uint32_t> barrier_counts;
+            command_stream.Visit([&barrier_counts](const auto& packet)
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(packet)>, Null::CommandStream::SetResourceBarriersPacket>)
+                    barrier_counts.push_back(packet.barriers_count);
+            });
+            return barrier_counts;
+        };
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface()).SetCommandStream(&command_stream);
+
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindingsResourceBarriers(program_bindings_refs));
+        CHECK(get_set_barrier_counts() == std::vector<uint32_t>{ 2U });
+        CHECK(texture_a.GetState() == Rhi::ResourceState::ShaderResource);
+        CHECK(texture_b.GetState() == Rhi::ResourceState::ShaderResource);
+
+        // Resources are already in required states, so no more barriers are set
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindingsResourceBarriers(program_bindings_refs));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(program_bindings_a));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(program_bindings_b));
+        CHECK(get_set_barrier_counts() == std::vector<uint32_t>{ 2U });
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
     SECTION("Commit Command List")
     {
         REQUIRE_NOTHROW(cmd_list.Reset());
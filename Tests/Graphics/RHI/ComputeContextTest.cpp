@@ -202,6 +202,11 @@ TEST_CASE("RHI Compute Context Functions", "[rhi][compute][context]")
         CHECK_NOTHROW(compute_context.WaitForGpu(Rhi::ContextWaitFor::ComputeComplete));
         CHECK(transfer_cmd_list.GetState() == Rhi::CommandListState::Executing);
     }
+
+    SECTION("Context Pipeline Cache Statistics")
+    {
+        CHECK(compute_context.GetPipelineCacheStatistics() == Rhi::PipelineCacheStatistics{});
+    }
 }
 
 TEST_CASE("RHI Compute Context Factory", "[rhi][compute][context][factory]")
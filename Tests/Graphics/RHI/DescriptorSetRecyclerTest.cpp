@@ -0,0 +1,219 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/DescriptorSetRecyclerTest.cpp
+Unit-tests of the backend-agnostic descriptor set recycler and frame retire queue
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/DescriptorSetRecycler.h>
+#include <Methane/Graphics/Base/FrameRetireQueue.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using Statistics       = Base::DescriptorSetRecyclerStatistics;
+using LayoutStatistics = Base::DescriptorSetLayoutStatistics;
+
+class TestDescriptorSetRecycler final
+    : public Base::DescriptorSetRecycler<uint32_t, uint32_t, uint32_t>
+{
+public:
+    using Sets = std::vector<uint32_t>;
+
+    const Sets& GetFreedSets() const noexcept     { return m_freed_sets; }
+    uint32_t    GetResetPoolsCount() const noexcept { return m_reset_pools_count; }
+
+protected:
+    // Base::DescriptorSetRecycler interface
+    void AllocateNativeSets(uint32_t, uint32_t sets_count, PooledSets& pooled_sets) override
+    {
+        for(uint32_t set_index = 0U; set_index < sets_count; ++set_index)
+        {
+            pooled_sets.push_back({ ++m_last_set, m_reset_pools_count });
+        }
+    }
+
+    void FreeNativeSets(const PooledSets& pooled_sets) override
+    {
+        for(const PooledSet& pooled_set : pooled_sets)
+        {
+            m_freed_sets.push_back(pooled_set.set);
+        }
+    }
+
+    void ResetNativePools() override
+    {
+        m_reset_pools_count++;
+    }
+
+private:
+    Sets     m_freed_sets;
+    uint32_t m_last_set          = 0U;
+    uint32_t m_reset_pools_count = 0U;
+};
+
+TEST_CASE("Descriptor Set Recycler", "[rhi][descriptor]")
+{
+    constexpr uint32_t layout_a = 1U;
+    constexpr uint32_t layout_b = 2U;
+
+    TestDescriptorSetRecycler recycler;
+    recycler.SetRetireFramesCount(2U);
+    recycler.RegisterLayout(layout_a);
+
+    SECTION("Descriptor sets are allocated from pools")
+    {
+        const TestDescriptorSetRecycler::Sets sets = recycler.AllocateSets(layout_a, 3U);
+        CHECK(sets == TestDescriptorSetRecycler::Sets{ 1U, 2U, 3U });
+        CHECK(recycler.GetStatistics() == Statistics{ 1U, 3U, 0U, 0U, LayoutStatistics{ 3U, 0U, 0U } });
+        CHECK(recycler.GetLayoutStatistics(layout_a) == LayoutStatistics{ 3U, 0U, 0U });
+    }
+
+    SECTION("Released descriptor set is reused after retire frames")
+    {
+        const TestDescriptorSetRecycler::Sets sets = recycler.AllocateSets(layout_a, 2U);
+        recycler.ReleaseSet(sets[0]);
+        CHECK(recycler.GetStatistics() == Statistics{ 1U, 2U, 0U, 0U, LayoutStatistics{ 1U, 0U, 1U } });
+
+        recycler.CompleteFrame();
+        CHECK(recycler.GetLayoutStatistics(layout_a) == LayoutStatistics{ 1U, 0U, 1U });
+
+        recycler.CompleteFrame();
+        CHECK(recycler.GetLayoutStatistics(layout_a) == LayoutStatistics{ 1U, 1U, 0U });
+
+        CHECK(recycler.AllocateSets(layout_a, 2U) == TestDescriptorSetRecycler::Sets{ sets[0], 3U });
+        CHECK(recycler.GetStatistics() == Statistics{ 1U, 3U, 1U, 0U, LayoutStatistics{ 3U, 0U, 0U } });
+    }
+
+    SECTION("Descriptor sets released in later frames are retired longer")
+    {
+        const TestDescriptorSetRecycler::Sets sets = recycler.AllocateSets(layout_a, 2U);
+        recycler.ReleaseSet(sets[0]);
+        recycler.CompleteFrame();
+        recycler.ReleaseSet(sets[1]);
+        recycler.CompleteFrame();
+        CHECK(recycler.GetLayoutStatistics(layout_a) == LayoutStatistics{ 0U, 1U, 1U });
+
+        recycler.CompleteFrame();
+        CHECK(recycler.GetLayoutStatistics(layout_a) == LayoutStatistics{ 0U, 2U, 0U });
+    }
+
+    SECTION("All retired descriptor sets are reused when GPU is idle")
+    {
+        const TestDescriptorSetRecycler::Sets sets = recycler.AllocateSets(layout_a, 2U);
+        recycler.ReleaseSet(sets[0]);
+        recycler.ReleaseSet(sets[1]);
+        recycler.CompleteAllFrames();
+        CHECK(recycler.GetStatistics() == Statistics{ 1U, 2U, 0U, 0U, LayoutStatistics{ 0U, 2U, 0U } });
+    }
+
+    SECTION("Released descriptor sets are not reused for other layouts")
+    {
+        recycler.RegisterLayout(layout_b);
+        recycler.ReleaseSet(recycler.AllocateSets(layout_a, 1U).front());
+        recycler.CompleteAllFrames();
+
+        CHECK(recycler.AllocateSets(layout_b, 1U) == TestDescriptorSetRecycler::Sets{ 2U });
+        CHECK(recycler.GetStatistics() == Statistics{ 2U, 2U, 0U, 0U, LayoutStatistics{ 1U, 1U, 0U } });
+        CHECK(recycler.GetLayoutStatistics(layout_b) == LayoutStatistics{ 1U, 0U, 0U });
+    }
+
+    SECTION("Descriptor sets of unregistered layout are freed after retirement")
+    {
+        const TestDescriptorSetRecycler::Sets sets = recycler.AllocateSets(layout_a, 3U);
+        recycler.ReleaseSet(sets[0]);
+        recycler.CompleteAllFrames();
+        recycler.ReleaseSet(sets[1]);
+        recycler.UnregisterLayout(layout_a);
+        recycler.ReleaseSet(sets[2]);
+        CHECK(recycler.GetFreedSets() == TestDescriptorSetRecycler::Sets{ sets[0] });
+        CHECK(recycler.GetStatistics() == Statistics{ 0U, 3U, 0U, 1U, LayoutStatistics{ 0U, 0U, 2U } });
+
+        recycler.CompleteFrame();
+        recycler.CompleteFrame();
+        CHECK(recycler.GetFreedSets() == sets);
+        CHECK(recycler.GetStatistics() == Statistics{ 0U, 3U, 0U, 3U, LayoutStatistics{ 0U, 0U, 0U } });
+    }
+
+    SECTION("All descriptor sets are released with pools reset")
+    {
+        const TestDescriptorSetRecycler::Sets sets = recycler.AllocateSets(layout_a, 2U);
+        recycler.ReleaseSet(sets[0]);
+        recycler.ReleaseAllSets();
+        CHECK(recycler.GetResetPoolsCount() == 1U);
+        CHECK(recycler.GetStatistics() == Statistics{ 1U, 2U, 0U, 0U, LayoutStatistics{ 0U, 0U, 0U } });
+
+        recycler.ReleaseSet(sets[1]);
+        CHECK(recycler.GetLayoutStatistics(layout_a) == LayoutStatistics{ 0U, 0U, 0U });
+        CHECK(recycler.GetFreedSets().empty());
+    }
+
+    SECTION("Registering layout twice throws")
+    {
+        CHECK_THROWS_AS(recycler.RegisterLayout(layout_a), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Frame Retire Queue", "[rhi][descriptor]")
+{
+    using Queue = Base::FrameRetireQueue<uint32_t>;
+    using Items = std::vector<uint32_t>;
+
+    Queue queue;
+    Items completed_items;
+    const auto complete_item = [&completed_items](uint32_t item) { completed_items.push_back(item); };
+
+    SECTION("Items are completed in frames order up to the given frame")
+    {
+        queue.Retire(1U, 0U);
+        queue.Retire(2U, 1U);
+        queue.Retire(3U, 2U);
+        CHECK(queue.CompleteFrames(1U, complete_item) == 2U);
+        CHECK(completed_items == Items{ 1U, 2U });
+        CHECK(queue.GetCount() == 1U);
+    }
+
+    SECTION("Merged items are ordered by frames")
+    {
+        Queue other_queue;
+        queue.Retire(1U, 0U);
+        queue.Retire(3U, 2U);
+        other_queue.Retire(2U, 1U);
+        queue.Merge(std::move(other_queue));
+        CHECK(other_queue.IsEmpty());
+        CHECK(queue.FindFrame([](uint32_t item) { return item == 3U; }) == Opt<Base::FrameIndex>(2U));
+        CHECK(queue.CompleteAllFrames(complete_item) == 3U);
+        CHECK(completed_items == Items{ 1U, 2U, 3U });
+    }
+
+    SECTION("Frame retire counter completes frames after retire frames count")
+    {
+        Base::FrameRetireCounter frame_counter(Base::FrameRetireCounter::GetRetireFramesCountOf(2U));
+        CHECK(frame_counter.GetRetireFramesCount() == 3U);
+        CHECK_FALSE(frame_counter.CompleteFrame().has_value());
+        CHECK_FALSE(frame_counter.CompleteFrame().has_value());
+        CHECK(frame_counter.CompleteFrame() == Opt<Base::FrameIndex>(0U));
+        CHECK(Base::FrameRetireCounter::GetRetireFramesCountOf(5U) == 5U);
+    }
+}
@@ -0,0 +1,277 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/DeviceMemoryAllocatorTest.cpp
+Unit-tests of the backend-agnostic device memory sub-allocator
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/DeviceMemoryAllocator.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <map>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using Allocation = Base::DeviceMemoryAllocation;
+using Settings   = Base::DeviceMemoryAllocatorSettings;
+
+class TestDeviceMemoryAllocator final
+    : public Base::DeviceMemoryAllocator
+{
+public:
+    using Base::DeviceMemoryAllocator::DeviceMemoryAllocator;
+
+    uint32_t GetNativeBlocksCount() const noexcept              { return static_cast<uint32_t>(m_block_size_by_index.size()); }
+    uint32_t GetNativeAllocationsCount() const noexcept         { return m_native_allocations_count; }
+    void     SetNativeAllocationFailure(bool is_failure) noexcept { m_is_native_allocation_failure = is_failure; }
+
+protected:
+    bool AllocateMemoryBlock(Data::Index, Data::Index block_index, uint64_t size) override
+    {
+        if (m_is_native_allocation_failure)
+            return false;
+
+        // Catch assertions are not used here, since memory blocks are allocated from multiple threads in some tests
+        m_block_size_by_index.try_emplace(block_index, size);
+        m_native_allocations_count++;
+        return true;
+    }
+
+    void FreeMemoryBlock(Data::Index block_index) override
+    {
+        m_block_size_by_index.erase(block_index);
+    }
+
+private:
+    std::map<Data::Index, uint64_t> m_block_size_by_index;
+    uint32_t                        m_native_allocations_count = 0U;
+    bool                            m_is_native_allocation_failure = false;
+};
+
+TEST_CASE("Device Memory Buddy Allocator", "[rhi][memory]")
+{
+    SECTION("Allocate ranges aligned by their size")
+    {
+        Base::DeviceMemoryBuddyAllocator allocator(4096U, 256U);
+        CHECK(allocator.Allocate(100U) == 0U);
+        CHECK(allocator.Allocate(512U) == 512U);
+        CHECK(allocator.Allocate(256U) == 256U);
+        CHECK(allocator.Allocate(1024U) == 1024U);
+        CHECK(allocator.GetUsedSize() == 2048U);
+        CHECK(allocator.GetAllocationsCount() == 4U);
+        CHECK(allocator.GetMaxFreeRangeSize() == 2048U);
+    }
+
+    SECTION("Allocate ranges with alignment larger than size")
+    {
+        Base::DeviceMemoryBuddyAllocator allocator(4096U, 256U);
+        CHECK(allocator.Allocate(256U) == 0U);
+        CHECK(allocator.Allocate(256U, 1024U) == 1024U);
+        CHECK(allocator.Allocate(256U) == 256U);
+    }
+
+    SECTION("Empty and too large ranges are not allocated")
+    {
+        Base::DeviceMemoryBuddyAllocator allocator(4096U, 256U);
+        CHECK_FALSE(allocator.Allocate(0U).has_value());
+        CHECK_FALSE(allocator.Allocate(8192U).has_value());
+        CHECK_FALSE(allocator.Allocate(256U, 8192U).has_value());
+        CHECK(allocator.IsEmpty());
+    }
+
+    SECTION("Allocation fails when block is full")
+    {
+        Base::DeviceMemoryBuddyAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(512U) == 0U);
+        CHECK(allocator.Allocate(512U) == 512U);
+        CHECK_FALSE(allocator.Allocate(256U).has_value());
+        CHECK(allocator.GetMaxFreeRangeSize() == 0U);
+    }
+
+    SECTION("Freed buddy ranges are merged")
+    {
+        Base::DeviceMemoryBuddyAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(256U) == 0U);
+        CHECK(allocator.Allocate(256U) == 256U);
+        CHECK(allocator.Allocate(512U) == 512U);
+        allocator.Free(0U);
+        CHECK(allocator.GetMaxFreeRangeSize() == 256U);
+        allocator.Free(256U);
+        CHECK(allocator.GetMaxFreeRangeSize() == 512U);
+        allocator.Free(512U);
+        CHECK(allocator.IsEmpty());
+        CHECK(allocator.GetUsedSize() == 0U);
+        CHECK(allocator.GetMaxFreeRangeSize() == 1024U);
+        CHECK(allocator.Allocate(1024U) == 0U);
+    }
+
+    SECTION("Free of not allocated range throws")
+    {
+        Base::DeviceMemoryBuddyAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(256U) == 0U);
+        CHECK_THROWS(allocator.Free(256U));
+    }
+
+    SECTION("Block size must be a power of two")
+    {
+        CHECK_THROWS(Base::DeviceMemoryBuddyAllocator(1000U, 256U));
+        CHECK_THROWS(Base::DeviceMemoryBuddyAllocator(1024U, 100U));
+    }
+}
+
+TEST_CASE("Device Memory Allocator", "[rhi][memory]")
+{
+    const Settings settings{ 4096U, 256U, 2048U };
+
+    SECTION("Sub-allocate resources from shared memory block")
+    {
+        TestDeviceMemoryAllocator allocator(settings);
+        const Allocation allocation_a = allocator.Allocate(0U, 300U, 256U);
+        const Allocation allocation_b = allocator.Allocate(0U, 256U, 256U);
+        REQUIRE(allocation_a.IsInitialized());
+        REQUIRE(allocation_b.IsInitialized());
+        CHECK(allocation_a == Allocation{ 0U, 0U, 0U, 300U, false });
+        CHECK(allocation_b == Allocation{ 0U, 0U, 512U, 256U, false });
+        CHECK(allocator.GetNativeBlocksCount() == 1U);
+
+        const Rhi::DeviceMemoryStatistics statistics = allocator.GetStatistics();
+        CHECK(statistics.allocated_size == 4096U);
+        CHECK(statistics.used_size == 556U);
+        CHECK(statistics.blocks_count == 1U);
+        CHECK(statistics.dedicated_blocks_count == 0U);
+        CHECK(statistics.allocations_count == 2U);
+    }
+
+    SECTION("Different pools use different memory blocks")
+    {
+        TestDeviceMemoryAllocator allocator(settings);
+        CHECK(allocator.Allocate(0U, 256U, 256U).block_index == 0U);
+        CHECK(allocator.Allocate(1U, 256U, 256U).block_index == 1U);
+        CHECK(allocator.Allocate(0U, 256U, 256U).block_index == 0U);
+        CHECK(allocator.GetNativeBlocksCount() == 2U);
+    }
+
+    SECTION("New memory block is allocated when pool blocks are full")
+    {
+        TestDeviceMemoryAllocator allocator(settings);
+        CHECK(allocator.Allocate(0U, 2000U, 256U) == Allocation{ 0U, 0U, 0U, 2000U, false });
+        CHECK(allocator.Allocate(0U, 2000U, 256U) == Allocation{ 0U, 0U, 2048U, 2000U, false });
+        CHECK(allocator.Allocate(0U, 256U, 256U) == Allocation{ 0U, 1U, 0U, 256U, false });
+        CHECK(allocator.GetStatistics().allocated_size == 8192U);
+    }
+
+    SECTION("Large resources get dedicated memory blocks")
+    {
+        TestDeviceMemoryAllocator allocator(settings);
+        const Allocation allocation = allocator.Allocate(0U, 3000U, 256U);
+        CHECK(allocation == Allocation{ 0U, 0U, 0U, 3000U, true });
+        CHECK(allocator.GetStatistics().dedicated_blocks_count == 1U);
+        CHECK(allocator.GetStatistics().allocated_size == 3000U);
+
+        allocator.Free(allocation);
+        CHECK(allocator.GetNativeBlocksCount() == 0U);
+        CHECK(allocator.GetStatistics() == Rhi::DeviceMemoryStatistics{});
+    }
+
+    SECTION("One empty memory block is kept in pool")
+    {
+        TestDeviceMemoryAllocator allocator(settings);
+        const Allocation allocation_a1 = allocator.Allocate(0U, 2000U, 256U);
+        const Allocation allocation_a2 = allocator.Allocate(0U, 2000U, 256U);
+        const Allocation allocation_b  = allocator.Allocate(0U, 1024U, 256U);
+        CHECK(allocation_b.block_index == 1U);
+        CHECK(allocator.GetNativeBlocksCount() == 2U);
+
+        allocator.Free(allocation_a1);
+        allocator.Free(allocation_a2);
+        CHECK(allocator.GetNativeBlocksCount() == 2U);
+        allocator.Free(allocation_b);
+        CHECK(allocator.GetNativeBlocksCount() == 1U);
+        CHECK(allocator.GetStatistics().allocations_count == 0U);
+        CHECK(allocator.GetStatistics().used_size == 0U);
+
+        CHECK(allocator.Allocate(0U, 256U, 256U).block_index == 0U);
+        CHECK(allocator.GetNativeAllocationsCount() == 2U);
+    }
+
+    SECTION("Freed memory block slots are reused")
+    {
+        TestDeviceMemoryAllocator allocator(settings);
+        const Allocation dedicated_allocation = allocator.Allocate(0U, 3000U, 256U);
+        CHECK(allocator.Allocate(1U, 256U, 256U).block_index == 1U);
+        allocator.Free(dedicated_allocation);
+        CHECK(allocator.Allocate(2U, 256U, 256U).block_index == 0U);
+        CHECK(allocator.GetStatistics().blocks_count == 2U);
+    }
+
+    SECTION("Native allocation failure returns uninitialized allocation")
+    {
+        TestDeviceMemoryAllocator allocator(settings);
+        allocator.SetNativeAllocationFailure(true);
+        CHECK_FALSE(allocator.Allocate(0U, 256U, 256U).IsInitialized());
+        CHECK_FALSE(allocator.Allocate(0U, 3000U, 256U).IsInitialized());
+        CHECK(allocator.GetStatistics() == Rhi::DeviceMemoryStatistics{});
+    }
+
+    SECTION("Free of uninitialized allocation is ignored")
+    {
+        TestDeviceMemoryAllocator allocator(settings);
+        CHECK_NOTHROW(allocator.Free(Allocation{}));
+    }
+
+    SECTION("Allocate resources from multiple threads")
+    {
+        TestDeviceMemoryAllocator allocator(Settings{ 64U * 1024U, 256U, 64U * 1024U });
+        constexpr size_t threads_count = 8U;
+        constexpr size_t thread_allocations_count = 100U;
+        std::vector<std::vector<Allocation>> allocations_by_thread(threads_count);
+        std::vector<std::thread> threads;
+        for (std::vector<Allocation>& thread_allocations : allocations_by_thread)
+        {
+            threads.emplace_back([&allocator, &thread_allocations]()
+            {
+                for (size_t i = 0U; i < thread_allocations_count; ++i)
+                {
+                    thread_allocations.push_back(allocator.Allocate(0U, 256U, 256U));
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<std::pair<Data::Index, uint64_t>> ranges;
+        for (const std::vector<Allocation>& thread_allocations : allocations_by_thread)
+        {
+            std::ranges::transform(thread_allocations, std::back_inserter(ranges),
+                                   [](const Allocation& allocation) { return std::pair(allocation.block_index, allocation.offset); });
+        }
+        std::ranges::sort(ranges);
+        CHECK(ranges.size() == threads_count * thread_allocations_count);
+        CHECK(std::ranges::adjacent_find(ranges) == ranges.end());
+        CHECK(allocator.GetStatistics().blocks_count == 4U);
+        CHECK(allocator.GetStatistics().used_size == threads_count * thread_allocations_count * 256U);
+    }
+}
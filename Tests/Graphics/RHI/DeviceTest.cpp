@@ -97,6 +97,16 @@ TEST_CASE("RHI Device Functions", "[device][rhi]")
         CHECK(device.GetCapabilities() == device_caps);
     }
 
+    SECTION("Check Get Memory Statistics")
+    {
+        CHECK(device.GetMemoryStatistics() == Rhi::DeviceMemoryStatistics{});
+    }
+
+    SECTION("Check Get Dynamic States")
+    {
+        CHECK(device.GetDynamicStates() == Rhi::DeviceDynamicStateMask{});
+    }
+
     SECTION("Check String Conversion")
     {
         CHECK(device.ToString() == "GPU \"Test GPU 1\"");
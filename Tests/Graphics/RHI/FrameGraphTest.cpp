@@ -0,0 +1,178 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/FrameGraphTest.cpp
+Unit-tests of the RHI FrameGraph
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/FrameGraph.h>
+#include <Methane/Graphics/RHI/Texture.h>
+
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("RHI Frame Graph Functions", "[rhi][frame-graph]")
+{
+    using enum Rhi::ResourceState;
+    using Access = Rhi::FrameGraphResourceAccess;
+
+    const Rhi::ComputeContext  compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::TextureSettings texture_settings = Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false);
+    const Rhi::Texture         output_texture = compute_context.CreateTexture(texture_settings);
+
+    // Shadow -> Blur -> Compose -> Output passes chain with Debug pass, which results are not used
+    Rhi::FrameGraph frame_graph(compute_context);
+    std::vector<size_t> executed_barriers_counts;
+    const auto pass_function = [&executed_barriers_counts](const Rhi::IResourceBarriers& barriers)
+    {
+        executed_barriers_counts.push_back(barriers.GetMap().size());
+    };
+
+    const Rhi::FrameGraphResourceId output_id  = frame_graph.ImportResource(output_texture, true);
+    const Rhi::FrameGraphResourceId shadow_id  = frame_graph.AddTransientTexture(texture_settings);
+    const Rhi::FrameGraphResourceId blur_id    = frame_graph.AddTransientTexture(texture_settings);
+    const Rhi::FrameGraphResourceId compose_id = frame_graph.AddTransientTexture(texture_settings);
+    const Rhi::FrameGraphResourceId debug_id   = frame_graph.AddTransientTexture(texture_settings);
+
+    frame_graph.AddPass({ "Shadow",  { { shadow_id, RenderTarget, Access::Write } } }, pass_function);
+    frame_graph.AddPass({ "Blur",    { { shadow_id, ShaderResource }, { blur_id, RenderTarget, Access::Write } } }, pass_function);
+    frame_graph.AddPass({ "Compose", { { blur_id, ShaderResource }, { compose_id, RenderTarget, Access::Write } } }, pass_function);
+    frame_graph.AddPass({ "Output",  { { compose_id, ShaderResource }, { output_id, RenderTarget, Access::Write } } }, pass_function);
+    frame_graph.AddPass({ "Debug",   { { shadow_id, ShaderResource }, { debug_id, RenderTarget, Access::Write } } }, pass_function);
+
+    SECTION("Frame Graph Construction")
+    {
+        CHECK(frame_graph.IsInitialized());
+        CHECK_FALSE(frame_graph.IsCompiled());
+        CHECK(&frame_graph.GetResource(output_id) == &output_texture.GetInterface());
+        CHECK_THROWS(frame_graph.GetResource(shadow_id));
+        CHECK_THROWS(frame_graph.Execute());
+    }
+
+    SECTION("Unused Passes are Culled")
+    {
+        const Rhi::FrameGraphSchedule& schedule = frame_graph.Compile();
+        CHECK(frame_graph.IsCompiled());
+        CHECK(schedule.culled_pass_ids == std::vector<Rhi::FrameGraphPassId>{ 4U });
+        REQUIRE(schedule.passes.size() == 4U);
+        for(Rhi::FrameGraphPassId pass_id = 0U; pass_id < 4U; ++pass_id)
+        {
+            CHECK(schedule.passes[pass_id].pass_id == pass_id);
+        }
+        CHECK_THROWS(frame_graph.GetResource(debug_id));
+    }
+
+    SECTION("Output Pass is not Culled")
+    {
+        frame_graph.AddPass({ "Overlay", { { debug_id, RenderTarget, Access::Write } }, true }, pass_function);
+        const Rhi::FrameGraphSchedule& schedule = frame_graph.Compile();
+        CHECK(schedule.culled_pass_ids.empty());
+        CHECK(schedule.passes.size() == 6U);
+    }
+
+    SECTION("Transient Textures with Non-Overlapping Lifetimes are Aliased")
+    {
+        const Rhi::FrameGraphSchedule& schedule = frame_graph.Compile();
+        CHECK(schedule.transient_slots_count == 2U);
+        REQUIRE(schedule.transient_slot_by_resource.size() == 5U);
+        CHECK_FALSE(schedule.transient_slot_by_resource[output_id].has_value());
+        CHECK(schedule.transient_slot_by_resource[shadow_id] == 0U);
+        CHECK(schedule.transient_slot_by_resource[blur_id] == 1U);
+        CHECK(schedule.transient_slot_by_resource[compose_id] == 0U);
+        CHECK_FALSE(schedule.transient_slot_by_resource[debug_id].has_value());
+        CHECK(&frame_graph.GetResource(shadow_id) == &frame_graph.GetResource(compose_id));
+        CHECK(&frame_graph.GetResource(shadow_id) != &frame_graph.GetResource(blur_id));
+    }
+
+    SECTION("Transient Textures with Different Settings are not Aliased")
+    {
+        const Rhi::FrameGraphResourceId other_id = frame_graph.AddTransientTexture(
+            Rhi::TextureSettings::ForImage(Dimensions(320, 240), {}, PixelFormat::RGBA8, false));
+        frame_graph.AddPass({ "Other", { { other_id, RenderTarget, Access::Write } }, true }, pass_function);
+        const Rhi::FrameGraphSchedule& schedule = frame_graph.Compile();
+        CHECK(schedule.transient_slots_count == 3U);
+        CHECK(schedule.transient_slot_by_resource[other_id] == 2U);
+    }
+
+    SECTION("Physical Transient Textures are Kept on Recompilation")
+    {
+        frame_graph.Compile();
+        const Rhi::IResource* shadow_texture_ptr = &frame_graph.GetResource(shadow_id);
+        frame_graph.AddPass({ "Final", { { output_id, Present } }, true }, pass_function);
+        CHECK_FALSE(frame_graph.IsCompiled());
+        frame_graph.Compile();
+        CHECK(&frame_graph.GetResource(shadow_id) == shadow_texture_ptr);
+    }
+
+    SECTION("Minimal Transition Barriers are Inferred")
+    {
+        const Rhi::FrameGraphSchedule& schedule = frame_graph.Compile();
+        REQUIRE(schedule.passes.size() == 4U);
+        CHECK(schedule.GetTransitionsCount() == 7U);
+        CHECK(schedule.passes[0].transitions == std::vector<Rhi::FrameGraphTransition>{
+            { shadow_id, Undefined, RenderTarget }
+        });
+        CHECK(schedule.passes[1].transitions == std::vector<Rhi::FrameGraphTransition>{
+            { shadow_id, RenderTarget, ShaderResource },
+            { blur_id, Undefined, RenderTarget }
+        });
+        CHECK(schedule.passes[2].transitions == std::vector<Rhi::FrameGraphTransition>{
+            { blur_id, RenderTarget, ShaderResource },
+            { compose_id, ShaderResource, RenderTarget } // aliased with shadow texture
+        });
+        CHECK(schedule.passes[3].transitions == std::vector<Rhi::FrameGraphTransition>{
+            { compose_id, RenderTarget, ShaderResource },
+            { output_id, Undefined, RenderTarget }
+        });
+    }
+
+    SECTION("Resource Used in Different States by One Pass is Rejected")
+    {
+        frame_graph.AddPass({ "Invalid", { { output_id, ShaderResource }, { output_id, CopySource } }, true }, pass_function);
+        CHECK_THROWS(frame_graph.Compile());
+    }
+
+    SECTION("Execute Passes with Transition Barriers")
+    {
+        frame_graph.Compile();
+        frame_graph.Execute();
+        CHECK(executed_barriers_counts == std::vector<size_t>{ 1U, 2U, 2U, 2U });
+        CHECK(output_texture.GetState() == RenderTarget);
+        CHECK(frame_graph.GetResource(compose_id).GetState() == ShaderResource);
+        CHECK(frame_graph.GetResource(blur_id).GetState() == ShaderResource);
+    }
+
+    SECTION("Repeated Execution Updates Transitions from Actual Resource States")
+    {
+        frame_graph.Compile();
+        frame_graph.Execute();
+        executed_barriers_counts.clear();
+        frame_graph.Execute();
+        CHECK(executed_barriers_counts == std::vector<size_t>{ 1U, 2U, 2U, 1U });
+    }
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ParallelRenderCommandListBenchmark.cpp
+Benchmark reset and commit of the parallel render command list depending on threads count.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+#include "RhiSettings.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+
+#include <array>
+#include <fmt/format.h>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr std::array<uint32_t, 5> g_thread_counts{ 1U, 2U, 4U, 8U, 16U };
+
+TEST_CASE("Benchmark parallel render command list reset and commit", "[rhi][list][render][benchmark][.]")
+{
+    tf::Executor                   parallel_executor;
+    const Platform::AppEnvironment app_env{ nullptr };
+    const Rhi::RenderContext       render_context   = Rhi::RenderContext(app_env, GetTestDevice(), parallel_executor, Test::GetRenderContextSettings());
+    const Rhi::CommandQueue        render_cmd_queue = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+    const Rhi::RenderPattern       render_pattern   = render_context.CreateRenderPattern(Test::GetRenderPatternSettings());
+    const Test::RenderPassResources render_pass_resources = Test::GetRenderPassResources(render_pattern);
+    const Rhi::RenderPass          render_pass      = render_pattern.CreateRenderPass(render_pass_resources.settings);
+    const Rhi::Program             render_program   = render_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            .shader_set = Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Render", "MainVS" } } },
+                { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Render", "MainPS" } } }
+            },
+            .input_buffer_layouts = Rhi::ProgramInputBufferLayouts
+            {
+                Rhi::ProgramInputBufferLayout
+                {
+                    .argument_semantics = Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" , "COLOR" },
+                    .step_type = Rhi::ProgramInputBufferLayout::StepType::PerVertex,
+                    .step_rate = 1U
+                }
+            },
+            .attachment_formats = render_pattern.GetAttachmentFormats()
+        });
+    const Rhi::RenderState render_state = render_context.CreateRenderState(Test::GetRenderStateSettings(render_context, render_pattern, render_program));
+    const Rhi::ViewState   view_state(Test::GetViewStateSettings());
+
+    const Rhi::ParallelRenderCommandList cmd_list = render_cmd_queue.CreateParallelRenderCommandList(render_pass);
+    const Rhi::CommandListSet            cmd_list_set({ cmd_list.GetInterface() });
+    cmd_list.SetParallelCommandListsReuseEnabled(true);
+
+    for(const uint32_t thread_count : g_thread_counts)
+    {
+        cmd_list.SetParallelCommandListsCount(thread_count);
+        BENCHMARK(fmt::format("Reset and commit parallel render command list with {} threads", thread_count))
+        {
+            cmd_list.ResetWithState(render_state);
+            cmd_list.SetViewState(view_state);
+            cmd_list.Commit();
+            render_cmd_queue.Execute(cmd_list_set);
+            dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+            return cmd_list.GetState();
+        };
+        CHECK(cmd_list.GetParallelCommandLists().size() == thread_count);
+    }
+}
@@ -38,6 +38,7 @@ Unit-tests of the RHI Parallel Render Command List
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 #include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
 #include <Methane/Graphics/RHI/Sampler.h>
 #include <Methane/Graphics/RHI/ObjectRegistry.h>
 #include <Methane/Graphics/Base/ViewState.h>
@@ -53,7 +54,9 @@ Unit-tests of the RHI Parallel Render Command List
 
 #include <chrono>
 #include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <thread>
@@ -327,6 +330,40 @@ TEST_CASE("RHI Parallel Render Command List Functions", "[rhi][list][render]")
         }
     }
 
+    SECTION("Decrease Parallel Render Command Lists Count")
+    {
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(4U));
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(1U));
+        CHECK(cmd_list.GetParallelCommandLists().size() == 1U);
+    }
+
+    SECTION("Reuse Parallel Render Command Lists")
+    {
+        CHECK_FALSE(cmd_list.IsParallelCommandListsReuseEnabled());
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsReuseEnabled(true));
+        CHECK(cmd_list.IsParallelCommandListsReuseEnabled());
+        CHECK(cmd_list.SetName("Test"));
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(4U));
+
+        std::vector<Rhi::IRenderCommandList*> thread_cmd_list_ptrs;
+        for (const Rhi::RenderCommandList& thread_cmd_list : cmd_list.GetParallelCommandLists())
+        {
+            thread_cmd_list_ptrs.emplace_back(thread_cmd_list.GetInterfacePtr().get());
+        }
+
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(2U));
+        CHECK(cmd_list.GetParallelCommandLists().size() == 2U);
+        REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(4U));
+
+        const std::vector<Rhi::RenderCommandList>& thread_cmd_lists = cmd_list.GetParallelCommandLists();
+        REQUIRE(thread_cmd_lists.size() == 4U);
+        for (uint32_t thread_index = 0U; thread_index < 4U; ++thread_index)
+        {
+            CHECK(thread_cmd_lists[thread_index].GetInterfacePtr().get() == thread_cmd_list_ptrs[thread_index]);
+            CHECK(thread_cmd_lists[thread_index].GetName() == fmt::format("Test - Thread {}", thread_index));
+        }
+    }
+
     REQUIRE_NOTHROW(cmd_list.SetParallelCommandListsCount(4U));
     const Rhi::RenderStateSettingsImpl render_state_settings = Test::GetRenderStateSettings(render_context, render_pattern, render_program);
     const Rhi::RenderState render_state = render_context.CreateRenderState(render_state_settings);
@@ -342,7 +379,7 @@ TEST_CASE("RHI Parallel Render Command List Functions", "[rhi][list][render]")
         {
             CHECK(thread_cmd_list.GetState() == Rhi::CommandListState::Encoding);
             const auto& null_thread_cmd_list = dynamic_cast<Null::RenderCommandList&>(thread_cmd_list.GetInterface());
-            CHECK(null_thread_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+            CHECK(null_thread_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
         }
     }
 
@@ -358,7 +395,7 @@ TEST_CASE("RHI Parallel Render Command List Functions", "[rhi][list][render]")
         {
             CHECK(thread_cmd_list.GetState() == Rhi::CommandListState::Encoding);
             const auto& null_thread_cmd_list = dynamic_cast<Null::RenderCommandList&>(thread_cmd_list.GetInterface());
-            CHECK(null_thread_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+            CHECK(null_thread_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
 
             const Opt<Rhi::CommandListDebugGroup> thread_debug_group_opt = debug_group.GetSubGroup(thread_index);
             CHECK(thread_debug_group_opt.has_value());
@@ -386,6 +423,158 @@ TEST_CASE("RHI Parallel Render Command List Functions", "[rhi][list][render]")
         }
     }
 
+    SECTION("Draw Parallel in Ranges Balanced by Cost")
+    {
+        using DrawRange = Rhi::ParallelRenderCommandList::DrawRange;
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+
+        std::mutex draw_ranges_mutex;
+        std::map<Rhi::IRenderCommandList*, DrawRange> draw_range_by_cmd_list;
+        REQUIRE_NOTHROW(cmd_list.DrawParallel(12U,
+            [&draw_ranges_mutex, &draw_range_by_cmd_list](const Rhi::RenderCommandList& render_cmd_list, const DrawRange& draw_range)
+            {
+                std::scoped_lock lock(draw_ranges_mutex);
+                draw_range_by_cmd_list.try_emplace(render_cmd_list.GetInterfacePtr().get(), draw_range);
+            },
+            [](Data::Index draw_index) { return draw_index < 4U ? 2U : 1U; }));
+
+        const std::vector<Rhi::RenderCommandList>& thread_cmd_lists = cmd_list.GetParallelCommandLists();
+        REQUIRE(draw_range_by_cmd_list.size() == 4U);
+        CHECK(draw_range_by_cmd_list.at(thread_cmd_lists[0].GetInterfacePtr().get()) == DrawRange(0U, 2U));
+        CHECK(draw_range_by_cmd_list.at(thread_cmd_lists[1].GetInterfacePtr().get()) == DrawRange(2U, 4U));
+        CHECK(draw_range_by_cmd_list.at(thread_cmd_lists[2].GetInterfacePtr().get()) == DrawRange(4U, 8U));
+        CHECK(draw_range_by_cmd_list.at(thread_cmd_lists[3].GetInterfacePtr().get()) == DrawRange(8U, 12U));
+    }
+
+    SECTION("Draw Parallel Uses Less Command Lists for Small Draws Count")
+    {
+        using DrawRange = Rhi::ParallelRenderCommandList::DrawRange;
+        CHECK(Base::ParallelRenderCommandList::PartitionDraws(4U, 0U).empty());
+        CHECK(Base::ParallelRenderCommandList::PartitionDraws(4U, 2U) == std::vector<DrawRange>{ { 0U, 1U }, { 1U, 2U } });
+        CHECK(Base::ParallelRenderCommandList::PartitionDraws(4U, 8U, {}, 3U) == std::vector<DrawRange>{ { 0U, 4U }, { 4U, 8U } });
+        CHECK(Base::ParallelRenderCommandList::PartitionDraws(4U, 8U, {}, 10U) == std::vector<DrawRange>{ { 0U, 8U } });
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        std::vector<Rhi::IRenderCommandList*> drawn_cmd_list_ptrs;
+        REQUIRE_NOTHROW(cmd_list.DrawParallel(1U,
+            [&drawn_cmd_list_ptrs](const Rhi::RenderCommandList& render_cmd_list, const DrawRange& draw_range)
+            {
+                CHECK(draw_range == DrawRange(0U, 1U));
+                drawn_cmd_list_ptrs.emplace_back(render_cmd_list.GetInterfacePtr().get());
+            }));
+        CHECK(drawn_cmd_list_ptrs == std::vector<Rhi::IRenderCommandList*>{ cmd_list.GetParallelCommandLists().front().GetInterfacePtr().get() });
+    }
+
+    SECTION("Idle Thread Command Lists are Not Committed and Executed")
+    {
+        using DrawRange = Rhi::ParallelRenderCommandList::DrawRange;
+        const Rhi::Buffer vertex_buffer_one = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(144U, 12U, true));
+        const Rhi::Buffer vertex_buffer_two = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(144U, 12U, true));
+        dynamic_cast<Null::Buffer&>(vertex_buffer_one.GetInterface()).SetInitializedDataSize(144U * 12U);
+        dynamic_cast<Null::Buffer&>(vertex_buffer_two.GetInterface()).SetInitializedDataSize(144U * 12U);
+        const Rhi::BufferSet vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer_one, vertex_buffer_two });
+        const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE_NOTHROW(cmd_list.DrawParallel(1U,
+            [&vertex_buffer_set](const Rhi::RenderCommandList& render_cmd_list, const DrawRange&)
+            {
+                render_cmd_list.SetVertexBuffers(vertex_buffer_set, false);
+                render_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U);
+            }));
+        REQUIRE_NOTHROW(cmd_list.Commit());
+
+        const std::vector<Rhi::RenderCommandList>& thread_cmd_lists = cmd_list.GetParallelCommandLists();
+        REQUIRE(thread_cmd_lists.size() == 4U);
+        CHECK(thread_cmd_lists[0].GetState() == Rhi::CommandListState::Committed);
+        for (uint32_t thread_index = 1U; thread_index < 4U; ++thread_index)
+        {
+            CHECK(thread_cmd_lists[thread_index].GetState() == Rhi::CommandListState::Encoding);
+        }
+
+        REQUIRE_NOTHROW(render_cmd_queue.Execute(cmd_list_set));
+        CHECK(thread_cmd_lists[0].GetState() == Rhi::CommandListState::Executing);
+        CHECK(thread_cmd_lists[1].GetState() == Rhi::CommandListState::Encoding);
+
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        CHECK(cmd_list.GetState() == Rhi::CommandListState::Pending);
+        CHECK(thread_cmd_lists[0].GetState() == Rhi::CommandListState::Pending);
+
+        // Idle command lists left in encoding state are reset again with the next encoding
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        for (const Rhi::RenderCommandList& thread_cmd_list : thread_cmd_lists)
+        {
+            CHECK(thread_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+            CHECK(dynamic_cast<Null::RenderCommandList&>(thread_cmd_list.GetInterface()).IsIdle());
+        }
+    }
+
+    SECTION("Idle Thread Command Lists Release Retained Resources and Debug Groups on Commit")
+    {
+        using DrawRange = Rhi::ParallelRenderCommandList::DrawRange;
+        const Rhi::Buffer vertex_buffer_one = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(144U, 12U, true));
+        const Rhi::Buffer vertex_buffer_two = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(144U, 12U, true));
+        dynamic_cast<Null::Buffer&>(vertex_buffer_one.GetInterface()).SetInitializedDataSize(144U * 12U);
+        dynamic_cast<Null::Buffer&>(vertex_buffer_two.GetInterface()).SetInitializedDataSize(144U * 12U);
+        const Rhi::BufferSet vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer_one, vertex_buffer_two });
+        const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+        const Rhi::CommandListDebugGroup debug_group("Test");
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state, &debug_group));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE_NOTHROW(cmd_list.DrawParallel(1U,
+            [&vertex_buffer_set](const Rhi::RenderCommandList& render_cmd_list, const DrawRange&)
+            {
+                render_cmd_list.SetVertexBuffers(vertex_buffer_set, false);
+                render_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U);
+            }));
+
+        // Thread command list with vertex buffers set and without draws is idle, but retains its vertex buffers
+        const std::vector<Rhi::RenderCommandList>& thread_cmd_lists = cmd_list.GetParallelCommandLists();
+        REQUIRE(thread_cmd_lists.size() == 4U);
+        const auto& null_idle_cmd_list = dynamic_cast<Null::RenderCommandList&>(thread_cmd_lists[1].GetInterface());
+        REQUIRE(thread_cmd_lists[1].SetVertexBuffers(vertex_buffer_set, false));
+        CHECK(null_idle_cmd_list.IsIdle());
+        CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(vertex_buffer_set, thread_cmd_lists[1]));
+        CHECK(null_idle_cmd_list.HasOpenDebugGroups());
+
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        CHECK(thread_cmd_lists[1].GetState() == Rhi::CommandListState::Encoding);
+        CHECK(null_idle_cmd_list.GetCommandState().retained_resources.empty());
+        CHECK_FALSE(null_idle_cmd_list.HasOpenDebugGroups());
+        CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(vertex_buffer_set, thread_cmd_lists[0]));
+
+        REQUIRE_NOTHROW(render_cmd_queue.Execute(cmd_list_set));
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        CHECK(null_idle_cmd_list.GetCommandState().retained_resources.empty());
+
+        // Debug group of idle command list is pushed again with the next encoding
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state, &debug_group));
+        const Opt<Rhi::CommandListDebugGroup> thread_debug_group_opt = debug_group.GetSubGroup(1U);
+        REQUIRE(thread_debug_group_opt.has_value());
+        REQUIRE(null_idle_cmd_list.GetTopOpenDebugGroup());
+        CHECK(null_idle_cmd_list.GetTopOpenDebugGroup()->GetName() == thread_debug_group_opt->GetName());
+    }
+
+    SECTION("Thread Command Lists with Resource Barriers are Not Idle")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        const std::vector<Rhi::RenderCommandList>& thread_cmd_lists = cmd_list.GetParallelCommandLists();
+        REQUIRE(thread_cmd_lists.size() == 4U);
+
+        const Rhi::Buffer buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+        const Rhi::ResourceBarriers buffer_barriers(Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(buffer.GetInterface(), Rhi::ResourceState::Common, Rhi::ResourceState::ConstantBuffer)
+        });
+        REQUIRE_NOTHROW(thread_cmd_lists[2].SetResourceBarriers(buffer_barriers));
+        CHECK_FALSE(dynamic_cast<Null::RenderCommandList&>(thread_cmd_lists[2].GetInterface()).IsIdle());
+        REQUIRE_NOTHROW(cmd_list.Commit());
+
+        CHECK(thread_cmd_lists[0].GetState() == Rhi::CommandListState::Encoding);
+        CHECK(thread_cmd_lists[2].GetState() == Rhi::CommandListState::Committed);
+    }
+
     const Rhi::ResourceBarriers barriers(Rhi::IResourceBarriers::Set{});
 
     SECTION("Set Beginning Resource Barriers")
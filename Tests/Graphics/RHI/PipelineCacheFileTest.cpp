@@ -0,0 +1,157 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/PipelineCacheFileTest.cpp
+Unit-tests of the versioned pipeline cache file
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/PipelineCacheFile.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using DeviceKey = Base::PipelineCacheDeviceKey;
+
+static const DeviceKey g_device_key{ 0x10DEU, 0x2204U, 0x12345678U, { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 12U, 13U, 14U, 15U, 16U } };
+
+static Data::Bytes GetTestCacheData(size_t size)
+{
+    Data::Bytes cache_data(size);
+    for (size_t i = 0U; i < size; ++i)
+    {
+        cache_data[i] = static_cast<std::byte>(i * 7U);
+    }
+    return cache_data;
+}
+
+static std::string GetTestFilePath()
+{
+    return (std::filesystem::temp_directory_path() / "MethanePipelineCacheFileTest.bin").string();
+}
+
+TEST_CASE("Pipeline Cache File Serialization", "[rhi][pipeline][cache]")
+{
+    const Data::Bytes cache_data = GetTestCacheData(1000U);
+
+    SECTION("Serialized data is deserialized for the same device")
+    {
+        const Data::Bytes file_data = Base::PipelineCacheFile::Serialize(g_device_key, cache_data);
+        CHECK(file_data.size() > cache_data.size());
+        CHECK(Base::PipelineCacheFile::Deserialize(g_device_key, file_data) == cache_data);
+    }
+
+    SECTION("Empty cache data is serialized")
+    {
+        const Data::Bytes file_data = Base::PipelineCacheFile::Serialize(g_device_key, {});
+        CHECK(Base::PipelineCacheFile::Deserialize(g_device_key, file_data).empty());
+    }
+
+    SECTION("Data is not deserialized for another device or driver")
+    {
+        const Data::Bytes file_data = Base::PipelineCacheFile::Serialize(g_device_key, cache_data);
+
+        DeviceKey other_device_key = g_device_key;
+        other_device_key.device_id++;
+        CHECK(Base::PipelineCacheFile::Deserialize(other_device_key, file_data).empty());
+
+        DeviceKey other_driver_key = g_device_key;
+        other_driver_key.driver_version++;
+        CHECK(Base::PipelineCacheFile::Deserialize(other_driver_key, file_data).empty());
+
+        DeviceKey other_uuid_key = g_device_key;
+        other_uuid_key.cache_uuid[15]++;
+        CHECK(Base::PipelineCacheFile::Deserialize(other_uuid_key, file_data).empty());
+    }
+
+    SECTION("Data is not deserialized with another file version")
+    {
+        Data::Bytes file_data = Base::PipelineCacheFile::Serialize(g_device_key, cache_data);
+        file_data[4] = static_cast<std::byte>(Base::PipelineCacheFile::g_version + 1U);
+        CHECK(Base::PipelineCacheFile::Deserialize(g_device_key, file_data).empty());
+    }
+
+    SECTION("Corrupted data is not deserialized")
+    {
+        Data::Bytes file_data = Base::PipelineCacheFile::Serialize(g_device_key, cache_data);
+        file_data.back() ^= std::byte{ 0xFF };
+        CHECK(Base::PipelineCacheFile::Deserialize(g_device_key, file_data).empty());
+    }
+
+    SECTION("Truncated data is not deserialized")
+    {
+        Data::Bytes file_data = Base::PipelineCacheFile::Serialize(g_device_key, cache_data);
+        file_data.pop_back();
+        CHECK(Base::PipelineCacheFile::Deserialize(g_device_key, file_data).empty());
+        file_data.resize(16U);
+        CHECK(Base::PipelineCacheFile::Deserialize(g_device_key, file_data).empty());
+    }
+}
+
+TEST_CASE("Pipeline Cache File Save and Load", "[rhi][pipeline][cache]")
+{
+    const std::string file_path = GetTestFilePath();
+    std::filesystem::remove(file_path);
+
+    SECTION("Missing file is loaded as empty data")
+    {
+        const Base::PipelineCacheFile cache_file(file_path, g_device_key);
+        CHECK(cache_file.Load().empty());
+    }
+
+    SECTION("Saved data is loaded for the same device")
+    {
+        const Data::Bytes cache_data = GetTestCacheData(4096U);
+        const Base::PipelineCacheFile cache_file(file_path, g_device_key);
+        CHECK(cache_file.Save(cache_data));
+        CHECK(cache_file.Load() == cache_data);
+        CHECK_FALSE(std::filesystem::exists(file_path + ".tmp"));
+    }
+
+    SECTION("Saved data is overwritten")
+    {
+        const Base::PipelineCacheFile cache_file(file_path, g_device_key);
+        CHECK(cache_file.Save(GetTestCacheData(4096U)));
+        CHECK(cache_file.Save(GetTestCacheData(100U)));
+        CHECK(cache_file.Load() == GetTestCacheData(100U));
+    }
+
+    SECTION("Saved data is not loaded for another device")
+    {
+        CHECK(Base::PipelineCacheFile(file_path, g_device_key).Save(GetTestCacheData(100U)));
+        DeviceKey other_device_key = g_device_key;
+        other_device_key.vendor_id++;
+        CHECK(Base::PipelineCacheFile(file_path, other_device_key).Load().empty());
+    }
+
+    SECTION("File with garbage content is loaded as empty data")
+    {
+        {
+            std::ofstream file_stream(file_path, std::ios::binary);
+            file_stream << "not a pipeline cache";
+        }
+        CHECK(Base::PipelineCacheFile(file_path, g_device_key).Load().empty());
+    }
+
+    std::filesystem::remove(file_path);
+}
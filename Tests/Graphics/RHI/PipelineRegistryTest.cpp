@@ -0,0 +1,344 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/PipelineRegistryTest.cpp
+Unit-tests of the pipeline registry and render pipeline key
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/Base/PipelineRegistry.h>
+#include <Methane/Graphics/Base/RenderPipelineKey.h>
+#include <Methane/Graphics/RHI/IRenderCommandList.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Data/AppShadersProvider.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <future>
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using TestPipelineRegistry = Base::PipelineRegistry<uint32_t, Ptr<uint32_t>>;
+using TestPipeline         = TestPipelineRegistry::Pipeline;
+
+TEST_CASE("Pipeline Registry", "[rhi][pipeline][registry]")
+{
+    tf::Executor executor;
+    TestPipelineRegistry registry(executor);
+    std::atomic<uint32_t> created_count{ 0U };
+
+    const auto create_pipeline = [&created_count](uint32_t value)
+    {
+        return [&created_count, value]()
+        {
+            created_count++;
+            return std::make_shared<uint32_t>(value);
+        };
+    };
+
+    SECTION("Pipelines with equal keys are shared")
+    {
+        const TestPipeline pipeline_a = registry.GetPipeline(1U, create_pipeline(1U));
+        const TestPipeline pipeline_b = registry.GetPipeline(1U, create_pipeline(1U));
+        CHECK(pipeline_a.IsReady());
+        CHECK(pipeline_a == pipeline_b);
+        CHECK(pipeline_a.Get() == pipeline_b.Get());
+        CHECK(created_count == 1U);
+        CHECK(registry.GetStatistics() == Base::PipelineRegistryStatistics{ 1U, 1U, 1U, 0U });
+    }
+
+    SECTION("Pipelines with different keys are not shared")
+    {
+        const TestPipeline pipeline_a = registry.GetPipeline(1U, create_pipeline(1U));
+        const TestPipeline pipeline_b = registry.GetPipeline(2U, create_pipeline(2U));
+        CHECK(*pipeline_a.Get() == 1U);
+        CHECK(*pipeline_b.Get() == 2U);
+        CHECK(created_count == 2U);
+        CHECK(registry.GetStatistics().pipelines_count == 2U);
+    }
+
+    SECTION("Pipeline is released with the last reference")
+    {
+        WeakPtr<uint32_t> pipeline_wptr;
+        {
+            const TestPipeline pipeline_a = registry.GetPipeline(1U, create_pipeline(1U));
+            TestPipeline pipeline_b = registry.GetPipeline(1U, create_pipeline(1U));
+            pipeline_wptr = pipeline_a.Get();
+            pipeline_b = {};
+            CHECK_FALSE(pipeline_wptr.expired());
+        }
+        CHECK(pipeline_wptr.expired());
+        CHECK(registry.GetStatistics().pipelines_count == 0U);
+
+        const TestPipeline pipeline_c = registry.GetPipeline(1U, create_pipeline(1U));
+        CHECK(created_count == 2U);
+    }
+
+    SECTION("Pipeline creation error is thrown in synchronous mode")
+    {
+        CHECK_THROWS_AS(registry.GetPipeline(1U, []() -> Ptr<uint32_t> { throw std::runtime_error("creation failed"); }), std::runtime_error);
+        const TestPipeline pipeline = registry.GetPipeline(1U, create_pipeline(1U));
+        CHECK(*pipeline.Get() == 1U);
+    }
+
+    SECTION("Synchronous pipeline creation does not block requests of other pipelines")
+    {
+        std::promise<void> creation_started;
+        std::promise<void> creation_allowed;
+        std::shared_future<void> creation_allowed_future = creation_allowed.get_future().share();
+        TestPipeline pipeline_a;
+        std::thread creation_thread([&registry, &pipeline_a, &creation_started, creation_allowed_future]()
+        {
+            pipeline_a = registry.GetPipeline(1U,
+                [&creation_started, creation_allowed_future]()
+                {
+                    creation_started.set_value();
+                    creation_allowed_future.wait();
+                    return std::make_shared<uint32_t>(1U);
+                });
+        });
+        creation_started.get_future().wait();
+
+        // Pipeline with other key is created while the first one is being created on another thread
+        const TestPipeline pipeline_b = registry.GetPipeline(2U, create_pipeline(2U));
+        CHECK(*pipeline_b.Get() == 2U);
+
+        // Pipeline with the same key is returned as placeholder, which is not ready until creation is completed
+        const TestPipeline pipeline_a_shared = registry.GetPipeline(1U, create_pipeline(1U));
+        CHECK_FALSE(pipeline_a_shared.IsReady());
+
+        creation_allowed.set_value();
+        creation_thread.join();
+        CHECK(pipeline_a_shared == pipeline_a);
+        CHECK(*pipeline_a_shared.Get() == 1U);
+        CHECK(created_count == 1U);
+        CHECK(registry.GetStatistics() == Base::PipelineRegistryStatistics{ 2U, 2U, 1U, 0U });
+    }
+
+    SECTION("Skipped pipeline uses are counted in statistics")
+    {
+        const TestPipeline pipeline = registry.GetPipeline(1U, create_pipeline(1U));
+        registry.AddSkippedUse();
+        registry.AddSkippedUse();
+        CHECK(registry.GetStatistics() == Base::PipelineRegistryStatistics{ 1U, 1U, 0U, 0U, 2U });
+    }
+
+    SECTION("Pipeline is created asynchronously without blocking")
+    {
+        std::promise<void> creation_allowed;
+        std::shared_future<void> creation_allowed_future = creation_allowed.get_future().share();
+        const TestPipeline pipeline = registry.GetPipeline(1U,
+            [creation_allowed_future]()
+            {
+                creation_allowed_future.wait();
+                return std::make_shared<uint32_t>(1U);
+            },
+            true);
+
+        CHECK(pipeline.IsInitialized());
+        CHECK_FALSE(pipeline.IsReady());
+        CHECK(pipeline.GetIfReady() == nullptr);
+
+        const TestPipeline pipeline_shared = registry.GetPipeline(1U, create_pipeline(1U));
+        CHECK(pipeline_shared == pipeline);
+        CHECK(created_count == 0U);
+
+        creation_allowed.set_value();
+        CHECK(*pipeline.Get() == 1U);
+        CHECK(pipeline.IsReady());
+        REQUIRE(pipeline.GetIfReady() != nullptr);
+        CHECK(**pipeline.GetIfReady() == 1U);
+        CHECK(registry.GetStatistics() == Base::PipelineRegistryStatistics{ 1U, 1U, 1U, 1U });
+    }
+
+    SECTION("Pending pipelines are completed on wait")
+    {
+        const TestPipeline pipeline_a = registry.GetPipeline(1U, create_pipeline(1U), true);
+        const TestPipeline pipeline_b = registry.GetPipeline(2U, create_pipeline(2U), true);
+        registry.WaitForPendingPipelines();
+        CHECK(pipeline_a.IsReady());
+        CHECK(pipeline_b.IsReady());
+        CHECK(created_count == 2U);
+    }
+
+    SECTION("Asynchronous pipeline creation error is thrown on get")
+    {
+        const TestPipeline pipeline = registry.GetPipeline(1U, []() -> Ptr<uint32_t> { throw std::runtime_error("creation failed"); }, true);
+        CHECK_THROWS_AS(pipeline.Get(), std::runtime_error);
+    }
+
+    SECTION("Pipelines are shared between threads")
+    {
+        constexpr size_t threads_count = 8U;
+        std::vector<TestPipeline> pipelines(threads_count);
+        std::vector<std::thread> threads;
+        for (size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            threads.emplace_back([&registry, &pipelines, &create_pipeline, thread_index]()
+            {
+                pipelines[thread_index] = registry.GetPipeline(1U, create_pipeline(1U), thread_index % 2 == 0);
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(std::ranges::adjacent_find(pipelines, std::not_equal_to<TestPipeline>()) == pipelines.end());
+        CHECK(*pipelines.front().Get() == 1U);
+        CHECK(created_count == 1U);
+        CHECK(registry.GetStatistics().reused_count == threads_count - 1U);
+    }
+}
+
+TEST_CASE("Render Pipeline Key", "[rhi][pipeline][registry]")
+{
+    using enum Rhi::DeviceDynamicState;
+    const Rhi::DeviceDynamicStateMask monolithic_states{ Viewports };
+    const Rhi::DeviceDynamicStateMask dynamic_states{ Viewports, ViewportsCount, PrimitiveTopology, CullMode, DepthTest, StencilTest };
+    const Rhi::RenderStateSettings settings;
+    const Rhi::ViewSettings view_settings{
+        { Viewport(0.0, 0.0, 0.0, 640.0, 480.0, 1.0) },
+        { ScissorRect(0U, 0U, 640U, 480U) }
+    };
+
+    SECTION("Keys of equal settings are equal")
+    {
+        const Base::RenderPipelineKey key_a(settings);
+        const Base::RenderPipelineKey key_b(settings);
+        CHECK(key_a == key_b);
+        CHECK(key_a.GetHash() == key_b.GetHash());
+    }
+
+    SECTION("Keys of programs with equal shaders and layout are equal")
+    {
+        static tf::Executor parallel_executor;
+        const Rhi::ComputeContext compute_context(GetTestDevice(), parallel_executor, {});
+        const Rhi::ProgramSettingsImpl program_settings{
+            { { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } } },
+        };
+        Rhi::ProgramSettingsImpl other_program_settings{
+            { { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" }, { Rhi::ShaderMacroDefinition("OTHER", "1") } } } },
+        };
+
+        const Rhi::Program program_a = compute_context.CreateProgram(program_settings);
+        const Rhi::Program program_b = compute_context.CreateProgram(program_settings);
+        const Rhi::Program program_c = compute_context.CreateProgram(other_program_settings);
+
+        Rhi::RenderStateSettings settings_a = settings;
+        Rhi::RenderStateSettings settings_b = settings;
+        Rhi::RenderStateSettings settings_c = settings;
+        settings_a.program_ptr = program_a.GetInterfacePtr();
+        settings_b.program_ptr = program_b.GetInterfacePtr();
+        settings_c.program_ptr = program_c.GetInterfacePtr();
+
+        const Base::RenderPipelineKey key_a(settings_a);
+        const Base::RenderPipelineKey key_b(settings_b);
+        const Base::RenderPipelineKey key_c(settings_c);
+        CHECK(key_a == key_b);
+        CHECK(key_a.GetHash() == key_b.GetHash());
+        CHECK_FALSE(key_a == key_c);
+        CHECK(key_a.GetHash() != key_c.GetHash());
+        CHECK_FALSE(key_a == Base::RenderPipelineKey(settings));
+    }
+
+    SECTION("Keys of different settings are different")
+    {
+        Rhi::RenderStateSettings other_settings = settings;
+        other_settings.rasterizer.cull_mode = Rhi::RasterizerCullMode::Front;
+        const Base::RenderPipelineKey key_a(settings);
+        const Base::RenderPipelineKey key_b(other_settings);
+        CHECK_FALSE(key_a == key_b);
+        CHECK(key_a.GetHash() != key_b.GetHash());
+    }
+
+    SECTION("Unused blending render targets are ignored")
+    {
+        Rhi::RenderStateSettings other_settings = settings;
+        other_settings.blending.render_targets[1].blend_enabled = true;
+        CHECK(Base::RenderPipelineKey(settings) == Base::RenderPipelineKey(other_settings));
+
+        other_settings.blending.is_independent = true;
+        CHECK_FALSE(Base::RenderPipelineKey(settings) == Base::RenderPipelineKey(other_settings));
+    }
+
+    SECTION("Settings of dynamic states are ignored")
+    {
+        Rhi::RenderStateSettings other_settings = settings;
+        other_settings.rasterizer.cull_mode = Rhi::RasterizerCullMode::Front;
+        other_settings.rasterizer.is_front_counter_clockwise = true;
+        other_settings.depth.enabled = true;
+        other_settings.depth.compare = Compare::Greater;
+        other_settings.stencil.enabled = true;
+        other_settings.stencil.front_face.stencil_pass = Rhi::FaceOperation::Replace;
+
+        const Base::RenderPipelineKey key_a(settings, dynamic_states);
+        const Base::RenderPipelineKey key_b(other_settings, dynamic_states);
+        CHECK(key_a == key_b);
+        CHECK(key_a.GetHash() == key_b.GetHash());
+        CHECK_FALSE(Base::RenderPipelineKey(settings, monolithic_states) == Base::RenderPipelineKey(other_settings, monolithic_states));
+
+        other_settings.rasterizer.fill_mode = Rhi::RasterizerFillMode::Wireframe;
+        CHECK_FALSE(key_a == Base::RenderPipelineKey(other_settings, dynamic_states));
+    }
+
+    SECTION("Keys of different dynamic states are different")
+    {
+        CHECK_FALSE(Base::RenderPipelineKey(settings, dynamic_states) == Base::RenderPipelineKey(settings));
+        CHECK(Base::RenderPipelineKey(settings, dynamic_states).GetHash() != Base::RenderPipelineKey(settings).GetHash());
+    }
+
+    SECTION("View settings and primitive are ignored with dynamic viewports count and topology")
+    {
+        const Base::RenderPipelineKey dynamic_key(settings, dynamic_states, &view_settings, Rhi::RenderPrimitive::Triangle);
+        CHECK(dynamic_key == Base::RenderPipelineKey(settings, dynamic_states));
+        CHECK_FALSE(dynamic_key.GetViewShape().has_value());
+        CHECK_FALSE(dynamic_key.GetPrimitive().has_value());
+
+        const Base::RenderPipelineKey monolithic_key(settings, monolithic_states, &view_settings, Rhi::RenderPrimitive::Triangle);
+        CHECK(monolithic_key.GetViewShape() == Base::RenderPipelineViewShape{ 1U, 1U });
+        CHECK(monolithic_key.GetPrimitive() == Rhi::RenderPrimitive::Triangle);
+        CHECK_FALSE(monolithic_key == Base::RenderPipelineKey(settings, monolithic_states, &view_settings, Rhi::RenderPrimitive::Line));
+    }
+
+    SECTION("Keys with equal view state shape are equal")
+    {
+        Rhi::ViewSettings other_view_settings = view_settings;
+        other_view_settings.viewports.front().size.SetWidth(1280.0);
+        const Base::RenderPipelineKey key_a(settings, monolithic_states, &view_settings, Rhi::RenderPrimitive::Triangle);
+        const Base::RenderPipelineKey key_b(settings, monolithic_states, &other_view_settings, Rhi::RenderPrimitive::Triangle);
+        CHECK(key_a == key_b);
+        CHECK(key_a.GetHash() == key_b.GetHash());
+
+        other_view_settings.viewports.push_back(Viewport(0.0, 0.0, 0.0, 640.0, 480.0, 1.0));
+        const Base::RenderPipelineKey key_c(settings, monolithic_states, &other_view_settings, Rhi::RenderPrimitive::Triangle);
+        CHECK_FALSE(key_a == key_c);
+        CHECK(key_a.GetHash() != key_c.GetHash());
+    }
+}
@@ -0,0 +1,123 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ProgramBindingsBenchmark.cpp
+Benchmark parallel creation of program bindings with root constant arguments.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/Null/Program.h>
+
+#include <vector>
+#include <algorithm>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr size_t g_program_bindings_count = 100000U;
+
+static Rhi::Program CreateRootConstantsProgram(const Rhi::ComputeContext& compute_context)
+{
+    const Rhi::ProgramArgumentAccessor in_buffer_accessor {
+        Rhi::ShaderType::Compute, "InBuffer",
+        Rhi::ProgramArgumentAccessType::Mutable,
+        Rhi::ProgramArgumentValueType::RootConstantBuffer
+    };
+    const Rhi::ProgramArgumentAccessor in_value_accessor {
+        Rhi::ShaderType::Compute, "InValue",
+        Rhi::ProgramArgumentAccessType::Mutable,
+        Rhi::ProgramArgumentValueType::RootConstantValue
+    };
+
+    Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors
+            {
+                in_buffer_accessor,
+                in_value_accessor
+            }
+        });
+    dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+        { in_buffer_accessor, { Rhi::ResourceType::Buffer, 1U, 4U } },
+        { in_value_accessor,  { Rhi::ResourceType::Buffer, 1U, 4U } },
+    });
+    return compute_program;
+}
+
+static size_t MeasureParallelProgramBindingsCreation(size_t threads_count, Catch::Benchmark::Chronometer meter)
+{
+    tf::Executor parallel_executor(threads_count);
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), parallel_executor, {});
+    const Rhi::Program compute_program = CreateRootConstantsProgram(compute_context);
+    std::vector<Rhi::ProgramBindings> program_bindings(g_program_bindings_count);
+
+    meter.measure([&]()
+    {
+        tf::Taskflow task_flow;
+        task_flow.for_each_index(size_t{ 0U }, g_program_bindings_count, size_t{ 1U },
+            [&compute_program, &program_bindings](const size_t bindings_index)
+            {
+                program_bindings[bindings_index] = compute_program.CreateBindings({});
+                program_bindings[bindings_index].Get({ Rhi::ShaderType::Compute, "InValue" })
+                                                .SetRootConstant(Rhi::RootConstant(static_cast<uint32_t>(bindings_index)));
+            });
+        parallel_executor.run(task_flow).get();
+    });
+
+    // Prevent code removal by optimizer and check that all program bindings were created
+    const size_t created_bindings_count = static_cast<size_t>(
+        std::ranges::count_if(program_bindings, [](const Rhi::ProgramBindings& bindings)
+                              { return bindings.IsInitialized(); }));
+    CHECK(created_bindings_count == g_program_bindings_count);
+    return created_bindings_count;
+}
+
+TEST_CASE("Benchmark parallel program bindings creation", "[rhi][program][bindings][benchmark][.]")
+{
+    BENCHMARK_ADVANCED("Create 100k program bindings in 1 thread")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureParallelProgramBindingsCreation(1U, meter);
+    };
+    BENCHMARK_ADVANCED("Create 100k program bindings in 2 threads")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureParallelProgramBindingsCreation(2U, meter);
+    };
+    BENCHMARK_ADVANCED("Create 100k program bindings in 4 threads")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureParallelProgramBindingsCreation(4U, meter);
+    };
+    BENCHMARK_ADVANCED("Create 100k program bindings in 8 threads")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureParallelProgramBindingsCreation(8U, meter);
+    };
+}
@@ -22,9 +22,13 @@ Unit-tests of the RHI Program Bindings
 ******************************************************************************/
 
 #include "RhiTestHelpers.hpp"
+#include "RhiSettings.hpp"
 
 #include <Methane/Data/AppShadersProvider.h>
 #include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
 #include <Methane/Graphics/RHI/Program.h>
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 #include <Methane/Graphics/RHI/Buffer.h>
@@ -32,7 +36,10 @@ Unit-tests of the RHI Program Bindings
 #include <Methane/Graphics/RHI/Sampler.h>
 #include <Methane/Graphics/RHI/ObjectRegistry.h>
 #include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/BindlessDescriptorTable.h>
 
+#include <array>
 #include <memory>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -361,4 +368,79 @@ TEST_CASE("RHI Program Bindings Functions", "[rhi][program][bindings]")
               "  - Compute shaders argument 'InValue' (Mutable, RootConstantValue) is bound to value of 4 bytes;\n" \
               "  - Compute shaders argument 'OutBuffer' (Mutable, ResourceView) is bound to Buffer 'B1' subresources from index(d:0, a:0, m:0) for count(d:1, a:1, m:1) with offset 0.");
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("RHI Program Bindings with Bindless Arguments", "[rhi][program][bindings][bindless]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::ProgramArgumentAccessor resources_accessor = META_PROGRAM_ARG_BINDLESS_INDEX_CONSTANT(Rhi::ShaderType::Compute, "InResources");
+    const Rhi::Program compute_program = [&compute_context, &resources_accessor]()
+    {
+        Rhi::Program compute_program = compute_context.CreateProgram(
+            Rhi::ProgramSettingsImpl
+            {
+                Rhi::ProgramSettingsImpl::ShaderSet
+                {
+                    { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+                },
+                Rhi::ProgramInputBufferLayouts{ },
+                Rhi::ProgramArgumentAccessors{ resources_accessor }
+            });
+        dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+            { resources_accessor, { Rhi::ResourceType::Buffer, 1U, 3U * sizeof(uint32_t) } },
+        });
+        return compute_program;
+    }();
+
+    const Rhi::Texture texture1 = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+    const Rhi::Texture texture2 = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(320, 240), {}, PixelFormat::R8Unorm, false));
+    const Rhi::Buffer  buffer   = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+    const Rhi::ResourceViews resource_views{
+        texture1.GetResourceView(),
+        texture2.GetResourceView(),
+        buffer.GetResourceView()
+    };
+
+    SECTION("Textures and Buffers are Bound by Indices in Descriptor Arrays of their Types")
+    {
+        Rhi::ProgramBindings program_bindings;
+        REQUIRE_NOTHROW(program_bindings = compute_program.CreateBindings({ { resources_accessor, resource_views } }));
+        REQUIRE(program_bindings.IsInitialized());
+
+        const Rhi::IProgramArgumentBinding& resources_binding = program_bindings.Get(resources_accessor);
+        CHECK(resources_binding.GetResourceViews() == resource_views);
+        CHECK(resources_binding.GetRootConstant().GetValue<std::array<uint32_t, 3>>() == std::array<uint32_t, 3>{ 0U, 1U, 0U });
+    }
+
+    SECTION("Resources Bound through Bindless Argument are Transitioned to Shader Resource State")
+    {
+        const Rhi::ProgramBindings program_bindings = compute_program.CreateBindings({ { resources_accessor, resource_views } });
+        const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+        const Rhi::ComputeCommandList cmd_list = compute_cmd_queue.CreateComputeCommandList();
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindingsResourceBarriers({ program_bindings.GetInterface() }));
+        CHECK(texture1.GetState() == Rhi::ResourceState::ShaderResource);
+        CHECK(texture2.GetState() == Rhi::ResourceState::ShaderResource);
+        CHECK(buffer.GetState() == Rhi::ResourceState::ShaderResource);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Bindless Descriptors are Retired for Not Less Than Three Frames")
+    {
+        const Ptr<Base::BindlessDescriptorTable> bindless_table_ptr = dynamic_cast<const Base::Context&>(compute_context.GetInterface()).GetBindlessDescriptorTablePtr();
+        REQUIRE(bindless_table_ptr);
+        CHECK(bindless_table_ptr->GetSettings().retire_frames_count == 3U);
+    }
+
+    SECTION("Bindless Descriptors are Retired for Frame Buffers Count of Render Context")
+    {
+        const Platform::AppEnvironment app_env{ nullptr };
+        Rhi::RenderContextSettings render_context_settings = Test::GetRenderContextSettings();
+        render_context_settings.frame_buffers_count = 5U;
+        const Rhi::RenderContext render_context(app_env, GetTestDevice(), g_parallel_executor, render_context_settings);
+        const Ptr<Base::BindlessDescriptorTable> bindless_table_ptr = dynamic_cast<const Base::Context&>(render_context.GetInterface()).GetBindlessDescriptorTablePtr();
+        REQUIRE(bindless_table_ptr);
+        CHECK(bindless_table_ptr->GetSettings().retire_frames_count == 5U);
+    }
+}
@@ -0,0 +1,166 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandListBenchmark.cpp
+Benchmark encoding of the indexed draw calls with resources binding in render command list.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+#include "RhiSettings.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+#include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Null/Buffer.h>
+
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_draws_count        = 100000U;
+static constexpr uint32_t g_meshes_count       = 16U;
+static constexpr uint32_t g_mesh_vertex_count  = 1024U;
+static constexpr uint32_t g_mesh_index_count   = 3072U;
+
+struct MeshResources
+{
+    Rhi::BufferSet       vertex_buffer_set;
+    Rhi::Buffer          index_buffer;
+    Rhi::ProgramBindings program_bindings;
+};
+
+static Rhi::Program CreateMeshProgram(const Rhi::RenderContext& render_context, const Rhi::RenderPattern& render_pattern)
+{
+    const Rhi::ProgramArgumentAccessor uniforms_accessor{ Rhi::ShaderType::Vertex, "Uniforms", Rhi::ProgramArgumentAccessType::Mutable };
+    Rhi::Program mesh_program = render_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            .shader_set = Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Mesh", "MainVS" } } },
+                { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Mesh", "MainPS" } } }
+            },
+            .input_buffer_layouts = Rhi::ProgramInputBufferLayouts
+            {
+                Rhi::ProgramInputBufferLayout
+                {
+                    .argument_semantics = Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" , "NORMAL" },
+                    .step_type = Rhi::ProgramInputBufferLayout::StepType::PerVertex,
+                    .step_rate = 1U
+                }
+            },
+            .argument_accessors = Rhi::ProgramArgumentAccessors
+            {
+                uniforms_accessor
+            },
+            .attachment_formats = render_pattern.GetAttachmentFormats()
+        });
+    dynamic_cast<Null::Program&>(mesh_program.GetInterface()).SetArgumentBindings({
+        { uniforms_accessor, { Rhi::ResourceType::Buffer, 1U } }
+    });
+    return mesh_program;
+}
+
+static std::vector<MeshResources> CreateMeshResources(const Rhi::RenderContext& render_context, const Rhi::Program& mesh_program)
+{
+    std::vector<MeshResources> meshes;
+    meshes.reserve(g_meshes_count);
+    for(uint32_t mesh_index = 0U; mesh_index < g_meshes_count; ++mesh_index)
+    {
+        Rhi::Buffer vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(g_mesh_vertex_count * 24U, 24U));
+        dynamic_cast<Null::Buffer&>(vertex_buffer.GetInterface()).SetInitializedDataSize(g_mesh_vertex_count * 24U);
+
+        Rhi::Buffer index_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(g_mesh_index_count * 4U, PixelFormat::R32Uint));
+        dynamic_cast<Null::Buffer&>(index_buffer.GetInterface()).SetInitializedDataSize(g_mesh_index_count * 4U);
+
+        const Rhi::Buffer uniforms_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U, false, true));
+        meshes.push_back(MeshResources{
+            Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer }),
+            index_buffer,
+            mesh_program.CreateBindings({
+                { { Rhi::ShaderType::Vertex, "Uniforms" }, uniforms_buffer.GetResourceView() }
+            })
+        });
+    }
+    return meshes;
+}
+
+TEST_CASE("Benchmark render command list draws encoding", "[rhi][list][render][benchmark][.]")
+{
+    tf::Executor                   parallel_executor;
+    const Platform::AppEnvironment app_env{ nullptr };
+    const Rhi::RenderContext       render_context   = Rhi::RenderContext(app_env, GetTestDevice(), parallel_executor, Test::GetRenderContextSettings());
+    const Rhi::CommandQueue        render_cmd_queue = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+    const Rhi::RenderPattern       render_pattern   = render_context.CreateRenderPattern(Test::GetRenderPatternSettings());
+    const Test::RenderPassResources render_pass_resources = Test::GetRenderPassResources(render_pattern);
+    const Rhi::RenderPass          render_pass      = render_pattern.CreateRenderPass(render_pass_resources.settings);
+    const Rhi::Program             mesh_program     = CreateMeshProgram(render_context, render_pattern);
+    const Rhi::RenderState         render_state     = render_context.CreateRenderState(Test::GetRenderStateSettings(render_context, render_pattern, mesh_program));
+    const Rhi::ViewState           view_state(Test::GetViewStateSettings());
+    const std::vector<MeshResources> meshes = CreateMeshResources(render_context, mesh_program);
+
+    const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+    const Rhi::CommandListSet    cmd_list_set({ cmd_list.GetInterface() });
+    const auto&                  null_cmd_list = dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface());
+
+    const Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior({
+        Rhi::ProgramBindingsApplyBehavior::ChangesOnly,
+        Rhi::ProgramBindingsApplyBehavior::RetainResources
+    });
+
+    size_t retained_resources_count = 0U;
+    BENCHMARK("Record 100k indexed draws of 16 alternating meshes")
+    {
+        cmd_list.ResetWithState(render_state);
+        cmd_list.SetViewState(view_state);
+        for(uint32_t draw_index = 0U; draw_index < g_draws_count; ++draw_index)
+        {
+            const MeshResources& mesh = meshes[draw_index % g_meshes_count];
+            cmd_list.SetProgramBindings(mesh.program_bindings, bindings_apply_behavior);
+            cmd_list.SetVertexBuffers(mesh.vertex_buffer_set);
+            cmd_list.SetIndexBuffer(mesh.index_buffer);
+            cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle, g_mesh_index_count);
+        }
+        cmd_list.Commit();
+
+        // Retained resources are released on execution completion, so they are counted right before it
+        retained_resources_count = null_cmd_list.GetCommandState().retained_resources.size();
+        render_cmd_queue.Execute(cmd_list_set);
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        return retained_resources_count;
+    };
+
+    // Render state and every mesh vertex buffer set, index buffer and program bindings are retained only once
+    CHECK(retained_resources_count == 1U + g_meshes_count * 3U);
+}
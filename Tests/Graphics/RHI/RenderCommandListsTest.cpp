@@ -52,6 +52,7 @@ Unit-tests of the RHI Render Command List
 #include <Methane/Graphics/Null/ProgramBindings.h>
 #include <Methane/Graphics/Null/Buffer.h>
 
+#include <array>
 #include <chrono>
 #include <future>
 #include <memory>
@@ -271,6 +272,10 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         REQUIRE_NOTHROW(cmd_list.Reset());
         REQUIRE_NOTHROW(cmd_list.SetProgramBindings(render_program_bindings));
         CHECK(dynamic_cast<Null::RenderCommandList&>(cmd_list.GetInterface()).GetProgramBindingsPtr() == render_program_bindings.GetInterfacePtr().get());
+
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(render_program_bindings));
+        CHECK(null_cmd_list.GetStateFilteringStatistics().program_bindings.issued_count == 1U);
+        CHECK(null_cmd_list.GetStateFilteringStatistics().program_bindings.filtered_count == 1U);
     }
 
     SECTION("Set Resource Barriers")
@@ -369,7 +374,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
     {
         REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
         CHECK(cmd_list.GetState() == Rhi::CommandListState::Encoding);
-        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
     }
 
     SECTION("Reset Command List Once with Render State")
@@ -377,7 +382,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         REQUIRE_NOTHROW(cmd_list.ResetWithStateOnce(render_state));
         REQUIRE_NOTHROW(cmd_list.ResetWithStateOnce(render_state));
         CHECK(cmd_list.GetState() == Rhi::CommandListState::Encoding);
-        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
         CHECK(null_render_state.GetAppliedStateGroups().GetValue() == ~0U);
     }
 
@@ -387,7 +392,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state, &debug_group));
         CHECK(cmd_list.GetState() == Rhi::CommandListState::Encoding);
         CHECK(null_cmd_list.GetTopOpenDebugGroup()->GetName() == "Test");
-        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
         CHECK(null_render_state.GetAppliedStateGroups().GetValue() == ~0U);
     }
 
@@ -400,7 +405,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         REQUIRE_NOTHROW(cmd_list.ResetWithStateOnce(render_state, &debug_group2));
         CHECK(cmd_list.GetState() == Rhi::CommandListState::Encoding);
         CHECK(null_cmd_list.GetTopOpenDebugGroup()->GetName() == "Test1");
-        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
     }
 
     SECTION("Set Command List Render State after Stateless Reset")
@@ -412,7 +417,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         };
         REQUIRE_NOTHROW(cmd_list.Reset());
         REQUIRE_NOTHROW(cmd_list.SetRenderState(render_state, state_groups));
-        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
         CHECK(null_cmd_list.GetDrawingState().render_state_groups == state_groups);
         CHECK(null_render_state.GetAppliedStateGroups() == state_groups);
     }
@@ -439,12 +444,12 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         const auto& other_null_render_state = dynamic_cast<Null::RenderState&>(other_render_state.GetInterface());
 
         REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
-        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == render_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr == render_state.GetInterfacePtr().get());
         CHECK(null_cmd_list.GetDrawingState().render_state_groups.GetValue() == ~0U);
         CHECK(null_render_state.GetAppliedStateGroups().GetValue() == ~0U);
 
         REQUIRE_NOTHROW(cmd_list.SetRenderState(other_render_state));
-        CHECK(null_cmd_list.GetDrawingState().render_state_ptr.get() == other_render_state.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr == other_render_state.GetInterfacePtr().get());
         CHECK(null_cmd_list.GetDrawingState().render_state_groups.GetValue() == ~0U);
         CHECK(other_null_render_state.GetAppliedStateGroups() == Rhi::RenderStateGroupMask{
             Rhi::RenderStateGroup::Rasterizer,
@@ -495,7 +500,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
     {
         REQUIRE_NOTHROW(cmd_list.Reset());
         CHECK(cmd_list.SetVertexBuffers(vertex_buffer_set));
-        CHECK(null_cmd_list.GetDrawingState().vertex_buffer_set_ptr.get() == vertex_buffer_set.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().vertex_buffer_set_ptr == vertex_buffer_set.GetInterfacePtr().get());
         CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(vertex_buffer_set, cmd_list));
     }
 
@@ -505,7 +510,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         REQUIRE_NOTHROW(cmd_list.Reset());
         CHECK(cmd_list.SetVertexBuffers(vertex_buffer_set));
         CHECK(cmd_list.SetVertexBuffers(other_vertex_buffer_set));
-        CHECK(null_cmd_list.GetDrawingState().vertex_buffer_set_ptr.get() == other_vertex_buffer_set.GetInterfacePtr().get());
+        CHECK(null_cmd_list.GetDrawingState().vertex_buffer_set_ptr == other_vertex_buffer_set.GetInterfacePtr().get());
         CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(vertex_buffer_set, cmd_list));
         CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(other_vertex_buffer_set, cmd_list));
     }
@@ -517,6 +522,55 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         CHECK_FALSE(cmd_list.SetVertexBuffers(vertex_buffer_set));
     }
 
+    SECTION("Alternating Vertex Buffers are Retained Only Once")
+    {
+        const Rhi::BufferSet other_vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer_one });
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        for(uint32_t bind_index = 0U; bind_index < 10U; ++bind_index)
+        {
+            CHECK(cmd_list.SetVertexBuffers(vertex_buffer_set));
+            CHECK(cmd_list.SetVertexBuffers(other_vertex_buffer_set));
+        }
+        CHECK(null_cmd_list.GetCommandState().retained_resources.size() == 2U);
+    }
+
+    SECTION("Vertex Buffers Used by Two Command Lists are Retained Only Once by Each")
+    {
+        const Rhi::BufferSet other_vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer_one });
+        const Rhi::RenderCommandList other_cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        const auto& other_null_cmd_list = dynamic_cast<Null::RenderCommandList&>(other_cmd_list.GetInterface());
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(other_cmd_list.Reset());
+        for(uint32_t bind_index = 0U; bind_index < 10U; ++bind_index)
+        {
+            CHECK(cmd_list.SetVertexBuffers(vertex_buffer_set));
+            CHECK(other_cmd_list.SetVertexBuffers(vertex_buffer_set));
+            CHECK(cmd_list.SetVertexBuffers(other_vertex_buffer_set));
+            CHECK(other_cmd_list.SetVertexBuffers(other_vertex_buffer_set));
+        }
+        CHECK(null_cmd_list.GetCommandState().retained_resources.size() == 2U);
+        CHECK(other_null_cmd_list.GetCommandState().retained_resources.size() == 2U);
+        CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(vertex_buffer_set, other_cmd_list));
+        CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(other_vertex_buffer_set, other_cmd_list));
+    }
+
+    SECTION("Retained Vertex Buffers are Released on Completion and Retained Again")
+    {
+        const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        REQUIRE_NOTHROW(render_cmd_queue.Execute(cmd_list_set));
+        CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(vertex_buffer_set, cmd_list));
+
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        CHECK(null_cmd_list.GetCommandState().retained_resources.empty());
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(vertex_buffer_set, cmd_list));
+    }
+
     SECTION("Can Not Set Vertex Buffers with Constant Buffers")
     {
         Rhi::Buffer          constant_buffer_one  = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(421, true, true));
@@ -537,7 +591,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
     {
         REQUIRE_NOTHROW(cmd_list.Reset());
         CHECK(cmd_list.SetIndexBuffer(index_buffer_one));
-        CHECK(dynamic_cast<const Rhi::IBuffer*>(null_cmd_list.GetDrawingState().index_buffer_ptr.get()) == index_buffer_one.GetInterfacePtr().get());
+        CHECK(dynamic_cast<const Rhi::IBuffer*>(null_cmd_list.GetDrawingState().index_buffer_ptr) == index_buffer_one.GetInterfacePtr().get());
         CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(index_buffer_one, cmd_list));
     }
 
@@ -547,7 +601,7 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         REQUIRE_NOTHROW(cmd_list.Reset());
         CHECK(cmd_list.SetIndexBuffer(index_buffer_one));
         CHECK(cmd_list.SetIndexBuffer(index_buffer_two));
-        CHECK(dynamic_cast<const Rhi::IBuffer*>(null_cmd_list.GetDrawingState().index_buffer_ptr.get()) == index_buffer_two.GetInterfacePtr().get());
+        CHECK(dynamic_cast<const Rhi::IBuffer*>(null_cmd_list.GetDrawingState().index_buffer_ptr) == index_buffer_two.GetInterfacePtr().get());
         CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(index_buffer_one, cmd_list));
         CHECK(IsResourceRetainedByCommandList<Null::RenderCommandList>(index_buffer_two, cmd_list));
     }
@@ -559,6 +613,47 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         CHECK_FALSE(cmd_list.SetIndexBuffer(index_buffer_one));
     }
 
+    SECTION("Redundant State Commands are Filtered and Counted")
+    {
+        const Rhi::BufferSet other_vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer_one });
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetRenderState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        for(uint32_t draw_index = 0U; draw_index < 4U; ++draw_index)
+        {
+            REQUIRE_NOTHROW(cmd_list.SetVertexBuffers(draw_index < 2U ? vertex_buffer_set : other_vertex_buffer_set));
+            REQUIRE_NOTHROW(cmd_list.SetIndexBuffer(index_buffer_one));
+        }
+
+        const Base::StateFilteringStatistics& statistics = null_cmd_list.GetStateFilteringStatistics();
+        CHECK(statistics.render_state.issued_count == 1U);
+        CHECK(statistics.render_state.filtered_count == 1U);
+        CHECK(statistics.view_state.issued_count == 1U);
+        CHECK(statistics.view_state.filtered_count == 1U);
+        CHECK(statistics.vertex_buffers.issued_count == 2U);
+        CHECK(statistics.vertex_buffers.filtered_count == 2U);
+        CHECK(statistics.index_buffer.issued_count == 1U);
+        CHECK(statistics.index_buffer.filtered_count == 3U);
+        CHECK(statistics.GetIssuedCount() == 5U);
+        CHECK(statistics.GetFilteredCount() == 7U);
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK(null_cmd_list.GetStateFilteringStatistics().GetIssuedCount() == 0U);
+        CHECK(null_cmd_list.GetStateFilteringStatistics().GetFilteredCount() == 0U);
+    }
+
+    SECTION("Same Render State with New State Groups is Not Filtered")
+    {
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.SetRenderState(render_state, Rhi::RenderStateGroupMask{ Rhi::RenderStateGroup::Rasterizer }));
+        REQUIRE_NOTHROW(cmd_list.SetRenderState(render_state, Rhi::RenderStateGroupMask{ Rhi::RenderStateGroup::Rasterizer }));
+        REQUIRE_NOTHROW(cmd_list.SetRenderState(render_state));
+        CHECK(null_cmd_list.GetStateFilteringStatistics().render_state.issued_count == 2U);
+        CHECK(null_cmd_list.GetStateFilteringStatistics().render_state.filtered_count == 1U);
+        CHECK(null_cmd_list.GetDrawingState().bound_render_state_groups.GetValue() == ~0U);
+    }
+
     SECTION("Can Not Set Index Buffer with Vertex Buffer")
     {
         REQUIRE_NOTHROW(cmd_list.Reset());
@@ -630,6 +725,115 @@ TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
         CHECK(null_cmd_list.GetDrawingState().primitive_type_opt == Rhi::RenderPrimitive::Triangle);
     }
 
+    SECTION("Can Multi-Draw Indexed Triangles from Vertex Buffers")
+    {
+        const std::array<Rhi::DrawIndexedArguments, 3> draw_arguments{
+            Rhi::DrawIndexedArguments{ .index_count = indices_count, .instance_count = 1U },
+            Rhi::DrawIndexedArguments{ .index_count = 30U, .instance_count = 5U, .start_index = 60U, .start_vertex = 12U, .start_instance = 1U },
+            Rhi::DrawIndexedArguments{ .index_count = 3U, .instance_count = 12U, .start_index = indices_count - 3U }
+        };
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE(cmd_list.SetIndexBuffer(index_buffer_one));
+        REQUIRE_NOTHROW(cmd_list.MultiDrawIndexed(Rhi::RenderPrimitive::Triangle, draw_arguments));
+        CHECK(null_cmd_list.GetDrawingState().primitive_type_opt == Rhi::RenderPrimitive::Triangle);
+    }
+
+    SECTION("Can Not Multi-Draw Indexed Triangles with More Indices than Available in Index Buffer")
+    {
+        const std::array<Rhi::DrawIndexedArguments, 2> draw_arguments{
+            Rhi::DrawIndexedArguments{ .index_count = indices_count },
+            Rhi::DrawIndexedArguments{ .index_count = 6U, .start_index = indices_count - 3U }
+        };
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE(cmd_list.SetIndexBuffer(index_buffer_one));
+        CHECK_THROWS_AS(cmd_list.MultiDrawIndexed(Rhi::RenderPrimitive::Triangle, draw_arguments), ArgumentException);
+    }
+
+    SECTION("Can Multi-Draw Indexed Triangles with Zero Index Count Substituted by Index Buffer Size")
+    {
+        const std::array<Rhi::DrawIndexedArguments, 2> draw_arguments{
+            Rhi::DrawIndexedArguments{ .index_count = 0U, .instance_count = 2U },
+            Rhi::DrawIndexedArguments{ .index_count = 0U, .instance_count = 1U, .start_index = 0U, .start_vertex = 12U }
+        };
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE(cmd_list.SetIndexBuffer(index_buffer_one));
+        REQUIRE_NOTHROW(cmd_list.MultiDrawIndexed(Rhi::RenderPrimitive::Triangle, draw_arguments));
+        CHECK(null_cmd_list.GetDrawingState().primitive_type_opt == Rhi::RenderPrimitive::Triangle);
+    }
+
+    SECTION("Can Not Multi-Draw Indexed Triangles with Zero Index Count from Offset Start Index")
+    {
+        const std::array<Rhi::DrawIndexedArguments, 1> draw_arguments{
+            Rhi::DrawIndexedArguments{ .index_count = 0U, .start_index = 3U }
+        };
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE(cmd_list.SetIndexBuffer(index_buffer_one));
+        CHECK_THROWS_AS(cmd_list.MultiDrawIndexed(Rhi::RenderPrimitive::Triangle, draw_arguments), ArgumentException);
+    }
+
+    const Rhi::Buffer indirect_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndirectBuffer(sizeof(Rhi::DrawIndexedArguments) * 4U));
+    const Rhi::Buffer count_buffer    = render_context.CreateBuffer(Rhi::BufferSettings::ForIndirectBuffer(sizeof(uint32_t) * 2U));
+
+    SECTION("Can Draw Indirect Triangles from Vertex Buffers")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE_NOTHROW(cmd_list.DrawIndirect(Rhi::RenderPrimitive::Triangle, indirect_buffer, sizeof(Rhi::DrawArguments), 3U));
+        CHECK(null_cmd_list.GetDrawingState().primitive_type_opt == Rhi::RenderPrimitive::Triangle);
+        CHECK(indirect_buffer.GetState() == Rhi::ResourceState::IndirectArgument);
+    }
+
+    SECTION("Can Draw Indexed Indirect Triangles with Draws Count from Count Buffer")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE(cmd_list.SetIndexBuffer(index_buffer_one));
+        REQUIRE_NOTHROW(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, indirect_buffer, 0U, 4U,
+                                                     &count_buffer, sizeof(uint32_t)));
+        CHECK(null_cmd_list.GetDrawingState().primitive_type_opt == Rhi::RenderPrimitive::Triangle);
+        CHECK(indirect_buffer.GetState() == Rhi::ResourceState::IndirectArgument);
+        CHECK(count_buffer.GetState() == Rhi::ResourceState::IndirectArgument);
+    }
+
+    SECTION("Can Not Draw Indirect Triangles with Arguments from Non-Indirect Buffer")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        CHECK_THROWS_AS(cmd_list.DrawIndirect(Rhi::RenderPrimitive::Triangle, vertex_buffer_two, 0U, 1U), ArgumentException);
+        CHECK_THROWS_AS(cmd_list.DrawIndirect(Rhi::RenderPrimitive::Triangle, indirect_buffer, 0U, 1U, &vertex_buffer_two), ArgumentException);
+    }
+
+    SECTION("Can Not Draw Indexed Indirect Triangles Out of Indirect Buffer Bounds")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE(cmd_list.SetIndexBuffer(index_buffer_one));
+        CHECK_THROWS_AS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, indirect_buffer, sizeof(Rhi::DrawIndexedArguments), 4U), ArgumentException);
+        CHECK_THROWS_AS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, indirect_buffer, 0U, 0U), ArgumentException);
+        CHECK_THROWS_AS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, indirect_buffer, 0U, 1U,
+                                                     &count_buffer, sizeof(uint32_t) * 2U), ArgumentException);
+    }
+
+    SECTION("Can Not Draw Indexed Indirect Triangles Without Index Buffer")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        CHECK_THROWS_AS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, indirect_buffer, 0U, 1U), ArgumentException);
+    }
+
     SECTION("Can Not Draw Indexed Triangles from Uninitialized Vertex Buffers")
     {
         dynamic_cast<Null::Buffer&>(vertex_buffer_one.GetInterface()).SetInitializedDataSize(0U);
@@ -0,0 +1,394 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RootConstantStorageTest.cpp
+Unit-tests of the root constants storage sub-allocator
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/Base/RootConstantBuffer.h>
+#include <Methane/Graphics/Base/Context.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <array>
+#include <vector>
+#include <utility>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using RootConstantAccessorPtr = UniquePtr<Base::RootConstantAccessor>;
+using RootConstantRange       = Base::RootConstantAccessor::Range;
+
+static tf::Executor g_parallel_executor;
+
+// Returns value stored at the beginning of root constant data, which may be larger than the value
+static uint32_t GetFirstValue(const RootConstantAccessorPtr& accessor_ptr)
+{
+    const Rhi::RootConstant root_constant = accessor_ptr->GetRootConstant();
+    REQUIRE(root_constant.GetDataSize() >= sizeof(uint32_t));
+    return *reinterpret_cast<const uint32_t*>(root_constant.GetDataPtr()); // NOSONAR
+}
+
+class TestRootConstantStorage final
+    : public Base::RootConstantStorage
+{
+public:
+    using RootConstantStorage::TakeDirtyRanges;
+};
+
+TEST_CASE("RHI Root Constant Storage Allocations", "[rhi][root-constant]")
+{
+    SECTION("Reserve small root constants in storage chunk")
+    {
+        Base::RootConstantStorage storage;
+        const RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(16U);
+        const RootConstantAccessorPtr accessor_b_ptr = storage.ReserveRootConstant(300U);
+        CHECK(accessor_a_ptr->GetBufferRange() == RootConstantRange(0U, 256U));
+        CHECK(accessor_b_ptr->GetBufferRange() == RootConstantRange(256U, 768U));
+        CHECK(storage.GetDataSize() == 16384U);
+        CHECK(storage.GetStatistics().chunks_count == 1U);
+    }
+
+    SECTION("Reuse released chunk slots")
+    {
+        Base::RootConstantStorage storage;
+        RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(16U);
+        const RootConstantAccessorPtr accessor_b_ptr = storage.ReserveRootConstant(16U);
+        accessor_a_ptr.reset();
+
+        const RootConstantAccessorPtr accessor_c_ptr = storage.ReserveRootConstant(32U);
+        CHECK(accessor_c_ptr->GetBufferRange() == RootConstantRange(0U, 256U));
+        CHECK(storage.GetDataSize() == 16384U);
+    }
+
+    SECTION("Reserve best fit free range")
+    {
+        Base::RootConstantStorage storage;
+        RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(8192U);
+        const RootConstantAccessorPtr accessor_b_ptr = storage.ReserveRootConstant(8192U);
+        RootConstantAccessorPtr accessor_c_ptr = storage.ReserveRootConstant(5120U);
+        const RootConstantAccessorPtr accessor_d_ptr = storage.ReserveRootConstant(8192U);
+        accessor_a_ptr.reset();
+        accessor_c_ptr.reset();
+
+        const RootConstantAccessorPtr accessor_e_ptr = storage.ReserveRootConstant(5000U);
+        CHECK(accessor_e_ptr->GetBufferRange() == RootConstantRange(16384U, 21504U));
+        CHECK(storage.GetDataSize() == 29696U);
+    }
+
+    SECTION("Extend free range at the end of storage")
+    {
+        Base::RootConstantStorage storage;
+        const RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(8192U);
+        RootConstantAccessorPtr accessor_b_ptr = storage.ReserveRootConstant(8192U);
+        accessor_b_ptr.reset();
+
+        const RootConstantAccessorPtr accessor_c_ptr = storage.ReserveRootConstant(10240U);
+        CHECK(accessor_c_ptr->GetBufferRange() == RootConstantRange(8192U, 18432U));
+        CHECK(storage.GetDataSize() == 18432U);
+    }
+
+    SECTION("Reserve small root constants from multiple threads")
+    {
+        Base::RootConstantStorage storage;
+        constexpr size_t threads_count = 8U;
+        constexpr size_t thread_constants_count = 1000U;
+        std::vector<std::vector<RootConstantAccessorPtr>> accessors_by_thread(threads_count);
+        std::vector<std::thread> threads;
+        for (std::vector<RootConstantAccessorPtr>& thread_accessors : accessors_by_thread)
+        {
+            threads.emplace_back([&storage, &thread_accessors]()
+            {
+                for (size_t i = 0U; i < thread_constants_count; ++i)
+                {
+                    thread_accessors.push_back(storage.ReserveRootConstant(16U));
+                    if (i % 3U == 0U)
+                        thread_accessors[i / 2U].reset();
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        Data::RangeSet<Data::Index> reserved_ranges;
+        size_t reserved_ranges_count = 0U;
+        for (const std::vector<RootConstantAccessorPtr>& thread_accessors : accessors_by_thread)
+        {
+            for (const RootConstantAccessorPtr& accessor_ptr : thread_accessors)
+            {
+                if (!accessor_ptr)
+                    continue;
+
+                reserved_ranges.Add(accessor_ptr->GetBufferRange());
+                reserved_ranges_count++;
+            }
+        }
+
+        // Reserved ranges do not overlap, so their total length is equal to the live size
+        Data::Size reserved_size = 0U;
+        for (const RootConstantRange& range : reserved_ranges)
+        {
+            reserved_size += range.GetLength();
+        }
+        CHECK(reserved_size == reserved_ranges_count * 256U);
+        CHECK(storage.GetStatistics().live_size == reserved_size);
+    }
+}
+
+TEST_CASE("RHI Root Constant Storage Dirty Ranges", "[rhi][root-constant]")
+{
+    TestRootConstantStorage storage;
+    const RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(4U);
+    const RootConstantAccessorPtr accessor_b_ptr = storage.ReserveRootConstant(4U);
+    const RootConstantAccessorPtr accessor_c_ptr = storage.ReserveRootConstant(64U);
+
+    SECTION("Changed root constants are tracked as dirty ranges")
+    {
+        REQUIRE(accessor_a_ptr->SetRootConstant(Rhi::RootConstant(1U)));
+        REQUIRE(accessor_c_ptr->SetRootConstant(Rhi::RootConstant(std::array<uint32_t, 16>{ })));
+        CHECK(storage.TakeDirtyRanges() == Data::RangeSet<Data::Index>{ { 0U, 4U }, { 512U, 576U } });
+        CHECK(storage.TakeDirtyRanges().IsEmpty());
+    }
+
+    SECTION("Unchanged root constants are not tracked as dirty ranges")
+    {
+        REQUIRE(accessor_b_ptr->SetRootConstant(Rhi::RootConstant(2U)));
+        CHECK(storage.TakeDirtyRanges() == Data::RangeSet<Data::Index>{ { 256U, 260U } });
+        CHECK_FALSE(accessor_b_ptr->SetRootConstant(Rhi::RootConstant(2U)));
+        CHECK(storage.TakeDirtyRanges().IsEmpty());
+    }
+}
+
+TEST_CASE("RHI Root Constant Storage Statistics", "[rhi][root-constant]")
+{
+    Base::RootConstantStorage storage;
+    RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(8192U);
+    const RootConstantAccessorPtr accessor_b_ptr = storage.ReserveRootConstant(8192U);
+    RootConstantAccessorPtr accessor_c_ptr = storage.ReserveRootConstant(8192U);
+    const RootConstantAccessorPtr accessor_d_ptr = storage.ReserveRootConstant(8192U);
+    accessor_a_ptr.reset();
+    accessor_c_ptr.reset();
+
+    const Base::RootConstantStorage::Statistics statistics = storage.GetStatistics();
+    CHECK(statistics.live_size == 16384U);
+    CHECK(statistics.peak_live_size == 32768U);
+    CHECK(statistics.buffer_size == 32768U);
+    CHECK(statistics.free_size == 16384U);
+    CHECK(statistics.max_free_range_size == 8192U);
+    CHECK(statistics.chunks_count == 0U);
+    CHECK(statistics.compactions_count == 0U);
+    CHECK(statistics.GetFragmentationRatio() == 0.5F);
+}
+
+TEST_CASE("RHI Root Constant Storage Compaction", "[rhi][root-constant]")
+{
+    const uint32_t test_value = 42U;
+
+    SECTION("Compact storage with released root constants")
+    {
+        Base::RootConstantStorage storage;
+        RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(8192U);
+        RootConstantAccessorPtr accessor_b_ptr = storage.ReserveRootConstant(8192U);
+        const RootConstantAccessorPtr accessor_c_ptr = storage.ReserveRootConstant(8192U);
+        REQUIRE(accessor_c_ptr->SetRootConstant(Rhi::RootConstant(test_value)));
+        accessor_a_ptr.reset();
+        accessor_b_ptr.reset();
+
+        REQUIRE(storage.Compact());
+        CHECK(accessor_c_ptr->GetBufferRange() == RootConstantRange(0U, 8192U));
+        CHECK(GetFirstValue(accessor_c_ptr) == test_value);
+        CHECK(storage.GetDataSize() == 8192U);
+        CHECK(storage.GetStatistics().compactions_count == 1U);
+    }
+
+    SECTION("Compact storage with chunk of small root constants")
+    {
+        Base::RootConstantStorage storage;
+        RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(8192U);
+        const RootConstantAccessorPtr accessor_b_ptr = storage.ReserveRootConstant(4U);
+        REQUIRE(accessor_b_ptr->SetRootConstant(Rhi::RootConstant(test_value)));
+        accessor_a_ptr.reset();
+
+        REQUIRE(storage.Compact());
+        CHECK(accessor_b_ptr->GetBufferRange() == RootConstantRange(0U, 256U));
+        CHECK(accessor_b_ptr->GetRootConstant().GetValue<uint32_t>() == test_value);
+        CHECK(storage.GetDataSize() == 16384U);
+    }
+
+    SECTION("Release root constants in parallel with compaction")
+    {
+        Base::RootConstantStorage storage;
+        constexpr uint32_t constants_count = 256U;
+        std::vector<RootConstantAccessorPtr> released_large_accessors;
+        std::vector<RootConstantAccessorPtr> released_small_accessors;
+        std::vector<std::pair<RootConstantAccessorPtr, uint32_t>> kept_accessors;
+        for (uint32_t value = 0U; value < constants_count; ++value)
+        {
+            RootConstantAccessorPtr large_accessor_ptr = storage.ReserveRootConstant(8192U);
+            RootConstantAccessorPtr small_accessor_ptr = storage.ReserveRootConstant(4U);
+            REQUIRE(large_accessor_ptr->SetRootConstant(Rhi::RootConstant(value)));
+            REQUIRE(small_accessor_ptr->SetRootConstant(Rhi::RootConstant(value)));
+            if (value % 2U)
+            {
+                kept_accessors.emplace_back(std::move(large_accessor_ptr), value);
+                released_small_accessors.push_back(std::move(small_accessor_ptr));
+            }
+            else
+            {
+                kept_accessors.emplace_back(std::move(small_accessor_ptr), value);
+                released_large_accessors.push_back(std::move(large_accessor_ptr));
+            }
+        }
+
+        // Small root constants are released from chunks without storage lock,
+        // while chunks are moved by compaction after release of each large root constant
+        std::thread release_thread([&released_small_accessors]()
+        {
+            for (RootConstantAccessorPtr& accessor_ptr : released_small_accessors)
+            {
+                accessor_ptr.reset();
+            }
+        });
+        for (RootConstantAccessorPtr& accessor_ptr : released_large_accessors)
+        {
+            accessor_ptr.reset();
+            storage.Compact();
+        }
+        release_thread.join();
+        storage.Compact();
+
+        Data::Size kept_size = 0U;
+        for (const auto& [accessor_ptr, value] : kept_accessors)
+        {
+            CHECK(GetFirstValue(accessor_ptr) == value);
+            kept_size += accessor_ptr->GetBufferRange().GetLength();
+        }
+        CHECK(storage.GetStatistics().live_size == kept_size);
+    }
+
+    SECTION("Reserve root constants in parallel with compaction")
+    {
+        Base::RootConstantStorage storage;
+        constexpr uint32_t threads_count = 4U;
+        constexpr uint32_t thread_constants_count = 500U;
+        std::vector<std::vector<std::pair<RootConstantAccessorPtr, uint32_t>>> accessors_by_thread(threads_count);
+        std::vector<std::thread> threads;
+        std::atomic<uint32_t> running_threads_count{ threads_count };
+        for (uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            // Chunks emptied by released root constants are removed by compaction, while other chunks are reserved in arenas
+            threads.emplace_back([&storage, &running_threads_count, &thread_accessors = accessors_by_thread[thread_index], thread_index]()
+            {
+                for (uint32_t i = 0U; i < thread_constants_count; ++i)
+                {
+                    const uint32_t value = thread_index * thread_constants_count + i;
+                    RootConstantAccessorPtr accessor_ptr = storage.ReserveRootConstant(4U);
+                    accessor_ptr->SetRootConstant(Rhi::RootConstant(value));
+                    if (i % 4U)
+                        thread_accessors.emplace_back(std::move(accessor_ptr), value);
+                }
+                running_threads_count--;
+            });
+        }
+        while (running_threads_count)
+        {
+            storage.Compact();
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        storage.Compact();
+
+        Data::RangeSet<Data::Index> reserved_ranges;
+        for (const std::vector<std::pair<RootConstantAccessorPtr, uint32_t>>& thread_accessors : accessors_by_thread)
+        {
+            for (const auto& [accessor_ptr, value] : thread_accessors)
+            {
+                CHECK(accessor_ptr->GetRootConstant().GetValue<uint32_t>() == value);
+                reserved_ranges.Add(accessor_ptr->GetBufferRange());
+            }
+        }
+
+        Data::Size reserved_size = 0U;
+        for (const RootConstantRange& range : reserved_ranges)
+        {
+            reserved_size += range.GetLength();
+        }
+        CHECK(reserved_size == threads_count * thread_constants_count * 3U / 4U * 256U);
+        CHECK(storage.GetStatistics().live_size == reserved_size);
+    }
+
+    SECTION("Compact storage without free ranges")
+    {
+        Base::RootConstantStorage storage;
+        const RootConstantAccessorPtr accessor_a_ptr = storage.ReserveRootConstant(4U);
+        CHECK_FALSE(storage.Compact());
+        CHECK(accessor_a_ptr->GetBufferRange() == RootConstantRange(0U, 256U));
+    }
+}
+
+TEST_CASE("RHI Root Constant Buffer Upload", "[rhi][root-constant]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    Base::RootConstantBuffer root_constant_buffer(dynamic_cast<Base::Context&>(compute_context.GetInterface()), "Test Root Constant Buffer");
+    RootConstantAccessorPtr accessor_x_ptr = root_constant_buffer.ReserveRootConstant(65536U);
+    const RootConstantAccessorPtr accessor_a_ptr = root_constant_buffer.ReserveRootConstant(4U);
+    const RootConstantAccessorPtr accessor_b_ptr = root_constant_buffer.ReserveRootConstant(4U);
+    REQUIRE(accessor_x_ptr->SetRootConstant(Rhi::RootConstant(1U)));
+    REQUIRE(accessor_a_ptr->SetRootConstant(Rhi::RootConstant(2U)));
+    REQUIRE(accessor_b_ptr->SetRootConstant(Rhi::RootConstant(3U)));
+
+    // Buffer data is uploaded entirely after creation of the GPU buffer
+    compute_context.CompleteInitialization();
+    REQUIRE(root_constant_buffer.GetUploadedDataSize() == 81920U);
+
+    SECTION("Only changed root constant is uploaded")
+    {
+        REQUIRE(accessor_b_ptr->SetRootConstant(Rhi::RootConstant(4U)));
+        compute_context.CompleteInitialization();
+        CHECK(root_constant_buffer.GetUploadedDataSize() == 4U);
+    }
+
+    SECTION("Changed root constants separated with small gap are uploaded as one range")
+    {
+        REQUIRE(accessor_a_ptr->SetRootConstant(Rhi::RootConstant(5U)));
+        REQUIRE(accessor_b_ptr->SetRootConstant(Rhi::RootConstant(6U)));
+        compute_context.CompleteInitialization();
+        CHECK(root_constant_buffer.GetUploadedDataSize() == 260U);
+    }
+
+    SECTION("Compacted buffer data is uploaded entirely")
+    {
+        accessor_x_ptr.reset();
+        REQUIRE(root_constant_buffer.Compact());
+        compute_context.CompleteInitialization();
+        CHECK(root_constant_buffer.GetDataSize() == 16384U);
+        CHECK(root_constant_buffer.GetUploadedDataSize() == 16384U);
+        CHECK(accessor_b_ptr->GetRootConstant().GetValue<uint32_t>() == 3U);
+    }
+}
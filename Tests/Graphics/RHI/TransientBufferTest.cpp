@@ -0,0 +1,259 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/TransientBufferTest.cpp
+Unit-tests of the RHI TransientBuffer and its frame-indexed ring allocator
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/TransientBuffer.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/Base/TransientBuffer.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using FlushRanges = Base::TransientRingAllocator::FlushRanges;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("RHI Transient Ring Allocator", "[rhi][transient-buffer]")
+{
+    SECTION("Allocate aligned slices")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(16U) == 0U);
+        CHECK(allocator.Allocate(300U) == 256U);
+        CHECK(allocator.Allocate(256U) == 768U);
+        CHECK(allocator.GetStatistics().used_size == 1024U);
+        CHECK(allocator.GetStatistics().allocations_count == 3U);
+    }
+
+    SECTION("Capacity is aligned")
+    {
+        const Base::TransientRingAllocator allocator(1000U, 256U);
+        CHECK(allocator.GetCapacity() == 1024U);
+    }
+
+    SECTION("Empty and too large slices are not allocated")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK_FALSE(allocator.Allocate(0U).has_value());
+        CHECK_FALSE(allocator.Allocate(2048U).has_value());
+        CHECK(allocator.GetStatistics().allocations_count == 0U);
+    }
+
+    SECTION("Allocation fails when frames in flight fill the ring")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(512U) == 0U);
+        allocator.CloseFrame(0U);
+        CHECK(allocator.Allocate(512U) == 512U);
+        allocator.CloseFrame(1U);
+        CHECK_FALSE(allocator.Allocate(256U).has_value());
+        CHECK(allocator.GetStatistics().frames_in_flight == 2U);
+    }
+
+    SECTION("Completed frame slices are recycled")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(512U) == 0U);
+        allocator.CloseFrame(0U);
+        CHECK(allocator.Allocate(512U) == 512U);
+        allocator.CloseFrame(1U);
+        allocator.CompleteFrame(0U);
+        CHECK(allocator.GetStatistics().used_size == 512U);
+        CHECK(allocator.GetStatistics().frames_in_flight == 1U);
+        CHECK(allocator.Allocate(512U) == 0U);
+    }
+
+    SECTION("Completion of unknown frame is ignored")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(512U) == 0U);
+        allocator.CloseFrame(0U);
+        allocator.CompleteFrame(1U);
+        CHECK(allocator.GetStatistics().used_size == 512U);
+        CHECK(allocator.GetStatistics().frames_in_flight == 1U);
+    }
+
+    SECTION("Completion of frame completes previous frames")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(256U) == 0U);
+        allocator.CloseFrame(0U);
+        CHECK(allocator.Allocate(256U) == 256U);
+        allocator.CloseFrame(1U);
+        CHECK(allocator.Allocate(256U) == 512U);
+        allocator.CloseFrame(2U);
+        allocator.CompleteFrame(1U);
+        CHECK(allocator.GetStatistics().used_size == 256U);
+        CHECK(allocator.GetStatistics().frames_in_flight == 1U);
+    }
+
+    SECTION("Slice which does not fit before the end of ring is wrapped to the beginning")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(768U) == 0U);
+        allocator.CloseFrame(0U);
+        allocator.CompleteFrame(0U);
+        CHECK(allocator.Allocate(512U) == 0U);
+        CHECK(allocator.GetStatistics().used_size == 768U);
+        CHECK(allocator.GetStatistics().peak_used_size == 768U);
+    }
+
+    SECTION("Complete all frames recycles all slices")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK(allocator.Allocate(512U) == 0U);
+        allocator.CloseFrame(0U);
+        CHECK(allocator.Allocate(512U) == 512U);
+        allocator.CompleteAllFrames();
+        CHECK(allocator.GetStatistics().used_size == 0U);
+        CHECK(allocator.GetStatistics().frames_in_flight == 0U);
+        CHECK(allocator.Allocate(1024U) == 0U);
+    }
+
+    SECTION("Flush ranges cover slices allocated since previous flush")
+    {
+        Base::TransientRingAllocator allocator(1024U, 256U);
+        CHECK(allocator.TakeFlushRanges() == FlushRanges{});
+        CHECK(allocator.Allocate(512U) == 0U);
+        CHECK(allocator.TakeFlushRanges() == FlushRanges{ Rhi::BytesRange(0U, 512U), {} });
+        CHECK(allocator.Allocate(256U) == 512U);
+        allocator.CompleteAllFrames();
+        CHECK(allocator.Allocate(512U) == 0U);
+        CHECK(allocator.TakeFlushRanges() == FlushRanges{ Rhi::BytesRange(0U, 1024U), {} });
+        allocator.CompleteAllFrames();
+        CHECK(allocator.Allocate(256U) == 512U);
+        CHECK(allocator.Allocate(256U) == 768U);
+        allocator.CompleteAllFrames();
+        CHECK(allocator.Allocate(256U) == 0U);
+        CHECK(allocator.TakeFlushRanges() == FlushRanges{ Rhi::BytesRange(512U, 1024U), Rhi::BytesRange(0U, 256U) });
+        CHECK(allocator.TakeFlushRanges() == FlushRanges{});
+    }
+
+    SECTION("Allocate slices from multiple threads")
+    {
+        Base::TransientRingAllocator allocator(64U * 1024U, 16U);
+        constexpr size_t threads_count = 8U;
+        constexpr size_t thread_slices_count = 500U;
+        std::vector<std::vector<Data::Size>> offsets_by_thread(threads_count);
+        std::vector<std::thread> threads;
+        for (std::vector<Data::Size>& thread_offsets : offsets_by_thread)
+        {
+            threads.emplace_back([&allocator, &thread_offsets]()
+            {
+                for (size_t i = 0U; i < thread_slices_count; ++i)
+                {
+                    const Opt<Data::Size> offset_opt = allocator.Allocate(16U);
+                    if (offset_opt)
+                        thread_offsets.push_back(*offset_opt);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<Data::Size> offsets;
+        for (const std::vector<Data::Size>& thread_offsets : offsets_by_thread)
+        {
+            offsets.insert(offsets.end(), thread_offsets.begin(), thread_offsets.end());
+        }
+        std::ranges::sort(offsets);
+        CHECK(offsets.size() == threads_count * thread_slices_count);
+        CHECK(std::ranges::adjacent_find(offsets) == offsets.end());
+        CHECK(allocator.GetStatistics().used_size == threads_count * thread_slices_count * 16U);
+    }
+}
+
+TEST_CASE("RHI Transient Buffer Functions", "[rhi][transient-buffer]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::TransientBufferSettings settings{ 4096U, 256U };
+
+    SECTION("Transient Buffer Construction")
+    {
+        Rhi::TransientBuffer transient_buffer;
+        REQUIRE_NOTHROW(transient_buffer = Rhi::TransientBuffer(compute_context, settings));
+        REQUIRE(transient_buffer.IsInitialized());
+        CHECK(transient_buffer.GetSettings() == settings);
+        CHECK(transient_buffer.GetBuffer().GetSettings().size == 4096U);
+        CHECK(transient_buffer.GetBuffer().GetSettings().storage_mode == Rhi::BufferStorageMode::Managed);
+        CHECK(transient_buffer.GetStatistics().capacity == 4096U);
+    }
+
+    SECTION("Context Default Transient Buffer")
+    {
+        const Rhi::TransientBuffer transient_buffer = compute_context.GetTransientBuffer();
+        REQUIRE(transient_buffer.IsInitialized());
+        CHECK(transient_buffer.GetSettings() == Rhi::TransientBufferSettings{});
+        CHECK(&compute_context.GetTransientBuffer().GetInterface() == &transient_buffer.GetInterface());
+    }
+
+    SECTION("Allocate and Write Slices")
+    {
+        const Rhi::TransientBuffer transient_buffer(compute_context, settings);
+        const Rhi::TransientBufferSlice slice_a = transient_buffer.Allocate(16U);
+        const Rhi::TransientBufferSlice slice_b = transient_buffer.Allocate(16U);
+        REQUIRE(slice_a.IsInitialized());
+        REQUIRE(slice_b.IsInitialized());
+        CHECK(slice_a.buffer_ptr == &transient_buffer.GetBuffer().GetInterface());
+        CHECK(slice_a.offset == 0U);
+        CHECK(slice_b.offset == 256U);
+        CHECK(slice_b.data_ptr == slice_a.data_ptr + 256U);
+
+        const std::array<std::byte, 4> data{ std::byte(1), std::byte(2), std::byte(3), std::byte(4) };
+        CHECK_NOTHROW(slice_b.SetData(data.data(), 4U, 12U));
+        CHECK(std::equal(data.begin(), data.end(), slice_b.data_ptr + 12U));
+        CHECK_THROWS(slice_b.SetData(data.data(), 4U, 14U));
+        CHECK_NOTHROW(transient_buffer.Flush());
+
+        const Rhi::ResourceView resource_view = slice_b.GetResourceView();
+        CHECK(resource_view.GetOffset() == 256U);
+        CHECK(resource_view.GetSize() == 16U);
+    }
+
+    SECTION("Allocation Throws when Buffer is Full")
+    {
+        const Rhi::TransientBuffer transient_buffer(compute_context, settings);
+        CHECK_NOTHROW(transient_buffer.Allocate(4096U));
+        CHECK_THROWS(transient_buffer.Allocate(16U));
+    }
+
+    SECTION("Slices are Recycled on GPU Wait")
+    {
+        const Rhi::TransientBuffer transient_buffer(compute_context, settings);
+        CHECK_NOTHROW(transient_buffer.Allocate(4096U));
+        compute_context.WaitForGpu(Rhi::ContextWaitFor::ComputeComplete);
+        CHECK(transient_buffer.GetStatistics().used_size == 0U);
+        CHECK_NOTHROW(transient_buffer.Allocate(4096U));
+    }
+}